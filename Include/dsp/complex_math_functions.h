@@ -337,6 +337,137 @@ const float64_t * pSrcB,
 	  uint32_t numSamples);
 
 
+/**
+ * @brief Instance structure for the floating-point NCO.
+ */
+typedef struct
+{
+  uint32_t phase;         /**< phase accumulator. 2^32 is a full turn. */
+  uint32_t phaseInc;      /**< phase increment per sample. */
+} arm_nco_instance_f32;
+
+/**
+ * @brief  Initialization function for the floating-point NCO.
+ * @param[out] S          points to an instance of the floating-point NCO structure
+ * @param[in]  frequency  frequency normalized by the sampling frequency
+ * @param[in]  phase      initial phase in radians
+ */
+void arm_nco_init_f32(
+  arm_nco_instance_f32 * S,
+  float32_t frequency,
+  float32_t phase);
+
+/**
+ * @brief  Floating-point NCO.
+ * @param[in,out] S           points to an instance of the floating-point NCO structure
+ * @param[out]    pDst        points to the complex output vector
+ * @param[in]     numSamples  number of complex samples to generate
+ */
+void arm_nco_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+/**
+ * @brief  Floating-point complex mixer.
+ * @param[in,out] S           points to an instance of the floating-point NCO structure
+ * @param[in]     pSrc        points to the complex input vector
+ * @param[out]    pDst        points to the complex output vector
+ * @param[in]     numSamples  number of complex samples in each vector
+ */
+void arm_mix_cmplx_f32(
+  arm_nco_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+/**
+ * @brief Instance structure for the Q31 NCO.
+ */
+typedef struct
+{
+  uint32_t phase;         /**< phase accumulator. 2^32 is a full turn. */
+  uint32_t phaseInc;      /**< phase increment per sample. */
+} arm_nco_instance_q31;
+
+/**
+ * @brief  Initialization function for the Q31 NCO.
+ * @param[out] S          points to an instance of the Q31 NCO structure
+ * @param[in]  frequency  frequency normalized by the sampling frequency
+ * @param[in]  phase      initial phase scaled like in arm_sin_q31
+ */
+void arm_nco_init_q31(
+  arm_nco_instance_q31 * S,
+  q31_t frequency,
+  q31_t phase);
+
+/**
+ * @brief  Q31 NCO.
+ * @param[in,out] S           points to an instance of the Q31 NCO structure
+ * @param[out]    pDst        points to the complex output vector
+ * @param[in]     numSamples  number of complex samples to generate
+ */
+void arm_nco_q31(
+  arm_nco_instance_q31 * S,
+  q31_t * pDst,
+  uint32_t numSamples);
+
+/**
+ * @brief  Q31 complex mixer.
+ * @param[in,out] S           points to an instance of the Q31 NCO structure
+ * @param[in]     pSrc        points to the complex input vector
+ * @param[out]    pDst        points to the complex output vector
+ * @param[in]     numSamples  number of complex samples in each vector
+ */
+void arm_mix_cmplx_q31(
+  arm_nco_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numSamples);
+
+/**
+ * @brief Instance structure for the Q15 NCO.
+ */
+typedef struct
+{
+  uint32_t phase;         /**< phase accumulator. 2^32 is a full turn. */
+  uint32_t phaseInc;      /**< phase increment per sample. */
+} arm_nco_instance_q15;
+
+/**
+ * @brief  Initialization function for the Q15 NCO.
+ * @param[out] S          points to an instance of the Q15 NCO structure
+ * @param[in]  frequency  frequency normalized by the sampling frequency
+ * @param[in]  phase      initial phase scaled like in arm_sin_q15
+ */
+void arm_nco_init_q15(
+  arm_nco_instance_q15 * S,
+  q15_t frequency,
+  q15_t phase);
+
+/**
+ * @brief  Q15 NCO.
+ * @param[in,out] S           points to an instance of the Q15 NCO structure
+ * @param[out]    pDst        points to the complex output vector
+ * @param[in]     numSamples  number of complex samples to generate
+ */
+void arm_nco_q15(
+  arm_nco_instance_q15 * S,
+  q15_t * pDst,
+  uint32_t numSamples);
+
+/**
+ * @brief  Q15 complex mixer.
+ * @param[in,out] S           points to an instance of the Q15 NCO structure
+ * @param[in]     pSrc        points to the complex input vector
+ * @param[out]    pDst        points to the complex output vector
+ * @param[in]     numSamples  number of complex samples in each vector
+ */
+void arm_mix_cmplx_q15(
+  arm_nco_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples);
 
 #ifdef   __cplusplus
 }
@@ -161,6 +161,14 @@ extern "C"
    * \par
    * Instance structure cannot be placed into a const data section and it is recommended to use the initialization function.
    *
+   * \par PID Bank
+   * The <code>arm_pid_bank</code> functions advance many independent controllers by one sample.
+   * The gains and the states are stored as arrays with one entry per controller
+   * so that several controllers can be computed in parallel.
+   * The outputs can optionally be clamped to per controller limits.
+   * Since the state contains the previous output, clamping the output also
+   * prevents the integral term from winding up.
+   *
    * \par Fixed-Point Behavior
    * Care must be taken when using the fixed-point versions of the PID Controller functions.
    * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.
@@ -406,6 +414,177 @@ __STATIC_FORCEINLINE q15_t arm_pid_q15(
   }
 
 
+  /**
+   * @ingroup PID
+   * @brief Instance structure for a bank of floating-point PID Controls.
+   */
+  typedef struct
+  {
+          uint32_t numControllers;   /**< number of controllers in the bank. */
+          float32_t *pGains;          /**< points to the derived gains: numControllers A0, then A1, then A2. */
+          float32_t *pState;          /**< points to the state: numControllers x[n-1], then x[n-2], then y[n-1]. */
+    const float32_t *pMin;            /**< points to the lower output limits or NULL. */
+    const float32_t *pMax;            /**< points to the upper output limits or NULL. */
+  } arm_pid_bank_instance_f32;
+
+  /**
+   * @ingroup PID
+   * @brief Instance structure for a bank of Q31 PID Controls.
+   */
+  typedef struct
+  {
+          uint32_t numControllers;   /**< number of controllers in the bank. */
+          q31_t *pGains;          /**< points to the derived gains: numControllers A0, then A1, then A2. */
+          q31_t *pState;          /**< points to the state: numControllers x[n-1], then x[n-2], then y[n-1]. */
+    const q31_t *pMin;            /**< points to the lower output limits or NULL. */
+    const q31_t *pMax;            /**< points to the upper output limits or NULL. */
+  } arm_pid_bank_instance_q31;
+
+  /**
+   * @ingroup PID
+   * @brief Instance structure for a bank of Q15 PID Controls.
+   */
+  typedef struct
+  {
+          uint32_t numControllers;   /**< number of controllers in the bank. */
+          q15_t *pGains;          /**< points to the derived gains: numControllers A0, then A1, then A2. */
+          q15_t *pState;          /**< points to the state: numControllers x[n-1], then x[n-2], then y[n-1]. */
+    const q15_t *pMin;            /**< points to the lower output limits or NULL. */
+    const q15_t *pMax;            /**< points to the upper output limits or NULL. */
+  } arm_pid_bank_instance_q15;
+
+  /**
+   * @brief  Initialization function for a bank of floating-point PID Controls.
+   * @param[in,out] S               points to an instance of the PID bank structure.
+   * @param[in]     numControllers  number of controllers in the bank.
+   * @param[in]     pKp             points to the proportional gains.
+   * @param[in]     pKi             points to the integral gains.
+   * @param[in]     pKd             points to the derivative gains.
+   * @param[in]     pGains          points to the derived gains buffer of 3*numControllers values.
+   * @param[in]     pState          points to the state buffer of 3*numControllers values.
+   * @param[in]     pMin            points to the lower output limits or NULL.
+   * @param[in]     pMax            points to the upper output limits or NULL.
+   */
+  void arm_pid_bank_init_f32(
+        arm_pid_bank_instance_f32 * S,
+        uint32_t numControllers,
+  const float32_t * pKp,
+  const float32_t * pKi,
+  const float32_t * pKd,
+        float32_t * pGains,
+        float32_t * pState,
+  const float32_t * pMin,
+  const float32_t * pMax);
+
+
+  /**
+   * @brief  Reset function for a bank of floating-point PID Controls.
+   * @param[in,out] S  points to an instance of the PID bank structure.
+   */
+  void arm_pid_bank_reset_f32(
+  const arm_pid_bank_instance_f32 * S);
+
+
+  /**
+   * @brief  Process function for a bank of floating-point PID Controls.
+   * @param[in]  S     points to an instance of the PID bank structure.
+   * @param[in]  pSrc  points to one input sample per controller.
+   * @param[out] pDst  points to one output sample per controller.
+   */
+  void arm_pid_bank_f32(
+  const arm_pid_bank_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst);
+
+
+  /**
+   * @brief  Initialization function for a bank of Q31 PID Controls.
+   * @param[in,out] S               points to an instance of the PID bank structure.
+   * @param[in]     numControllers  number of controllers in the bank.
+   * @param[in]     pKp             points to the proportional gains.
+   * @param[in]     pKi             points to the integral gains.
+   * @param[in]     pKd             points to the derivative gains.
+   * @param[in]     pGains          points to the derived gains buffer of 3*numControllers values.
+   * @param[in]     pState          points to the state buffer of 3*numControllers values.
+   * @param[in]     pMin            points to the lower output limits or NULL.
+   * @param[in]     pMax            points to the upper output limits or NULL.
+   */
+  void arm_pid_bank_init_q31(
+        arm_pid_bank_instance_q31 * S,
+        uint32_t numControllers,
+  const q31_t * pKp,
+  const q31_t * pKi,
+  const q31_t * pKd,
+        q31_t * pGains,
+        q31_t * pState,
+  const q31_t * pMin,
+  const q31_t * pMax);
+
+
+  /**
+   * @brief  Reset function for a bank of Q31 PID Controls.
+   * @param[in,out] S  points to an instance of the PID bank structure.
+   */
+  void arm_pid_bank_reset_q31(
+  const arm_pid_bank_instance_q31 * S);
+
+
+  /**
+   * @brief  Process function for a bank of Q31 PID Controls.
+   * @param[in]  S     points to an instance of the PID bank structure.
+   * @param[in]  pSrc  points to one input sample per controller.
+   * @param[out] pDst  points to one output sample per controller.
+   */
+  void arm_pid_bank_q31(
+  const arm_pid_bank_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst);
+
+
+  /**
+   * @brief  Initialization function for a bank of Q15 PID Controls.
+   * @param[in,out] S               points to an instance of the PID bank structure.
+   * @param[in]     numControllers  number of controllers in the bank.
+   * @param[in]     pKp             points to the proportional gains.
+   * @param[in]     pKi             points to the integral gains.
+   * @param[in]     pKd             points to the derivative gains.
+   * @param[in]     pGains          points to the derived gains buffer of 3*numControllers values.
+   * @param[in]     pState          points to the state buffer of 3*numControllers values.
+   * @param[in]     pMin            points to the lower output limits or NULL.
+   * @param[in]     pMax            points to the upper output limits or NULL.
+   */
+  void arm_pid_bank_init_q15(
+        arm_pid_bank_instance_q15 * S,
+        uint32_t numControllers,
+  const q15_t * pKp,
+  const q15_t * pKi,
+  const q15_t * pKd,
+        q15_t * pGains,
+        q15_t * pState,
+  const q15_t * pMin,
+  const q15_t * pMax);
+
+
+  /**
+   * @brief  Reset function for a bank of Q15 PID Controls.
+   * @param[in,out] S  points to an instance of the PID bank structure.
+   */
+  void arm_pid_bank_reset_q15(
+  const arm_pid_bank_instance_q15 * S);
+
+
+  /**
+   * @brief  Process function for a bank of Q15 PID Controls.
+   * @param[in]  S     points to an instance of the PID bank structure.
+   * @param[in]  pSrc  points to one input sample per controller.
+   * @param[out] pDst  points to one output sample per controller.
+   */
+  void arm_pid_bank_q15(
+  const arm_pid_bank_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst);
+
+
 
   /**
    * @ingroup groupController
@@ -423,6 +602,8 @@ __STATIC_FORCEINLINE q15_t arm_pid_q15(
    * \image html park.gif "Stator current space vector and its component in (a,b) and in the d,q rotating reference frame"
    *
    * The function operates on a single sample of data and each call to the function returns the processed output.
+   * The block functions process arrays of samples. arm_clarke_park_f32 and arm_clarke_park_q31
+   * fuse the Clarke and Park transforms and compute the sine and cosine of the angles.
    * The library provides separate functions for Q31 and floating-point data types.
    * \par Algorithm
    * \image html parkFormula.gif
@@ -523,6 +704,8 @@ __STATIC_FORCEINLINE void arm_park_q31(
    * Inverse Park transform converts the input flux and torque components to two-coordinate vector.
    *
    * The function operates on a single sample of data and each call to the function returns the processed output.
+   * The block functions process arrays of samples. arm_inv_park_clarke_f32 and arm_inv_park_clarke_q31
+   * fuse the Inverse Park and Inverse Clarke transforms and compute the sine and cosine of the angles.
    * The library provides separate functions for Q31 and floating-point data types.
    * \par Algorithm
    * \image html parkInvFormula.gif
@@ -625,6 +808,7 @@ __STATIC_FORCEINLINE void arm_inv_park_q31(
    * can be calculated using only <code>Ia</code> and <code>Ib</code>.
    *
    * The function operates on a single sample of data and each call to the function returns the processed output.
+   * The block functions process arrays of samples.
    * The library provides separate functions for Q31 and floating-point data types.
    * \par Algorithm
    * \image html clarkeFormula.gif
@@ -705,6 +889,7 @@ __STATIC_FORCEINLINE void arm_clarke_q31(
    * Inverse Clarke transform converts the two-coordinate time invariant vector into instantaneous stator phases.
    *
    * The function operates on a single sample of data and each call to the function returns the processed output.
+   * The block functions process arrays of samples.
    * The library provides separate functions for Q31 and floating-point data types.
    * \par Algorithm
    * \image html clarkeInvFormula.gif
@@ -779,6 +964,234 @@ __STATIC_FORCEINLINE void arm_inv_clarke_q31(
 
 
   
+  /**
+   * @ingroup park
+   * @brief  Floating-point block Park transform
+   * @param[in]   pIalpha    points to the two-phase vector coordinates alpha
+   * @param[in]   pIbeta     points to the two-phase vector coordinates beta
+   * @param[in]   pSinVal    points to the sine values of the rotation angles
+   * @param[in]   pCosVal    points to the cosine values of the rotation angles
+   * @param[out]  pId        points to the rotor reference frame d
+   * @param[out]  pIq        points to the rotor reference frame q
+   * @param[in]   blockSize  number of samples to process
+   */
+  void arm_park_block_f32(
+  const float32_t * pIalpha,
+  const float32_t * pIbeta,
+  const float32_t * pSinVal,
+  const float32_t * pCosVal,
+        float32_t * pId,
+        float32_t * pIq,
+        uint32_t blockSize);
+
+
+  /**
+   * @ingroup park
+   * @brief  Floating-point fused Clarke and Park transforms
+   * @param[in]   pIa        points to the three-phase coordinates <code>a</code>
+   * @param[in]   pIb        points to the three-phase coordinates <code>b</code>
+   * @param[in]   pTheta     points to the rotor flux angles in radians
+   * @param[out]  pId        points to the rotor reference frame d
+   * @param[out]  pIq        points to the rotor reference frame q
+   * @param[in]   blockSize  number of samples to process
+   */
+  void arm_clarke_park_f32(
+  const float32_t * pIa,
+  const float32_t * pIb,
+  const float32_t * pTheta,
+        float32_t * pId,
+        float32_t * pIq,
+        uint32_t blockSize);
+
+
+  /**
+   * @ingroup park
+   * @brief  Q31 block Park transform
+   * @param[in]   pIalpha    points to the two-phase vector coordinates alpha
+   * @param[in]   pIbeta     points to the two-phase vector coordinates beta
+   * @param[in]   pSinVal    points to the sine values of the rotation angles
+   * @param[in]   pCosVal    points to the cosine values of the rotation angles
+   * @param[out]  pId        points to the rotor reference frame d
+   * @param[out]  pIq        points to the rotor reference frame q
+   * @param[in]   blockSize  number of samples to process
+   */
+  void arm_park_block_q31(
+  const q31_t * pIalpha,
+  const q31_t * pIbeta,
+  const q31_t * pSinVal,
+  const q31_t * pCosVal,
+        q31_t * pId,
+        q31_t * pIq,
+        uint32_t blockSize);
+
+
+  /**
+   * @ingroup park
+   * @brief  Q31 fused Clarke and Park transforms
+   * @param[in]   pIa        points to the three-phase coordinates <code>a</code>
+   * @param[in]   pIb        points to the three-phase coordinates <code>b</code>
+   * @param[in]   pTheta     points to the rotor flux angles, [-1 0.9999] mapping to [-180 +180] degrees
+   * @param[out]  pId        points to the rotor reference frame d
+   * @param[out]  pIq        points to the rotor reference frame q
+   * @param[in]   blockSize  number of samples to process
+   */
+  void arm_clarke_park_q31(
+  const q31_t * pIa,
+  const q31_t * pIb,
+  const q31_t * pTheta,
+        q31_t * pId,
+        q31_t * pIq,
+        uint32_t blockSize);
+
+
+  /**
+   * @ingroup inv_park
+   * @brief  Floating-point block Inverse Park transform
+   * @param[in]   pId        points to the rotor reference frame d
+   * @param[in]   pIq        points to the rotor reference frame q
+   * @param[in]   pSinVal    points to the sine values of the rotation angles
+   * @param[in]   pCosVal    points to the cosine values of the rotation angles
+   * @param[out]  pIalpha    points to the two-phase orthogonal vector axis alpha
+   * @param[out]  pIbeta     points to the two-phase orthogonal vector axis beta
+   * @param[in]   blockSize  number of samples to process
+   */
+  void arm_inv_park_block_f32(
+  const float32_t * pId,
+  const float32_t * pIq,
+  const float32_t * pSinVal,
+  const float32_t * pCosVal,
+        float32_t * pIalpha,
+        float32_t * pIbeta,
+        uint32_t blockSize);
+
+
+  /**
+   * @ingroup inv_park
+   * @brief  Floating-point fused Inverse Park and Inverse Clarke transforms
+   * @param[in]   pId        points to the rotor reference frame d
+   * @param[in]   pIq        points to the rotor reference frame q
+   * @param[in]   pTheta     points to the rotor flux angles in radians
+   * @param[out]  pIa        points to the three-phase coordinates <code>a</code>
+   * @param[out]  pIb        points to the three-phase coordinates <code>b</code>
+   * @param[in]   blockSize  number of samples to process
+   */
+  void arm_inv_park_clarke_f32(
+  const float32_t * pId,
+  const float32_t * pIq,
+  const float32_t * pTheta,
+        float32_t * pIa,
+        float32_t * pIb,
+        uint32_t blockSize);
+
+
+  /**
+   * @ingroup inv_park
+   * @brief  Q31 block Inverse Park transform
+   * @param[in]   pId        points to the rotor reference frame d
+   * @param[in]   pIq        points to the rotor reference frame q
+   * @param[in]   pSinVal    points to the sine values of the rotation angles
+   * @param[in]   pCosVal    points to the cosine values of the rotation angles
+   * @param[out]  pIalpha    points to the two-phase orthogonal vector axis alpha
+   * @param[out]  pIbeta     points to the two-phase orthogonal vector axis beta
+   * @param[in]   blockSize  number of samples to process
+   */
+  void arm_inv_park_block_q31(
+  const q31_t * pId,
+  const q31_t * pIq,
+  const q31_t * pSinVal,
+  const q31_t * pCosVal,
+        q31_t * pIalpha,
+        q31_t * pIbeta,
+        uint32_t blockSize);
+
+
+  /**
+   * @ingroup inv_park
+   * @brief  Q31 fused Inverse Park and Inverse Clarke transforms
+   * @param[in]   pId        points to the rotor reference frame d
+   * @param[in]   pIq        points to the rotor reference frame q
+   * @param[in]   pTheta     points to the rotor flux angles, [-1 0.9999] mapping to [-180 +180] degrees
+   * @param[out]  pIa        points to the three-phase coordinates <code>a</code>
+   * @param[out]  pIb        points to the three-phase coordinates <code>b</code>
+   * @param[in]   blockSize  number of samples to process
+   */
+  void arm_inv_park_clarke_q31(
+  const q31_t * pId,
+  const q31_t * pIq,
+  const q31_t * pTheta,
+        q31_t * pIa,
+        q31_t * pIb,
+        uint32_t blockSize);
+
+
+  /**
+   * @ingroup clarke
+   * @brief  Floating-point block Clarke transform
+   * @param[in]   pIa        points to the three-phase coordinates <code>a</code>
+   * @param[in]   pIb        points to the three-phase coordinates <code>b</code>
+   * @param[out]  pIalpha    points to the two-phase orthogonal vector axis alpha
+   * @param[out]  pIbeta     points to the two-phase orthogonal vector axis beta
+   * @param[in]   blockSize  number of samples to process
+   */
+  void arm_clarke_block_f32(
+  const float32_t * pIa,
+  const float32_t * pIb,
+        float32_t * pIalpha,
+        float32_t * pIbeta,
+        uint32_t blockSize);
+
+
+  /**
+   * @ingroup clarke
+   * @brief  Q31 block Clarke transform
+   * @param[in]   pIa        points to the three-phase coordinates <code>a</code>
+   * @param[in]   pIb        points to the three-phase coordinates <code>b</code>
+   * @param[out]  pIalpha    points to the two-phase orthogonal vector axis alpha
+   * @param[out]  pIbeta     points to the two-phase orthogonal vector axis beta
+   * @param[in]   blockSize  number of samples to process
+   */
+  void arm_clarke_block_q31(
+  const q31_t * pIa,
+  const q31_t * pIb,
+        q31_t * pIalpha,
+        q31_t * pIbeta,
+        uint32_t blockSize);
+
+
+  /**
+   * @ingroup inv_clarke
+   * @brief  Floating-point block Inverse Clarke transform
+   * @param[in]   pIalpha    points to the two-phase orthogonal vector axis alpha
+   * @param[in]   pIbeta     points to the two-phase orthogonal vector axis beta
+   * @param[out]  pIa        points to the three-phase coordinates <code>a</code>
+   * @param[out]  pIb        points to the three-phase coordinates <code>b</code>
+   * @param[in]   blockSize  number of samples to process
+   */
+  void arm_inv_clarke_block_f32(
+  const float32_t * pIalpha,
+  const float32_t * pIbeta,
+        float32_t * pIa,
+        float32_t * pIb,
+        uint32_t blockSize);
+
+
+  /**
+   * @ingroup inv_clarke
+   * @brief  Q31 block Inverse Clarke transform
+   * @param[in]   pIalpha    points to the two-phase orthogonal vector axis alpha
+   * @param[in]   pIbeta     points to the two-phase orthogonal vector axis beta
+   * @param[out]  pIa        points to the three-phase coordinates <code>a</code>
+   * @param[out]  pIb        points to the three-phase coordinates <code>b</code>
+   * @param[in]   blockSize  number of samples to process
+   */
+  void arm_inv_clarke_block_q31(
+  const q31_t * pIalpha,
+  const q31_t * pIbeta,
+        q31_t * pIa,
+        q31_t * pIb,
+        uint32_t blockSize);
+
+
 #ifdef   __cplusplus
 }
 #endif
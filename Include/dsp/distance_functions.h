@@ -333,6 +333,121 @@ float32_t arm_sokalsneath_distance(const uint32_t *pA, const uint32_t *pB, uint3
 
 float32_t arm_yule_distance(const uint32_t *pA, const uint32_t *pB, uint32_t numberOfBools);
 
+/**
+ * @brief Metrics for the pairwise distance matrix of float vectors
+ */
+typedef enum
+  {
+    ARM_CDIST_EUCLIDEAN = 0,      /**< Euclidean distance */
+    ARM_CDIST_SQEUCLIDEAN = 1,    /**< Squared euclidean distance */
+    ARM_CDIST_COSINE = 2,         /**< Cosine distance */
+    ARM_CDIST_CORRELATION = 3,    /**< Correlation distance */
+    ARM_CDIST_CITYBLOCK = 4,      /**< Cityblock (Manhattan) distance */
+    ARM_CDIST_CHEBYSHEV = 5,      /**< Chebyshev distance */
+    ARM_CDIST_BRAYCURTIS = 6,     /**< Bray-Curtis distance */
+    ARM_CDIST_CANBERRA = 7,       /**< Canberra distance */
+    ARM_CDIST_JENSENSHANNON = 8   /**< Jensen-Shannon distance */
+  } arm_cdist_metric;
+
+/**
+ * @brief Metrics for the pairwise distance matrix of boolean vectors
+ */
+typedef enum
+  {
+    ARM_CDIST_DICE = 0,           /**< Dice distance */
+    ARM_CDIST_HAMMING = 1,        /**< Hamming distance */
+    ARM_CDIST_JACCARD = 2,        /**< Jaccard distance */
+    ARM_CDIST_KULSINSKI = 3,      /**< Kulsinski distance */
+    ARM_CDIST_ROGERSTANIMOTO = 4, /**< Rogers-Tanimoto distance */
+    ARM_CDIST_RUSSELLRAO = 5,     /**< Russell-Rao distance */
+    ARM_CDIST_SOKALMICHENER = 6,  /**< Sokal-Michener distance */
+    ARM_CDIST_SOKALSNEATH = 7,    /**< Sokal-Sneath distance */
+    ARM_CDIST_YULE = 8            /**< Yule distance */
+  } arm_cdist_boolean_metric;
+
+/**
+ * @brief         Pairwise distances between the rows of two matrices
+ * @param[in]     pSrcA    points to the first matrix (numA rows of vectorDimension samples)
+ * @param[in]     pSrcB    points to the second matrix (numB rows of vectorDimension samples)
+ * @param[in]     metric   distance to use
+ * @param[in]     pScratch temporary buffer of (numA + numB) * (vectorDimension + 1) samples
+ * @param[out]    pDst     points to the distance matrix (numA rows * numB columns)
+ * @return        execution status
+ *
+ */
+arm_status arm_cdist_f32(const arm_matrix_instance_f32 *pSrcA,
+                         const arm_matrix_instance_f32 *pSrcB,
+                         arm_cdist_metric metric,
+                         float32_t *pScratch,
+                         arm_matrix_instance_f32 *pDst);
+
+/**
+ * @brief         Pairwise Minkowski distances between the rows of two matrices
+ * @param[in]     pSrcA    points to the first matrix (numA rows of vectorDimension samples)
+ * @param[in]     pSrcB    points to the second matrix (numB rows of vectorDimension samples)
+ * @param[in]     order    Distance order
+ * @param[out]    pDst     points to the distance matrix (numA rows * numB columns)
+ * @return        execution status
+ *
+ */
+arm_status arm_cdist_minkowski_f32(const arm_matrix_instance_f32 *pSrcA,
+                                   const arm_matrix_instance_f32 *pSrcB,
+                                   int32_t order,
+                                   arm_matrix_instance_f32 *pDst);
+
+/**
+ * @brief        Pairwise boolean distances between two sets of vectors
+ *
+ * @param[in]    pSrcA           First set of numA vectors of packed booleans
+ * @param[in]    numA            Number of vectors in the first set
+ * @param[in]    pSrcB           Second set of numB vectors of packed booleans
+ * @param[in]    numB            Number of vectors in the second set
+ * @param[in]    numberOfBools   Number of booleans in each vector
+ * @param[in]    metric          Distance to use
+ * @param[out]   pDst            Distance matrix (numA rows * numB columns)
+ * @return       Error if the metric is not recognized
+ *
+ */
+arm_status arm_cdist_boolean(const uint32_t *pSrcA,
+                             uint32_t numA,
+                             const uint32_t *pSrcB,
+                             uint32_t numB,
+                             uint32_t numberOfBools,
+                             arm_cdist_boolean_metric metric,
+                             float32_t *pDst);
+
+/**
+ * @brief         k nearest neighbours of query vectors
+ * @param[in]     pQueries     points to the queries (numQueries rows of vectorDimension samples)
+ * @param[in]     pReferences  points to the references (numReferences rows of vectorDimension samples)
+ * @param[in]     k            number of neighbours
+ * @param[out]    pIndices     indices of the neighbours (numQueries rows of k indices)
+ * @param[out]    pDistances   euclidean distances to the neighbours (numQueries rows of k distances)
+ * @return        execution status
+ *
+ */
+arm_status arm_knn_f32(const arm_matrix_instance_f32 *pQueries,
+                       const arm_matrix_instance_f32 *pReferences,
+                       uint32_t k,
+                       uint32_t *pIndices,
+                       float32_t *pDistances);
+
+/**
+ * @brief         k nearest neighbours of Q15 query vectors
+ * @param[in]     pQueries     points to the queries (numQueries rows of vectorDimension samples)
+ * @param[in]     pReferences  points to the references (numReferences rows of vectorDimension samples)
+ * @param[in]     k            number of neighbours
+ * @param[out]    pIndices     indices of the neighbours (numQueries rows of k indices)
+ * @param[out]    pDistances   squared euclidean distances to the neighbours in 34.30 format (numQueries rows of k distances)
+ * @return        execution status
+ *
+ */
+arm_status arm_knn_q15(const arm_matrix_instance_q15 *pQueries,
+                       const arm_matrix_instance_q15 *pReferences,
+                       uint32_t k,
+                       uint32_t *pIndices,
+                       q63_t *pDistances);
+
 typedef enum
   {
     ARM_DTW_SAKOE_CHIBA_WINDOW = 1,
@@ -379,6 +494,66 @@ arm_status arm_dtw_distance_f32(const arm_matrix_instance_f32 *pDistance,
 void arm_dtw_path_f32(const arm_matrix_instance_f32 *pDTW,
                       int16_t *pPath,
                       uint32_t *pathLength);
+
+/**
+ * @brief         Band limited Dynamic Time Warping distance
+ * @param[in]     pQuery           Query sequence (queryLength * vectorDimension)
+ * @param[in]     queryLength      Number of feature vectors in the query
+ * @param[in]     pTemplate        Template sequence (templateLength * vectorDimension)
+ * @param[in]     templateLength   Number of feature vectors in the template
+ * @param[in]     vectorDimension  Dimension of the feature vectors
+ * @param[in]     windowSize       Sakoe-Chiba window size
+ * @param[in]     threshold        Early abandon threshold (F32_MAX to disable)
+ * @param[out]    pScratch         Temporary cost buffer of 2*(2*windowSize+1) samples
+ * @param[out]    distance         Distance (F32_MAX when bigger than threshold)
+ * @return Error in case no path can be found with window constraint
+ *
+ */
+
+arm_status arm_dtw_band_distance_f32(const float32_t *pQuery,
+                                     uint32_t queryLength,
+                                     const float32_t *pTemplate,
+                                     uint32_t templateLength,
+                                     uint32_t vectorDimension,
+                                     int32_t windowSize,
+                                     float32_t threshold,
+                                     float32_t *pScratch,
+                                     float32_t *distance);
+
+/**
+ * @brief         Envelope of a template for the LB_Keogh lower bound
+ * @param[in]     pTemplate        Template sequence (templateLength * vectorDimension)
+ * @param[in]     templateLength   Number of feature vectors in the template
+ * @param[in]     vectorDimension  Dimension of the feature vectors
+ * @param[in]     windowSize       Sakoe-Chiba window size
+ * @param[out]    pUpper           Upper envelope (templateLength * vectorDimension)
+ * @param[out]    pLower           Lower envelope (templateLength * vectorDimension)
+ *
+ */
+
+void arm_dtw_lb_keogh_envelope_f32(const float32_t *pTemplate,
+                                   uint32_t templateLength,
+                                   uint32_t vectorDimension,
+                                   int32_t windowSize,
+                                   float32_t *pUpper,
+                                   float32_t *pLower);
+
+/**
+ * @brief         LB_Keogh lower bound of the Dynamic Time Warping distance
+ * @param[in]     pQuery           Query sequence (length * vectorDimension)
+ * @param[in]     pUpper           Upper envelope of the template
+ * @param[in]     pLower           Lower envelope of the template
+ * @param[in]     length           Number of feature vectors in the query and template
+ * @param[in]     vectorDimension  Dimension of the feature vectors
+ * @return Lower bound of the band limited DTW distance
+ *
+ */
+
+float32_t arm_dtw_lb_keogh_f32(const float32_t *pQuery,
+                               const float32_t *pUpper,
+                               const float32_t *pLower,
+                               uint32_t length,
+                               uint32_t vectorDimension);
 #ifdef   __cplusplus
 }
 #endif
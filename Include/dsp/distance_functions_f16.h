@@ -43,6 +43,7 @@ __attribute__((weak)) float __powisf2(float a, int b);
 #include "dsp/basic_math_functions_f16.h"
 
 #include "dsp/fast_math_functions_f16.h"
+#include "dsp/matrix_functions_f16.h"
 
 #ifdef   __cplusplus
 extern "C"
@@ -161,6 +162,22 @@ float16_t arm_jensenshannon_distance_f16(const float16_t *pA,const float16_t *pB
  */
 float16_t arm_minkowski_distance_f16(const float16_t *pA,const float16_t *pB, int32_t order, uint32_t blockSize);
 
+/**
+ * @brief         k nearest neighbours of query vectors
+ * @param[in]     pQueries     points to the queries (numQueries rows of vectorDimension samples)
+ * @param[in]     pReferences  points to the references (numReferences rows of vectorDimension samples)
+ * @param[in]     k            number of neighbours
+ * @param[out]    pIndices     indices of the neighbours (numQueries rows of k indices)
+ * @param[out]    pDistances   euclidean distances to the neighbours (numQueries rows of k distances)
+ * @return        execution status
+ *
+ */
+arm_status arm_knn_f16(const arm_matrix_instance_f16 *pQueries,
+                       const arm_matrix_instance_f16 *pReferences,
+                       uint32_t k,
+                       uint32_t *pIndices,
+                       float16_t *pDistances);
+
 
 #endif /*defined(ARM_FLOAT16_SUPPORTED)*/
 #ifdef   __cplusplus
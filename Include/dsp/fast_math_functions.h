@@ -197,6 +197,111 @@ extern "C"
 		float64_t * pDst,
 		uint32_t blockSize);
 
+/**
+  @brief         Floating-point vector of sine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+ */
+  void arm_vsin_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Floating-point vector of cosine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+ */
+  void arm_vcos_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Floating-point vector of sine and cosine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pSin       points to the output vector of sines
+  @param[out]    pCos       points to the output vector of cosines
+  @param[in]     blockSize  number of samples in each vector
+ */
+  void arm_vsincos_f32(
+  const float32_t * pSrc,
+        float32_t * pSin,
+        float32_t * pCos,
+        uint32_t blockSize);
+
+/**
+  @brief         Q31 vector of sine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+ */
+  void arm_vsin_q31(
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Q31 vector of cosine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+ */
+  void arm_vcos_q31(
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Q31 vector of sine and cosine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pSin       points to the output vector of sines
+  @param[out]    pCos       points to the output vector of cosines
+  @param[in]     blockSize  number of samples in each vector
+ */
+  void arm_vsincos_q31(
+  const q31_t * pSrc,
+        q31_t * pSin,
+        q31_t * pCos,
+        uint32_t blockSize);
+
+/**
+  @brief         Q15 vector of sine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+ */
+  void arm_vsin_q15(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Q15 vector of cosine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+ */
+  void arm_vcos_q15(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Q15 vector of sine and cosine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pSin       points to the output vector of sines
+  @param[out]    pCos       points to the output vector of cosines
+  @param[in]     blockSize  number of samples in each vector
+ */
+  void arm_vsincos_q15(
+  const q15_t * pSrc,
+        q15_t * pSin,
+        q15_t * pCos,
+        uint32_t blockSize);
+
 
 
  /**
@@ -302,6 +407,36 @@ arm_status arm_sqrt_q15(
   q15_t in,
   q15_t * pOut);
 
+/**
+  @brief         Q31 vector of square roots.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : all the input values are positive
+                   - \ref ARM_MATH_ARGUMENT_ERROR : at least one input value is negative
+ */
+arm_status arm_vsqrt_q31(
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+
+/**
+  @brief         Q15 vector of square roots.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : all the input values are positive
+                   - \ref ARM_MATH_ARGUMENT_ERROR : at least one input value is negative
+ */
+arm_status arm_vsqrt_q15(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+
 
 
   /**
@@ -342,6 +477,36 @@ arm_status arm_divide_q31(q31_t numerator,
   q31_t *quotient,
   int16_t *shift);
 
+  /**
+  @brief         Fixed point division of vectors
+  @param[in]     pNumerator    points to the vector of numerators
+  @param[in]     pDenominator  points to the vector of denominators
+  @param[out]    pQuotient     points to the vector of quotients normalized between -1.0 and 1.0
+  @param[out]    pShift        points to the vector of left shifts to get the unnormalized quotients
+  @param[in]     blockSize     number of samples in each vector
+  @return        error status
+ */
+arm_status arm_vdivide_q15(const q15_t * pNumerator,
+  const q15_t * pDenominator,
+  q15_t * pQuotient,
+  int16_t * pShift,
+  uint32_t blockSize);
+
+  /**
+  @brief         Fixed point division of vectors
+  @param[in]     pNumerator    points to the vector of numerators
+  @param[in]     pDenominator  points to the vector of denominators
+  @param[out]    pQuotient     points to the vector of quotients normalized between -1.0 and 1.0
+  @param[out]    pShift        points to the vector of left shifts to get the unnormalized quotients
+  @param[in]     blockSize     number of samples in each vector
+  @return        error status
+ */
+arm_status arm_vdivide_q31(const q31_t * pNumerator,
+  const q31_t * pDenominator,
+  q31_t * pQuotient,
+  int16_t * pShift,
+  uint32_t blockSize);
+
 
 
   /**
@@ -372,6 +537,45 @@ arm_status arm_divide_q31(q31_t numerator,
    */
   arm_status arm_atan2_q15(q15_t y,q15_t x,q15_t *result);
 
+  /**
+     @brief  Arc tangent of y/x for vectors of coordinates.
+     @param[in]   pSrcY      points to the vector of y coordinates
+     @param[in]   pSrcX      points to the vector of x coordinates
+     @param[out]  pDst       points to the output vector
+     @param[in]   blockSize  number of samples in each vector
+     @return  error status.
+   */
+  arm_status arm_vatan2_f32(const float32_t * pSrcY,
+  const float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+     @brief  Arc tangent of y/x for vectors of coordinates.
+     @param[in]   pSrcY      points to the vector of y coordinates
+     @param[in]   pSrcX      points to the vector of x coordinates
+     @param[out]  pDst       points to the output vector in Q2.29
+     @param[in]   blockSize  number of samples in each vector
+     @return  error status.
+   */
+  arm_status arm_vatan2_q31(const q31_t * pSrcY,
+  const q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+     @brief  Arc tangent of y/x for vectors of coordinates.
+     @param[in]   pSrcY      points to the vector of y coordinates
+     @param[in]   pSrcX      points to the vector of x coordinates
+     @param[out]  pDst       points to the output vector in Q2.13
+     @param[in]   blockSize  number of samples in each vector
+     @return  error status.
+   */
+  arm_status arm_vatan2_q15(const q15_t * pSrcY,
+  const q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize);
+
 #ifdef   __cplusplus
 }
 #endif
@@ -105,6 +105,41 @@ __STATIC_FORCEINLINE arm_status arm_sqrt_f16(
         float16_t * pDst,
         uint32_t blockSize);
 
+/**
+  @brief         Floating-point vector of sine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+ */
+  void arm_vsin_f16(
+  const float16_t * pSrc,
+        float16_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Floating-point vector of cosine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+ */
+  void arm_vcos_f16(
+  const float16_t * pSrc,
+        float16_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Floating-point vector of sine and cosine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pSin       points to the output vector of sines
+  @param[out]    pCos       points to the output vector of cosines
+  @param[in]     blockSize  number of samples in each vector
+ */
+  void arm_vsincos_f16(
+  const float16_t * pSrc,
+        float16_t * pSin,
+        float16_t * pCos,
+        uint32_t blockSize);
+
   /**
      @brief  Arc tangent in radian of y/x using sign of x and y to determine right quadrant.
      @param[in]   y  y coordinate
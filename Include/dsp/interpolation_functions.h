@@ -99,6 +99,29 @@ extern "C"
   } arm_bilinear_interp_instance_q7;
 
 
+  /**
+   * @brief Instance structure for the floating-point interval index.
+   */
+  typedef struct
+  {
+    const float32_t * x;       /**< x values */
+    uint32_t n_x;              /**< Number of x values */
+    uint32_t numBuckets;       /**< Number of buckets */
+    float32_t invBucketWidth;  /**< Inverse of the width of a bucket */
+    uint32_t * pBuckets;       /**< First interval of each bucket (numBuckets+1 values) */
+  } arm_interp_index_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point non-uniform linear interpolation.
+   */
+  typedef struct
+  {
+    const float32_t * x;       /**< x values */
+    const float32_t * y;       /**< y values */
+    uint32_t n_x;              /**< Number of known data points */
+    const arm_interp_index_instance_f32 * pIndex; /**< Interval index of the x values or NULL */
+  } arm_linear_interp_nonuniform_instance_f32;
+
   /**
    * @brief Struct for specifying cubic spline type
    */
@@ -118,6 +141,7 @@ extern "C"
     const float32_t * y;       /**< y values */
     uint32_t n_x;              /**< Number of known data points */
     float32_t * coeffs;        /**< Coefficients buffer (b,c, and d) */
+    const arm_interp_index_instance_f32 * pIndex; /**< Interval index of the x values or NULL */
   } arm_spline_instance_f32;
 
 
@@ -155,6 +179,34 @@ extern "C"
 
 
    /**
+   * @brief Initialization function for the floating-point interval index.
+   * @param[out] S           points to an instance of the interval index.
+   * @param[in]  x           points to the x values (strictly increasing).
+   * @param[in]  n           number of x values (at least 2).
+   * @param[in]  numBuckets  number of buckets (at least 1).
+   * @param[in]  pBuckets    buffer of numBuckets+1 values for the index.
+   */
+  void arm_interp_index_init_f32(
+        arm_interp_index_instance_f32 * S,
+  const float32_t * x,
+        uint32_t n,
+        uint32_t numBuckets,
+        uint32_t * pBuckets);
+
+  /**
+   * @brief Floating-point linear interpolation on a non-uniform grid.
+   * @param[in]  S          points to an instance of the non-uniform linear interpolation structure.
+   * @param[in]  pSrc       points to the block of input samples.
+   * @param[out] pDst       points to the block of output samples.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_linear_interp_nonuniform_f32(
+  const arm_linear_interp_nonuniform_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
    * @brief  Process function for the floating-point Linear Interpolation Function.
    * @param[in,out] S  is an instance of the floating-point Linear Interpolation structure
    * @param[in]     x  input sample to process
@@ -218,6 +270,64 @@ q7_t arm_linear_interp_q7(
   q31_t x,
   uint32_t nValues);
 
+  /**
+   * @brief  Floating-point linear interpolation of a block of samples.
+   * @param[in]  S          points to an instance of the floating-point Linear Interpolation structure
+   * @param[in]  pSrc       points to the block of input samples
+   * @param[out] pDst       points to the block of output samples
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_linear_interp_block_f32(
+  const arm_linear_interp_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Q31 linear interpolation of a block of samples.
+   * @param[in]  pYData     points to the Q31 Linear Interpolation table
+   * @param[in]  nValues    number of table values
+   * @param[in]  pSrc       points to the block of input samples in 12.20 format
+   * @param[out] pDst       points to the block of output samples
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_linear_interp_block_q31(
+  const q31_t * pYData,
+        uint32_t nValues,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Q15 linear interpolation of a block of samples.
+   * @param[in]  pYData     points to the Q15 Linear Interpolation table
+   * @param[in]  nValues    number of table values
+   * @param[in]  pSrc       points to the block of input samples in 12.20 format
+   * @param[out] pDst       points to the block of output samples
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_linear_interp_block_q15(
+  const q15_t * pYData,
+        uint32_t nValues,
+  const q31_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Q7 linear interpolation of a block of samples.
+   * @param[in]  pYData     points to the Q7 Linear Interpolation table
+   * @param[in]  nValues    number of table values
+   * @param[in]  pSrc       points to the block of input samples in 12.20 format
+   * @param[out] pDst       points to the block of output samples
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_linear_interp_block_q7(
+  const q7_t * pYData,
+        uint32_t nValues,
+  const q31_t * pSrc,
+        q7_t * pDst,
+        uint32_t blockSize);
+
   /**
   * @brief  Floating-point bilinear interpolation.
   * @param[in,out] S  points to an instance of the interpolation structure.
@@ -267,6 +377,66 @@ q7_t arm_linear_interp_q7(
   q31_t X,
   q31_t Y);
 
+  /**
+  * @brief  Floating-point bilinear interpolation of a block of points.
+  * @param[in]  S          points to an instance of the interpolation structure.
+  * @param[in]  pX         points to the X coordinates
+  * @param[in]  pY         points to the Y coordinates
+  * @param[out] pDst       points to the block of interpolated values
+  * @param[in]  blockSize  number of points to process
+  */
+  void arm_bilinear_interp_block_f32(
+  const arm_bilinear_interp_instance_f32 * S,
+  const float32_t * pX,
+  const float32_t * pY,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+  * @brief  Q31 bilinear interpolation of a block of points.
+  * @param[in]  S          points to an instance of the interpolation structure.
+  * @param[in]  pX         points to the X coordinates in 12.20 format
+  * @param[in]  pY         points to the Y coordinates in 12.20 format
+  * @param[out] pDst       points to the block of interpolated values
+  * @param[in]  blockSize  number of points to process
+  */
+  void arm_bilinear_interp_block_q31(
+  const arm_bilinear_interp_instance_q31 * S,
+  const q31_t * pX,
+  const q31_t * pY,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+  * @brief  Q15 bilinear interpolation of a block of points.
+  * @param[in]  S          points to an instance of the interpolation structure.
+  * @param[in]  pX         points to the X coordinates in 12.20 format
+  * @param[in]  pY         points to the Y coordinates in 12.20 format
+  * @param[out] pDst       points to the block of interpolated values
+  * @param[in]  blockSize  number of points to process
+  */
+  void arm_bilinear_interp_block_q15(
+  const arm_bilinear_interp_instance_q15 * S,
+  const q31_t * pX,
+  const q31_t * pY,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+  * @brief  Q7 bilinear interpolation of a block of points.
+  * @param[in]  S          points to an instance of the interpolation structure.
+  * @param[in]  pX         points to the X coordinates in 12.20 format
+  * @param[in]  pY         points to the Y coordinates in 12.20 format
+  * @param[out] pDst       points to the block of interpolated values
+  * @param[in]  blockSize  number of points to process
+  */
+  void arm_bilinear_interp_block_q7(
+  const arm_bilinear_interp_instance_q7 * S,
+  const q31_t * pX,
+  const q31_t * pY,
+        q7_t * pDst,
+        uint32_t blockSize);
+
 
 #ifdef   __cplusplus
 }
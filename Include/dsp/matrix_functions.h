@@ -109,9 +109,64 @@ extern "C"
  * return <code>ARM_MATH_SUCCESS</code>.
  */
 
+  /**
+   * @brief Operation applied to an operand of the general matrix multiplication.
+   */
+  typedef enum
+  {
+    ARM_MAT_NO_TRANS = 0,
+             /**< The matrix is used as it is */
+    ARM_MAT_TRANS = 1
+             /**< The matrix is transposed */
+  } arm_mat_trans_op;
+
+  /**
+   * @brief Q31 scaling factor closest to 1 for the general matrix multiplication.
+   */
+  #define ARM_MAT_GEMM_ONE_Q31 ((q31_t) 0x7FFFFFFF)
+
+  /**
+   * @brief Q15 scaling factor closest to 1 for the general matrix multiplication.
+   */
+  #define ARM_MAT_GEMM_ONE_Q15 ((q15_t) 0x7FFF)
+
+  /**
+   * @brief Maximum number of elements processed by one call to a vector function
+   * in the element-wise large matrix functions.
+   */
+#if !defined(ARM_MAT_LARGE_BLOCK_SIZE)
+  #define ARM_MAT_LARGE_BLOCK_SIZE (0x40000000U)
+#endif
+
+  /**
+   * @brief Size of the tiles used by the large matrix transpose.
+   */
+  #define ARM_MAT_LARGE_TRANS_TILE (16U)
+
+  /**
+   * @brief Default number of columns of the panels of the blocked decompositions.
+   */
+  #define ARM_MAT_DEFAULT_PANEL_SIZE (32U)
+
+  /**
+   * @brief Maximum dimension of the matrices of the batched inverse and solve.
+   */
+  #define ARM_MAT_BATCH_MAX_DIM (8U)
+
   #define DEFAULT_HOUSEHOLDER_THRESHOLD_F64 (1.0e-16)
   #define DEFAULT_HOUSEHOLDER_THRESHOLD_F32 (1.0e-12f)
 
+  /**
+   * @brief Maximum number of QL iterations per eigenvalue and of Jacobi sweeps.
+   */
+  #define ARM_MAT_EIG_MAX_ITERATIONS (30U)
+
+  /**
+   * @brief Orthogonality tolerance of the one-sided Jacobi SVD.
+   */
+  #define ARM_MAT_JACOBI_TOLERANCE_F64 (1.0e-15)
+  #define ARM_MAT_JACOBI_TOLERANCE_F32 (1.0e-7f)
+
   /**
    * @brief Instance structure for the floating-point matrix structure.
    */
@@ -162,6 +217,89 @@ extern "C"
     q31_t *pData;         /**< points to the data of the matrix. */
   } arm_matrix_instance_q31;
 
+  /**
+   * @brief Instance structure for the floating-point strided matrix structure.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    uint16_t stride;      /**< distance between the starts of two consecutive rows. */
+    float32_t *pData;     /**< points to the data of the matrix. */
+  } arm_matrix_strided_instance_f32;
+
+  /**
+   * @brief Instance structure for the double precision floating-point strided matrix structure.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    uint16_t stride;      /**< distance between the starts of two consecutive rows. */
+    float64_t *pData;     /**< points to the data of the matrix. */
+  } arm_matrix_strided_instance_f64;
+
+  /**
+   * @brief Instance structure for the floating-point large matrix structure.
+   */
+  typedef struct
+  {
+    uint32_t numRows;     /**< number of rows of the matrix.     */
+    uint32_t numCols;     /**< number of columns of the matrix.  */
+    float32_t *pData;    /**< points to the data of the matrix. */
+  } arm_matrix_instance_large_f32;
+
+  /**
+   * @brief Instance structure for the floating-point large matrix structure.
+   */
+  typedef struct
+  {
+    uint32_t numRows;     /**< number of rows of the matrix.     */
+    uint32_t numCols;     /**< number of columns of the matrix.  */
+    float64_t *pData;    /**< points to the data of the matrix. */
+  } arm_matrix_instance_large_f64;
+
+  /**
+   * @brief Instance structure for the Q31 large matrix structure.
+   */
+  typedef struct
+  {
+    uint32_t numRows;     /**< number of rows of the matrix.     */
+    uint32_t numCols;     /**< number of columns of the matrix.  */
+    q31_t *pData;        /**< points to the data of the matrix. */
+  } arm_matrix_instance_large_q31;
+
+  /**
+   * @brief Instance structure for the Q15 large matrix structure.
+   */
+  typedef struct
+  {
+    uint32_t numRows;     /**< number of rows of the matrix.     */
+    uint32_t numCols;     /**< number of columns of the matrix.  */
+    q15_t *pData;        /**< points to the data of the matrix. */
+  } arm_matrix_instance_large_q15;
+
+  /**
+   * @brief Instance structure for the Q7 large matrix structure.
+   */
+  typedef struct
+  {
+    uint32_t numRows;     /**< number of rows of the matrix.     */
+    uint32_t numCols;     /**< number of columns of the matrix.  */
+    q7_t *pData;         /**< points to the data of the matrix. */
+  } arm_matrix_instance_large_q7;
+
+  /**
+   * @brief Instance structure for the floating-point batch of matrices.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of each matrix.     */
+    uint16_t numCols;     /**< number of columns of each matrix.  */
+    uint32_t batchSize;   /**< number of matrices in the batch.   */
+    float32_t *pData;     /**< points to the interleaved data of the matrices. */
+  } arm_matrix_batch_instance_f32;
+
   /**
    * @brief Floating-point matrix addition.
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -646,6 +784,708 @@ void arm_mat_init_f64(
       uint16_t nColumns,
       float64_t * pData);
 
+  /**
+   * @brief  Floating-point strided matrix initialization.
+   * @param[in,out] S         points to an instance of the floating-point strided matrix structure.
+   * @param[in]     nRows     number of rows in the matrix.
+   * @param[in]     nColumns  number of columns in the matrix.
+   * @param[in]     stride    distance between the starts of two consecutive rows.
+   * @param[in]     pData     points to the matrix data array.
+   */
+void arm_mat_strided_init_f32(
+        arm_matrix_strided_instance_f32 * S,
+        uint16_t nRows,
+        uint16_t nColumns,
+        uint16_t stride,
+        float32_t * pData);
+
+  /**
+   * @brief  View of a block of a floating-point strided matrix.
+   * @param[in]  pSrc      points to the strided matrix.
+   * @param[in]  row       first row of the block.
+   * @param[in]  col       first column of the block.
+   * @param[in]  nRows     number of rows of the block.
+   * @param[in]  nColumns  number of columns of the block.
+   * @param[out] pDst      points to the view of the block.
+   * @return     The function returns ARM_MATH_SIZE_MISMATCH if the block is outside of the matrix.
+   */
+arm_status arm_mat_strided_sub_f32(
+  const arm_matrix_strided_instance_f32 * pSrc,
+        uint16_t row,
+        uint16_t col,
+        uint16_t nRows,
+        uint16_t nColumns,
+        arm_matrix_strided_instance_f32 * pDst);
+
+  /**
+   * @brief  Double precision floating-point strided matrix initialization.
+   * @param[in,out] S         points to an instance of the floating-point strided matrix structure.
+   * @param[in]     nRows     number of rows in the matrix.
+   * @param[in]     nColumns  number of columns in the matrix.
+   * @param[in]     stride    distance between the starts of two consecutive rows.
+   * @param[in]     pData     points to the matrix data array.
+   */
+void arm_mat_strided_init_f64(
+        arm_matrix_strided_instance_f64 * S,
+        uint16_t nRows,
+        uint16_t nColumns,
+        uint16_t stride,
+        float64_t * pData);
+
+  /**
+   * @brief  View of a block of a double precision floating-point strided matrix.
+   * @param[in]  pSrc      points to the strided matrix.
+   * @param[in]  row       first row of the block.
+   * @param[in]  col       first column of the block.
+   * @param[in]  nRows     number of rows of the block.
+   * @param[in]  nColumns  number of columns of the block.
+   * @param[out] pDst      points to the view of the block.
+   * @return     The function returns ARM_MATH_SIZE_MISMATCH if the block is outside of the matrix.
+   */
+arm_status arm_mat_strided_sub_f64(
+  const arm_matrix_strided_instance_f64 * pSrc,
+        uint16_t row,
+        uint16_t col,
+        uint16_t nRows,
+        uint16_t nColumns,
+        arm_matrix_strided_instance_f64 * pDst);
+
+  /**
+   * @brief  Floating-point batch of matrices initialization.
+   * @param[in,out] S          points to an instance of the floating-point batch of matrices structure.
+   * @param[in]     nRows      number of rows of each matrix.
+   * @param[in]     nColumns   number of columns of each matrix.
+   * @param[in]     batchSize  number of matrices in the batch.
+   * @param[in]     pData      points to the interleaved data array.
+   */
+void arm_mat_batch_init_f32(
+        arm_matrix_batch_instance_f32 * S,
+        uint16_t nRows,
+        uint16_t nColumns,
+        uint32_t batchSize,
+        float32_t * pData);
+
+  /**
+   * @brief  Copy a matrix into a batch of matrices.
+   * @param[in,out] S      points to the batch of matrices.
+   * @param[in]     index  index of the matrix in the batch.
+   * @param[in]     pSrc   points to the matrix to copy.
+   * @return     The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match.
+   */
+arm_status arm_mat_batch_set_f32(
+        arm_matrix_batch_instance_f32 * S,
+        uint32_t index,
+  const arm_matrix_instance_f32 * pSrc);
+
+  /**
+   * @brief  Copy a matrix of a batch of matrices.
+   * @param[in]  S      points to the batch of matrices.
+   * @param[in]  index  index of the matrix in the batch.
+   * @param[out] pDst   points to the destination matrix.
+   * @return     The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match.
+   */
+arm_status arm_mat_batch_get_f32(
+  const arm_matrix_batch_instance_f32 * S,
+        uint32_t index,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point multiplication of batches of matrices.
+   * @param[in]  pSrcA  points to the first batch of matrices
+   * @param[in]  pSrcB  points to the second batch of matrices
+   * @param[out] pDst   points to output batch of matrices
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_batch_mult_f32(
+  const arm_matrix_batch_instance_f32 * pSrcA,
+  const arm_matrix_batch_instance_f32 * pSrcB,
+        arm_matrix_batch_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point inverse of a batch of matrices.
+   * @param[in]  pSrc  points to the batch of matrices to invert
+   * @param[out] pDst  points to the batch of inverses
+   * @return     The function returns ARM_MATH_SINGULAR if one of the matrices is singular,
+   * ARM_MATH_ARGUMENT_ERROR if the dimension is bigger than ARM_MAT_BATCH_MAX_DIM.
+   */
+arm_status arm_mat_batch_inverse_f32(
+  const arm_matrix_batch_instance_f32 * pSrc,
+        arm_matrix_batch_instance_f32 * pDst);
+
+  /**
+   * @brief Solve A X = B for a batch of floating-point matrices.
+   * @param[in]  pSrcA  points to the batch of square matrices A
+   * @param[in]  pSrcB  points to the batch of right hand sides B
+   * @param[out] pDst   points to the batch of solutions X
+   * @return     The function returns ARM_MATH_SINGULAR if one of the matrices A is singular,
+   * ARM_MATH_ARGUMENT_ERROR if a dimension is bigger than ARM_MAT_BATCH_MAX_DIM.
+   */
+arm_status arm_mat_batch_solve_f32(
+  const arm_matrix_batch_instance_f32 * pSrcA,
+  const arm_matrix_batch_instance_f32 * pSrcB,
+        arm_matrix_batch_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point matrix multiplication of strided matrices.
+   * @param[in]  pSrcA  points to the first input strided matrix structure
+   * @param[in]  pSrcB  points to the second input strided matrix structure
+   * @param[out] pDst   points to output strided matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_strided_f32(
+  const arm_matrix_strided_instance_f32 * pSrcA,
+  const arm_matrix_strided_instance_f32 * pSrcB,
+        arm_matrix_strided_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point matrix addition of strided matrices.
+   * @param[in]  pSrcA  points to the first input strided matrix structure
+   * @param[in]  pSrcB  points to the second input strided matrix structure
+   * @param[out] pDst   points to output strided matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_add_strided_f32(
+  const arm_matrix_strided_instance_f32 * pSrcA,
+  const arm_matrix_strided_instance_f32 * pSrcB,
+        arm_matrix_strided_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point matrix transpose of a strided matrix.
+   * @param[in]  pSrc  points to the input strided matrix
+   * @param[out] pDst  points to the output strided matrix
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_trans_strided_f32(
+  const arm_matrix_strided_instance_f32 * pSrc,
+        arm_matrix_strided_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point multiplication of a strided matrix and a vector.
+   * @param[in]  pSrcMat  points to the input strided matrix structure
+   * @param[in]  pVec     points to vector
+   * @param[out] pDst     points to output vector
+   */
+void arm_mat_vec_mult_strided_f32(
+  const arm_matrix_strided_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst);
+
+  /**
+   * @brief Solve UT . X = A where UT is an upper triangular strided matrix
+   * @param[in]  ut  The upper triangular strided matrix
+   * @param[in]  a  The strided matrix a
+   * @param[out] dst The solution X of UT . X = A
+   * @return The function returns ARM_MATH_SINGULAR, if the system can't be solved.
+   */
+arm_status arm_mat_solve_upper_triangular_strided_f32(
+  const arm_matrix_strided_instance_f32 * ut,
+  const arm_matrix_strided_instance_f32 * a,
+        arm_matrix_strided_instance_f32 * dst);
+
+  /**
+   * @brief Solve LT . X = A where LT is a lower triangular strided matrix
+   * @param[in]  lt  The lower triangular strided matrix
+   * @param[in]  a  The strided matrix a
+   * @param[out] dst The solution X of LT . X = A
+   * @return The function returns ARM_MATH_SINGULAR, if the system can't be solved.
+   */
+arm_status arm_mat_solve_lower_triangular_strided_f32(
+  const arm_matrix_strided_instance_f32 * lt,
+  const arm_matrix_strided_instance_f32 * a,
+        arm_matrix_strided_instance_f32 * dst);
+
+  /**
+   * @brief Floating-point general matrix multiplication : C = alpha * op(A) * op(B) + beta * C.
+   * @param[in]     transA  \ref ARM_MAT_TRANS if A must be transposed
+   * @param[in]     transB  \ref ARM_MAT_TRANS if B must be transposed
+   * @param[in]     alpha   scaling of the product
+   * @param[in]     pSrcA   points to the first input matrix structure
+   * @param[in]     pSrcB   points to the second input matrix structure
+   * @param[in]     beta    scaling of the destination
+   * @param[in,out] pDst    points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_gemm_f32(
+        arm_mat_trans_op transA,
+        arm_mat_trans_op transB,
+        float32_t alpha,
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        float32_t beta,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point general matrix multiplication of strided matrices : C = alpha * op(A) * op(B) + beta * C.
+   * @param[in]     transA  \ref ARM_MAT_TRANS if A must be transposed
+   * @param[in]     transB  \ref ARM_MAT_TRANS if B must be transposed
+   * @param[in]     alpha   scaling of the product
+   * @param[in]     pSrcA   points to the first input matrix structure
+   * @param[in]     pSrcB   points to the second input matrix structure
+   * @param[in]     beta    scaling of the destination
+   * @param[in,out] pDst    points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_gemm_strided_f32(
+        arm_mat_trans_op transA,
+        arm_mat_trans_op transB,
+        float32_t alpha,
+  const arm_matrix_strided_instance_f32 * pSrcA,
+  const arm_matrix_strided_instance_f32 * pSrcB,
+        float32_t beta,
+        arm_matrix_strided_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point general matrix multiplication : C = alpha * op(A) * op(B) + beta * C.
+   * @param[in]     transA  \ref ARM_MAT_TRANS if A must be transposed
+   * @param[in]     transB  \ref ARM_MAT_TRANS if B must be transposed
+   * @param[in]     alpha   scaling of the product
+   * @param[in]     pSrcA   points to the first input matrix structure
+   * @param[in]     pSrcB   points to the second input matrix structure
+   * @param[in]     beta    scaling of the destination
+   * @param[in,out] pDst    points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_gemm_f64(
+        arm_mat_trans_op transA,
+        arm_mat_trans_op transB,
+        float64_t alpha,
+  const arm_matrix_instance_f64 * pSrcA,
+  const arm_matrix_instance_f64 * pSrcB,
+        float64_t beta,
+        arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Floating-point general matrix multiplication of strided matrices : C = alpha * op(A) * op(B) + beta * C.
+   * @param[in]     transA  \ref ARM_MAT_TRANS if A must be transposed
+   * @param[in]     transB  \ref ARM_MAT_TRANS if B must be transposed
+   * @param[in]     alpha   scaling of the product
+   * @param[in]     pSrcA   points to the first input matrix structure
+   * @param[in]     pSrcB   points to the second input matrix structure
+   * @param[in]     beta    scaling of the destination
+   * @param[in,out] pDst    points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_gemm_strided_f64(
+        arm_mat_trans_op transA,
+        arm_mat_trans_op transB,
+        float64_t alpha,
+  const arm_matrix_strided_instance_f64 * pSrcA,
+  const arm_matrix_strided_instance_f64 * pSrcB,
+        float64_t beta,
+        arm_matrix_strided_instance_f64 * pDst);
+
+  /**
+   * @brief Q31 general matrix multiplication : C = alpha * op(A) * op(B) + beta * C.
+   * @param[in]     transA  \ref ARM_MAT_TRANS if A must be transposed
+   * @param[in]     transB  \ref ARM_MAT_TRANS if B must be transposed
+   * @param[in]     alpha   scaling of the product
+   * @param[in]     pSrcA   points to the first input matrix structure
+   * @param[in]     pSrcB   points to the second input matrix structure
+   * @param[in]     beta    scaling of the destination
+   * @param[in,out] pDst    points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_gemm_q31(
+        arm_mat_trans_op transA,
+        arm_mat_trans_op transB,
+        q31_t alpha,
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+        q31_t beta,
+        arm_matrix_instance_q31 * pDst);
+
+  /**
+   * @brief Q15 general matrix multiplication : C = alpha * op(A) * op(B) + beta * C.
+   * @param[in]     transA  \ref ARM_MAT_TRANS if A must be transposed
+   * @param[in]     transB  \ref ARM_MAT_TRANS if B must be transposed
+   * @param[in]     alpha   scaling of the product
+   * @param[in]     pSrcA   points to the first input matrix structure
+   * @param[in]     pSrcB   points to the second input matrix structure
+   * @param[in]     beta    scaling of the destination
+   * @param[in,out] pDst    points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_gemm_q15(
+        arm_mat_trans_op transA,
+        arm_mat_trans_op transB,
+        q15_t alpha,
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+        q15_t beta,
+        arm_matrix_instance_q15 * pDst);
+
+  /**
+   * @brief  Floating-point large matrix initialization.
+   * @param[in,out] S         points to an instance of the floating-point large matrix structure.
+   * @param[in]     nRows     number of rows in the matrix.
+   * @param[in]     nColumns  number of columns in the matrix.
+   * @param[in]     pData     points to the matrix data array.
+   */
+void arm_mat_init_large_f32(
+        arm_matrix_instance_large_f32 * S,
+        uint32_t nRows,
+        uint32_t nColumns,
+        float32_t * pData);
+
+  /**
+   * @brief  Floating-point large matrix initialization.
+   * @param[in,out] S         points to an instance of the floating-point large matrix structure.
+   * @param[in]     nRows     number of rows in the matrix.
+   * @param[in]     nColumns  number of columns in the matrix.
+   * @param[in]     pData     points to the matrix data array.
+   */
+void arm_mat_init_large_f64(
+        arm_matrix_instance_large_f64 * S,
+        uint32_t nRows,
+        uint32_t nColumns,
+        float64_t * pData);
+
+  /**
+   * @brief  Q31 large matrix initialization.
+   * @param[in,out] S         points to an instance of the Q31 large matrix structure.
+   * @param[in]     nRows     number of rows in the matrix.
+   * @param[in]     nColumns  number of columns in the matrix.
+   * @param[in]     pData     points to the matrix data array.
+   */
+void arm_mat_init_large_q31(
+        arm_matrix_instance_large_q31 * S,
+        uint32_t nRows,
+        uint32_t nColumns,
+        q31_t * pData);
+
+  /**
+   * @brief  Q15 large matrix initialization.
+   * @param[in,out] S         points to an instance of the Q15 large matrix structure.
+   * @param[in]     nRows     number of rows in the matrix.
+   * @param[in]     nColumns  number of columns in the matrix.
+   * @param[in]     pData     points to the matrix data array.
+   */
+void arm_mat_init_large_q15(
+        arm_matrix_instance_large_q15 * S,
+        uint32_t nRows,
+        uint32_t nColumns,
+        q15_t * pData);
+
+  /**
+   * @brief  Q7 large matrix initialization.
+   * @param[in,out] S         points to an instance of the Q7 large matrix structure.
+   * @param[in]     nRows     number of rows in the matrix.
+   * @param[in]     nColumns  number of columns in the matrix.
+   * @param[in]     pData     points to the matrix data array.
+   */
+void arm_mat_init_large_q7(
+        arm_matrix_instance_large_q7 * S,
+        uint32_t nRows,
+        uint32_t nColumns,
+        q7_t * pData);
+
+  /**
+   * @brief Floating-point large matrix addition.
+   * @param[in]  pSrcA  points to the first input large matrix structure
+   * @param[in]  pSrcB  points to the second input large matrix structure
+   * @param[out] pDst   points to output large matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_add_large_f32(
+  const arm_matrix_instance_large_f32 * pSrcA,
+  const arm_matrix_instance_large_f32 * pSrcB,
+        arm_matrix_instance_large_f32 * pDst);
+
+  /**
+   * @brief Q31 large matrix addition.
+   * @param[in]  pSrcA  points to the first input large matrix structure
+   * @param[in]  pSrcB  points to the second input large matrix structure
+   * @param[out] pDst   points to output large matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_add_large_q31(
+  const arm_matrix_instance_large_q31 * pSrcA,
+  const arm_matrix_instance_large_q31 * pSrcB,
+        arm_matrix_instance_large_q31 * pDst);
+
+  /**
+   * @brief Q15 large matrix addition.
+   * @param[in]  pSrcA  points to the first input large matrix structure
+   * @param[in]  pSrcB  points to the second input large matrix structure
+   * @param[out] pDst   points to output large matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_add_large_q15(
+  const arm_matrix_instance_large_q15 * pSrcA,
+  const arm_matrix_instance_large_q15 * pSrcB,
+        arm_matrix_instance_large_q15 * pDst);
+
+  /**
+   * @brief Floating-point large matrix subtraction.
+   * @param[in]  pSrcA  points to the first input large matrix structure
+   * @param[in]  pSrcB  points to the second input large matrix structure
+   * @param[out] pDst   points to output large matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_sub_large_f32(
+  const arm_matrix_instance_large_f32 * pSrcA,
+  const arm_matrix_instance_large_f32 * pSrcB,
+        arm_matrix_instance_large_f32 * pDst);
+
+  /**
+   * @brief Floating-point large matrix subtraction.
+   * @param[in]  pSrcA  points to the first input large matrix structure
+   * @param[in]  pSrcB  points to the second input large matrix structure
+   * @param[out] pDst   points to output large matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_sub_large_f64(
+  const arm_matrix_instance_large_f64 * pSrcA,
+  const arm_matrix_instance_large_f64 * pSrcB,
+        arm_matrix_instance_large_f64 * pDst);
+
+  /**
+   * @brief Q31 large matrix subtraction.
+   * @param[in]  pSrcA  points to the first input large matrix structure
+   * @param[in]  pSrcB  points to the second input large matrix structure
+   * @param[out] pDst   points to output large matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_sub_large_q31(
+  const arm_matrix_instance_large_q31 * pSrcA,
+  const arm_matrix_instance_large_q31 * pSrcB,
+        arm_matrix_instance_large_q31 * pDst);
+
+  /**
+   * @brief Q15 large matrix subtraction.
+   * @param[in]  pSrcA  points to the first input large matrix structure
+   * @param[in]  pSrcB  points to the second input large matrix structure
+   * @param[out] pDst   points to output large matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_sub_large_q15(
+  const arm_matrix_instance_large_q15 * pSrcA,
+  const arm_matrix_instance_large_q15 * pSrcB,
+        arm_matrix_instance_large_q15 * pDst);
+
+  /**
+   * @brief Floating-point large matrix multiplication.
+   * @param[in]  pSrcA  points to the first input large matrix structure
+   * @param[in]  pSrcB  points to the second input large matrix structure
+   * @param[out] pDst   points to output large matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_large_f32(
+  const arm_matrix_instance_large_f32 * pSrcA,
+  const arm_matrix_instance_large_f32 * pSrcB,
+        arm_matrix_instance_large_f32 * pDst);
+
+  /**
+   * @brief Floating-point large matrix multiplication.
+   * @param[in]  pSrcA  points to the first input large matrix structure
+   * @param[in]  pSrcB  points to the second input large matrix structure
+   * @param[out] pDst   points to output large matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_large_f64(
+  const arm_matrix_instance_large_f64 * pSrcA,
+  const arm_matrix_instance_large_f64 * pSrcB,
+        arm_matrix_instance_large_f64 * pDst);
+
+  /**
+   * @brief Q31 large matrix multiplication.
+   * @param[in]  pSrcA  points to the first input large matrix structure
+   * @param[in]  pSrcB  points to the second input large matrix structure
+   * @param[out] pDst   points to output large matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_large_q31(
+  const arm_matrix_instance_large_q31 * pSrcA,
+  const arm_matrix_instance_large_q31 * pSrcB,
+        arm_matrix_instance_large_q31 * pDst);
+
+  /**
+   * @brief Q15 large matrix multiplication.
+   * @param[in]  pSrcA  points to the first input large matrix structure
+   * @param[in]  pSrcB  points to the second input large matrix structure
+   * @param[out] pDst   points to output large matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_large_q15(
+  const arm_matrix_instance_large_q15 * pSrcA,
+  const arm_matrix_instance_large_q15 * pSrcB,
+        arm_matrix_instance_large_q15 * pDst);
+
+  /**
+   * @brief Q7 large matrix multiplication.
+   * @param[in]  pSrcA  points to the first input large matrix structure
+   * @param[in]  pSrcB  points to the second input large matrix structure
+   * @param[out] pDst   points to output large matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_large_q7(
+  const arm_matrix_instance_large_q7 * pSrcA,
+  const arm_matrix_instance_large_q7 * pSrcB,
+        arm_matrix_instance_large_q7 * pDst);
+
+  /**
+   * @brief Floating-point large matrix scaling.
+   * @param[in]  pSrc   points to the input large matrix
+   * @param[in]  scale  scale factor
+   * @param[out] pDst   points to the output large matrix
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_scale_large_f32(
+  const arm_matrix_instance_large_f32 * pSrc,
+        float32_t scale,
+        arm_matrix_instance_large_f32 * pDst);
+
+  /**
+   * @brief Q31 large matrix scaling.
+   * @param[in]  pSrc        points to the input large matrix
+   * @param[in]  scaleFract  fractional portion of the scale factor
+   * @param[in]  shift       number of bits to shift the result by
+   * @param[out] pDst        points to the output large matrix
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_scale_large_q31(
+  const arm_matrix_instance_large_q31 * pSrc,
+        q31_t scaleFract,
+        int32_t shift,
+        arm_matrix_instance_large_q31 * pDst);
+
+  /**
+   * @brief Q15 large matrix scaling.
+   * @param[in]  pSrc        points to the input large matrix
+   * @param[in]  scaleFract  fractional portion of the scale factor
+   * @param[in]  shift       number of bits to shift the result by
+   * @param[out] pDst        points to the output large matrix
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_scale_large_q15(
+  const arm_matrix_instance_large_q15 * pSrc,
+        q15_t scaleFract,
+        int32_t shift,
+        arm_matrix_instance_large_q15 * pDst);
+
+  /**
+   * @brief Floating-point large matrix transpose.
+   * @param[in]  pSrc  points to the input large matrix
+   * @param[out] pDst  points to the output large matrix
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_trans_large_f32(
+  const arm_matrix_instance_large_f32 * pSrc,
+        arm_matrix_instance_large_f32 * pDst);
+
+  /**
+   * @brief Floating-point large matrix transpose.
+   * @param[in]  pSrc  points to the input large matrix
+   * @param[out] pDst  points to the output large matrix
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_trans_large_f64(
+  const arm_matrix_instance_large_f64 * pSrc,
+        arm_matrix_instance_large_f64 * pDst);
+
+  /**
+   * @brief Q31 large matrix transpose.
+   * @param[in]  pSrc  points to the input large matrix
+   * @param[out] pDst  points to the output large matrix
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_trans_large_q31(
+  const arm_matrix_instance_large_q31 * pSrc,
+        arm_matrix_instance_large_q31 * pDst);
+
+  /**
+   * @brief Q15 large matrix transpose.
+   * @param[in]  pSrc  points to the input large matrix
+   * @param[out] pDst  points to the output large matrix
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_trans_large_q15(
+  const arm_matrix_instance_large_q15 * pSrc,
+        arm_matrix_instance_large_q15 * pDst);
+
+  /**
+   * @brief Q7 large matrix transpose.
+   * @param[in]  pSrc  points to the input large matrix
+   * @param[out] pDst  points to the output large matrix
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_trans_large_q7(
+  const arm_matrix_instance_large_q7 * pSrc,
+        arm_matrix_instance_large_q7 * pDst);
+
+  /**
+   * @brief Floating-point large matrix and vector multiplication.
+   * @param[in]  pSrcMat  points to the input large matrix structure
+   * @param[in]  pVec     points to the input vector
+   * @param[out] pDst     points to the output vector
+   */
+void arm_mat_vec_mult_large_f32(
+  const arm_matrix_instance_large_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst);
+
+  /**
+   * @brief Q31 large matrix and vector multiplication.
+   * @param[in]  pSrcMat  points to the input large matrix structure
+   * @param[in]  pVec     points to the input vector
+   * @param[out] pDst     points to the output vector
+   */
+void arm_mat_vec_mult_large_q31(
+  const arm_matrix_instance_large_q31 * pSrcMat,
+  const q31_t * pVec,
+        q31_t * pDst);
+
+  /**
+   * @brief Q15 large matrix and vector multiplication.
+   * @param[in]  pSrcMat  points to the input large matrix structure
+   * @param[in]  pVec     points to the input vector
+   * @param[out] pDst     points to the output vector
+   */
+void arm_mat_vec_mult_large_q15(
+  const arm_matrix_instance_large_q15 * pSrcMat,
+  const q15_t * pVec,
+        q15_t * pDst);
+
+  /**
+   * @brief Q7 large matrix and vector multiplication.
+   * @param[in]  pSrcMat  points to the input large matrix structure
+   * @param[in]  pVec     points to the input vector
+   * @param[out] pDst     points to the output vector
+   */
+void arm_mat_vec_mult_large_q7(
+  const arm_matrix_instance_large_q7 * pSrcMat,
+  const q7_t * pVec,
+        q7_t * pDst);
 
 
 
@@ -698,6 +1538,36 @@ void arm_mat_init_f64(
   const arm_matrix_instance_f32 * src,
   arm_matrix_instance_f32 * dst);
 
+ /**
+   * @brief Floating-point blocked Cholesky decomposition of Symmetric Positive Definite Matrix.
+   * @param[in]  src        points to the instance of the input floating-point matrix structure.
+   * @param[out] dst        points to the instance of the output floating-point matrix structure.
+   * @param[in]  panelSize  number of columns of the panels.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix does not have a decomposition, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   * The function returns ARM_MATH_ARGUMENT_ERROR if panelSize is 0.
+   * The decomposition is returning a lower triangular matrix.
+   */
+  arm_status arm_mat_cholesky_blocked_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst,
+  uint16_t panelSize);
+
+ /**
+   * @brief Floating-point blocked Cholesky decomposition of Symmetric Positive Definite Matrix.
+   * @param[in]  src        points to the instance of the input floating-point matrix structure.
+   * @param[out] dst        points to the instance of the output floating-point matrix structure.
+   * @param[in]  panelSize  number of columns of the panels.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix does not have a decomposition, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   * The function returns ARM_MATH_ARGUMENT_ERROR if panelSize is 0.
+   * The decomposition is returning a lower triangular matrix.
+   */
+  arm_status arm_mat_cholesky_blocked_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst,
+  uint16_t panelSize);
+
   /**
    * @brief Solve UT . X = A where UT is an upper triangular matrix
    * @param[in]  ut  The upper triangular matrix
@@ -780,6 +1650,158 @@ void arm_mat_init_f64(
   arm_matrix_instance_f64 * d,
   uint16_t * pp);
 
+ /**
+   * @brief Floating-point blocked LDL decomposition of Symmetric Positive Semi-Definite Matrix.
+   * @param[in]  src        points to the instance of the input floating-point matrix structure.
+   * @param[out] l          points to the instance of the output floating-point triangular matrix structure.
+   * @param[out] d          points to the instance of the output floating-point diagonal matrix structure.
+   * @param[out] pp         points to the output permutation vector.
+   * @param[in]  panelSize  number of columns of the panels.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix does not have a decomposition, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   * The function returns ARM_MATH_ARGUMENT_ERROR if panelSize is 0.
+   * The decomposition is returning a lower triangular matrix.
+   */
+  arm_status arm_mat_ldlt_blocked_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * l,
+  arm_matrix_instance_f32 * d,
+  uint16_t * pp,
+  uint16_t panelSize);
+
+ /**
+   * @brief Floating-point blocked LDL decomposition of Symmetric Positive Semi-Definite Matrix.
+   * @param[in]  src        points to the instance of the input floating-point matrix structure.
+   * @param[out] l          points to the instance of the output floating-point triangular matrix structure.
+   * @param[out] d          points to the instance of the output floating-point diagonal matrix structure.
+   * @param[out] pp         points to the output permutation vector.
+   * @param[in]  panelSize  number of columns of the panels.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix does not have a decomposition, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   * The function returns ARM_MATH_ARGUMENT_ERROR if panelSize is 0.
+   * The decomposition is returning a lower triangular matrix.
+   */
+  arm_status arm_mat_ldlt_blocked_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * l,
+  arm_matrix_instance_f64 * d,
+  uint16_t * pp,
+  uint16_t panelSize);
+
+ /**
+   * @brief Floating-point LU decomposition with partial pivoting.
+   * @param[in]  pSrc    points to the instance of the input floating-point matrix structure.
+   * @param[out] pLU     points to the instance of the output floating-point matrix structure for the packed L and U factors.
+   * @param[out] pPivot  points to the output pivot vector.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_lu_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pLU,
+  uint16_t * pPivot);
+
+ /**
+   * @brief Solve A . X = B using the floating-point LU decomposition of A.
+   * @param[in]  pLU     points to the packed L and U factors computed by arm_mat_lu_f32.
+   * @param[in]  pPivot  points to the pivot vector computed by arm_mat_lu_f32.
+   * @param[in]  pSrc    points to the right hand sides B.
+   * @param[out] pDst    points to the solutions X.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   */
+  arm_status arm_mat_lu_solve_f32(
+  const arm_matrix_instance_f32 * pLU,
+  const uint16_t * pPivot,
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+ /**
+   * @brief Floating-point LU decomposition with partial pivoting.
+   * @param[in]  pSrc    points to the instance of the input floating-point matrix structure.
+   * @param[out] pLU     points to the instance of the output floating-point matrix structure for the packed L and U factors.
+   * @param[out] pPivot  points to the output pivot vector.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_lu_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pLU,
+  uint16_t * pPivot);
+
+ /**
+   * @brief Solve A . X = B using the floating-point LU decomposition of A.
+   * @param[in]  pLU     points to the packed L and U factors computed by arm_mat_lu_f64.
+   * @param[in]  pPivot  points to the pivot vector computed by arm_mat_lu_f64.
+   * @param[in]  pSrc    points to the right hand sides B.
+   * @param[out] pDst    points to the solutions X.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   */
+  arm_status arm_mat_lu_solve_f64(
+  const arm_matrix_instance_f64 * pLU,
+  const uint16_t * pPivot,
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst);
+
+ /**
+   * @brief Floating-point eigen-decomposition of a symmetric matrix.
+   * @param[in]  pSrc           points to the input symmetric matrix. It is not modified.
+   * @param[out] pEigenValues   points to the eigenvalues in increasing order.
+   * @param[out] pEigenVectors  points to the output matrix of eigenvectors (one per column).
+   * @param[in,out] pTmp        points to a temporary buffer of dimension 3 * n.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the iterations do not converge, the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_eig_sym_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  float32_t * pEigenValues,
+  arm_matrix_instance_f32 * pEigenVectors,
+  float32_t * pTmp);
+
+ /**
+   * @brief Floating-point singular value decomposition of a m x n matrix with m >= n.
+   * @param[in]  pSrc  points to the input matrix.
+   * @param[out] pU    points to the output matrix U of dimension m x n.
+   * @param[out] pS    points to the singular values in decreasing order.
+   * @param[out] pV    points to the output matrix V of dimension n x n.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the iterations do not converge, the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_svd_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pU,
+  float32_t * pS,
+  arm_matrix_instance_f32 * pV);
+
+ /**
+   * @brief Floating-point eigen-decomposition of a symmetric matrix.
+   * @param[in]  pSrc           points to the input symmetric matrix. It is not modified.
+   * @param[out] pEigenValues   points to the eigenvalues in increasing order.
+   * @param[out] pEigenVectors  points to the output matrix of eigenvectors (one per column).
+   * @param[in,out] pTmp        points to a temporary buffer of dimension 3 * n.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the iterations do not converge, the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_eig_sym_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  float64_t * pEigenValues,
+  arm_matrix_instance_f64 * pEigenVectors,
+  float64_t * pTmp);
+
+ /**
+   * @brief Floating-point singular value decomposition of a m x n matrix with m >= n.
+   * @param[in]  pSrc  points to the input matrix.
+   * @param[out] pU    points to the output matrix U of dimension m x n.
+   * @param[out] pS    points to the singular values in decreasing order.
+   * @param[out] pV    points to the output matrix V of dimension n x n.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the iterations do not converge, the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_svd_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pU,
+  float64_t * pS,
+  arm_matrix_instance_f64 * pV);
+
 /**
   @brief         QR decomposition of a m x n floating point matrix with m >= n.
   @param[in]     pSrc      points to input matrix structure. The source matrix is modified by the function.
@@ -830,6 +1852,98 @@ arm_status arm_mat_qr_f64(
     float64_t *pTmpB
     );
 
+/**
+  @brief         Blocked QR decomposition of a m x n floating point matrix with m >= n.
+  @param[in]     pSrc       points to input matrix structure.
+  @param[in]     threshold  norm2 threshold.
+  @param[out]    pOutR      points to output R matrix structure of dimension m x n
+  @param[out]    pOutQ      points to output Q matrix structure of dimension m x m
+  @param[out]    pOutTau    points to Householder scaling factors of dimension n
+  @param[inout]  pTmp       points to a temporary buffer of dimension m + panelSize * (panelSize + n).
+  @param[in]     panelSize  number of columns of the panels.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH  : Matrix size check failed
+                   - \ref ARM_MATH_ARGUMENT_ERROR : panelSize is 0
+ */
+
+arm_status arm_mat_qr_blocked_f32(
+    const arm_matrix_instance_f32 * pSrc,
+    const float32_t threshold,
+    arm_matrix_instance_f32 * pOutR,
+    arm_matrix_instance_f32 * pOutQ,
+    float32_t * pOutTau,
+    float32_t * pTmp,
+    uint16_t panelSize
+    );
+
+/**
+  @brief         Least squares solution of A X = B using the QR decomposition of A.
+  @param[in]     pR     points to the R matrix with the reflectors (m x n)
+  @param[in]     pTau   points to the Householder scaling factors (dimension n)
+  @param[in]     pSrc   points to the right hand sides B (m x nrhs)
+  @param[out]    pDst   points to the solutions X (n x nrhs)
+  @param[inout]  pTmp   points to a temporary buffer of dimension m * nrhs.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : R is singular
+ */
+
+arm_status arm_mat_qr_solve_f32(
+    const arm_matrix_instance_f32 * pR,
+    const float32_t * pTau,
+    const arm_matrix_instance_f32 * pSrc,
+    arm_matrix_instance_f32 * pDst,
+    float32_t * pTmp
+    );
+
+/**
+  @brief         Blocked QR decomposition of a m x n floating point matrix with m >= n.
+  @param[in]     pSrc       points to input matrix structure.
+  @param[in]     threshold  norm2 threshold.
+  @param[out]    pOutR      points to output R matrix structure of dimension m x n
+  @param[out]    pOutQ      points to output Q matrix structure of dimension m x m
+  @param[out]    pOutTau    points to Householder scaling factors of dimension n
+  @param[inout]  pTmp       points to a temporary buffer of dimension m + panelSize * (panelSize + n).
+  @param[in]     panelSize  number of columns of the panels.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH  : Matrix size check failed
+                   - \ref ARM_MATH_ARGUMENT_ERROR : panelSize is 0
+ */
+
+arm_status arm_mat_qr_blocked_f64(
+    const arm_matrix_instance_f64 * pSrc,
+    const float64_t threshold,
+    arm_matrix_instance_f64 * pOutR,
+    arm_matrix_instance_f64 * pOutQ,
+    float64_t * pOutTau,
+    float64_t * pTmp,
+    uint16_t panelSize
+    );
+
+/**
+  @brief         Least squares solution of A X = B using the QR decomposition of A.
+  @param[in]     pR     points to the R matrix with the reflectors (m x n)
+  @param[in]     pTau   points to the Householder scaling factors (dimension n)
+  @param[in]     pSrc   points to the right hand sides B (m x nrhs)
+  @param[out]    pDst   points to the solutions X (n x nrhs)
+  @param[inout]  pTmp   points to a temporary buffer of dimension m * nrhs.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : R is singular
+ */
+
+arm_status arm_mat_qr_solve_f64(
+    const arm_matrix_instance_f64 * pR,
+    const float64_t * pTau,
+    const arm_matrix_instance_f64 * pSrc,
+    arm_matrix_instance_f64 * pDst,
+    float64_t * pTmp
+    );
+
 /**
   @brief         Householder transform of a floating point vector.
   @param[in]     pSrc        points to the input vector.
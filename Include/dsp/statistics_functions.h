@@ -980,6 +980,385 @@ const float64_t * pSrc,
       uint32_t blockSize,
       float64_t * pResult);
 
+/**
+ * @brief Statistics of a floating-point vector computed by arm_stats_f32.
+ */
+typedef struct
+{
+  float32_t mean;      /**< mean value. */
+  float32_t var;       /**< variance. */
+  float32_t std;       /**< standard deviation. */
+  float32_t rms;       /**< root mean square. */
+  float32_t min;       /**< minimum value. */
+  float32_t max;       /**< maximum value. */
+  uint32_t minIndex;   /**< index of the minimum value. */
+  uint32_t maxIndex;   /**< index of the maximum value. */
+} arm_stats_result_f32;
+
+/**
+ * @brief Statistics of a Q31 vector computed by arm_stats_q31.
+ */
+typedef struct
+{
+  q31_t mean;          /**< mean value. */
+  q31_t var;           /**< variance. */
+  q31_t std;           /**< standard deviation. */
+  q31_t rms;           /**< root mean square. */
+  q31_t min;           /**< minimum value. */
+  q31_t max;           /**< maximum value. */
+  uint32_t minIndex;   /**< index of the minimum value. */
+  uint32_t maxIndex;   /**< index of the maximum value. */
+} arm_stats_result_q31;
+
+/**
+ * @brief Statistics of a Q15 vector computed by arm_stats_q15.
+ */
+typedef struct
+{
+  q15_t mean;          /**< mean value. */
+  q15_t var;           /**< variance. */
+  q15_t std;           /**< standard deviation. */
+  q15_t rms;           /**< root mean square. */
+  q15_t min;           /**< minimum value. */
+  q15_t max;           /**< maximum value. */
+  uint32_t minIndex;   /**< index of the minimum value. */
+  uint32_t maxIndex;   /**< index of the maximum value. */
+} arm_stats_result_q15;
+
+/**
+ * @brief  Mean, variance, standard deviation, RMS, minimum and maximum of a floating-point vector in one pass.
+ * @param[in]  pSrc       is input pointer
+ * @param[in]  blockSize  is the number of samples to process
+ * @param[out] pResult    is output statistics
+ */
+void arm_stats_f32(
+const float32_t * pSrc,
+      uint32_t blockSize,
+      arm_stats_result_f32 * pResult);
+
+/**
+ * @brief  Mean, variance, standard deviation, RMS, minimum and maximum of a Q31 vector in one pass.
+ * @param[in]  pSrc       is input pointer
+ * @param[in]  blockSize  is the number of samples to process
+ * @param[out] pResult    is output statistics
+ */
+void arm_stats_q31(
+const q31_t * pSrc,
+      uint32_t blockSize,
+      arm_stats_result_q31 * pResult);
+
+/**
+ * @brief  Mean, variance, standard deviation, RMS, minimum and maximum of a Q15 vector in one pass.
+ * @param[in]  pSrc       is input pointer
+ * @param[in]  blockSize  is the number of samples to process
+ * @param[out] pResult    is output statistics
+ */
+void arm_stats_q15(
+const q15_t * pSrc,
+      uint32_t blockSize,
+      arm_stats_result_q15 * pResult);
+
+/**
+ * @brief Instance structure for the floating-point running statistics.
+ */
+typedef struct
+{
+  uint32_t count;      /**< number of samples processed. */
+  float32_t mean;      /**< mean of the samples. */
+  float32_t m2;        /**< sum of the squared deviations from the mean. */
+  float32_t min;       /**< minimum value. */
+  float32_t max;       /**< maximum value. */
+  uint32_t minIndex;   /**< index of the minimum value. */
+  uint32_t maxIndex;   /**< index of the maximum value. */
+} arm_running_stats_instance_f32;
+
+/**
+ * @brief Instance structure for the floating-point sliding window statistics.
+ */
+typedef struct
+{
+  uint32_t windowSize;      /**< number of samples in the window. */
+  uint32_t count;           /**< number of samples currently in the window. */
+  uint32_t writeIndex;      /**< position of the next sample in the state buffer. */
+  float32_t *pState;        /**< points to the state buffer. The array is of length windowSize. */
+  uint32_t *pMinQueue;      /**< points to the queue of candidate minimums. The array is of length windowSize. */
+  uint32_t *pMaxQueue;      /**< points to the queue of candidate maximums. The array is of length windowSize. */
+  uint32_t minHead;         /**< first element of the minimum queue. */
+  uint32_t minCount;        /**< number of elements in the minimum queue. */
+  uint32_t maxHead;         /**< first element of the maximum queue. */
+  uint32_t maxCount;        /**< number of elements in the maximum queue. */
+  float32_t shift;          /**< offset subtracted from the samples before accumulation. */
+  float32_t sum;            /**< sum of the shifted samples in the window. */
+  float32_t sumOfSquares;   /**< sum of the squares of the shifted samples in the window. */
+  uint32_t nbUpdates;       /**< number of samples since the last recomputation of the sums. */
+} arm_sliding_window_instance_f32;
+
+/**
+ * @brief Instance structure for the Q31 running statistics.
+ */
+typedef struct
+{
+  uint32_t count;      /**< number of samples processed. */
+  q63_t sum;           /**< sum of the samples. */
+  q63_t sumShifted;    /**< sum of the downshifted samples. */
+  q63_t sumOfSquares;  /**< sum of the squares of the downshifted samples. */
+  q63_t power;         /**< sum of the squares for the RMS. */
+  q31_t min;           /**< minimum value. */
+  q31_t max;           /**< maximum value. */
+  uint32_t minIndex;   /**< index of the minimum value. */
+  uint32_t maxIndex;   /**< index of the maximum value. */
+} arm_running_stats_instance_q31;
+
+/**
+ * @brief Instance structure for the Q31 sliding window statistics.
+ */
+typedef struct
+{
+  uint32_t windowSize;      /**< number of samples in the window. */
+  uint32_t count;           /**< number of samples currently in the window. */
+  uint32_t writeIndex;      /**< position of the next sample in the state buffer. */
+  q31_t *pState;            /**< points to the state buffer. The array is of length windowSize. */
+  uint32_t *pMinQueue;      /**< points to the queue of candidate minimums. The array is of length windowSize. */
+  uint32_t *pMaxQueue;      /**< points to the queue of candidate maximums. The array is of length windowSize. */
+  uint32_t minHead;         /**< first element of the minimum queue. */
+  uint32_t minCount;        /**< number of elements in the minimum queue. */
+  uint32_t maxHead;         /**< first element of the maximum queue. */
+  uint32_t maxCount;        /**< number of elements in the maximum queue. */
+  q63_t sum;                /**< sum of the samples in the window. */
+  q63_t sumShifted;         /**< sum of the downshifted samples in the window. */
+  q63_t sumOfSquares;       /**< sum of the squares of the downshifted samples in the window. */
+  q63_t power;              /**< sum of the squares for the RMS in the window. */
+} arm_sliding_window_instance_q31;
+
+/**
+ * @brief Instance structure for the Q15 running statistics.
+ */
+typedef struct
+{
+  uint32_t count;      /**< number of samples processed. */
+  q63_t sum;           /**< sum of the samples. */
+  q63_t sumOfSquares;  /**< sum of the squares of the samples. */
+  q15_t min;           /**< minimum value. */
+  q15_t max;           /**< maximum value. */
+  uint32_t minIndex;   /**< index of the minimum value. */
+  uint32_t maxIndex;   /**< index of the maximum value. */
+} arm_running_stats_instance_q15;
+
+/**
+ * @brief Instance structure for the Q15 sliding window statistics.
+ */
+typedef struct
+{
+  uint32_t windowSize;      /**< number of samples in the window. */
+  uint32_t count;           /**< number of samples currently in the window. */
+  uint32_t writeIndex;      /**< position of the next sample in the state buffer. */
+  q15_t *pState;            /**< points to the state buffer. The array is of length windowSize. */
+  uint32_t *pMinQueue;      /**< points to the queue of candidate minimums. The array is of length windowSize. */
+  uint32_t *pMaxQueue;      /**< points to the queue of candidate maximums. The array is of length windowSize. */
+  uint32_t minHead;         /**< first element of the minimum queue. */
+  uint32_t minCount;        /**< number of elements in the minimum queue. */
+  uint32_t maxHead;         /**< first element of the maximum queue. */
+  uint32_t maxCount;        /**< number of elements in the maximum queue. */
+  q63_t sum;                /**< sum of the samples in the window. */
+  q63_t sumOfSquares;       /**< sum of the squares of the samples in the window. */
+} arm_sliding_window_instance_q15;
+
+/**
+ * @brief  Initialization function for the floating-point running statistics.
+ * @param[out] S          points to an instance of the running statistics structure.
+ */
+void arm_running_stats_init_f32(
+      arm_running_stats_instance_f32 * S);
+
+/**
+ * @brief  Update the floating-point running statistics with new samples.
+ * @param[in,out] S          points to an instance of the running statistics structure.
+ * @param[in]     pSrc       points to the new samples
+ * @param[in]     blockSize  number of new samples
+ */
+void arm_running_stats_f32(
+      arm_running_stats_instance_f32 * S,
+const float32_t * pSrc,
+      uint32_t blockSize);
+
+/**
+ * @brief  Statistics of all the samples processed by the floating-point running statistics.
+ * @param[in]  S          points to an instance of the running statistics structure.
+ * @param[out] pResult    is output statistics
+ */
+void arm_running_stats_result_f32(
+const arm_running_stats_instance_f32 * S,
+      arm_stats_result_f32 * pResult);
+
+/**
+ * @brief  Initialization function for the floating-point sliding window statistics.
+ * @param[out] S           points to an instance of the sliding window statistics structure.
+ * @param[in]  windowSize  number of samples in the window
+ * @param[in]  pState      points to the state buffer of length windowSize
+ * @param[in]  pMinQueue   points to a buffer of length windowSize
+ * @param[in]  pMaxQueue   points to a buffer of length windowSize
+ * @return     execution status
+ *               - \ref ARM_MATH_SUCCESS        : Operation successful
+ *               - \ref ARM_MATH_ARGUMENT_ERROR : windowSize is 0
+ */
+arm_status arm_sliding_window_init_f32(
+      arm_sliding_window_instance_f32 * S,
+      uint32_t windowSize,
+      float32_t * pState,
+      uint32_t * pMinQueue,
+      uint32_t * pMaxQueue);
+
+/**
+ * @brief  Add new samples to the floating-point sliding window statistics.
+ * @param[in,out] S          points to an instance of the sliding window statistics structure.
+ * @param[in]     pSrc       points to the new samples
+ * @param[in]     blockSize  number of new samples
+ */
+void arm_sliding_window_f32(
+      arm_sliding_window_instance_f32 * S,
+const float32_t * pSrc,
+      uint32_t blockSize);
+
+/**
+ * @brief  Statistics of the samples in the floating-point sliding window.
+ * @param[in]  S          points to an instance of the sliding window statistics structure.
+ * @param[out] pResult    is output statistics
+ */
+void arm_sliding_window_result_f32(
+const arm_sliding_window_instance_f32 * S,
+      arm_stats_result_f32 * pResult);
+
+/**
+ * @brief  Initialization function for the Q31 running statistics.
+ * @param[out] S          points to an instance of the running statistics structure.
+ */
+void arm_running_stats_init_q31(
+      arm_running_stats_instance_q31 * S);
+
+/**
+ * @brief  Update the Q31 running statistics with new samples.
+ * @param[in,out] S          points to an instance of the running statistics structure.
+ * @param[in]     pSrc       points to the new samples
+ * @param[in]     blockSize  number of new samples
+ */
+void arm_running_stats_q31(
+      arm_running_stats_instance_q31 * S,
+const q31_t * pSrc,
+      uint32_t blockSize);
+
+/**
+ * @brief  Statistics of all the samples processed by the Q31 running statistics.
+ * @param[in]  S          points to an instance of the running statistics structure.
+ * @param[out] pResult    is output statistics
+ */
+void arm_running_stats_result_q31(
+const arm_running_stats_instance_q31 * S,
+      arm_stats_result_q31 * pResult);
+
+/**
+ * @brief  Initialization function for the Q31 sliding window statistics.
+ * @param[out] S           points to an instance of the sliding window statistics structure.
+ * @param[in]  windowSize  number of samples in the window
+ * @param[in]  pState      points to the state buffer of length windowSize
+ * @param[in]  pMinQueue   points to a buffer of length windowSize
+ * @param[in]  pMaxQueue   points to a buffer of length windowSize
+ * @return     execution status
+ *               - \ref ARM_MATH_SUCCESS        : Operation successful
+ *               - \ref ARM_MATH_ARGUMENT_ERROR : windowSize is 0
+ */
+arm_status arm_sliding_window_init_q31(
+      arm_sliding_window_instance_q31 * S,
+      uint32_t windowSize,
+      q31_t * pState,
+      uint32_t * pMinQueue,
+      uint32_t * pMaxQueue);
+
+/**
+ * @brief  Add new samples to the Q31 sliding window statistics.
+ * @param[in,out] S          points to an instance of the sliding window statistics structure.
+ * @param[in]     pSrc       points to the new samples
+ * @param[in]     blockSize  number of new samples
+ */
+void arm_sliding_window_q31(
+      arm_sliding_window_instance_q31 * S,
+const q31_t * pSrc,
+      uint32_t blockSize);
+
+/**
+ * @brief  Statistics of the samples in the Q31 sliding window.
+ * @param[in]  S          points to an instance of the sliding window statistics structure.
+ * @param[out] pResult    is output statistics
+ */
+void arm_sliding_window_result_q31(
+const arm_sliding_window_instance_q31 * S,
+      arm_stats_result_q31 * pResult);
+
+/**
+ * @brief  Initialization function for the Q15 running statistics.
+ * @param[out] S          points to an instance of the running statistics structure.
+ */
+void arm_running_stats_init_q15(
+      arm_running_stats_instance_q15 * S);
+
+/**
+ * @brief  Update the Q15 running statistics with new samples.
+ * @param[in,out] S          points to an instance of the running statistics structure.
+ * @param[in]     pSrc       points to the new samples
+ * @param[in]     blockSize  number of new samples
+ */
+void arm_running_stats_q15(
+      arm_running_stats_instance_q15 * S,
+const q15_t * pSrc,
+      uint32_t blockSize);
+
+/**
+ * @brief  Statistics of all the samples processed by the Q15 running statistics.
+ * @param[in]  S          points to an instance of the running statistics structure.
+ * @param[out] pResult    is output statistics
+ */
+void arm_running_stats_result_q15(
+const arm_running_stats_instance_q15 * S,
+      arm_stats_result_q15 * pResult);
+
+/**
+ * @brief  Initialization function for the Q15 sliding window statistics.
+ * @param[out] S           points to an instance of the sliding window statistics structure.
+ * @param[in]  windowSize  number of samples in the window
+ * @param[in]  pState      points to the state buffer of length windowSize
+ * @param[in]  pMinQueue   points to a buffer of length windowSize
+ * @param[in]  pMaxQueue   points to a buffer of length windowSize
+ * @return     execution status
+ *               - \ref ARM_MATH_SUCCESS        : Operation successful
+ *               - \ref ARM_MATH_ARGUMENT_ERROR : windowSize is 0
+ */
+arm_status arm_sliding_window_init_q15(
+      arm_sliding_window_instance_q15 * S,
+      uint32_t windowSize,
+      q15_t * pState,
+      uint32_t * pMinQueue,
+      uint32_t * pMaxQueue);
+
+/**
+ * @brief  Add new samples to the Q15 sliding window statistics.
+ * @param[in,out] S          points to an instance of the sliding window statistics structure.
+ * @param[in]     pSrc       points to the new samples
+ * @param[in]     blockSize  number of new samples
+ */
+void arm_sliding_window_q15(
+      arm_sliding_window_instance_q15 * S,
+const q15_t * pSrc,
+      uint32_t blockSize);
+
+/**
+ * @brief  Statistics of the samples in the Q15 sliding window.
+ * @param[in]  S          points to an instance of the sliding window statistics structure.
+ * @param[out] pResult    is output statistics
+ */
+void arm_sliding_window_result_q15(
+const arm_sliding_window_instance_q15 * S,
+      arm_stats_result_q15 * pResult);
+
+
 
 #ifdef   __cplusplus
 }
@@ -292,8 +292,10 @@ const q7_t * pSrc,
              /**< Insertion sort */
     ARM_SORT_QUICK     = 4,
              /**< Quick sort     */
-    ARM_SORT_SELECTION = 5
+    ARM_SORT_SELECTION = 5,
              /**< Selection sort */
+    ARM_SORT_RADIX     = 6
+             /**< Radix sort     */
   } arm_sort_alg;
 
   /**
@@ -369,6 +371,37 @@ const q7_t * pSrc,
     arm_sort_dir dir,
     float32_t * buffer);
 
+  /**
+   * @brief Instance structure for the argsort.
+   */
+  typedef struct
+  {
+    arm_sort_dir dir;        /**< Sorting order (direction)  */
+    uint32_t * buffer;       /**< Working buffer of 2*blockSize words */
+  } arm_argsort_instance_f32;
+
+  /**
+   * @param[in]      S          points to an instance of the argsort structure.
+   * @param[in]      pSrc       points to the block of input data.
+   * @param[out]     pIndex     points to the permutation sorting the input
+   * @param[in]      blockSize  number of samples to process.
+   */
+  void arm_argsort_f32(
+    const arm_argsort_instance_f32 * S,
+    const float32_t *pSrc,
+          uint32_t *pIndex,
+          uint32_t blockSize);
+
+  /**
+   * @param[in,out]  S            points to an instance of the argsort structure.
+   * @param[in]      dir          Sorting order.
+   * @param[in]      buffer       Working buffer.
+   */
+  void arm_argsort_init_f32(
+    arm_argsort_instance_f32 * S,
+    arm_sort_dir dir,
+    uint32_t * buffer);
+
  
  
   /**
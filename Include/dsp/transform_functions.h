@@ -850,6 +850,366 @@ void arm_rfft_fast_f32(
 #endif
 
 
+#if !defined(ARM_MATH_NEON)
+  /**
+   * @brief Instance structure for the floating-point DCT functions.
+   */
+  typedef struct
+  {
+          uint16_t N;                      /**< length of the DCT. */
+    const float32_t *pTwiddleDct2;         /**< post-rotation of the DCT-II. */
+    const float32_t *pTwiddleDct4Pre;      /**< pre-rotation of the DCT-IV. */
+    const float32_t *pTwiddleDct4Post;     /**< post-rotation of the DCT-IV. */
+          arm_rfft_fast_instance_f32 rfft; /**< Internal RFFT of length N. Its internal CFFT is used by the DCT-IV. */
+  } arm_dct_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 DCT functions.
+   */
+  typedef struct
+  {
+          uint16_t N;                      /**< length of the DCT. */
+    const q31_t *pTwiddleDct2;             /**< post-rotation of the DCT-II. */
+    const q31_t *pTwiddleRfft;             /**< twiddles of the real FFT computed with the CFFT. */
+    const q31_t *pTwiddleDct4Pre;          /**< pre-rotation of the DCT-IV. */
+    const q31_t *pTwiddleDct4Post;         /**< post-rotation of the DCT-IV. */
+          arm_cfft_instance_q31 cfft;      /**< Internal CFFT of length N/2. */
+  } arm_dct_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 DCT functions.
+   */
+  typedef struct
+  {
+          uint16_t N;                      /**< length of the DCT. */
+    const q15_t *pTwiddleDct2;             /**< post-rotation of the DCT-II. */
+    const q15_t *pTwiddleRfft;             /**< twiddles of the real FFT computed with the CFFT. */
+    const q15_t *pTwiddleDct4Pre;          /**< pre-rotation of the DCT-IV. */
+    const q15_t *pTwiddleDct4Post;         /**< post-rotation of the DCT-IV. */
+          arm_cfft_instance_q15 cfft;      /**< Internal CFFT of length N/2. */
+  } arm_dct_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point DCT.
+   * @param[out] S         points to an instance of the floating-point DCT structure.
+   * @param[in]  N         length of the DCT.
+   * @param[out] pTwiddle  points to a buffer of 3*N values for the rotation tables.
+   * @return     execution status
+   */
+  arm_status arm_dct_init_f32(
+        arm_dct_instance_f32 * S,
+        uint16_t N,
+        float32_t * pTwiddle);
+
+  /**
+   * @brief  Initialization function for the Q31 DCT.
+   * @param[out] S         points to an instance of the Q31 DCT structure.
+   * @param[in]  N         length of the DCT.
+   * @param[out] pTwiddle  points to a buffer of 4*N values for the rotation tables.
+   * @return     execution status
+   */
+  arm_status arm_dct_init_q31(
+        arm_dct_instance_q31 * S,
+        uint16_t N,
+        q31_t * pTwiddle);
+
+  /**
+   * @brief  Initialization function for the Q15 DCT.
+   * @param[out] S         points to an instance of the Q15 DCT structure.
+   * @param[in]  N         length of the DCT.
+   * @param[out] pTwiddle  points to a buffer of 4*N values for the rotation tables.
+   * @return     execution status
+   */
+  arm_status arm_dct_init_q15(
+        arm_dct_instance_q15 * S,
+        uint16_t N,
+        q15_t * pTwiddle);
+
+  /**
+   * @brief  Floating-point DCT-II.
+   * @param[in]  S     points to an instance of the floating-point DCT structure.
+   * @param[in]  pSrc  points to the input buffer of N values
+   * @param[out] pDst  points to the output buffer of N values
+   * @param[out] pTmp  points to a temporary buffer of N values
+   */
+  void arm_dct2_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp);
+
+  /**
+   * @brief  Floating-point inverse DCT-II (DCT-III).
+   * @param[in]  S     points to an instance of the floating-point DCT structure.
+   * @param[in]  pSrc  points to the input buffer of N values
+   * @param[out] pDst  points to the output buffer of N values
+   * @param[out] pTmp  points to a temporary buffer of N values
+   */
+  void arm_idct2_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp);
+
+  /**
+   * @brief  Floating-point DST-II.
+   * @param[in]  S     points to an instance of the floating-point DCT structure.
+   * @param[in]  pSrc  points to the input buffer of N values
+   * @param[out] pDst  points to the output buffer of N values
+   * @param[out] pTmp  points to a temporary buffer of N values
+   */
+  void arm_dst2_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp);
+
+  /**
+   * @brief  Floating-point inverse DST-II (DST-III).
+   * @param[in]  S     points to an instance of the floating-point DCT structure.
+   * @param[in]  pSrc  points to the input buffer of N values
+   * @param[out] pDst  points to the output buffer of N values
+   * @param[out] pTmp  points to a temporary buffer of N values
+   */
+  void arm_idst2_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp);
+
+  /**
+   * @brief  Floating-point DCT-IV.
+   * @param[in]  S     points to an instance of the floating-point DCT structure.
+   * @param[in]  pSrc  points to the input buffer of N values
+   * @param[out] pDst  points to the output buffer of N values
+   * @param[out] pTmp  points to a temporary buffer of N values
+   */
+  void arm_dct4_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp);
+
+  /**
+   * @brief  Floating-point inverse DCT-IV.
+   * @param[in]  S     points to an instance of the floating-point DCT structure.
+   * @param[in]  pSrc  points to the input buffer of N values
+   * @param[out] pDst  points to the output buffer of N values
+   * @param[out] pTmp  points to a temporary buffer of N values
+   */
+  void arm_idct4_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp);
+
+  /**
+   * @brief  Q31 DCT-II.
+   * @param[in]  S     points to an instance of the Q31 DCT structure.
+   * @param[in]  pSrc  points to the input buffer of N values
+   * @param[out] pDst  points to the output buffer of N values
+   * @param[out] pTmp  points to a temporary buffer of N values
+   */
+  void arm_dct2_q31(
+  const arm_dct_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pTmp);
+
+  /**
+   * @brief  Q31 inverse DCT-II (DCT-III).
+   * @param[in]  S     points to an instance of the Q31 DCT structure.
+   * @param[in]  pSrc  points to the input buffer of N values
+   * @param[out] pDst  points to the output buffer of N values
+   * @param[out] pTmp  points to a temporary buffer of N values
+   */
+  void arm_idct2_q31(
+  const arm_dct_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pTmp);
+
+  /**
+   * @brief  Q31 DCT-IV.
+   * @param[in]  S     points to an instance of the Q31 DCT structure.
+   * @param[in]  pSrc  points to the input buffer of N values
+   * @param[out] pDst  points to the output buffer of N values
+   * @param[out] pTmp  points to a temporary buffer of N values
+   */
+  void arm_dct4_q31(
+  const arm_dct_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pTmp);
+
+  /**
+   * @brief  Q31 inverse DCT-IV.
+   * @param[in]  S     points to an instance of the Q31 DCT structure.
+   * @param[in]  pSrc  points to the input buffer of N values
+   * @param[out] pDst  points to the output buffer of N values
+   * @param[out] pTmp  points to a temporary buffer of N values
+   */
+  void arm_idct4_q31(
+  const arm_dct_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pTmp);
+
+  /**
+   * @brief  Q15 DCT-II.
+   * @param[in]  S     points to an instance of the Q15 DCT structure.
+   * @param[in]  pSrc  points to the input buffer of N values
+   * @param[out] pDst  points to the output buffer of N values
+   * @param[out] pTmp  points to a temporary buffer of N values
+   */
+  void arm_dct2_q15(
+  const arm_dct_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        q15_t * pTmp);
+
+  /**
+   * @brief  Q15 inverse DCT-II (DCT-III).
+   * @param[in]  S     points to an instance of the Q15 DCT structure.
+   * @param[in]  pSrc  points to the input buffer of N values
+   * @param[out] pDst  points to the output buffer of N values
+   * @param[out] pTmp  points to a temporary buffer of N values
+   */
+  void arm_idct2_q15(
+  const arm_dct_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        q15_t * pTmp);
+
+  /**
+   * @brief  Q15 DCT-IV.
+   * @param[in]  S     points to an instance of the Q15 DCT structure.
+   * @param[in]  pSrc  points to the input buffer of N values
+   * @param[out] pDst  points to the output buffer of N values
+   * @param[out] pTmp  points to a temporary buffer of N values
+   */
+  void arm_dct4_q15(
+  const arm_dct_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        q15_t * pTmp);
+
+  /**
+   * @brief  Q15 inverse DCT-IV.
+   * @param[in]  S     points to an instance of the Q15 DCT structure.
+   * @param[in]  pSrc  points to the input buffer of N values
+   * @param[out] pDst  points to the output buffer of N values
+   * @param[out] pTmp  points to a temporary buffer of N values
+   */
+  void arm_idct4_q15(
+  const arm_dct_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        q15_t * pTmp);
+
+  /**
+   * @brief Instance structure for the floating-point MDCT functions.
+   */
+  typedef struct
+  {
+          uint16_t N;                      /**< number of MDCT coefficients (hop size). */
+    const float32_t *pWindow;              /**< points to the window of 2*N values. */
+          float32_t *pState;               /**< points to the state buffer of N values. */
+    const float32_t *pTwiddlePre;          /**< pre-rotation of the DCT-IV. */
+    const float32_t *pTwiddlePost;         /**< post-rotation of the DCT-IV. */
+          arm_cfft_instance_f32 cfft;      /**< Internal CFFT of length N/2. */
+  } arm_mdct_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 MDCT functions.
+   */
+  typedef struct
+  {
+          uint16_t N;                      /**< number of MDCT coefficients (hop size). */
+    const q31_t *pWindow;                  /**< points to the window of 2*N values. */
+          q31_t *pState;                   /**< points to the state buffer of N values. */
+    const q31_t *pTwiddlePre;              /**< pre-rotation of the DCT-IV. */
+    const q31_t *pTwiddlePost;             /**< post-rotation of the DCT-IV. */
+          arm_cfft_instance_q31 cfft;      /**< Internal CFFT of length N/2. */
+  } arm_mdct_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point MDCT.
+   * @param[out] S         points to an instance of the floating-point MDCT structure.
+   * @param[in]  N         number of MDCT coefficients.
+   * @param[in]  pWindow   points to the window of 2*N values.
+   * @param[out] pState    points to the state buffer of N values.
+   * @param[out] pTwiddle  points to a buffer of 2*N values for the rotation tables.
+   * @return     execution status
+   */
+  arm_status arm_mdct_init_f32(
+        arm_mdct_instance_f32 * S,
+        uint16_t N,
+  const float32_t * pWindow,
+        float32_t * pState,
+        float32_t * pTwiddle);
+
+  /**
+   * @brief  Initialization function for the Q31 MDCT.
+   * @param[out] S         points to an instance of the Q31 MDCT structure.
+   * @param[in]  N         number of MDCT coefficients.
+   * @param[in]  pWindow   points to the window of 2*N values.
+   * @param[out] pState    points to the state buffer of N values.
+   * @param[out] pTwiddle  points to a buffer of 2*N values for the rotation tables.
+   * @return     execution status
+   */
+  arm_status arm_mdct_init_q31(
+        arm_mdct_instance_q31 * S,
+        uint16_t N,
+  const q31_t * pWindow,
+        q31_t * pState,
+        q31_t * pTwiddle);
+
+  /**
+   * @brief  Floating-point MDCT of a frame.
+   * @param[in,out] S     points to an instance of the floating-point MDCT structure.
+   * @param[in]     pSrc  points to the N new samples
+   * @param[out]    pDst  points to the N MDCT coefficients
+   */
+  void arm_mdct_f32(
+        arm_mdct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst);
+
+  /**
+   * @brief  Floating-point inverse MDCT of a frame with overlap-add.
+   * @param[in,out] S     points to an instance of the floating-point MDCT structure.
+   * @param[in]     pSrc  points to the N MDCT coefficients
+   * @param[out]    pDst  points to the N reconstructed samples
+   */
+  void arm_imdct_f32(
+        arm_mdct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst);
+
+  /**
+   * @brief  Q31 MDCT of a frame.
+   * @param[in,out] S     points to an instance of the Q31 MDCT structure.
+   * @param[in]     pSrc  points to the N new samples
+   * @param[out]    pDst  points to the N MDCT coefficients
+   */
+  void arm_mdct_q31(
+        arm_mdct_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst);
+
+  /**
+   * @brief  Q31 inverse MDCT of a frame with overlap-add.
+   * @param[in,out] S     points to an instance of the Q31 MDCT structure.
+   * @param[in]     pSrc  points to the N MDCT coefficients
+   * @param[out]    pDst  points to the N reconstructed samples
+   */
+  void arm_imdct_q31(
+        arm_mdct_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst);
+#endif /* !defined(ARM_MATH_NEON) */
+
   /**
    * @brief Instance structure for the Floating-point MFCC function.
    */
@@ -0,0 +1,499 @@
+/******************************************************************************
+ * @file     arm_atan2.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ARM_ATAN2_H_
+#define ARM_ATAN2_H_
+
+#include "arm_math_types.h"
+#include "dsp/fast_math_functions.h"
+#include "dsp/utils.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+
+atan for argument between in [0, 1.0]
+
+
+*/
+
+#define ATANHALFF32 0.463648f
+#define PIHALFF32 1.5707963267948966192313f
+
+#define ATAN2_NB_COEFS_F32 10
+
+static const float32_t atan2_coefs_f32[ATAN2_NB_COEFS_F32]={0.0f
+,1.0000001638308195518f
+,-0.0000228941363602264f
+,-0.3328086544578890873f
+,-0.004404814619311061f
+,0.2162217461808173258f
+,-0.0207504842057097504f
+,-0.1745263362250363339f
+,0.1340557235283553386f
+,-0.0323664125927477625f
+};
+
+__STATIC_FORCEINLINE float32_t arm_atan_limited_f32(float32_t x)
+{
+    float32_t res=atan2_coefs_f32[ATAN2_NB_COEFS_F32-1];
+    int i=1;
+    for(i=1;i<ATAN2_NB_COEFS_F32;i++)
+    {
+        res = x*res + atan2_coefs_f32[ATAN2_NB_COEFS_F32-1-i];
+    }
+
+
+    return(res);
+}
+
+__STATIC_FORCEINLINE float32_t arm_atan_f32(float32_t x)
+{
+   int sign=0;
+   float32_t res=0.0f;
+
+   if (x < 0.0f)
+   {
+      sign=1;
+      x=-x;
+   }
+
+   if (x > 1.0f)
+   {
+      x = 1.0f / x;
+      res = PIHALFF32 - arm_atan_limited_f32(x);
+   }
+   else
+   {
+     res += arm_atan_limited_f32(x);
+   }
+
+
+   if (sign)
+   {
+     res = -res;
+   }
+
+   return(res);
+}
+
+__STATIC_FORCEINLINE arm_status arm_atan2_core_f32(float32_t y,float32_t x,float32_t *result)
+{
+    if (x > 0.0f)
+    {
+        *result=arm_atan_f32(y/x);
+        return(ARM_MATH_SUCCESS);
+    }
+    if (x < 0.0f)
+    {
+        if (y > 0.0f)
+        {
+           *result=arm_atan_f32(y/x) + PI;
+        }
+        else if (y < 0.0f)
+        {
+           *result=arm_atan_f32(y/x) - PI;
+        }
+        else
+        {
+            if (signbit(y))
+            {
+               *result= -PI;
+            }
+            else
+            {
+               *result= PI;
+            }
+        }
+        return(ARM_MATH_SUCCESS);
+    }
+    if (x == 0.0f)
+    {
+        if (y > 0.0f)
+        {
+            *result=PIHALFF32;
+            return(ARM_MATH_SUCCESS);
+        }
+        if (y < 0.0f)
+        {
+            *result=-PIHALFF32;
+            return(ARM_MATH_SUCCESS);
+        }
+    }
+    
+
+    return(ARM_MATH_NANINF);
+
+}
+
+/*
+
+atan for argument between in [0, 1.0]
+
+*/
+
+
+/* Q2.29 */
+#define ATANHALF_Q29 0xed63383
+#define PIHALF_Q29 0x3243f6a9
+#define PIQ29 0x6487ed51
+
+#define ATAN2_NB_COEFS_Q31 13
+
+static const q31_t atan2_coefs_q31[ATAN2_NB_COEFS_Q31]={0x00000000
+,0x7ffffffe
+,0x000001b6
+,0xd555158e
+,0x00036463
+,0x1985f617
+,0x001992ae
+,0xeed53a7f
+,0xf8f15245
+,0x2215a3a4
+,0xe0fab004
+,0x0cdd4825
+,0xfddbc054
+};
+
+
+__STATIC_FORCEINLINE q31_t arm_atan_limited_q31(q31_t x)
+{
+    q63_t res=(q63_t)atan2_coefs_q31[ATAN2_NB_COEFS_Q31-1];
+    int i=1;
+    for(i=1;i<ATAN2_NB_COEFS_Q31;i++)
+    {
+        res = ((q63_t) x * res) >> 31U;
+        res = res + ((q63_t) atan2_coefs_q31[ATAN2_NB_COEFS_Q31-1-i]) ;
+    }
+
+    return(clip_q63_to_q31(res>>2));
+}
+
+
+__STATIC_FORCEINLINE q31_t arm_atan_q31(q31_t y,q31_t x)
+{
+   int sign=0;
+   q31_t res=0;
+
+   if (y<0)
+   {
+    /* Negate y */
+#if defined (ARM_MATH_DSP)
+    y = __QSUB(0, y);
+#else
+    y = (y == INT32_MIN) ? INT32_MAX : -y;
+#endif
+
+     sign=1-sign;
+   }
+
+   if (x < 0)
+   {
+      sign=1 - sign;
+
+    /* Negate x */
+#if defined (ARM_MATH_DSP)
+    x = __QSUB(0, x);
+#else
+    x = (x == INT32_MIN) ? INT32_MAX : -x;
+#endif
+   }
+
+   if (y > x)
+   {
+    q31_t ratio;
+    int16_t shift;
+
+    arm_divide_q31(x,y,&ratio,&shift);
+
+    /* Shift ratio by shift */
+    if (shift >= 0)
+    {
+         ratio = clip_q63_to_q31((q63_t) ratio << shift);
+    }
+    else
+    {
+         ratio = (ratio >> -shift);
+    }
+   
+    res = PIHALF_Q29 - arm_atan_limited_q31(ratio);
+      
+   }
+   else
+   {
+    q31_t ratio;
+    int16_t shift;
+
+    arm_divide_q31(y,x,&ratio,&shift);
+
+    /* Shift ratio by shift */
+    if (shift >= 0)
+    {
+         ratio = clip_q63_to_q31((q63_t) ratio << shift);
+    }
+    else
+    {
+         ratio = (ratio >> -shift);
+    }
+   
+
+    res = arm_atan_limited_q31(ratio);
+
+   }
+
+
+   if (sign)
+   {
+     /* Negate res */
+#if defined (ARM_MATH_DSP)
+     res = __QSUB(0, res);
+#else
+     res = (res == INT32_MIN) ? INT32_MAX : -res;
+#endif
+   }
+
+   return(res);
+}
+
+__STATIC_FORCEINLINE arm_status arm_atan2_core_q31(q31_t y,q31_t x,q31_t *result)
+{
+    if (x > 0)
+    {
+        *result=arm_atan_q31(y,x);
+        return(ARM_MATH_SUCCESS);
+    }
+    if (x < 0)
+    {
+        if (y > 0)
+        {
+           *result=arm_atan_q31(y,x) + PIQ29;
+        }
+        else if (y < 0)
+        {
+           *result=arm_atan_q31(y,x) - PIQ29;
+        }
+        else
+        {
+           *result= PIQ29;
+        }
+        return(ARM_MATH_SUCCESS);
+    }
+    if (x == 0)
+    {
+        if (y > 0)
+        {
+            *result=PIHALF_Q29;
+            return(ARM_MATH_SUCCESS);
+        }
+        if (y < 0)
+        {
+            *result=-PIHALF_Q29;
+            return(ARM_MATH_SUCCESS);
+        }
+    }
+    
+
+    return(ARM_MATH_NANINF);
+
+}
+
+/*
+
+atan for argument between in [0, 1.0]
+
+*/
+
+
+/* Q2.13 */
+#define ATANHALFQ13 0xed6
+#define PIHALFQ13 0x3244
+#define PIQ13 0x6488
+
+#define ATAN2_NB_COEFS_Q15 10
+
+static const q15_t atan2_coefs_q15[ATAN2_NB_COEFS_Q15]={
+     0, // 0x0000
+ 32767, // 0x7fff
+    -1, // 0xffff
+-10905, // 0xd567
+  -144, // 0xff70
+  7085, // 0x1bad
+  -680, // 0xfd58
+ -5719, // 0xe9a9
+  4393, // 0x1129
+ -1061  // 0xfbdb
+};
+
+__STATIC_FORCEINLINE q15_t arm_atan_limited_q15(q15_t x)
+{
+    q31_t res=(q31_t)atan2_coefs_q15[ATAN2_NB_COEFS_Q15-1];
+    int i=1;
+    for(i=1;i<ATAN2_NB_COEFS_Q15;i++)
+    {
+        res = ((q31_t) x * res) >> 15U;
+        res = res + ((q31_t) atan2_coefs_q15[ATAN2_NB_COEFS_Q15-1-i]) ;
+    }
+
+    res = __SSAT(res>>2,16);
+
+    
+    return(res);
+}
+
+
+__STATIC_FORCEINLINE q15_t arm_atan_q15(q15_t y,q15_t x)
+{
+   int sign=0;
+   q15_t res=0;
+
+   if (y<0)
+   {
+     /* Negate y */
+#if defined (ARM_MATH_DSP)
+     y = __QSUB16(0, y);
+#else 
+     y = (y == (q15_t) 0x8000) ? (q15_t) 0x7fff : -y;
+#endif
+
+     sign=1-sign;
+   }
+
+   if (x < 0)
+   {
+      sign=1 - sign;
+     
+      /* Negate x */
+#if defined (ARM_MATH_DSP)
+     x = __QSUB16(0, x);
+#else 
+     x = (x == (q15_t) 0x8000) ? (q15_t) 0x7fff : -x;
+#endif
+   }
+
+   if (y > x)
+   {
+    q15_t ratio;
+    int16_t shift;
+
+    arm_divide_q15(x,y,&ratio,&shift);
+
+    /* Shift ratio by shift */
+    if (shift >=0)
+    {
+       ratio = __SSAT(((q31_t) ratio << shift), 16);
+    }
+    else
+    {
+       ratio = (ratio >> -shift);
+    }
+   
+    res = PIHALFQ13 - arm_atan_limited_q15(ratio);
+      
+   }
+   else
+   {
+    q15_t ratio;
+    int16_t shift;
+
+    arm_divide_q15(y,x,&ratio,&shift);
+
+    /* Shift ratio by shift */
+    if (shift >=0)
+    {
+       ratio = __SSAT(((q31_t) ratio << shift), 16);
+    }
+    else
+    {
+       ratio = (ratio >> -shift);
+    }
+   
+
+    res = arm_atan_limited_q15(ratio);
+
+   }
+
+
+   if (sign)
+   {
+     /* Negate res */
+#if defined (ARM_MATH_DSP)
+     res = __QSUB16(0, res);
+#else 
+     res = (res == (q15_t) 0x8000) ? (q15_t) 0x7fff : -res;
+#endif
+   }
+
+   return(res);
+}
+
+__STATIC_FORCEINLINE arm_status arm_atan2_core_q15(q15_t y,q15_t x,q15_t *result)
+{
+    if (x > 0)
+    {
+        *result=arm_atan_q15(y,x);
+        return(ARM_MATH_SUCCESS);
+    }
+    if (x < 0)
+    {
+        if (y > 0)
+        {
+           *result=arm_atan_q15(y,x) + PIQ13;
+        }
+        else if (y < 0)
+        {
+           *result=arm_atan_q15(y,x) - PIQ13;
+        }
+        else
+        {
+            *result= PIQ13;
+        }
+        return(ARM_MATH_SUCCESS);
+    }
+    if (x == 0)
+    {
+        if (y > 0)
+        {
+            *result=PIHALFQ13;
+            return(ARM_MATH_SUCCESS);
+        }
+        if (y < 0)
+        {
+            *result=-PIHALFQ13;
+            return(ARM_MATH_SUCCESS);
+        }
+    }
+    
+
+    return(ARM_MATH_NANINF);
+
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_ATAN2_H_ */
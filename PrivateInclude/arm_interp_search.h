@@ -0,0 +1,134 @@
+/******************************************************************************
+ * @file     arm_interp_search.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef ARM_INTERP_SEARCH_H_
+#define ARM_INTERP_SEARCH_H_
+
+#include "arm_math_types.h"
+#include "dsp/interpolation_functions.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+
+Interval search in a table of increasing x values.
+
+Interval i is [x(i), x(i+1)]. A value equal to x(i+1) belongs to interval i.
+The values below x(0) belong to the first interval and the values above
+the last x value belong to the last one.
+
+*/
+
+/**
+  @brief         Search of the interval of a value
+  @param[in]     x     x values in increasing order
+  @param[in]     lo    first candidate interval
+  @param[in]     hi    last candidate interval
+  @param[in]     xq    value
+  @return        first interval i in [lo, hi] such that xq <= x(i+1), or hi when there is none
+
+  @par           The search is exponential from lo and then binary so that
+                 the cost is logarithmic in the distance to lo.
+ */
+__STATIC_FORCEINLINE int32_t arm_interp_interval_f32(
+  const float32_t * x,
+        int32_t lo,
+        int32_t hi,
+        float32_t xq)
+{
+    int32_t top = lo;
+    int32_t step = 1;
+    int32_t mid;
+
+    /* Exponential search */
+    while ((top < hi) && (xq > x[top + 1]))
+    {
+        lo = top + 1;
+        top = lo + step;
+        top = (top < hi) ? top : hi;
+        step <<= 1;
+    }
+
+    /* Binary search in [lo, top] */
+    while (lo < top)
+    {
+        mid = lo + ((top - lo) >> 1);
+        if (xq > x[mid + 1])
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            top = mid;
+        }
+    }
+
+    return (lo);
+}
+
+/**
+  @brief         Bucket of a value in an interval index
+  @param[in]     S     points to an instance of the interval index
+  @param[in]     xq    value
+  @return        bucket in [0, numBuckets-1]
+ */
+__STATIC_FORCEINLINE int32_t arm_interp_index_bucket_f32(
+  const arm_interp_index_instance_f32 * S,
+        float32_t xq)
+{
+    float32_t pos = (xq - S->x[0]) * S->invBucketWidth;
+    const float32_t last = (float32_t) (S->numBuckets - 1U);
+
+    /* The comparisons are written so that a value which is not a number goes to bucket 0 */
+    pos = (pos > 0.0f) ? pos : 0.0f;
+    pos = (pos < last) ? pos : last;
+
+    return ((int32_t) pos);
+}
+
+/**
+  @brief         Interval of a value using an interval index
+  @param[in]     S     points to an instance of the interval index
+  @param[in]     xq    value
+  @return        interval of xq
+ */
+__STATIC_FORCEINLINE int32_t arm_interp_index_lookup_f32(
+  const arm_interp_index_instance_f32 * S,
+        float32_t xq)
+{
+    int32_t k = arm_interp_index_bucket_f32(S, xq);
+
+    /* The interval is between the first intervals of the bucket and of the next one */
+    return (arm_interp_interval_f32(S->x, (int32_t) S->pBuckets[k], (int32_t) S->pBuckets[k + 1], xq));
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_INTERP_SEARCH_H_ */
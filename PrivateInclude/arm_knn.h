@@ -0,0 +1,142 @@
+/******************************************************************************
+ * @file     arm_knn.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef ARM_KNN_H_
+#define ARM_KNN_H_
+
+#include "arm_math_types.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+
+Selection of the k nearest neighbours of a query.
+
+The k best candidates are kept in a max-heap in the output
+buffers of the query. The candidates are ordered by distance
+and then by index so that the result does not depend on the
+order in which the candidates are inserted.
+
+ARM_KNN_DEFINE_HEAP(SUFFIX,T,C) defines for the distance type T:
+
+- arm_knn_sift_down_SUFFIX : restore the heap property from a position
+- arm_knn_push_SUFFIX      : insert the candidate r of distance d
+                             (the candidates must be pushed with r = 0,1,2 ...)
+- arm_knn_sort_SUFFIX      : sort the heap by increasing distance
+
+C is the type used for the comparisons (_Float16 for float16_t).
+
+*/
+
+#define ARM_KNN_GREATER(C,D,I,A,B) \
+  (((C)(D)[(A)] > (C)(D)[(B)]) || (((C)(D)[(A)] == (C)(D)[(B)]) && ((I)[(A)] > (I)[(B)])))
+
+#define ARM_KNN_DEFINE_HEAP(SUFFIX,T,C)                                      \
+__STATIC_FORCEINLINE void arm_knn_sift_down_##SUFFIX(T *pDist,               \
+                                                     uint32_t *pIdx,         \
+                                                     uint32_t pos,           \
+                                                     uint32_t size)          \
+{                                                                            \
+    uint32_t child;                                                          \
+    T d;                                                                     \
+    uint32_t i;                                                              \
+                                                                             \
+    while ((child = 2U * pos + 1U) < size)                                   \
+    {                                                                        \
+        if ((child + 1U < size) &&                                           \
+            ARM_KNN_GREATER(C, pDist, pIdx, child + 1U, child))              \
+        {                                                                    \
+            child++;                                                         \
+        }                                                                    \
+        if (!ARM_KNN_GREATER(C, pDist, pIdx, child, pos))                    \
+        {                                                                    \
+            break;                                                           \
+        }                                                                    \
+        d = pDist[pos];                                                      \
+        pDist[pos] = pDist[child];                                           \
+        pDist[child] = d;                                                    \
+        i = pIdx[pos];                                                       \
+        pIdx[pos] = pIdx[child];                                             \
+        pIdx[child] = i;                                                     \
+        pos = child;                                                         \
+    }                                                                        \
+}                                                                            \
+                                                                             \
+__STATIC_FORCEINLINE void arm_knn_push_##SUFFIX(T *pDist,                    \
+                                                uint32_t *pIdx,              \
+                                                uint32_t k,                  \
+                                                uint32_t r,                  \
+                                                T d)                         \
+{                                                                            \
+    uint32_t i;                                                              \
+                                                                             \
+    if (r < k)                                                               \
+    {                                                                        \
+        pDist[r] = d;                                                        \
+        pIdx[r] = r;                                                         \
+        if (r == k - 1U)                                                     \
+        {                                                                    \
+            for (i = k / 2U; i > 0U; i--)                                    \
+            {                                                                \
+                arm_knn_sift_down_##SUFFIX(pDist, pIdx, i - 1U, k);          \
+            }                                                                \
+        }                                                                    \
+    }                                                                        \
+    else if ((C)d < (C)pDist[0])                                             \
+    {                                                                        \
+        /* Replace the worst candidate */                                    \
+        pDist[0] = d;                                                        \
+        pIdx[0] = r;                                                         \
+        arm_knn_sift_down_##SUFFIX(pDist, pIdx, 0, k);                       \
+    }                                                                        \
+}                                                                            \
+                                                                             \
+__STATIC_FORCEINLINE void arm_knn_sort_##SUFFIX(T *pDist,                    \
+                                                uint32_t *pIdx,              \
+                                                uint32_t k)                  \
+{                                                                            \
+    T d;                                                                     \
+    uint32_t i, idx;                                                         \
+                                                                             \
+    for (i = k - 1U; i > 0U; i--)                                            \
+    {                                                                        \
+        d = pDist[0];                                                        \
+        pDist[0] = pDist[i];                                                 \
+        pDist[i] = d;                                                        \
+        idx = pIdx[0];                                                       \
+        pIdx[0] = pIdx[i];                                                   \
+        pIdx[i] = idx;                                                       \
+        arm_knn_sift_down_##SUFFIX(pDist, pIdx, 0, i);                       \
+    }                                                                        \
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_KNN_H_ */
@@ -0,0 +1,302 @@
+/******************************************************************************
+ * @file     arm_mat_batch.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ARM_MAT_BATCH_H_
+#define ARM_MAT_BATCH_H_
+
+#include "dsp/matrix_functions.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+
+The batched solvers process ARM_MAT_BATCH_LANES matrices at a time.
+The matrices are copied into local buffers where the element (i,j)
+of the lane l is at a[(i * n + j) * ARM_MAT_BATCH_LANES + l] so that
+all the loops on the lanes are contiguous and can be vectorized.
+
+The pivoting is done without branches: the pivot row is exchanged
+with each row below it whose element is bigger, lane by lane.
+At the end, the pivot row contains the biggest element of the column
+like with the usual partial pivoting.
+
+The kernels are force inlined and called with constant dimensions
+so that the compiler can unroll the loops on the rows and columns.
+
+A matrix is singular when a pivot is below n * ARM_MAT_BATCH_EPS_F32
+times its biggest element. A test of the pivot against 0 is not reliable
+because the vectorized reciprocals may be approximated (-ffast-math).
+
+*/
+#define ARM_MAT_BATCH_LANES 4
+#define ARM_MAT_BATCH_EPS_F32 1.1920929e-7f
+
+/**
+  @brief         Load a chunk of lanes of a batch of matrices
+  @param[in]     pSrc       points to the first element of the first lane of the chunk
+  @param[in]     batchSize  number of matrices in the batch
+  @param[in]     nbElems    number of elements of each matrix
+  @param[in]     nbLanes    number of valid lanes in the chunk
+  @param[out]    pDst       points to the local buffer
+ */
+__STATIC_FORCEINLINE void arm_mat_batch_load_f32(
+  const float32_t * pSrc,
+  uint32_t batchSize,
+  int nbElems,
+  int nbLanes,
+  float32_t * pDst)
+{
+    int e, l;
+
+    for (e = 0; e < nbElems; e++)
+    {
+        for (l = 0; l < nbLanes; l++)
+        {
+            pDst[e * ARM_MAT_BATCH_LANES + l] = pSrc[(uint32_t) e * batchSize + l];
+        }
+    }
+}
+
+/**
+  @brief         Store a chunk of lanes of a batch of matrices
+  @param[in]     pSrc       points to the local buffer
+  @param[in]     batchSize  number of matrices in the batch
+  @param[in]     nbElems    number of elements of each matrix
+  @param[in]     nbLanes    number of valid lanes in the chunk
+  @param[out]    pDst       points to the first element of the first lane of the chunk
+ */
+__STATIC_FORCEINLINE void arm_mat_batch_store_f32(
+  const float32_t * pSrc,
+  uint32_t batchSize,
+  int nbElems,
+  int nbLanes,
+  float32_t * pDst)
+{
+    int e, l;
+
+    for (e = 0; e < nbElems; e++)
+    {
+        for (l = 0; l < nbLanes; l++)
+        {
+            pDst[(uint32_t) e * batchSize + l] = pSrc[e * ARM_MAT_BATCH_LANES + l];
+        }
+    }
+}
+
+/**
+  @brief         Gauss-Jordan elimination of ARM_MAT_BATCH_LANES systems A X = B
+  @param[in]     n     dimension of the matrices A
+  @param[in]     m     number of columns of the matrices B
+  @param[in,out] pA    points to the matrices A. They are destroyed.
+  @param[in,out] pX    points to the matrices B. They are replaced by X.
+  @return        1 if one of the matrices A is singular and 0 otherwise
+ */
+__STATIC_FORCEINLINE int arm_mat_batch_gauss_jordan_f32(
+  const int n,
+  const int m,
+  float32_t * pA,
+  float32_t * pX)
+{
+    const int L = ARM_MAT_BATCH_LANES;
+    float32_t pivot[ARM_MAT_BATCH_LANES];
+    float32_t threshold[ARM_MAT_BATCH_LANES];
+    int swap[ARM_MAT_BATCH_LANES];
+    float32_t t, u, f;
+    int singular = 0;
+    int c, r, j, l;
+
+    /* Singularity threshold of each lane */
+    for (l = 0; l < L; l++)
+    {
+        threshold[l] = 0.0f;
+    }
+    for (j = 0; j < n * n; j++)
+    {
+        for (l = 0; l < L; l++)
+        {
+            t = fabsf(pA[j * L + l]);
+            threshold[l] = (t > threshold[l]) ? t : threshold[l];
+        }
+    }
+    for (l = 0; l < L; l++)
+    {
+        threshold[l] *= (float32_t) n * ARM_MAT_BATCH_EPS_F32;
+    }
+
+    for (c = 0; c < n; c++)
+    {
+        /* Partial pivoting */
+        for (r = c + 1; r < n; r++)
+        {
+            for (l = 0; l < L; l++)
+            {
+                swap[l] = fabsf(pA[(r * n + c) * L + l]) > fabsf(pA[(c * n + c) * L + l]);
+            }
+            for (j = c; j < n; j++)
+            {
+                for (l = 0; l < L; l++)
+                {
+                    t = pA[(c * n + j) * L + l];
+                    u = pA[(r * n + j) * L + l];
+                    pA[(c * n + j) * L + l] = swap[l] ? u : t;
+                    pA[(r * n + j) * L + l] = swap[l] ? t : u;
+                }
+            }
+            for (j = 0; j < m; j++)
+            {
+                for (l = 0; l < L; l++)
+                {
+                    t = pX[(c * m + j) * L + l];
+                    u = pX[(r * m + j) * L + l];
+                    pX[(c * m + j) * L + l] = swap[l] ? u : t;
+                    pX[(r * m + j) * L + l] = swap[l] ? t : u;
+                }
+            }
+        }
+
+        /* Normalization of the pivot row */
+        for (l = 0; l < L; l++)
+        {
+            singular |= (fabsf(pA[(c * n + c) * L + l]) <= threshold[l]);
+            pivot[l] = 1.0f / pA[(c * n + c) * L + l];
+        }
+        for (j = c + 1; j < n; j++)
+        {
+            for (l = 0; l < L; l++)
+            {
+                pA[(c * n + j) * L + l] *= pivot[l];
+            }
+        }
+        for (j = 0; j < m; j++)
+        {
+            for (l = 0; l < L; l++)
+            {
+                pX[(c * m + j) * L + l] *= pivot[l];
+            }
+        }
+
+        /* Elimination of the column in the other rows */
+        for (r = 0; r < n; r++)
+        {
+            if (r == c)
+            {
+                continue;
+            }
+            for (l = 0; l < L; l++)
+            {
+                pivot[l] = pA[(r * n + c) * L + l];
+            }
+            for (j = c + 1; j < n; j++)
+            {
+                for (l = 0; l < L; l++)
+                {
+                    f = pivot[l];
+                    pA[(r * n + j) * L + l] -= f * pA[(c * n + j) * L + l];
+                }
+            }
+            for (j = 0; j < m; j++)
+            {
+                for (l = 0; l < L; l++)
+                {
+                    f = pivot[l];
+                    pX[(r * m + j) * L + l] -= f * pX[(c * m + j) * L + l];
+                }
+            }
+        }
+    }
+
+    return (singular);
+}
+
+/**
+  @brief         Solve A X = B for a batch of matrices
+  @param[in]     n          dimension of the matrices A
+  @param[in]     m          number of columns of the matrices B
+  @param[in]     pA         points to the batch of matrices A
+  @param[in]     pB         points to the batch of matrices B (NULL for the identity)
+  @param[out]    pX         points to the batch of solutions
+  @param[in]     batchSize  number of matrices in the batch
+  @return        1 if one of the matrices A is singular and 0 otherwise
+
+  @par           The lanes which are not used in the last chunk are
+                 filled with identity matrices.
+ */
+__STATIC_FORCEINLINE int arm_mat_batch_solve_kernel_f32(
+  const int n,
+  const int m,
+  const float32_t * pA,
+  const float32_t * pB,
+  float32_t * pX,
+  uint32_t batchSize)
+{
+    float32_t a[ARM_MAT_BATCH_MAX_DIM * ARM_MAT_BATCH_MAX_DIM * ARM_MAT_BATCH_LANES];
+    float32_t x[ARM_MAT_BATCH_MAX_DIM * ARM_MAT_BATCH_MAX_DIM * ARM_MAT_BATCH_LANES];
+    uint32_t k;
+    int nbLanes, i, j, l;
+    int singular = 0;
+
+    for (k = 0; k < batchSize; k += ARM_MAT_BATCH_LANES)
+    {
+        nbLanes = (batchSize - k < ARM_MAT_BATCH_LANES) ? (int) (batchSize - k) : ARM_MAT_BATCH_LANES;
+
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                for (l = 0; l < ARM_MAT_BATCH_LANES; l++)
+                {
+                    a[(i * n + j) * ARM_MAT_BATCH_LANES + l] = (i == j) ? 1.0f : 0.0f;
+                }
+            }
+            for (j = 0; j < m; j++)
+            {
+                for (l = 0; l < ARM_MAT_BATCH_LANES; l++)
+                {
+                    x[(i * m + j) * ARM_MAT_BATCH_LANES + l] = (pB == NULL) && (i == j) ? 1.0f : 0.0f;
+                }
+            }
+        }
+
+        arm_mat_batch_load_f32(pA + k, batchSize, n * n, nbLanes, a);
+        if (pB != NULL)
+        {
+            arm_mat_batch_load_f32(pB + k, batchSize, n * m, nbLanes, x);
+        }
+
+        singular |= arm_mat_batch_gauss_jordan_f32(n, m, a, x);
+
+        arm_mat_batch_store_f32(x, batchSize, n * m, nbLanes, pX + k);
+    }
+
+    return (singular);
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_MAT_BATCH_H_ */
@@ -0,0 +1,469 @@
+/******************************************************************************
+ * @file     arm_sincos.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ARM_SINCOS_H_
+#define ARM_SINCOS_H_
+
+#include "arm_math_types.h"
+#include "arm_common_tables.h"
+#include "dsp/none.h"
+
+#if (defined(ARM_MATH_MVEF) || defined(ARM_MATH_MVEI) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_helium_utils.h"
+#endif
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+
+The angle x in radians is reduced to r in [-pi/4, pi/4] with
+x = q * pi/2 + r. pi/2 is split in 3 parts so that q * part is exact for the
+first ones. sin(r) and cos(r) are approximated with minimax polynomials
+and the quadrant q selects and negates them.
+
+The absolute error is below 1e-7 for |x| < 8192.
+
+Fixed-point angles are reduced exactly with integer arithmetic.
+For the Q31 functions, r is scaled to t in [-1, 1] with r = t * pi/4 and
+sin(r) = t * S(t^2), cos(r) = 1 + t^2 * C(t^2) are evaluated with
+Q31 rounding multiplications only. The absolute error is below 4 LSB.
+The Q31 angles can also be reduced for the floating-point polynomial.
+
+The phase functions take a 32-bit phase where 2^32 is a full turn
+and interpolate the sine tables used by arm_sin_q31 and arm_sin_q15.
+
+*/
+#define ARM_SINCOS_2_PI_F32    0.636619772367581f
+#define ARM_SINCOS_PIO2_F32    1.570796326794897f
+#define ARM_SINCOS_PIO2_1_F32  1.5703125f
+#define ARM_SINCOS_PIO2_2_F32  4.837512969970703125e-4f
+#define ARM_SINCOS_PIO2_3_F32  7.54978995489188216e-8f
+
+#define ARM_SINCOS_S1_F32     -1.6666654611e-1f
+#define ARM_SINCOS_S2_F32      8.3321608736e-3f
+#define ARM_SINCOS_S3_F32     -1.9515295891e-4f
+
+#define ARM_SINCOS_C1_F32      4.166664568298827e-2f
+#define ARM_SINCOS_C2_F32     -1.388731625493765e-3f
+#define ARM_SINCOS_C3_F32      2.443315711809948e-5f
+
+#define ARM_SINCOS_S0_Q31      1686629713
+#define ARM_SINCOS_S1_Q31      -173399666
+#define ARM_SINCOS_S2_Q31         5348077
+#define ARM_SINCOS_S3_Q31          -78537
+#define ARM_SINCOS_S4_Q31             663
+
+#define ARM_SINCOS_C0_Q31      -662337939
+#define ARM_SINCOS_C1_Q31        34046945
+#define ARM_SINCOS_C2_Q31         -700062
+#define ARM_SINCOS_C3_Q31            7711
+#define ARM_SINCOS_C4_Q31             -52
+
+/**
+  @brief         Sine and cosine of q * pi/2 + r
+  @param[in]     r     reduced angle in [-pi/4, pi/4]
+  @param[in]     q     quadrant
+  @param[out]    pSin  sine of the angle
+  @param[out]    pCos  cosine of the angle
+ */
+__STATIC_FORCEINLINE void arm_sincos_quadrant_f32(
+  float32_t r,
+  int32_t q,
+  float32_t * pSin,
+  float32_t * pCos)
+{
+    float32_t z, s, c, temp;
+
+    z = r * r;
+
+    s = r + r * z * (ARM_SINCOS_S1_F32 + z * (ARM_SINCOS_S2_F32 + z * ARM_SINCOS_S3_F32));
+    c = 1.0f - 0.5f * z + z * z * (ARM_SINCOS_C1_F32 + z * (ARM_SINCOS_C2_F32 + z * ARM_SINCOS_C3_F32));
+
+    if (q & 1)
+    {
+        temp = s;
+        s = c;
+        c = temp;
+    }
+    if (q & 2)
+    {
+        s = -s;
+    }
+    if ((q + 1) & 2)
+    {
+        c = -c;
+    }
+
+    *pSin = s;
+    *pCos = c;
+}
+
+/**
+  @brief         Sine and cosine of an angle in radians
+  @param[in]     x     angle in radians
+  @param[out]    pSin  sine of x
+  @param[out]    pCos  cosine of x
+ */
+__STATIC_FORCEINLINE void arm_sincos_core_f32(
+  float32_t x,
+  float32_t * pSin,
+  float32_t * pCos)
+{
+    float32_t qf, r;
+    int32_t q;
+
+    /* Nearest multiple of pi/2 */
+    qf = x * ARM_SINCOS_2_PI_F32;
+    q = (int32_t) ((qf >= 0.0f) ? (qf + 0.5f) : (qf - 0.5f));
+    qf = (float32_t) q;
+
+    r = x - qf * ARM_SINCOS_PIO2_1_F32;
+    r = r - qf * ARM_SINCOS_PIO2_2_F32;
+    r = r - qf * ARM_SINCOS_PIO2_3_F32;
+
+    arm_sincos_quadrant_f32(r, q, pSin, pCos);
+}
+
+/**
+  @brief         Floating-point sine and cosine of a Q31 angle
+  @param[in]     x     angle scaled like in arm_sin_q31 (2^31 is 2*pi)
+  @param[out]    pSin  sine of x
+  @param[out]    pCos  cosine of x
+ */
+__STATIC_FORCEINLINE void arm_sincos_core_q31_f32(
+  q31_t x,
+  float32_t * pSin,
+  float32_t * pCos)
+{
+    int32_t q, r;
+
+    /* Nearest multiple of pi/2 (2^29). The computation is done modulo 2^32
+       which is a multiple of the period. */
+    q = ((int32_t) ((uint32_t) x + 0x10000000U)) >> 29;
+    r = (int32_t) ((uint32_t) x - ((uint32_t) q << 29));
+
+    arm_sincos_quadrant_f32((float32_t) r * (ARM_SINCOS_PIO2_F32 / 536870912.0f), q, pSin, pCos);
+}
+
+/**
+  @brief         Q31 multiplication rounded like vqrdmulhq
+  @param[in]     a  first operand
+  @param[in]     b  second operand
+  @return        a * b saturated to Q31
+ */
+__STATIC_FORCEINLINE q31_t arm_sincos_mul_q31(
+  q31_t a,
+  q31_t b)
+{
+    return (clip_q63_to_q31(((q63_t) a * b + 0x40000000) >> 31));
+}
+
+/**
+  @brief         Q31 sine and cosine of a Q31 angle
+  @param[in]     x     angle scaled like in arm_sin_q31 (2^31 is 2*pi)
+  @param[out]    pSin  sine of x
+  @param[out]    pCos  cosine of x
+ */
+__STATIC_FORCEINLINE void arm_sincos_core_q31(
+  q31_t x,
+  q31_t * pSin,
+  q31_t * pCos)
+{
+    int32_t q, r;
+    q31_t t, z, p, s, c;
+
+    /* Nearest multiple of pi/2 (2^29). The computation is done modulo 2^32
+       which is a multiple of the period. */
+    q = ((int32_t) ((uint32_t) x + 0x10000000U)) >> 29;
+    r = (int32_t) ((uint32_t) x - ((uint32_t) q << 29));
+
+    /* r is in [-pi/4, pi/4[ and t = r / (pi/4) is in [-1, 1[ */
+    t = (q31_t) ((uint32_t) r << 3);
+    z = arm_sincos_mul_q31(t, t);
+
+    p = ARM_SINCOS_S3_Q31 + arm_sincos_mul_q31(z, ARM_SINCOS_S4_Q31);
+    p = ARM_SINCOS_S2_Q31 + arm_sincos_mul_q31(z, p);
+    p = ARM_SINCOS_S1_Q31 + arm_sincos_mul_q31(z, p);
+    p = ARM_SINCOS_S0_Q31 + arm_sincos_mul_q31(z, p);
+    s = arm_sincos_mul_q31(t, p);
+
+    p = ARM_SINCOS_C3_Q31 + arm_sincos_mul_q31(z, ARM_SINCOS_C4_Q31);
+    p = ARM_SINCOS_C2_Q31 + arm_sincos_mul_q31(z, p);
+    p = ARM_SINCOS_C1_Q31 + arm_sincos_mul_q31(z, p);
+    p = ARM_SINCOS_C0_Q31 + arm_sincos_mul_q31(z, p);
+
+    /* 1 + z * C(z) saturated to Q31 */
+    c = clip_q63_to_q31((q63_t) arm_sincos_mul_q31(z, p) + 0x80000000LL);
+
+    if (q & 1)
+    {
+        p = s;
+        s = c;
+        c = p;
+    }
+    if (q & 2)
+    {
+        s = -s;
+    }
+    if ((q + 1) & 2)
+    {
+        c = -c;
+    }
+
+    *pSin = s;
+    *pCos = c;
+}
+
+/**
+  @brief         Q15 sine and cosine of a Q15 angle
+  @param[in]     x     angle scaled like in arm_sin_q15 (2^15 is 2*pi)
+  @param[out]    pSin  sine of x
+  @param[out]    pCos  cosine of x
+ */
+__STATIC_FORCEINLINE void arm_sincos_core_q15(
+  q15_t x,
+  q15_t * pSin,
+  q15_t * pCos)
+{
+    q31_t s, c;
+
+    arm_sincos_core_q31((q31_t) x << 16, &s, &c);
+
+    /* Rounded and saturated like vqrshrnbq_n_s32 */
+    *pSin = (q15_t) __SSAT((q31_t) (((q63_t) s + 0x8000) >> 16), 16);
+    *pCos = (q15_t) __SSAT((q31_t) (((q63_t) c + 0x8000) >> 16), 16);
+}
+
+/**
+  @brief         Q31 sine and cosine of a 32-bit phase
+  @param[in]     phase  phase (2^32 is 2*pi)
+  @param[out]    pSin   sine of the phase
+  @param[out]    pCos   cosine of the phase
+ */
+__STATIC_FORCEINLINE void arm_sincos_phase_q31(
+  uint32_t phase,
+  q31_t * pSin,
+  q31_t * pCos)
+{
+    uint32_t index;
+    q31_t fract, a, b, val;
+
+    /* Sine */
+    index = phase >> 23;
+    fract = (q31_t) ((phase & 0x7FFFFFU) << 8);
+    a = sinTable_q31[index];
+    b = sinTable_q31[index + 1];
+    val = (q63_t) (0x80000000 - fract) * a >> 32;
+    val = (q31_t) ((((q63_t) val << 32) + ((q63_t) fract * b)) >> 32);
+    *pSin = val << 1;
+
+    /* Cosine is the sine a quarter of turn later */
+    phase += 0x40000000U;
+    index = phase >> 23;
+    a = sinTable_q31[index];
+    b = sinTable_q31[index + 1];
+    val = (q63_t) (0x80000000 - fract) * a >> 32;
+    val = (q31_t) ((((q63_t) val << 32) + ((q63_t) fract * b)) >> 32);
+    *pCos = val << 1;
+}
+
+/**
+  @brief         Q15 sine and cosine of a 32-bit phase
+  @param[in]     phase  phase (2^32 is 2*pi)
+  @param[out]    pSin   sine of the phase
+  @param[out]    pCos   cosine of the phase
+ */
+__STATIC_FORCEINLINE void arm_sincos_phase_q15(
+  uint32_t phase,
+  q15_t * pSin,
+  q15_t * pCos)
+{
+    uint32_t index;
+    q15_t fract, a, b;
+    q31_t val;
+
+    /* Sine */
+    index = phase >> 23;
+    fract = (q15_t) ((phase >> 8) & 0x7FFFU);
+    a = sinTable_q15[index];
+    b = sinTable_q15[index + 1];
+    val = (q31_t) (0x8000 - fract) * a >> 16;
+    val = (q15_t) ((((q31_t) val << 16) + ((q31_t) fract * b)) >> 16);
+    *pSin = (q15_t) (val << 1);
+
+    /* Cosine is the sine a quarter of turn later */
+    index = (phase + 0x40000000U) >> 23;
+    a = sinTable_q15[index];
+    b = sinTable_q15[index + 1];
+    val = (q31_t) (0x8000 - fract) * a >> 16;
+    val = (q15_t) ((((q31_t) val << 16) + ((q31_t) fract * b)) >> 16);
+    *pCos = (q15_t) (val << 1);
+}
+
+#if (defined(ARM_MATH_MVEF) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+/**
+  @brief         Sine and cosine of q * pi/2 + r for 4 angles
+  @param[in]     r     reduced angles in [-pi/4, pi/4]
+  @param[in]     q     quadrants
+  @param[out]    pSin  sines of the angles
+  @param[out]    pCos  cosines of the angles
+ */
+__STATIC_INLINE void vsincosq_quadrant_f32(
+  f32x4_t r,
+  int32x4_t q,
+  f32x4_t * pSin,
+  f32x4_t * pCos)
+{
+    f32x4_t z, s, c, ps, pc;
+    mve_pred16_t p0;
+
+    z = vmulq(r, r);
+
+    ps = vfmaq(vdupq_n_f32(ARM_SINCOS_S2_F32), z, vdupq_n_f32(ARM_SINCOS_S3_F32));
+    ps = vfmaq(vdupq_n_f32(ARM_SINCOS_S1_F32), z, ps);
+    s = vfmaq(r, vmulq(r, z), ps);
+
+    pc = vfmaq(vdupq_n_f32(ARM_SINCOS_C2_F32), z, vdupq_n_f32(ARM_SINCOS_C3_F32));
+    pc = vfmaq(vdupq_n_f32(ARM_SINCOS_C1_F32), z, pc);
+    c = vfmaq(vfmsq(vdupq_n_f32(1.0f), z, vdupq_n_f32(0.5f)), vmulq(z, z), pc);
+
+    /* Odd quadrants : sine and cosine are swapped */
+    p0 = vcmpneq_n_s32(vandq_s32(q, vdupq_n_s32(1)), 0);
+    ps = vpselq(c, s, p0);
+    pc = vpselq(s, c, p0);
+
+    p0 = vcmpneq_n_s32(vandq_s32(q, vdupq_n_s32(2)), 0);
+    *pSin = vnegq_m(ps, ps, p0);
+
+    p0 = vcmpneq_n_s32(vandq_s32(vaddq_n_s32(q, 1), vdupq_n_s32(2)), 0);
+    *pCos = vnegq_m(pc, pc, p0);
+}
+
+/**
+  @brief         Sine and cosine of 4 angles in radians
+  @param[in]     x     angles in radians
+  @param[out]    pSin  sines of x
+  @param[out]    pCos  cosines of x
+ */
+__STATIC_INLINE void vsincosq_f32(
+  f32x4_t x,
+  f32x4_t * pSin,
+  f32x4_t * pCos)
+{
+    f32x4_t qf, r;
+    int32x4_t q;
+
+    /* Nearest multiple of pi/2 */
+    q = vcvtaq_s32_f32(vmulq_n_f32(x, ARM_SINCOS_2_PI_F32));
+    qf = vcvtq_f32_s32(q);
+
+    r = vfmsq(x, qf, vdupq_n_f32(ARM_SINCOS_PIO2_1_F32));
+    r = vfmsq(r, qf, vdupq_n_f32(ARM_SINCOS_PIO2_2_F32));
+    r = vfmsq(r, qf, vdupq_n_f32(ARM_SINCOS_PIO2_3_F32));
+
+    vsincosq_quadrant_f32(r, q, pSin, pCos);
+}
+
+/**
+  @brief         Floating-point sine and cosine of 4 Q31 angles
+  @param[in]     x     angles scaled like in arm_sin_q31 (2^31 is 2*pi)
+  @param[out]    pSin  sines of x
+  @param[out]    pCos  cosines of x
+ */
+__STATIC_INLINE void vsincosq_q31_f32(
+  q31x4_t x,
+  f32x4_t * pSin,
+  f32x4_t * pCos)
+{
+    int32x4_t q, r;
+
+    /* Nearest multiple of pi/2 (2^29) */
+    q = vshrq(vaddq_n_s32(x, 0x10000000), 29);
+    r = vsubq(x, vshlq_n_s32(q, 29));
+
+    vsincosq_quadrant_f32(vmulq_n_f32(vcvtq_n_f32_s32(r, 29), ARM_SINCOS_PIO2_F32), q, pSin, pCos);
+}
+
+#endif /* (defined(ARM_MATH_MVEF) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+/**
+  @brief         Q31 sine and cosine of 4 Q31 angles
+  @param[in]     x     angles scaled like in arm_sin_q31 (2^31 is 2*pi)
+  @param[out]    pSin  sines of x
+  @param[out]    pCos  cosines of x
+
+  The results are the same as the ones of arm_sincos_core_q31.
+ */
+__STATIC_INLINE void vsincosq_q31(
+  q31x4_t x,
+  q31x4_t * pSin,
+  q31x4_t * pCos)
+{
+    int32x4_t q, t, z, p, s, c;
+    mve_pred16_t p0;
+
+    /* Nearest multiple of pi/2 (2^29) */
+    q = vshrq(vaddq_n_s32(x, 0x10000000), 29);
+    t = vshlq_n_s32(vsubq(x, vshlq_n_s32(q, 29)), 3);
+    z = vqrdmulhq(t, t);
+
+    p = vaddq_n_s32(vqrdmulhq_n_s32(z, ARM_SINCOS_S4_Q31), ARM_SINCOS_S3_Q31);
+    p = vaddq_n_s32(vqrdmulhq(z, p), ARM_SINCOS_S2_Q31);
+    p = vaddq_n_s32(vqrdmulhq(z, p), ARM_SINCOS_S1_Q31);
+    p = vaddq_n_s32(vqrdmulhq(z, p), ARM_SINCOS_S0_Q31);
+    s = vqrdmulhq(t, p);
+
+    p = vaddq_n_s32(vqrdmulhq_n_s32(z, ARM_SINCOS_C4_Q31), ARM_SINCOS_C3_Q31);
+    p = vaddq_n_s32(vqrdmulhq(z, p), ARM_SINCOS_C2_Q31);
+    p = vaddq_n_s32(vqrdmulhq(z, p), ARM_SINCOS_C1_Q31);
+    p = vaddq_n_s32(vqrdmulhq(z, p), ARM_SINCOS_C0_Q31);
+
+    /* 1 + z * C(z) saturated to Q31 : C(z) <= 0 and 1 + x = (x + 1) + (1 - 2^-31) */
+    c = vqaddq(vaddq_n_s32(vqrdmulhq(z, p), 1), vdupq_n_s32(0x7FFFFFFF));
+
+    /* Odd quadrants : sine and cosine are swapped */
+    p0 = vcmpneq_n_s32(vandq_s32(q, vdupq_n_s32(1)), 0);
+    p = vpselq(c, s, p0);
+    c = vpselq(s, c, p0);
+
+    p0 = vcmpneq_n_s32(vandq_s32(q, vdupq_n_s32(2)), 0);
+    *pSin = vnegq_m(p, p, p0);
+
+    p0 = vcmpneq_n_s32(vandq_s32(vaddq_n_s32(q, 1), vdupq_n_s32(2)), 0);
+    *pCos = vnegq_m(c, c, p0);
+}
+
+#endif /* defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_SINCOS_H_ */
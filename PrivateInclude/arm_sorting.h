@@ -104,6 +104,52 @@ extern "C"
           float32_t * pDst,
           uint32_t blockSize);
 
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_radix_sort_f32(
+    const arm_sort_instance_f32 * S,
+          float32_t * pSrc,
+          float32_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @brief  Map the bit pattern of a float to an unsigned key
+   *         with the same ordering.
+   * @param[in]  bits  bit pattern of the float
+   * @param[in]  dir   sorting order
+   * @return     key
+   *
+   * Negative values have all their bits inverted and positive values
+   * have their sign bit set. For a descending order, the key is inverted.
+   */
+  __STATIC_FORCEINLINE uint32_t arm_sort_key_f32(uint32_t bits, uint8_t dir)
+  {
+      uint32_t mask = (bits & 0x80000000U) ? 0xFFFFFFFFU : 0x80000000U;
+      uint32_t key = bits ^ mask;
+
+      return (dir == ARM_SORT_ASCENDING) ? key : ~key;
+  }
+
+  /**
+   * @brief  Inverse of arm_sort_key_f32
+   * @param[in]  key  key
+   * @param[in]  dir  sorting order
+   * @return     bit pattern of the float
+   */
+  __STATIC_FORCEINLINE uint32_t arm_sort_bits_f32(uint32_t key, uint8_t dir)
+  {
+      uint32_t mask;
+
+      key = (dir == ARM_SORT_ASCENDING) ? key : ~key;
+      mask = (key & 0x80000000U) ? 0x80000000U : 0xFFFFFFFFU;
+
+      return key ^ mask;
+  }
+
 #if defined(ARM_MATH_NEON)
 
 #define vtrn256_128q(a, b)                   \
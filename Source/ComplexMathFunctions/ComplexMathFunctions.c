@@ -48,3 +48,12 @@
 #include "arm_cmplx_mult_real_f32.c"
 #include "arm_cmplx_mult_real_q15.c"
 #include "arm_cmplx_mult_real_q31.c"
+#include "arm_nco_init_f32.c"
+#include "arm_nco_f32.c"
+#include "arm_mix_cmplx_f32.c"
+#include "arm_nco_init_q31.c"
+#include "arm_nco_q31.c"
+#include "arm_mix_cmplx_q31.c"
+#include "arm_nco_init_q15.c"
+#include "arm_nco_q15.c"
+#include "arm_mix_cmplx_q15.c"
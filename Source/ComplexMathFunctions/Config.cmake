@@ -39,6 +39,16 @@ target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_cmplx_mult_real_f32.c)
 target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_cmplx_mult_real_q15.c)
 target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_cmplx_mult_real_q31.c)
 
+target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_nco_init_f32.c)
+target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_nco_f32.c)
+target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_mix_cmplx_f32.c)
+target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_nco_init_q31.c)
+target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_nco_q31.c)
+target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_mix_cmplx_q31.c)
+target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_nco_init_q15.c)
+target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_nco_q15.c)
+target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_mix_cmplx_q15.c)
+
 if ((NOT ARMAC5) AND (NOT DISABLEFLOAT16))
 target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_cmplx_conj_f16.c)
 target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_cmplx_dot_prod_f16.c)
@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mix_cmplx_f32.c
+ * Description:  Floating-point complex mixer
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/complex_math_functions.h"
+#include "arm_sincos.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup NCO
+  @{
+ */
+
+/**
+  @brief         Floating-point complex mixer.
+  @param[in,out] S           points to an instance of the floating-point NCO structure
+  @param[in]     pSrc        points to the complex input vector
+  @param[out]    pDst        points to the complex output vector
+  @param[in]     numSamples  number of complex samples in each vector
+
+  @par           Details
+                   The input is multiplied by the complex exponential generated
+                   by the NCO and the phase of the NCO is advanced by numSamples.
+                   pSrc and pDst can be the same buffer.
+ */
+ARM_DSP_ATTRIBUTE void arm_mix_cmplx_f32(
+  arm_nco_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+   uint32_t phase = S->phase;
+   const uint32_t phaseInc = S->phaseInc;
+   uint32_t blkCnt;
+   float32_t sinVal, cosVal, re, im;
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+   f32x4x2_t vecIn, vecOut;
+   f32x4_t vecSin, vecCos;
+   uint32x4_t vecPhase;
+
+   /* Phases of 4 consecutive samples */
+   vecPhase = vmlaq_n_u32(vdupq_n_u32(phase), vidupq_n_u32(0U, 1), phaseInc);
+
+   blkCnt = numSamples >> 2U;
+   while (blkCnt > 0U)
+   {
+      vecIn = vld2q(pSrc);
+      vsincosq_q31_f32(vreinterpretq_s32_u32(vshrq(vecPhase, 1)), &vecSin, &vecCos);
+
+      vecOut.val[0] = vfmsq(vmulq(vecIn.val[0], vecCos), vecIn.val[1], vecSin);
+      vecOut.val[1] = vfmaq(vmulq(vecIn.val[0], vecSin), vecIn.val[1], vecCos);
+      vst2q(pDst, vecOut);
+      pSrc += 8;
+      pDst += 8;
+
+      vecPhase = vaddq_n_u32(vecPhase, 4U * phaseInc);
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   phase = vgetq_lane(vecPhase, 0);
+   blkCnt = numSamples & 3U;
+#else
+   blkCnt = numSamples;
+#endif
+
+   while (blkCnt > 0U)
+   {
+      arm_sincos_core_q31_f32((q31_t) (phase >> 1), &sinVal, &cosVal);
+
+      re = *pSrc++;
+      im = *pSrc++;
+
+      /* y = x * (cos + j sin) */
+      *pDst++ = re * cosVal - im * sinVal;
+      *pDst++ = re * sinVal + im * cosVal;
+      phase += phaseInc;
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   S->phase = phase;
+}
+
+/**
+  @} end of NCO group
+ */
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mix_cmplx_q15.c
+ * Description:  Q15 complex mixer
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/complex_math_functions.h"
+#include "arm_sincos.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup NCO
+  @{
+ */
+
+/**
+  @brief         Q15 complex mixer.
+  @param[in,out] S           points to an instance of the Q15 NCO structure
+  @param[in]     pSrc        points to the complex input vector
+  @param[out]    pDst        points to the complex output vector
+  @param[in]     numSamples  number of complex samples in each vector
+
+  @par           Details
+                   The input is multiplied by the complex exponential generated
+                   by the NCO and the phase of the NCO is advanced by numSamples.
+                   pSrc and pDst can be the same buffer.
+
+  @par           Scaling and Overflow Behavior
+                   The intermediate products are accumulated
+                   in 64 bits and the result is saturated to 1.15 format.
+ */
+ARM_DSP_ATTRIBUTE void arm_mix_cmplx_q15(
+  arm_nco_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+   uint32_t phase = S->phase;
+   const uint32_t phaseInc = S->phaseInc;
+   uint32_t blkCnt = numSamples;
+   q15_t sinVal, cosVal, re, im;
+
+   while (blkCnt > 0U)
+   {
+      arm_sincos_phase_q15(phase, &sinVal, &cosVal);
+
+      re = *pSrc++;
+      im = *pSrc++;
+
+      /* y = x * (cos + j sin) */
+      *pDst++ = (q15_t) __SSAT((q31_t) (((q63_t) re * cosVal - (q63_t) im * sinVal) >> 15), 16);
+      *pDst++ = (q15_t) __SSAT((q31_t) (((q63_t) re * sinVal + (q63_t) im * cosVal) >> 15), 16);
+      phase += phaseInc;
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   S->phase = phase;
+}
+
+/**
+  @} end of NCO group
+ */
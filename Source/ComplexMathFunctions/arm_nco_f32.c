@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_f32.c
+ * Description:  Floating-point NCO
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/complex_math_functions.h"
+#include "arm_sincos.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup NCO Numerically Controlled Oscillator
+
+  Generates the complex exponential <code>exp(j * phase[n])</code> where
+  the phase is incremented by a constant step at each sample, and mixes
+  a complex signal with it to shift its frequency.
+
+  The phase is a 32-bit accumulator where 2^32 is a full turn. It wraps
+  exactly so the phase is continuous from one call to the next and does
+  not drift however long the stream is. The frequency resolution is fs / 2^32.
+
+  The mixer computes in one pass:
+  <pre>
+      pDst[n] = pSrc[n] * exp(j * phase[n])
+  </pre>
+  which replaces the generation of a sine and cosine per sample followed
+  by a call to arm_cmplx_mult_cmplx. A positive frequency shifts
+  the spectrum up.
+
+  The floating-point functions compute the exponential from the exact
+  phase with the polynomial used by the vector sine and cosine functions.
+  The fixed-point functions interpolate the tables used by arm_sin_q31
+  and arm_sin_q15.
+
+  The complex data is interleaved (real, imag, real, imag, ...).
+ */
+
+/**
+  @addtogroup NCO
+  @{
+ */
+
+/**
+  @brief         Floating-point NCO.
+  @param[in,out] S           points to an instance of the floating-point NCO structure
+  @param[out]    pDst        points to the complex output vector
+  @param[in]     numSamples  number of complex samples to generate
+ */
+ARM_DSP_ATTRIBUTE void arm_nco_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+   uint32_t phase = S->phase;
+   const uint32_t phaseInc = S->phaseInc;
+   uint32_t blkCnt;
+   float32_t sinVal, cosVal;
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+   f32x4x2_t vecOut;
+   f32x4_t vecSin, vecCos;
+   uint32x4_t vecPhase;
+
+   /* Phases of 4 consecutive samples */
+   vecPhase = vmlaq_n_u32(vdupq_n_u32(phase), vidupq_n_u32(0U, 1), phaseInc);
+
+   blkCnt = numSamples >> 2U;
+   while (blkCnt > 0U)
+   {
+      vsincosq_q31_f32(vreinterpretq_s32_u32(vshrq(vecPhase, 1)), &vecSin, &vecCos);
+
+      vecOut.val[0] = vecCos;
+      vecOut.val[1] = vecSin;
+      vst2q(pDst, vecOut);
+      pDst += 8;
+
+      vecPhase = vaddq_n_u32(vecPhase, 4U * phaseInc);
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   phase = vgetq_lane(vecPhase, 0);
+   blkCnt = numSamples & 3U;
+#else
+   blkCnt = numSamples;
+#endif
+
+   while (blkCnt > 0U)
+   {
+      arm_sincos_core_q31_f32((q31_t) (phase >> 1), &sinVal, &cosVal);
+
+      *pDst++ = cosVal;
+      *pDst++ = sinVal;
+      phase += phaseInc;
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   S->phase = phase;
+}
+
+/**
+  @} end of NCO group
+ */
@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_init_q15.c
+ * Description:  Q15 NCO initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/complex_math_functions.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup NCO
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 NCO.
+  @param[out]    S          points to an instance of the Q15 NCO structure
+  @param[in]     frequency  frequency normalized by the sampling frequency
+  @param[in]     phase      initial phase scaled like in arm_sin_q15
+
+  @par           Details
+                   The frequency can be negative. Frequencies outside of
+                   [-0.5, 0.5) are aliased.
+ */
+ARM_DSP_ATTRIBUTE void arm_nco_init_q15(
+  arm_nco_instance_q15 * S,
+  q15_t frequency,
+  q15_t phase)
+{
+  S->phaseInc = (uint32_t) frequency << 17;
+  S->phase = (uint32_t) phase << 17;
+}
+
+/**
+  @} end of NCO group
+ */
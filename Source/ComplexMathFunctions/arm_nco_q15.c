@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_q15.c
+ * Description:  Q15 NCO
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/complex_math_functions.h"
+#include "arm_sincos.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup NCO
+  @{
+ */
+
+/**
+  @brief         Q15 NCO.
+  @param[in,out] S           points to an instance of the Q15 NCO structure
+  @param[out]    pDst        points to the complex output vector
+  @param[in]     numSamples  number of complex samples to generate
+ */
+ARM_DSP_ATTRIBUTE void arm_nco_q15(
+  arm_nco_instance_q15 * S,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+   uint32_t phase = S->phase;
+   const uint32_t phaseInc = S->phaseInc;
+   uint32_t blkCnt = numSamples;
+   q15_t sinVal, cosVal;
+
+   while (blkCnt > 0U)
+   {
+      arm_sincos_phase_q15(phase, &sinVal, &cosVal);
+
+      *pDst++ = cosVal;
+      *pDst++ = sinVal;
+      phase += phaseInc;
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   S->phase = phase;
+}
+
+/**
+  @} end of NCO group
+ */
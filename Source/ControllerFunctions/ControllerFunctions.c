@@ -32,9 +32,31 @@
 #include "arm_pid_reset_f32.c"
 #include "arm_pid_reset_q15.c"
 #include "arm_pid_reset_q31.c"
+#include "arm_pid_bank_f32.c"
+#include "arm_pid_bank_q15.c"
+#include "arm_pid_bank_q31.c"
+#include "arm_pid_bank_init_f32.c"
+#include "arm_pid_bank_init_q15.c"
+#include "arm_pid_bank_init_q31.c"
+#include "arm_pid_bank_reset_f32.c"
+#include "arm_pid_bank_reset_q15.c"
+#include "arm_pid_bank_reset_q31.c"
 
 
 #include "arm_sin_cos_f32.c"
 
 #include "arm_sin_cos_q31.c"
 
+#include "arm_clarke_block_f32.c"
+#include "arm_clarke_block_q31.c"
+#include "arm_clarke_park_f32.c"
+#include "arm_clarke_park_q31.c"
+#include "arm_inv_clarke_block_f32.c"
+#include "arm_inv_clarke_block_q31.c"
+#include "arm_inv_park_block_f32.c"
+#include "arm_inv_park_block_q31.c"
+#include "arm_inv_park_clarke_f32.c"
+#include "arm_inv_park_clarke_q31.c"
+#include "arm_park_block_f32.c"
+#include "arm_park_block_q31.c"
+
@@ -0,0 +1,60 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_clarke_block_q31.c
+ * Description:  Q31 block Clarke transform
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/controller_functions.h"
+
+/**
+  @ingroup clarke
+  @brief         Q31 block Clarke transform.
+  @param[in]     pIa        points to the three-phase coordinates <code>a</code>
+  @param[in]     pIb        points to the three-phase coordinates <code>b</code>
+  @param[out]    pIalpha    points to the two-phase orthogonal vector axis alpha
+  @param[out]    pIbeta     points to the two-phase orthogonal vector axis beta
+  @param[in]     blockSize  number of samples to process
+
+  @par           Scaling and Overflow Behavior
+                   The same as the single sample Q31 function. The result is the same as
+                   calling it for each sample.
+ */
+ARM_DSP_ATTRIBUTE void arm_clarke_block_q31(
+  const q31_t * pIa,
+  const q31_t * pIb,
+        q31_t * pIalpha,
+        q31_t * pIbeta,
+        uint32_t blockSize)
+{
+  uint32_t i;                                    /* Loop counter */
+
+  for (i = 0U; i < blockSize; i++)
+  {
+      arm_clarke_q31(pIa[i], pIb[i], &pIalpha[i], &pIbeta[i]);
+  }
+}
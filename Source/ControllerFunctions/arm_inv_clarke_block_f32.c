@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_inv_clarke_block_f32.c
+ * Description:  Floating-point block Inverse Clarke transform
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/controller_functions.h"
+
+/**
+  @ingroup inv_clarke
+  @brief         Floating-point block Inverse Clarke transform.
+  @param[in]     pIalpha    points to the two-phase orthogonal vector axis alpha
+  @param[in]     pIbeta     points to the two-phase orthogonal vector axis beta
+  @param[out]    pIa        points to the three-phase coordinates <code>a</code>
+  @param[out]    pIb        points to the three-phase coordinates <code>b</code>
+  @param[in]     blockSize  number of samples to process
+
+  @par           Details
+                   The result is the same as calling the single sample function
+                   for each sample.
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+ARM_DSP_ATTRIBUTE void arm_inv_clarke_block_f32(
+  const float32_t * pIalpha,
+  const float32_t * pIbeta,
+        float32_t * pIa,
+        float32_t * pIb,
+        uint32_t blockSize)
+{
+    int32_t blkCnt;                              /* Loop counter */
+
+    blkCnt = (int32_t) blockSize;
+    while (blkCnt > 0)
+    {
+        mve_pred16_t p0 = vctp32q(blkCnt);
+        f32x4_t vecAlpha = vldrwq_z_f32(pIalpha, p0);
+        f32x4_t vecBeta = vldrwq_z_f32(pIbeta, p0);
+
+        /* Ib = -(1/2) * Ialpha + (sqrt(3)/2) * Ibeta */
+        f32x4_t vecB = vmulq_n_f32(vecAlpha, -0.5f);
+        vecB = vfmaq_n_f32(vecB, vecBeta, 0.8660254039f);
+
+        vstrwq_p(pIa, vecAlpha, p0);
+        vstrwq_p(pIb, vecB, p0);
+
+        pIalpha += 4;
+        pIbeta += 4;
+        pIa += 4;
+        pIb += 4;
+
+        /* Decrement loop counter */
+        blkCnt -= 4;
+    }
+}
+
+#else
+ARM_DSP_ATTRIBUTE void arm_inv_clarke_block_f32(
+  const float32_t * pIalpha,
+  const float32_t * pIbeta,
+        float32_t * pIa,
+        float32_t * pIb,
+        uint32_t blockSize)
+{
+  uint32_t i;                                    /* Loop counter */
+
+  for (i = 0U; i < blockSize; i++)
+  {
+      arm_inv_clarke_f32(pIalpha[i], pIbeta[i], &pIa[i], &pIb[i]);
+  }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
@@ -0,0 +1,64 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_inv_park_block_q31.c
+ * Description:  Q31 block Inverse Park transform
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/controller_functions.h"
+
+/**
+  @ingroup inv_park
+  @brief         Q31 block Inverse Park transform.
+  @param[in]     pId        points to the rotor reference frame d
+  @param[in]     pIq        points to the rotor reference frame q
+  @param[in]     pSinVal    points to the sine values of the rotation angles
+  @param[in]     pCosVal    points to the cosine values of the rotation angles
+  @param[out]    pIalpha    points to the two-phase orthogonal vector axis alpha
+  @param[out]    pIbeta     points to the two-phase orthogonal vector axis beta
+  @param[in]     blockSize  number of samples to process
+
+  @par           Scaling and Overflow Behavior
+                   The same as the single sample Q31 function. The result is the same as
+                   calling it for each sample.
+ */
+ARM_DSP_ATTRIBUTE void arm_inv_park_block_q31(
+  const q31_t * pId,
+  const q31_t * pIq,
+  const q31_t * pSinVal,
+  const q31_t * pCosVal,
+        q31_t * pIalpha,
+        q31_t * pIbeta,
+        uint32_t blockSize)
+{
+  uint32_t i;                                    /* Loop counter */
+
+  for (i = 0U; i < blockSize; i++)
+  {
+      arm_inv_park_q31(pId[i], pIq[i], &pIalpha[i], &pIbeta[i], pSinVal[i], pCosVal[i]);
+  }
+}
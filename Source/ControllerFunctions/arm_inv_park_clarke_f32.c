@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_inv_park_clarke_f32.c
+ * Description:  Floating-point fused Inverse Park and Inverse Clarke transforms
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/controller_functions.h"
+#include "arm_sincos.h"
+
+/**
+  @ingroup inv_park
+  @brief         Floating-point fused Inverse Park and Inverse Clarke transforms.
+  @param[in]     pId        points to the rotor reference frame d
+  @param[in]     pIq        points to the rotor reference frame q
+  @param[in]     pTheta     points to the rotor flux angles in radians
+  @param[out]    pIa        points to the three-phase coordinates <code>a</code>
+  @param[out]    pIb        points to the three-phase coordinates <code>b</code>
+  @param[in]     blockSize  number of samples to process
+
+  @par           Details
+                   The sine and cosine of the angles are computed with a polynomial
+                   approximation. The absolute error is below 1e-7 for angles below 8192
+                   in absolute value. Ialpha and Ibeta are not stored.
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+ARM_DSP_ATTRIBUTE void arm_inv_park_clarke_f32(
+  const float32_t * pId,
+  const float32_t * pIq,
+  const float32_t * pTheta,
+        float32_t * pIa,
+        float32_t * pIb,
+        uint32_t blockSize)
+{
+    int32_t blkCnt;                              /* Loop counter */
+
+    blkCnt = (int32_t) blockSize;
+    while (blkCnt > 0)
+    {
+        mve_pred16_t p0 = vctp32q(blkCnt);
+        f32x4_t vecD = vldrwq_z_f32(pId, p0);
+        f32x4_t vecQ = vldrwq_z_f32(pIq, p0);
+        f32x4_t vecAlpha, vecBeta, vecSin, vecCos;
+
+        vsincosq_f32(vldrwq_z_f32(pTheta, p0), &vecSin, &vecCos);
+
+        /* Ialpha = Id * cosVal - Iq * sinVal */
+        vecAlpha = vfmsq(vmulq(vecD, vecCos), vecQ, vecSin);
+        /* Ibeta = Id * sinVal + Iq * cosVal */
+        vecBeta = vfmaq(vmulq(vecD, vecSin), vecQ, vecCos);
+
+        /* Ia = Ialpha, Ib = -(1/2) * Ialpha + (sqrt(3)/2) * Ibeta */
+        vstrwq_p(pIa, vecAlpha, p0);
+        vstrwq_p(pIb, vfmaq_n_f32(vmulq_n_f32(vecAlpha, -0.5f), vecBeta, 0.8660254039f), p0);
+
+        pId += 4;
+        pIq += 4;
+        pTheta += 4;
+        pIa += 4;
+        pIb += 4;
+
+        /* Decrement loop counter */
+        blkCnt -= 4;
+    }
+}
+
+#else
+ARM_DSP_ATTRIBUTE void arm_inv_park_clarke_f32(
+  const float32_t * pId,
+  const float32_t * pIq,
+  const float32_t * pTheta,
+        float32_t * pIa,
+        float32_t * pIb,
+        uint32_t blockSize)
+{
+  uint32_t i;                                    /* Loop counter */
+  float32_t Ialpha, Ibeta, sinVal, cosVal;
+
+  for (i = 0U; i < blockSize; i++)
+  {
+      arm_sincos_core_f32(pTheta[i], &sinVal, &cosVal);
+      arm_inv_park_f32(pId[i], pIq[i], &Ialpha, &Ibeta, sinVal, cosVal);
+      arm_inv_clarke_f32(Ialpha, Ibeta, &pIa[i], &pIb[i]);
+  }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_inv_park_clarke_q31.c
+ * Description:  Q31 fused Inverse Park and Inverse Clarke transforms
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/controller_functions.h"
+
+/**
+  @ingroup inv_park
+  @brief         Q31 fused Inverse Park and Inverse Clarke transforms.
+  @param[in]     pId        points to the rotor reference frame d
+  @param[in]     pIq        points to the rotor reference frame q
+  @param[in]     pTheta     points to the rotor flux angles, [-1 0.9999] mapping to [-180 +180] degrees
+  @param[out]    pIa        points to the three-phase coordinates <code>a</code>
+  @param[out]    pIb        points to the three-phase coordinates <code>b</code>
+  @param[in]     blockSize  number of samples to process
+
+  @par           Details
+                   The sine and cosine of the angles are computed with arm_sin_cos_q31.
+                   Ialpha and Ibeta are not stored.
+
+  @par           Scaling and Overflow Behavior
+                   The same as the single sample Q31 transforms.
+ */
+ARM_DSP_ATTRIBUTE void arm_inv_park_clarke_q31(
+  const q31_t * pId,
+  const q31_t * pIq,
+  const q31_t * pTheta,
+        q31_t * pIa,
+        q31_t * pIb,
+        uint32_t blockSize)
+{
+  uint32_t i;                                    /* Loop counter */
+  q31_t Ialpha, Ibeta, sinVal, cosVal;
+
+  for (i = 0U; i < blockSize; i++)
+  {
+      arm_sin_cos_q31(pTheta[i], &sinVal, &cosVal);
+      arm_inv_park_q31(pId[i], pIq[i], &Ialpha, &Ibeta, sinVal, cosVal);
+      arm_inv_clarke_q31(Ialpha, Ibeta, &pIa[i], &pIb[i]);
+  }
+}
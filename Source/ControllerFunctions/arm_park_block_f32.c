@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_park_block_f32.c
+ * Description:  Floating-point block Park transform
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/controller_functions.h"
+
+/**
+  @ingroup park
+  @brief         Floating-point block Park transform.
+  @param[in]     pIalpha    points to the two-phase vector coordinates alpha
+  @param[in]     pIbeta     points to the two-phase vector coordinates beta
+  @param[in]     pSinVal    points to the sine values of the rotation angles
+  @param[in]     pCosVal    points to the cosine values of the rotation angles
+  @param[out]    pId        points to the rotor reference frame d
+  @param[out]    pIq        points to the rotor reference frame q
+  @param[in]     blockSize  number of samples to process
+
+  @par           Details
+                   The result is the same as calling the single sample function
+                   for each sample.
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+ARM_DSP_ATTRIBUTE void arm_park_block_f32(
+  const float32_t * pIalpha,
+  const float32_t * pIbeta,
+  const float32_t * pSinVal,
+  const float32_t * pCosVal,
+        float32_t * pId,
+        float32_t * pIq,
+        uint32_t blockSize)
+{
+    int32_t blkCnt;                              /* Loop counter */
+
+    blkCnt = (int32_t) blockSize;
+    while (blkCnt > 0)
+    {
+        mve_pred16_t p0 = vctp32q(blkCnt);
+        f32x4_t vecAlpha = vldrwq_z_f32(pIalpha, p0);
+        f32x4_t vecBeta = vldrwq_z_f32(pIbeta, p0);
+        f32x4_t vecSin = vldrwq_z_f32(pSinVal, p0);
+        f32x4_t vecCos = vldrwq_z_f32(pCosVal, p0);
+
+        /* Id = Ialpha * cosVal + Ibeta * sinVal */
+        vstrwq_p(pId, vfmaq(vmulq(vecAlpha, vecCos), vecBeta, vecSin), p0);
+        /* Iq = - Ialpha * sinVal + Ibeta * cosVal */
+        vstrwq_p(pIq, vfmsq(vmulq(vecBeta, vecCos), vecAlpha, vecSin), p0);
+
+        pIalpha += 4;
+        pIbeta += 4;
+        pSinVal += 4;
+        pCosVal += 4;
+        pId += 4;
+        pIq += 4;
+
+        /* Decrement loop counter */
+        blkCnt -= 4;
+    }
+}
+
+#else
+ARM_DSP_ATTRIBUTE void arm_park_block_f32(
+  const float32_t * pIalpha,
+  const float32_t * pIbeta,
+  const float32_t * pSinVal,
+  const float32_t * pCosVal,
+        float32_t * pId,
+        float32_t * pIq,
+        uint32_t blockSize)
+{
+  uint32_t i;                                    /* Loop counter */
+
+  for (i = 0U; i < blockSize; i++)
+  {
+      arm_park_f32(pIalpha[i], pIbeta[i], &pId[i], &pIq[i], pSinVal[i], pCosVal[i]);
+  }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
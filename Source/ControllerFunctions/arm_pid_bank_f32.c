@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_bank_f32.c
+ * Description:  Floating-point PID Control bank
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup PID
+  @{
+ */
+
+/**
+  @brief         Process function for a bank of floating-point PID Controls.
+  @param[in]     S     points to an instance of the floating-point PID bank structure
+  @param[in]     pSrc  points to one input sample per controller
+  @param[out]    pDst  points to one output sample per controller
+
+  @par           Details
+                   Each controller computes
+                   <code>y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]</code>
+                   like arm_pid_f32.
+                   When limits are defined, y[n] is clamped before being
+                   written to the output and to the state.
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+ARM_DSP_ATTRIBUTE void arm_pid_bank_f32(
+  const arm_pid_bank_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst)
+{
+    const uint32_t numControllers = S->numControllers;
+    const float32_t *pA0 = S->pGains;
+    const float32_t *pA1 = S->pGains + numControllers;
+    const float32_t *pA2 = S->pGains + 2U * numControllers;
+    float32_t *pX1 = S->pState;
+    float32_t *pX2 = S->pState + numControllers;
+    float32_t *pY1 = S->pState + 2U * numControllers;
+    const float32_t *pMin = S->pMin;
+    const float32_t *pMax = S->pMax;
+    int32_t  blkCnt;
+    f32x4_t  vecIn, vecX1, vecAcc;
+
+    blkCnt = (int32_t) numControllers;
+    while (blkCnt > 0)
+    {
+        mve_pred16_t p0 = vctp32q(blkCnt);
+
+        vecIn = vldrwq_z_f32(pSrc, p0);
+        vecX1 = vldrwq_z_f32(pX1, p0);
+        vecAcc = vldrwq_z_f32(pY1, p0);
+
+        /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+        vecAcc = vfmaq(vecAcc, vldrwq_z_f32(pA0, p0), vecIn);
+        vecAcc = vfmaq(vecAcc, vldrwq_z_f32(pA1, p0), vecX1);
+        vecAcc = vfmaq(vecAcc, vldrwq_z_f32(pA2, p0), vldrwq_z_f32(pX2, p0));
+
+        /* Clamp the output and the integral term */
+        if (pMin != NULL)
+        {
+            vecAcc = vmaxnmq(vecAcc, vldrwq_z_f32(pMin, p0));
+            pMin += 4;
+        }
+        if (pMax != NULL)
+        {
+            vecAcc = vminnmq(vecAcc, vldrwq_z_f32(pMax, p0));
+            pMax += 4;
+        }
+
+        /* Update state */
+        vstrwq_p(pX2, vecX1, p0);
+        vstrwq_p(pX1, vecIn, p0);
+        vstrwq_p(pY1, vecAcc, p0);
+        vstrwq_p(pDst, vecAcc, p0);
+
+        pSrc += 4;
+        pDst += 4;
+        pA0 += 4;
+        pA1 += 4;
+        pA2 += 4;
+        pX1 += 4;
+        pX2 += 4;
+        pY1 += 4;
+
+        /* Decrement loop counter */
+        blkCnt -= 4;
+    }
+}
+
+#else
+ARM_DSP_ATTRIBUTE void arm_pid_bank_f32(
+  const arm_pid_bank_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst)
+{
+    const uint32_t numControllers = S->numControllers;
+    const float32_t *pA0 = S->pGains;
+    const float32_t *pA1 = S->pGains + numControllers;
+    const float32_t *pA2 = S->pGains + 2U * numControllers;
+    float32_t *pX1 = S->pState;
+    float32_t *pX2 = S->pState + numControllers;
+    float32_t *pY1 = S->pState + 2U * numControllers;
+    const float32_t *pMin = S->pMin;
+    const float32_t *pMax = S->pMax;
+    float32_t in, out;
+    uint32_t i;
+
+    for (i = 0U; i < numControllers; i++)
+    {
+        in = pSrc[i];
+
+        /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+        out = (pA0[i] * in) + (pA1[i] * pX1[i]) + (pA2[i] * pX2[i]) + pY1[i];
+
+        /* Clamp the output and the integral term */
+        if ((pMin != NULL) && (out < pMin[i]))
+        {
+            out = pMin[i];
+        }
+        if ((pMax != NULL) && (out > pMax[i]))
+        {
+            out = pMax[i];
+        }
+
+        /* Update state */
+        pX2[i] = pX1[i];
+        pX1[i] = in;
+        pY1[i] = out;
+
+        pDst[i] = out;
+    }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of PID group
+ */
@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_bank_init_f32.c
+ * Description:  Floating-point PID Control bank initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup PID
+  @{
+ */
+
+/**
+  @brief         Initialization function for a bank of floating-point PID Controls.
+  @param[in,out] S               points to an instance of the floating-point PID bank structure
+  @param[in]     numControllers  number of controllers in the bank
+  @param[in]     pKp             points to the proportional gains
+  @param[in]     pKi             points to the integral gains
+  @param[in]     pKd             points to the derivative gains
+  @param[in]     pGains          points to the derived gains buffer of 3*numControllers values
+  @param[in]     pState          points to the state buffer of 3*numControllers values
+  @param[in]     pMin            points to the lower output limits or NULL
+  @param[in]     pMax            points to the upper output limits or NULL
+
+  @par           Details
+                   The function computes the gains <code>A0</code>, <code>A1</code> and <code>A2</code>
+                   of each controller in the same way as the single controller initialization function
+                   and sets the state of all the controllers to zeros.
+                   When <code>pMin</code> and <code>pMax</code> are NULL, the outputs are not clamped.
+                   The limit buffers are used by reference and are not copied.
+ */
+
+ARM_DSP_ATTRIBUTE void arm_pid_bank_init_f32(
+        arm_pid_bank_instance_f32 * S,
+        uint32_t numControllers,
+  const float32_t * pKp,
+  const float32_t * pKi,
+  const float32_t * pKd,
+        float32_t * pGains,
+        float32_t * pState,
+  const float32_t * pMin,
+  const float32_t * pMax)
+{
+  float32_t *pA0 = pGains;
+  float32_t *pA1 = pGains + numControllers;
+  float32_t *pA2 = pGains + 2U * numControllers;
+  uint32_t i;
+
+  S->numControllers = numControllers;
+  S->pGains = pGains;
+  S->pState = pState;
+  S->pMin = pMin;
+  S->pMax = pMax;
+
+  for (i = 0U; i < numControllers; i++)
+  {
+    pA0[i] = pKp[i] + pKi[i] + pKd[i];
+    pA1[i] = (-pKp[i]) - (2.0f * pKd[i]);
+    pA2[i] = pKd[i];
+  }
+
+  arm_pid_bank_reset_f32(S);
+}
+
+/**
+  @} end of PID group
+ */
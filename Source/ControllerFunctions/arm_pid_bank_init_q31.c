@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_bank_init_q31.c
+ * Description:  Q31 PID Control bank initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup PID
+  @{
+ */
+
+/**
+  @brief         Initialization function for a bank of Q31 PID Controls.
+  @param[in,out] S               points to an instance of the Q31 PID bank structure
+  @param[in]     numControllers  number of controllers in the bank
+  @param[in]     pKp             points to the proportional gains
+  @param[in]     pKi             points to the integral gains
+  @param[in]     pKd             points to the derivative gains
+  @param[in]     pGains          points to the derived gains buffer of 3*numControllers values
+  @param[in]     pState          points to the state buffer of 3*numControllers values
+  @param[in]     pMin            points to the lower output limits or NULL
+  @param[in]     pMax            points to the upper output limits or NULL
+
+  @par           Details
+                   The function computes the gains <code>A0</code>, <code>A1</code> and <code>A2</code>
+                   of each controller in the same way as the single controller initialization function
+                   and sets the state of all the controllers to zeros.
+                   When <code>pMin</code> and <code>pMax</code> are NULL, the outputs are not clamped.
+                   The limit buffers are used by reference and are not copied.
+ */
+
+ARM_DSP_ATTRIBUTE void arm_pid_bank_init_q31(
+        arm_pid_bank_instance_q31 * S,
+        uint32_t numControllers,
+  const q31_t * pKp,
+  const q31_t * pKi,
+  const q31_t * pKd,
+        q31_t * pGains,
+        q31_t * pState,
+  const q31_t * pMin,
+  const q31_t * pMax)
+{
+  q31_t *pA0 = pGains;
+  q31_t *pA1 = pGains + numControllers;
+  q31_t *pA2 = pGains + 2U * numControllers;
+  uint32_t i;
+  q31_t temp;                                    /* to store the sum */
+
+  S->numControllers = numControllers;
+  S->pGains = pGains;
+  S->pState = pState;
+  S->pMin = pMin;
+  S->pMax = pMax;
+
+  for (i = 0U; i < numControllers; i++)
+  {
+    temp = clip_q63_to_q31((q63_t) pKp[i] + pKi[i]);
+    pA0[i] = clip_q63_to_q31((q63_t) temp + pKd[i]);
+
+    temp = clip_q63_to_q31((q63_t) pKd[i] + pKd[i]);
+    pA1[i] = -clip_q63_to_q31((q63_t) temp + pKp[i]);
+
+    pA2[i] = pKd[i];
+  }
+
+  arm_pid_bank_reset_q31(S);
+}
+
+/**
+  @} end of PID group
+ */
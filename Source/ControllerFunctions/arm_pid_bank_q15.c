@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_bank_q15.c
+ * Description:  Q15 PID Control bank
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup PID
+  @{
+ */
+
+/**
+  @brief         Process function for a bank of Q15 PID Controls.
+  @param[in]     S     points to an instance of the Q15 PID bank structure
+  @param[in]     pSrc  points to one input sample per controller
+  @param[out]    pDst  points to one output sample per controller
+
+  @par           Details
+                   Each controller computes
+                   <code>y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]</code>
+                   like arm_pid_q15.
+                   When limits are defined, y[n] is clamped before being
+                   written to the output and to the state.
+
+  @par           Scaling and Overflow Behavior
+                   Each controller uses the same internal 64-bit accumulator as arm_pid_q15
+                   and the results are the same. The output is saturated to 1.15 format.
+ */
+ARM_DSP_ATTRIBUTE void arm_pid_bank_q15(
+  const arm_pid_bank_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst)
+{
+    const uint32_t numControllers = S->numControllers;
+    const q15_t *pA0 = S->pGains;
+    const q15_t *pA1 = S->pGains + numControllers;
+    const q15_t *pA2 = S->pGains + 2U * numControllers;
+    q15_t *pX1 = S->pState;
+    q15_t *pX2 = S->pState + numControllers;
+    q15_t *pY1 = S->pState + 2U * numControllers;
+    const q15_t *pMin = S->pMin;
+    const q15_t *pMax = S->pMax;
+    q63_t acc;
+    q15_t in, out;
+    uint32_t i;
+
+    for (i = 0U; i < numControllers; i++)
+    {
+        in = pSrc[i];
+
+        /* acc = A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+        acc = ((q31_t) pA0[i]) * in;
+        acc += (q31_t) pA1[i] * pX1[i];
+        acc += (q31_t) pA2[i] * pX2[i];
+
+        /* acc += y[n-1] */
+        acc += (q31_t) pY1[i] << 15;
+
+        /* saturate the output */
+        out = (q15_t) (__SSAT((q31_t)(acc >> 15), 16));
+
+        /* Clamp the output and the integral term */
+        if ((pMin != NULL) && (out < pMin[i]))
+        {
+            out = pMin[i];
+        }
+        if ((pMax != NULL) && (out > pMax[i]))
+        {
+            out = pMax[i];
+        }
+
+        /* Update state */
+        pX2[i] = pX1[i];
+        pX1[i] = in;
+        pY1[i] = out;
+
+        pDst[i] = out;
+    }
+}
+
+/**
+  @} end of PID group
+ */
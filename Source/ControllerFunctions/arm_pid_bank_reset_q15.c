@@ -0,0 +1,56 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_bank_reset_q15.c
+ * Description:  Q15 PID Control bank reset function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup PID
+  @{
+ */
+
+/**
+  @brief         Reset function for a bank of Q15 PID Controls.
+  @param[in,out] S  points to an instance of the Q15 PID bank structure
+
+  @par           Details
+                   The function resets the state of all the controllers to zeros.
+ */
+
+ARM_DSP_ATTRIBUTE void arm_pid_bank_reset_q15(
+  const arm_pid_bank_instance_q15 * S)
+{
+  /* Reset state to zero, The size is 3 samples per controller */
+  memset(S->pState, 0, 3U * S->numControllers * sizeof(q15_t));
+}
+
+/**
+  @} end of PID group
+ */
@@ -37,6 +37,13 @@ target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_yule_distance.c)
 target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_dtw_distance_f32.c)
 target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_dtw_path_f32.c)
 target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_dtw_init_window_q7.c)
+target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_dtw_band_distance_f32.c)
+target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_dtw_lb_keogh_f32.c)
+target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_cdist_f32.c)
+target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_cdist_minkowski_f32.c)
+target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_cdist_boolean.c)
+target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_knn_f32.c)
+target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_knn_q15.c)
 
 
 
@@ -50,6 +57,7 @@ target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_cosine_distance_f16.c)
 target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_euclidean_distance_f16.c)
 target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_jensenshannon_distance_f16.c)
 target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_minkowski_distance_f16.c)
+target_sources(CMSISDSP PRIVATE DistanceFunctions/arm_knn_f16.c)
 endif()
 
 endif()
\ No newline at end of file
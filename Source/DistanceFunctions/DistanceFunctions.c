@@ -51,4 +51,11 @@
 #include "arm_yule_distance.c"
 #include "arm_dtw_distance_f32.c"
 #include "arm_dtw_path_f32.c"
-#include "arm_dtw_init_window_q7.c"
\ No newline at end of file
+#include "arm_dtw_init_window_q7.c"
+#include "arm_dtw_band_distance_f32.c"
+#include "arm_dtw_lb_keogh_f32.c"
+#include "arm_cdist_f32.c"
+#include "arm_cdist_minkowski_f32.c"
+#include "arm_cdist_boolean.c"
+#include "arm_knn_f32.c"
+#include "arm_knn_q15.c"
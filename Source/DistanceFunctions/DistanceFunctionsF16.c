@@ -33,4 +33,4 @@
 #include "arm_euclidean_distance_f16.c"
 #include "arm_jensenshannon_distance_f16.c"
 #include "arm_minkowski_distance_f16.c"
-
+#include "arm_knn_f16.c"
@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cdist_boolean.c
+ * Description:  Pairwise boolean distance matrix
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/distance_functions.h"
+#include <limits.h>
+#include <math.h>
+
+
+/* Number of bits set in a word */
+__STATIC_FORCEINLINE uint32_t arm_cdist_popcount(uint32_t x)
+{
+    x = x - ((x >> 1) & 0x55555555U);
+    x = (x & 0x33333333U) + ((x >> 2) & 0x33333333U);
+    x = (x + (x >> 4)) & 0x0F0F0F0FU;
+    return((x * 0x01010101U) >> 24);
+}
+
+/**
+  @addtogroup BoolDist
+  @{
+ */
+
+/**
+ * @brief        Pairwise boolean distances between two sets of vectors
+ *
+ * @param[in]    pSrcA           First set of numA vectors of packed booleans
+ * @param[in]    numA            Number of vectors in the first set
+ * @param[in]    pSrcB           Second set of numB vectors of packed booleans
+ * @param[in]    numB            Number of vectors in the second set
+ * @param[in]    numberOfBools   Number of booleans in each vector
+ * @param[in]    metric          Distance to use
+ * @param[out]   pDst            Distance matrix (numA rows * numB columns)
+ * @return       ARM_MATH_ARGUMENT_ERROR if the metric is not recognized
+ *
+ * @par Details
+ * Each vector uses (numberOfBools + 31) / 32 words with the
+ * same packing as the other boolean distance functions.
+ *
+ * The counts of the pairs of booleans are computed on
+ * full words with a population count instead of bit by bit.
+ * The number of true booleans of each vector of the
+ * first set is computed only once.
+ * The results are the same as the ones of the vector
+ * distance functions.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_cdist_boolean(const uint32_t *pSrcA,
+                             uint32_t numA,
+                             const uint32_t *pSrcB,
+                             uint32_t numB,
+                             uint32_t numberOfBools,
+                             arm_cdist_boolean_metric metric,
+                             float32_t *pDst)
+{
+    const uint32_t nbWords = (numberOfBools + 31U) >> 5;
+    const uint32_t nbFullWords = numberOfBools >> 5;
+    const uint32_t remaining = numberOfBools & 0x1FU;
+    /* The remaining booleans are in the most significant bits of the last word */
+    const uint32_t lastMask = (remaining != 0U) ? (0xFFFFFFFFU << (32U - remaining)) : 0U;
+    const uint32_t *pA, *pB;
+    uint32_t ctt, ctf, cft, cff, r, b, na, nb;
+    float32_t d, s;
+
+    if (metric > ARM_CDIST_YULE)
+    {
+       return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    pA = pSrcA;
+    for(uint32_t i = 0; i < numA; i++)
+    {
+       /* Number of true booleans in vector A */
+       na = 0;
+       for(uint32_t k = 0; k < nbFullWords; k++)
+       {
+          na += arm_cdist_popcount(pA[k]);
+       }
+       if (remaining != 0U)
+       {
+          na += arm_cdist_popcount(pA[nbFullWords] & lastMask);
+       }
+
+       pB = pSrcB;
+       for(uint32_t j = 0; j < numB; j++)
+       {
+          ctt = 0;
+          nb = 0;
+          for(uint32_t k = 0; k < nbFullWords; k++)
+          {
+             b = pB[k];
+             ctt += arm_cdist_popcount(pA[k] & b);
+             nb += arm_cdist_popcount(b);
+          }
+          if (remaining != 0U)
+          {
+             b = pB[nbFullWords] & lastMask;
+             ctt += arm_cdist_popcount(pA[nbFullWords] & b);
+             nb += arm_cdist_popcount(b);
+          }
+
+          /* The other counts are deduced from the numbers of true booleans */
+          ctf = na - ctt;
+          cft = nb - ctt;
+          cff = numberOfBools - ctt - ctf - cft;
+
+          switch(metric)
+          {
+             case ARM_CDIST_DICE:
+                d = 1.0f*(ctf + cft) / (2.0f*ctt + cft + ctf);
+             break;
+             case ARM_CDIST_HAMMING:
+                d = 1.0f*(ctf + cft) / numberOfBools;
+             break;
+             case ARM_CDIST_JACCARD:
+                d = 1.0f*(ctf + cft) / (ctt + cft + ctf);
+             break;
+             case ARM_CDIST_KULSINSKI:
+                d = 1.0f*(ctf + cft - ctt + numberOfBools) / (cft + ctf + numberOfBools);
+             break;
+             case ARM_CDIST_ROGERSTANIMOTO:
+                r = 2*(ctf + cft);
+                d = 1.0f*r / (r + ctt + cff);
+             break;
+             case ARM_CDIST_RUSSELLRAO:
+                d = 1.0f*(numberOfBools - ctt) / ((float32_t)numberOfBools);
+             break;
+             case ARM_CDIST_SOKALMICHENER:
+                d = 2.0f*(ctf + cft);
+                s = 1.0f*(cff + ctt);
+                d = d / (s + d);
+             break;
+             case ARM_CDIST_SOKALSNEATH:
+                d = 2.0f*(ctf + cft);
+                d = d / (d + ctt);
+             break;
+             default:
+                r = 2*(ctf * cft);
+                d = 1.0f*r / (r/2.0f + ctt * cff);
+             break;
+          }
+          *pDst++ = d;
+
+          pB += nbWords;
+       }
+       pA += nbWords;
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of BoolDist group
+ */
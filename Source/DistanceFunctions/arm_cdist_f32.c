@@ -0,0 +1,272 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cdist_f32.c
+ * Description:  Pairwise distance matrix between two sets of vectors
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/distance_functions.h"
+#include <limits.h>
+#include <math.h>
+
+
+/**
+  @ingroup FloatDist
+ */
+
+/**
+  @defgroup cdist Pairwise distance matrix
+
+  Distances between all the rows of a matrix A
+  and all the rows of a matrix B.
+
+  The result is a matrix with as many rows as A
+  and as many columns as B. The element (i,j)
+  is the distance between row i of A and row j of B.
+
+  The euclidean, cosine and correlation distances
+  are computed from the matrix product A * B^T
+  with the optimized matrix multiplication and the
+  norms of the rows which are computed only once.
+  The other metrics are using the vector distance
+  functions for each pair of rows.
+
+ */
+
+/**
+  @addtogroup cdist
+  @{
+ */
+
+/**
+ * @brief         Pairwise distances between the rows of two matrices
+ * @param[in]     pSrcA    points to the first matrix (numA rows of vectorDimension samples)
+ * @param[in]     pSrcB    points to the second matrix (numB rows of vectorDimension samples)
+ * @param[in]     metric   distance to use
+ * @param[in]     pScratch temporary buffer of (numA + numB) * (vectorDimension + 1) samples
+ * @param[out]    pDst     points to the distance matrix (numA rows * numB columns)
+ * @return        execution status
+ *                  - \ref ARM_MATH_SUCCESS       : Operation successful
+ *                  - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ *                  - \ref ARM_MATH_ARGUMENT_ERROR : Unknown metric
+ *
+ * @par Scratch buffer
+ * The scratch buffer is only used by the euclidean,
+ * squared euclidean, cosine and correlation distances.
+ * It can be NULL for the other metrics.
+ *
+ * @par Accuracy
+ * The euclidean distances are computed as
+ * sqrt(||a||^2 + ||b||^2 - 2 a.b). For vectors which are
+ * very close relatively to their norms, the cancellation
+ * makes the result less accurate than \ref arm_euclidean_distance_f32.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_cdist_f32(const arm_matrix_instance_f32 *pSrcA,
+                         const arm_matrix_instance_f32 *pSrcB,
+                         arm_cdist_metric metric,
+                         float32_t *pScratch,
+                         arm_matrix_instance_f32 *pDst)
+{
+  const uint32_t numA = pSrcA->numRows;
+  const uint32_t numB = pSrcB->numRows;
+  const uint32_t dim = pSrcA->numCols;
+  const float32_t *pA, *pB;
+  float32_t *pOut = pDst->pData;
+  float32_t *pNormA, *pNormB, *pBT, *pAC;
+  float32_t mean, na, val;
+  arm_matrix_instance_f32 matA, matBT;
+  arm_status status;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  if ((pSrcB->numCols != dim) ||
+      (pDst->numRows != numA) ||
+      (pDst->numCols != numB))
+  {
+    return(ARM_MATH_SIZE_MISMATCH);
+  }
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  switch(metric)
+  {
+     case ARM_CDIST_EUCLIDEAN:
+     case ARM_CDIST_SQEUCLIDEAN:
+     case ARM_CDIST_COSINE:
+     case ARM_CDIST_CORRELATION:
+     {
+        /* Scratch layout : B^T, centered A (correlation), norms of A and B */
+        pBT = pScratch;
+        pAC = pBT + dim * numB;
+        pNormA = pAC + dim * numA;
+        pNormB = pNormA + numA;
+
+        /* Transpose B. For the correlation, rows are centered */
+        pB = pSrcB->pData;
+        for(uint32_t j = 0; j < numB; j++)
+        {
+           mean = 0.0f;
+           if (metric == ARM_CDIST_CORRELATION)
+           {
+              arm_mean_f32(pB, dim, &mean);
+           }
+           na = 0.0f;
+           for(uint32_t k = 0; k < dim; k++)
+           {
+              val = pB[k] - mean;
+              pBT[k * numB + j] = val;
+              na += val * val;
+           }
+           pNormB[j] = na;
+           pB += dim;
+        }
+
+        matA.numRows = numA;
+        matA.numCols = dim;
+        matA.pData = pSrcA->pData;
+
+        pA = pSrcA->pData;
+        for(uint32_t i = 0; i < numA; i++)
+        {
+           if (metric == ARM_CDIST_CORRELATION)
+           {
+              arm_mean_f32(pA, dim, &mean);
+              arm_offset_f32(pA, -mean, pAC + i * dim, dim);
+              arm_power_f32(pAC + i * dim, dim, &pNormA[i]);
+           }
+           else
+           {
+              arm_power_f32(pA, dim, &pNormA[i]);
+           }
+           pA += dim;
+        }
+
+        if (metric == ARM_CDIST_CORRELATION)
+        {
+           matA.pData = pAC;
+        }
+
+        matBT.numRows = dim;
+        matBT.numCols = numB;
+        matBT.pData = pBT;
+
+        /* Dot products between all the rows */
+        status = arm_mat_mult_f32(&matA, &matBT, pDst);
+        if (status != ARM_MATH_SUCCESS)
+        {
+           return(status);
+        }
+
+        if ((metric == ARM_CDIST_EUCLIDEAN) || (metric == ARM_CDIST_SQEUCLIDEAN))
+        {
+           for(uint32_t i = 0; i < numA; i++)
+           {
+              na = pNormA[i];
+              for(uint32_t j = 0; j < numB; j++)
+              {
+                 val = na + pNormB[j] - 2.0f * *pOut;
+                 *pOut++ = (val > 0.0f) ? val : 0.0f;
+              }
+           }
+
+           if (metric == ARM_CDIST_EUCLIDEAN)
+           {
+              pOut = pDst->pData;
+              for(uint32_t i = 0; i < numA * numB; i++)
+              {
+                 arm_sqrt_f32(pOut[i], &pOut[i]);
+              }
+           }
+        }
+        else
+        {
+           /* 1 - a.b / (||a|| ||b||) */
+           for(uint32_t j = 0; j < numB; j++)
+           {
+              arm_sqrt_f32(pNormB[j], &val);
+              pNormB[j] = 1.0f / val;
+           }
+           for(uint32_t i = 0; i < numA; i++)
+           {
+              arm_sqrt_f32(pNormA[i], &val);
+              na = 1.0f / val;
+              for(uint32_t j = 0; j < numB; j++)
+              {
+                 *pOut = 1.0f - *pOut * na * pNormB[j];
+                 pOut++;
+              }
+           }
+        }
+     }
+     break;
+
+     case ARM_CDIST_CITYBLOCK:
+     case ARM_CDIST_CHEBYSHEV:
+     case ARM_CDIST_BRAYCURTIS:
+     case ARM_CDIST_CANBERRA:
+     case ARM_CDIST_JENSENSHANNON:
+     {
+        pA = pSrcA->pData;
+        for(uint32_t i = 0; i < numA; i++)
+        {
+           pB = pSrcB->pData;
+           for(uint32_t j = 0; j < numB; j++)
+           {
+              switch(metric)
+              {
+                 case ARM_CDIST_CITYBLOCK:
+                    *pOut = arm_cityblock_distance_f32(pA, pB, dim);
+                 break;
+                 case ARM_CDIST_CHEBYSHEV:
+                    *pOut = arm_chebyshev_distance_f32(pA, pB, dim);
+                 break;
+                 case ARM_CDIST_BRAYCURTIS:
+                    *pOut = arm_braycurtis_distance_f32(pA, pB, dim);
+                 break;
+                 case ARM_CDIST_CANBERRA:
+                    *pOut = arm_canberra_distance_f32(pA, pB, dim);
+                 break;
+                 default:
+                    *pOut = arm_jensenshannon_distance_f32(pA, pB, dim);
+                 break;
+              }
+              pOut++;
+              pB += dim;
+           }
+           pA += dim;
+        }
+     }
+     break;
+
+     default:
+        return(ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  return(ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of cdist group
+ */
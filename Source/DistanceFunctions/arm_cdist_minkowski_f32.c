@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cdist_minkowski_f32.c
+ * Description:  Pairwise Minkowski distance matrix
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/distance_functions.h"
+#include <limits.h>
+#include <math.h>
+
+
+/**
+  @addtogroup cdist
+  @{
+ */
+
+/**
+ * @brief         Pairwise Minkowski distances between the rows of two matrices
+ * @param[in]     pSrcA    points to the first matrix (numA rows of vectorDimension samples)
+ * @param[in]     pSrcB    points to the second matrix (numB rows of vectorDimension samples)
+ * @param[in]     order    Distance order
+ * @param[out]    pDst     points to the distance matrix (numA rows * numB columns)
+ * @return        execution status
+ *                  - \ref ARM_MATH_SUCCESS       : Operation successful
+ *                  - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_cdist_minkowski_f32(const arm_matrix_instance_f32 *pSrcA,
+                                   const arm_matrix_instance_f32 *pSrcB,
+                                   int32_t order,
+                                   arm_matrix_instance_f32 *pDst)
+{
+  const uint32_t numA = pSrcA->numRows;
+  const uint32_t numB = pSrcB->numRows;
+  const uint32_t dim = pSrcA->numCols;
+  const float32_t *pA = pSrcA->pData;
+  const float32_t *pB;
+  float32_t *pOut = pDst->pData;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  if ((pSrcB->numCols != dim) ||
+      (pDst->numRows != numA) ||
+      (pDst->numCols != numB))
+  {
+    return(ARM_MATH_SIZE_MISMATCH);
+  }
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  for(uint32_t i = 0; i < numA; i++)
+  {
+     pB = pSrcB->pData;
+     for(uint32_t j = 0; j < numB; j++)
+     {
+        *pOut++ = arm_minkowski_distance_f32(pA, pB, order, dim);
+        pB += dim;
+     }
+     pA += dim;
+  }
+
+  return(ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of cdist group
+ */
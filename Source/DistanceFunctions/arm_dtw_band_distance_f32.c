@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dtw_band_distance_f32.c
+ * Description:  Band limited dynamic time warping distance
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/distance_functions.h"
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+
+
+/**
+  @addtogroup DTW
+  @{
+ */
+
+
+/**
+ * @brief         Band limited Dynamic Time Warping distance
+ * @param[in]     pQuery           Query sequence (queryLength * vectorDimension)
+ * @param[in]     queryLength      Number of feature vectors in the query
+ * @param[in]     pTemplate        Template sequence (templateLength * vectorDimension)
+ * @param[in]     templateLength   Number of feature vectors in the template
+ * @param[in]     vectorDimension  Dimension of the feature vectors
+ * @param[in]     windowSize       Sakoe-Chiba window size
+ * @param[in]     threshold        Early abandon threshold (F32_MAX to disable)
+ * @param[out]    pScratch         Temporary cost buffer of 2*(2*windowSize+1) samples
+ * @param[out]    distance         Distance
+ * @return ARM_MATH_ARGUMENT_ERROR in case no path can be found with window constraint
+ *
+ * @par Details
+ * The result is the same as the one of \ref arm_dtw_distance_f32
+ * with a Sakoe-Chiba window of size windowSize and a distance
+ * matrix containing the euclidean distances between
+ * the query and template feature vectors.
+ *
+ * The local distances are computed when needed and only
+ * the costs inside the band for the current and previous
+ * query vectors are kept. So no distance matrix is needed
+ * and the memory is proportional to the window size.
+ *
+ * @par Early abandon
+ * The costs can only increase along a warping path. When all
+ * the costs for a query vector are bigger than the cost corresponding
+ * to threshold, the final distance cannot be smaller than threshold
+ * and the computation is stopped.
+ *
+ * Whenever the distance is bigger than threshold, distance is
+ * set to F32_MAX.
+ *
+ * When searching the best template, threshold should be the
+ * best distance found so far.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_dtw_band_distance_f32(const float32_t *pQuery,
+                                     uint32_t queryLength,
+                                     const float32_t *pTemplate,
+                                     uint32_t templateLength,
+                                     uint32_t vectorDimension,
+                                     int32_t windowSize,
+                                     float32_t threshold,
+                                     float32_t *pScratch,
+                                     float32_t *distance)
+{
+   const int32_t bandWidth = 2*windowSize + 1;
+   float32_t *pPrev = pScratch;
+   float32_t *pCur = pScratch + bandWidth;
+   float32_t *pTmp;
+   float32_t maxCost, rowMin, d, cost, result;
+   int32_t tStart, tEnd, k;
+
+   if ((windowSize < 0) ||
+       (abs((int32_t)queryLength - (int32_t)templateLength) > windowSize))
+   {
+     return(ARM_MATH_ARGUMENT_ERROR);
+   }
+
+   /* Normalization is applied at the end so the threshold is
+      converted to a cost */
+   maxCost = threshold * (queryLength + templateLength);
+
+   for(int32_t q = 0; q < (int32_t)queryLength; q++)
+   {
+     /* Cell (q,t) of the band is at index t - q + windowSize */
+     tStart = (q > windowSize) ? q - windowSize : 0;
+     tEnd = q + windowSize;
+     if (tEnd > (int32_t)templateLength - 1)
+     {
+        tEnd = (int32_t)templateLength - 1;
+     }
+
+     for(k = 0; k < bandWidth; k++)
+     {
+        pCur[k] = F32_MAX;
+     }
+
+     rowMin = F32_MAX;
+     for(int32_t t = tStart; t <= tEnd; t++)
+     {
+        k = t - q + windowSize;
+
+        if (vectorDimension == 1U)
+        {
+           d = fabsf(pQuery[q] - pTemplate[t]);
+        }
+        else
+        {
+           d = arm_euclidean_distance_f32(pQuery + q*vectorDimension,
+                                          pTemplate + t*vectorDimension,
+                                          vectorDimension);
+        }
+
+        if (q == 0)
+        {
+           cost = (t == 0) ? d : pCur[k-1] + d;
+        }
+        else
+        {
+           cost = F32_MAX;
+           /* Diagonal step (q-1,t-1) */
+           if ((t > 0) && (pPrev[k] != F32_MAX))
+           {
+              cost = pPrev[k] + 2.0f * d;
+           }
+           /* Vertical step (q-1,t) */
+           if ((k + 1 < bandWidth) && (pPrev[k+1] != F32_MAX))
+           {
+              cost = MIN(cost, pPrev[k+1] + d);
+           }
+           /* Horizontal step (q,t-1) */
+           if ((t > tStart) && (pCur[k-1] != F32_MAX))
+           {
+              cost = MIN(cost, pCur[k-1] + d);
+           }
+        }
+
+        pCur[k] = cost;
+        rowMin = MIN(rowMin, cost);
+     }
+
+     if (rowMin > maxCost)
+     {
+        *distance = F32_MAX;
+        return(ARM_MATH_SUCCESS);
+     }
+
+     pTmp = pPrev;
+     pPrev = pCur;
+     pCur = pTmp;
+   }
+
+   /* Last template vector of the last query row */
+   result = pPrev[(int32_t)templateLength - (int32_t)queryLength + windowSize];
+   if (result == F32_MAX)
+   {
+     return(ARM_MATH_ARGUMENT_ERROR);
+   }
+
+   result = result / (queryLength + templateLength);
+   *distance = (result > threshold) ? F32_MAX : result;
+
+   return(ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of DTW group
+ */
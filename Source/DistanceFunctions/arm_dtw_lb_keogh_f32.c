@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dtw_lb_keogh_f32.c
+ * Description:  LB_Keogh lower bound for dynamic time warping
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/distance_functions.h"
+#include <limits.h>
+#include <math.h>
+
+
+/**
+  @addtogroup DTW
+  @{
+ */
+
+
+/**
+ * @brief         Envelope of a template for the LB_Keogh lower bound
+ * @param[in]     pTemplate        Template sequence (templateLength * vectorDimension)
+ * @param[in]     templateLength   Number of feature vectors in the template
+ * @param[in]     vectorDimension  Dimension of the feature vectors
+ * @param[in]     windowSize       Sakoe-Chiba window size
+ * @param[out]    pUpper           Upper envelope (templateLength * vectorDimension)
+ * @param[out]    pLower           Lower envelope (templateLength * vectorDimension)
+ *
+ * @par Details
+ * For each feature, the envelope contains the maximum and minimum
+ * of the template values inside the window around each position.
+ * It only depends on the template and can be computed
+ * once for all the queries.
+ */
+ARM_DSP_ATTRIBUTE void arm_dtw_lb_keogh_envelope_f32(const float32_t *pTemplate,
+                                   uint32_t templateLength,
+                                   uint32_t vectorDimension,
+                                   int32_t windowSize,
+                                   float32_t *pUpper,
+                                   float32_t *pLower)
+{
+   int32_t tStart, tEnd;
+   float32_t minVal, maxVal, val;
+
+   for(int32_t i = 0; i < (int32_t)templateLength; i++)
+   {
+      tStart = (i > windowSize) ? i - windowSize : 0;
+      tEnd = i + windowSize;
+      if (tEnd > (int32_t)templateLength - 1)
+      {
+         tEnd = (int32_t)templateLength - 1;
+      }
+
+      for(uint32_t f = 0; f < vectorDimension; f++)
+      {
+         minVal = F32_MAX;
+         maxVal = -F32_MAX;
+         for(int32_t t = tStart; t <= tEnd; t++)
+         {
+            val = pTemplate[t*vectorDimension + f];
+            minVal = MIN(minVal, val);
+            maxVal = MAX(maxVal, val);
+         }
+         pUpper[i*vectorDimension + f] = maxVal;
+         pLower[i*vectorDimension + f] = minVal;
+      }
+   }
+}
+
+/**
+ * @brief         LB_Keogh lower bound of the Dynamic Time Warping distance
+ * @param[in]     pQuery           Query sequence (length * vectorDimension)
+ * @param[in]     pUpper           Upper envelope of the template
+ * @param[in]     pLower           Lower envelope of the template
+ * @param[in]     length           Number of feature vectors in the query and template
+ * @param[in]     vectorDimension  Dimension of the feature vectors
+ * @return Lower bound
+ *
+ * @par Details
+ * The result is a lower bound of the distance computed by
+ * \ref arm_dtw_band_distance_f32 when the query and template
+ * have the same length and the same window size is used.
+ *
+ * It is much cheaper than the DTW distance and can be
+ * used to discard a template without computing the
+ * DTW distance : if the lower bound is bigger than the best
+ * distance found so far, the template cannot be better.
+ */
+ARM_DSP_ATTRIBUTE float32_t arm_dtw_lb_keogh_f32(const float32_t *pQuery,
+                               const float32_t *pUpper,
+                               const float32_t *pLower,
+                               uint32_t length,
+                               uint32_t vectorDimension)
+{
+   float32_t sum = 0.0f;
+   float32_t acc, val, diff;
+
+   for(uint32_t i = 0; i < length; i++)
+   {
+      /* Distance between the query vector and the box
+         defined by the envelope */
+      acc = 0.0f;
+      for(uint32_t f = 0; f < vectorDimension; f++)
+      {
+         val = *pQuery++;
+         diff = 0.0f;
+         if (val > *pUpper)
+         {
+            diff = val - *pUpper;
+         }
+         else if (val < *pLower)
+         {
+            diff = *pLower - val;
+         }
+         acc += diff * diff;
+         pUpper++;
+         pLower++;
+      }
+      sum += sqrtf(acc);
+   }
+
+   return(sum / (2.0f * length));
+}
+
+/**
+ * @} end of DTW group
+ */
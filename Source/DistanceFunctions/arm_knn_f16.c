@@ -0,0 +1,227 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_knn_f16.c
+ * Description:  Brute force k-nearest neighbours search
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/distance_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+#include <limits.h>
+#include <math.h>
+#include "arm_knn.h"
+
+#if defined(ARM_MATH_MVE_FLOAT16) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_helium_utils.h"
+#endif
+
+/* Number of queries processed together. Each reference
+   vector is loaded once for all the queries of a tile. */
+#define ARM_KNN_TILE_F16 4
+
+ARM_KNN_DEFINE_HEAP(f16,float16_t,_Float16)
+
+/* Squared distances between nbQueries queries and one reference */
+__STATIC_FORCEINLINE void arm_knn_tile_f16(const float16_t *pQuery,
+                                           uint32_t nbQueries,
+                                           const float16_t *pRef,
+                                           uint32_t dim,
+                                           float16_t *pDist)
+{
+#if defined(ARM_MATH_MVE_FLOAT16) && !defined(ARM_MATH_AUTOVECTORIZE)
+    if (nbQueries == ARM_KNN_TILE_F16)
+    {
+        const float16_t *pQ0 = pQuery;
+        const float16_t *pQ1 = pQ0 + dim;
+        const float16_t *pQ2 = pQ1 + dim;
+        const float16_t *pQ3 = pQ2 + dim;
+        const float16_t *pR = pRef;
+        f16x8_t acc0 = vdupq_n_f16(0.0f);
+        f16x8_t acc1 = vdupq_n_f16(0.0f);
+        f16x8_t acc2 = vdupq_n_f16(0.0f);
+        f16x8_t acc3 = vdupq_n_f16(0.0f);
+        f16x8_t r, t;
+        int32_t blkCnt = (int32_t)dim;
+
+        while (blkCnt > 0)
+        {
+            mve_pred16_t p0 = vctp16q(blkCnt);
+
+            r = vldrhq_z_f16(pR, p0);
+            t = vsubq(vldrhq_z_f16(pQ0, p0), r);
+            acc0 = vfmaq_m(acc0, t, t, p0);
+            t = vsubq(vldrhq_z_f16(pQ1, p0), r);
+            acc1 = vfmaq_m(acc1, t, t, p0);
+            t = vsubq(vldrhq_z_f16(pQ2, p0), r);
+            acc2 = vfmaq_m(acc2, t, t, p0);
+            t = vsubq(vldrhq_z_f16(pQ3, p0), r);
+            acc3 = vfmaq_m(acc3, t, t, p0);
+
+            pR += 8;
+            pQ0 += 8;
+            pQ1 += 8;
+            pQ2 += 8;
+            pQ3 += 8;
+            blkCnt -= 8;
+        }
+
+        pDist[0] = vecAddAcrossF16Mve(acc0);
+        pDist[1] = vecAddAcrossF16Mve(acc1);
+        pDist[2] = vecAddAcrossF16Mve(acc2);
+        pDist[3] = vecAddAcrossF16Mve(acc3);
+        return;
+    }
+#else
+    if (nbQueries == ARM_KNN_TILE_F16)
+    {
+        const float16_t *pQ0 = pQuery;
+        const float16_t *pQ1 = pQ0 + dim;
+        const float16_t *pQ2 = pQ1 + dim;
+        const float16_t *pQ3 = pQ2 + dim;
+        _Float16 acc0 = 0.0f16, acc1 = 0.0f16, acc2 = 0.0f16, acc3 = 0.0f16;
+        _Float16 r, t;
+
+        for (uint32_t j = 0; j < dim; j++)
+        {
+            r = (_Float16)pRef[j];
+            t = (_Float16)pQ0[j] - r;
+            acc0 += t * t;
+            t = (_Float16)pQ1[j] - r;
+            acc1 += t * t;
+            t = (_Float16)pQ2[j] - r;
+            acc2 += t * t;
+            t = (_Float16)pQ3[j] - r;
+            acc3 += t * t;
+        }
+
+        pDist[0] = acc0;
+        pDist[1] = acc1;
+        pDist[2] = acc2;
+        pDist[3] = acc3;
+        return;
+    }
+#endif
+
+    for (uint32_t q = 0; q < nbQueries; q++)
+    {
+        _Float16 acc = 0.0f16, t;
+
+        for (uint32_t j = 0; j < dim; j++)
+        {
+            t = (_Float16)pQuery[j] - (_Float16)pRef[j];
+            acc += t * t;
+        }
+        pDist[q] = acc;
+        pQuery += dim;
+    }
+}
+
+/**
+  @addtogroup KNN
+  @{
+ */
+
+/**
+ * @brief         k nearest neighbours of query vectors
+ * @param[in]     pQueries     points to the queries (numQueries rows of vectorDimension samples)
+ * @param[in]     pReferences  points to the references (numReferences rows of vectorDimension samples)
+ * @param[in]     k            number of neighbours
+ * @param[out]    pIndices     indices of the neighbours (numQueries rows of k indices)
+ * @param[out]    pDistances   euclidean distances to the neighbours (numQueries rows of k distances)
+ * @return        execution status
+ *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+ *                  - \ref ARM_MATH_SIZE_MISMATCH  : Dimension of queries and references are different
+ *                  - \ref ARM_MATH_ARGUMENT_ERROR : k is 0 or bigger than the number of references
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_knn_f16(const arm_matrix_instance_f16 *pQueries,
+                       const arm_matrix_instance_f16 *pReferences,
+                       uint32_t k,
+                       uint32_t *pIndices,
+                       float16_t *pDistances)
+{
+  const uint32_t numQueries = pQueries->numRows;
+  const uint32_t numRefs = pReferences->numRows;
+  const uint32_t dim = pQueries->numCols;
+  float16_t dist[ARM_KNN_TILE_F16];
+  float16_t *pDist;
+  uint32_t *pIdx, nbQueries, i;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  if (pReferences->numCols != dim)
+  {
+    return(ARM_MATH_SIZE_MISMATCH);
+  }
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  if ((k == 0U) || (k > numRefs))
+  {
+    return(ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (uint32_t q = 0; q < numQueries; q += ARM_KNN_TILE_F16)
+  {
+     nbQueries = MIN(ARM_KNN_TILE_F16, numQueries - q);
+
+     for (uint32_t r = 0; r < numRefs; r++)
+     {
+        arm_knn_tile_f16(pQueries->pData + q * dim, nbQueries,
+                         pReferences->pData + r * dim, dim, dist);
+
+        for (uint32_t t = 0; t < nbQueries; t++)
+        {
+           pDist = pDistances + (q + t) * k;
+           pIdx = pIndices + (q + t) * k;
+
+           arm_knn_push_f16(pDist, pIdx, k, r, dist[t]);
+        }
+     }
+  }
+
+  /* Sort the heaps by increasing distance */
+  for (uint32_t q = 0; q < numQueries; q++)
+  {
+     pDist = pDistances + q * k;
+     pIdx = pIndices + q * k;
+
+     arm_knn_sort_f16(pDist, pIdx, k);
+
+     for (i = 0; i < k; i++)
+     {
+        arm_sqrt_f16(pDist[i], &pDist[i]);
+     }
+  }
+
+  return(ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of KNN group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
@@ -0,0 +1,244 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_knn_f32.c
+ * Description:  Brute force k-nearest neighbours search
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/distance_functions.h"
+#include <limits.h>
+#include <math.h>
+#include "arm_knn.h"
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_helium_utils.h"
+#endif
+
+/* Number of queries processed together. Each reference
+   vector is loaded once for all the queries of a tile. */
+#define ARM_KNN_TILE_F32 4
+
+ARM_KNN_DEFINE_HEAP(f32,float32_t,float32_t)
+
+/* Squared distances between nbQueries queries and one reference */
+__STATIC_FORCEINLINE void arm_knn_tile_f32(const float32_t *pQuery,
+                                           uint32_t nbQueries,
+                                           const float32_t *pRef,
+                                           uint32_t dim,
+                                           float32_t *pDist)
+{
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+    if (nbQueries == ARM_KNN_TILE_F32)
+    {
+        const float32_t *pQ0 = pQuery;
+        const float32_t *pQ1 = pQ0 + dim;
+        const float32_t *pQ2 = pQ1 + dim;
+        const float32_t *pQ3 = pQ2 + dim;
+        const float32_t *pR = pRef;
+        f32x4_t acc0 = vdupq_n_f32(0.0f);
+        f32x4_t acc1 = vdupq_n_f32(0.0f);
+        f32x4_t acc2 = vdupq_n_f32(0.0f);
+        f32x4_t acc3 = vdupq_n_f32(0.0f);
+        f32x4_t r, t;
+        int32_t blkCnt = (int32_t)dim;
+
+        while (blkCnt > 0)
+        {
+            mve_pred16_t p0 = vctp32q(blkCnt);
+
+            r = vldrwq_z_f32(pR, p0);
+            t = vsubq(vldrwq_z_f32(pQ0, p0), r);
+            acc0 = vfmaq_m(acc0, t, t, p0);
+            t = vsubq(vldrwq_z_f32(pQ1, p0), r);
+            acc1 = vfmaq_m(acc1, t, t, p0);
+            t = vsubq(vldrwq_z_f32(pQ2, p0), r);
+            acc2 = vfmaq_m(acc2, t, t, p0);
+            t = vsubq(vldrwq_z_f32(pQ3, p0), r);
+            acc3 = vfmaq_m(acc3, t, t, p0);
+
+            pR += 4;
+            pQ0 += 4;
+            pQ1 += 4;
+            pQ2 += 4;
+            pQ3 += 4;
+            blkCnt -= 4;
+        }
+
+        pDist[0] = vecAddAcrossF32Mve(acc0);
+        pDist[1] = vecAddAcrossF32Mve(acc1);
+        pDist[2] = vecAddAcrossF32Mve(acc2);
+        pDist[3] = vecAddAcrossF32Mve(acc3);
+        return;
+    }
+#else
+    if (nbQueries == ARM_KNN_TILE_F32)
+    {
+        const float32_t *pQ0 = pQuery;
+        const float32_t *pQ1 = pQ0 + dim;
+        const float32_t *pQ2 = pQ1 + dim;
+        const float32_t *pQ3 = pQ2 + dim;
+        float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+        float32_t r, t;
+
+        for (uint32_t j = 0; j < dim; j++)
+        {
+            r = pRef[j];
+            t = pQ0[j] - r;
+            acc0 += t * t;
+            t = pQ1[j] - r;
+            acc1 += t * t;
+            t = pQ2[j] - r;
+            acc2 += t * t;
+            t = pQ3[j] - r;
+            acc3 += t * t;
+        }
+
+        pDist[0] = acc0;
+        pDist[1] = acc1;
+        pDist[2] = acc2;
+        pDist[3] = acc3;
+        return;
+    }
+#endif
+
+    for (uint32_t q = 0; q < nbQueries; q++)
+    {
+        float32_t acc = 0.0f, t;
+
+        for (uint32_t j = 0; j < dim; j++)
+        {
+            t = pQuery[j] - pRef[j];
+            acc += t * t;
+        }
+        pDist[q] = acc;
+        pQuery += dim;
+    }
+}
+
+/**
+  @ingroup groupDistance
+ */
+
+/**
+  @defgroup KNN k-Nearest Neighbours
+
+  Brute force search of the k nearest neighbours
+  of query vectors in a set of reference vectors.
+
+  The euclidean distances between a tile of queries and
+  each reference are computed together so that each
+  reference vector is loaded only once per tile.
+  For each query, the k best candidates are kept in
+  a max-heap in the output buffers. So, there is no need
+  to store or sort all the distances.
+
+  The neighbours are returned by increasing distance.
+  When distances are equal, the smallest reference index
+  comes first.
+ */
+
+/**
+  @addtogroup KNN
+  @{
+ */
+
+/**
+ * @brief         k nearest neighbours of query vectors
+ * @param[in]     pQueries     points to the queries (numQueries rows of vectorDimension samples)
+ * @param[in]     pReferences  points to the references (numReferences rows of vectorDimension samples)
+ * @param[in]     k            number of neighbours
+ * @param[out]    pIndices     indices of the neighbours (numQueries rows of k indices)
+ * @param[out]    pDistances   euclidean distances to the neighbours (numQueries rows of k distances)
+ * @return        execution status
+ *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+ *                  - \ref ARM_MATH_SIZE_MISMATCH  : Dimension of queries and references are different
+ *                  - \ref ARM_MATH_ARGUMENT_ERROR : k is 0 or bigger than the number of references
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_knn_f32(const arm_matrix_instance_f32 *pQueries,
+                       const arm_matrix_instance_f32 *pReferences,
+                       uint32_t k,
+                       uint32_t *pIndices,
+                       float32_t *pDistances)
+{
+  const uint32_t numQueries = pQueries->numRows;
+  const uint32_t numRefs = pReferences->numRows;
+  const uint32_t dim = pQueries->numCols;
+  float32_t dist[ARM_KNN_TILE_F32];
+  float32_t *pDist;
+  uint32_t *pIdx, nbQueries, i;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  if (pReferences->numCols != dim)
+  {
+    return(ARM_MATH_SIZE_MISMATCH);
+  }
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  if ((k == 0U) || (k > numRefs))
+  {
+    return(ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (uint32_t q = 0; q < numQueries; q += ARM_KNN_TILE_F32)
+  {
+     nbQueries = MIN(ARM_KNN_TILE_F32, numQueries - q);
+
+     for (uint32_t r = 0; r < numRefs; r++)
+     {
+        arm_knn_tile_f32(pQueries->pData + q * dim, nbQueries,
+                         pReferences->pData + r * dim, dim, dist);
+
+        for (uint32_t t = 0; t < nbQueries; t++)
+        {
+           pDist = pDistances + (q + t) * k;
+           pIdx = pIndices + (q + t) * k;
+
+           arm_knn_push_f32(pDist, pIdx, k, r, dist[t]);
+        }
+     }
+  }
+
+  /* Sort the heaps by increasing distance */
+  for (uint32_t q = 0; q < numQueries; q++)
+  {
+     pDist = pDistances + q * k;
+     pIdx = pIndices + q * k;
+
+     arm_knn_sort_f32(pDist, pIdx, k);
+
+     for (i = 0; i < k; i++)
+     {
+        arm_sqrt_f32(pDist[i], &pDist[i]);
+     }
+  }
+
+  return(ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of KNN group
+ */
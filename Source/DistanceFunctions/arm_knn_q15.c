@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_knn_q15.c
+ * Description:  Q15 brute force k-nearest neighbours search
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/distance_functions.h"
+#include <limits.h>
+#include <math.h>
+#include "arm_knn.h"
+
+
+/* Number of queries processed together. Each reference
+   vector is loaded once for all the queries of a tile. */
+#define ARM_KNN_TILE_Q15 4
+
+ARM_KNN_DEFINE_HEAP(q15,q63_t,q63_t)
+
+/* Squared distances between nbQueries queries and one reference */
+__STATIC_FORCEINLINE void arm_knn_tile_q15(const q15_t *pQuery,
+                                           uint32_t nbQueries,
+                                           const q15_t *pRef,
+                                           uint32_t dim,
+                                           q63_t *pDist)
+{
+    if (nbQueries == ARM_KNN_TILE_Q15)
+    {
+        const q15_t *pQ0 = pQuery;
+        const q15_t *pQ1 = pQ0 + dim;
+        const q15_t *pQ2 = pQ1 + dim;
+        const q15_t *pQ3 = pQ2 + dim;
+        q63_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+        q31_t r, t;
+
+        for (uint32_t j = 0; j < dim; j++)
+        {
+            r = pRef[j];
+            t = pQ0[j] - r;
+            acc0 += (q63_t) t * t;
+            t = pQ1[j] - r;
+            acc1 += (q63_t) t * t;
+            t = pQ2[j] - r;
+            acc2 += (q63_t) t * t;
+            t = pQ3[j] - r;
+            acc3 += (q63_t) t * t;
+        }
+
+        pDist[0] = acc0;
+        pDist[1] = acc1;
+        pDist[2] = acc2;
+        pDist[3] = acc3;
+        return;
+    }
+
+    for (uint32_t q = 0; q < nbQueries; q++)
+    {
+        q63_t acc = 0;
+        q31_t t;
+
+        for (uint32_t j = 0; j < dim; j++)
+        {
+            t = (q31_t) pQuery[j] - pRef[j];
+            acc += (q63_t) t * t;
+        }
+        pDist[q] = acc;
+        pQuery += dim;
+    }
+}
+
+/**
+  @addtogroup KNN
+  @{
+ */
+
+/**
+ * @brief         k nearest neighbours of query vectors
+ * @param[in]     pQueries     points to the queries (numQueries rows of vectorDimension samples)
+ * @param[in]     pReferences  points to the references (numReferences rows of vectorDimension samples)
+ * @param[in]     k            number of neighbours
+ * @param[out]    pIndices     indices of the neighbours (numQueries rows of k indices)
+ * @param[out]    pDistances   squared euclidean distances to the neighbours (numQueries rows of k distances)
+ * @return        execution status
+ *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+ *                  - \ref ARM_MATH_SIZE_MISMATCH  : Dimension of queries and references are different
+ *                  - \ref ARM_MATH_ARGUMENT_ERROR : k is 0 or bigger than the number of references
+ *
+ * @par           Scaling and Overflow Behavior
+ *                  The squared distances are computed exactly in a 64-bit
+ *                  accumulator and returned in 34.30 format. There is no sqrt
+ *                  so the distances are exact and the ordering is not
+ *                  affected by rounding.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_knn_q15(const arm_matrix_instance_q15 *pQueries,
+                       const arm_matrix_instance_q15 *pReferences,
+                       uint32_t k,
+                       uint32_t *pIndices,
+                       q63_t *pDistances)
+{
+  const uint32_t numQueries = pQueries->numRows;
+  const uint32_t numRefs = pReferences->numRows;
+  const uint32_t dim = pQueries->numCols;
+  q63_t dist[ARM_KNN_TILE_Q15];
+  q63_t *pDist;
+  uint32_t *pIdx, nbQueries;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  if (pReferences->numCols != dim)
+  {
+    return(ARM_MATH_SIZE_MISMATCH);
+  }
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  if ((k == 0U) || (k > numRefs))
+  {
+    return(ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (uint32_t q = 0; q < numQueries; q += ARM_KNN_TILE_Q15)
+  {
+     nbQueries = MIN(ARM_KNN_TILE_Q15, numQueries - q);
+
+     for (uint32_t r = 0; r < numRefs; r++)
+     {
+        arm_knn_tile_q15(pQueries->pData + q * dim, nbQueries,
+                         pReferences->pData + r * dim, dim, dist);
+
+        for (uint32_t t = 0; t < nbQueries; t++)
+        {
+           pDist = pDistances + (q + t) * k;
+           pIdx = pIndices + (q + t) * k;
+
+           arm_knn_push_q15(pDist, pIdx, k, r, dist[t]);
+        }
+     }
+  }
+
+  /* Sort the heaps by increasing distance */
+  for (uint32_t q = 0; q < numQueries; q++)
+  {
+     pDist = pDistances + q * k;
+     pIdx = pIndices + q * k;
+
+     arm_knn_sort_q15(pDist, pIdx, k);
+  }
+
+  return(ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of KNN group
+ */
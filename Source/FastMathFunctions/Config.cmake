@@ -33,12 +33,25 @@ target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vexp_f64.c)
 target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vlog_q31.c)
 target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vlog_q15.c)
 
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vsin_f32.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vcos_f32.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vsincos_f32.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vsin_q31.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vcos_q31.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vsincos_q31.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vsin_q15.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vcos_q15.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vsincos_q15.c)
+
 
 if ((NOT ARMAC5) AND (NOT DISABLEFLOAT16))
 target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vlog_f16.c)
 target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vexp_f16.c)
 target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vinverse_f16.c)
 target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_atan2_f16.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vsin_f16.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vcos_f16.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vsincos_f16.c)
 endif()
 
 target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_divide_q15.c)
@@ -48,6 +61,14 @@ target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_atan2_f32.c)
 target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_atan2_q31.c)
 target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_atan2_q15.c)
 
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vatan2_f32.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vatan2_q31.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vatan2_q15.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vsqrt_q31.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vsqrt_q15.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vdivide_q31.c)
+target_sources(CMSISDSP PRIVATE FastMathFunctions/arm_vdivide_q15.c)
+
 
 endif()
 
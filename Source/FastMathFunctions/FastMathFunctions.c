@@ -55,3 +55,19 @@
 #include "arm_atan2_f32.c"
 #include "arm_atan2_q31.c"
 #include "arm_atan2_q15.c"
+#include "arm_vsin_f32.c"
+#include "arm_vcos_f32.c"
+#include "arm_vsincos_f32.c"
+#include "arm_vsin_q31.c"
+#include "arm_vcos_q31.c"
+#include "arm_vsincos_q31.c"
+#include "arm_vsin_q15.c"
+#include "arm_vcos_q15.c"
+#include "arm_vsincos_q15.c"
+#include "arm_vatan2_f32.c"
+#include "arm_vatan2_q31.c"
+#include "arm_vatan2_q15.c"
+#include "arm_vsqrt_q31.c"
+#include "arm_vsqrt_q15.c"
+#include "arm_vdivide_q31.c"
+#include "arm_vdivide_q15.c"
@@ -30,3 +30,6 @@
 #include "arm_vlog_f16.c"
 #include "arm_vinverse_f16.c"
 #include "arm_atan2_f16.c"
+#include "arm_vsin_f16.c"
+#include "arm_vcos_f16.c"
+#include "arm_vsincos_f16.c"
@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vatan2_f32.c
+ * Description:  Vectorized floating-point arc tangent of y/x
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/fast_math_functions.h"
+#include "arm_atan2.h"
+
+#if (defined(ARM_MATH_MVEF) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_vec_math.h"
+#endif
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup atan2
+  @{
+ */
+
+/**
+  @brief         Arc tangent of y/x for vectors of coordinates
+  @param[in]     pSrcY      points to the vector of y coordinates
+  @param[in]     pSrcX      points to the vector of x coordinates
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        error status
+                   - \ref ARM_MATH_SUCCESS : all the angles are defined
+                   - \ref ARM_MATH_NANINF  : at least one pair is (0, 0); its angle is set to 0
+
+  @par           Details
+                   Same result as arm_atan2_f32 for each pair of coordinates.
+                   The smallest coordinate is divided by the biggest one and
+                   the quadrant is selected from the signs and the order of the
+                   coordinates, so the computation has no branch and can be
+                   vectorized.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_vatan2_f32(
+  const float32_t * pSrcY,
+  const float32_t * pSrcX,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+   uint32_t blkCnt;
+   arm_status status = ARM_MATH_SUCCESS;
+   float32_t y, x, ax, ay, num, den, res;
+
+#if (defined(ARM_MATH_MVEF) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE)
+   f32x4_t vecY, vecX, vecAx, vecAy, vecRatio, vecRes;
+   mve_pred16_t pSwap;
+   int i;
+
+   blkCnt = blockSize >> 2;
+
+   while (blkCnt > 0U)
+   {
+      vecY = vld1q(pSrcY);
+      vecX = vld1q(pSrcX);
+
+      vecAx = vabsq(vecX);
+      vecAy = vabsq(vecY);
+
+      /* Ratio in [0, 1]. When both coordinates are 0, the ratio is 0 */
+      pSwap = vcmpgtq(vecAy, vecAx);
+      vecRatio = vdiv_f32(vpselq(vecAx, vecAy, pSwap), vpselq(vecAy, vecAx, pSwap));
+      if (vcmpeqq_n_f32(vmaxnmq(vecAx, vecAy), 0.0f) != 0U)
+      {
+         status = ARM_MATH_NANINF;
+      }
+
+      vecRes = vdupq_n_f32(atan2_coefs_f32[ATAN2_NB_COEFS_F32-1]);
+      for (i = 1; i < ATAN2_NB_COEFS_F32; i++)
+      {
+         vecRes = vfmaq(vdupq_n_f32(atan2_coefs_f32[ATAN2_NB_COEFS_F32-1-i]), vecRes, vecRatio);
+      }
+
+      /* Quadrant */
+      vecRes = vpselq(vsubq(vdupq_n_f32(PIHALFF32), vecRes), vecRes, pSwap);
+      vecRes = vpselq(vsubq(vdupq_n_f32(PI), vecRes), vecRes, vcmpltq_n_f32(vecX, 0.0f));
+      vecRes = vnegq_m(vecRes, vecRes, vcmpltq_n_s32(vreinterpretq_s32_f32(vecY), 0));
+
+      vst1q(pDst, vecRes);
+
+      pSrcY += 4;
+      pSrcX += 4;
+      pDst += 4;
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   blkCnt = blockSize & 3;
+#else
+   blkCnt = blockSize;
+#endif
+
+   while (blkCnt > 0U)
+   {
+      y = *pSrcY++;
+      x = *pSrcX++;
+
+      ax = fabsf(x);
+      ay = fabsf(y);
+
+      /* Ratio in [0, 1] */
+      num = (ay > ax) ? ax : ay;
+      den = (ay > ax) ? ay : ax;
+
+      if (den == 0.0f)
+      {
+         res = 0.0f;
+         status = ARM_MATH_NANINF;
+      }
+      else
+      {
+         res = arm_atan_limited_f32(num / den);
+
+         /* Quadrant */
+         res = (ay > ax) ? PIHALFF32 - res : res;
+         res = (x < 0.0f) ? PI - res : res;
+         res = signbit(y) ? -res : res;
+      }
+
+      *pDst++ = res;
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   return (status);
+}
+
+/**
+  @} end of atan2 group
+ */
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vatan2_q31.c
+ * Description:  Vectorized Q31 arc tangent of y/x
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/fast_math_functions.h"
+#include "arm_atan2.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup atan2
+  @{
+ */
+
+/**
+  @brief         Arc tangent of y/x for vectors of coordinates
+  @param[in]     pSrcY      points to the vector of y coordinates
+  @param[in]     pSrcX      points to the vector of x coordinates
+  @param[out]    pDst       points to the output vector in Q2.29
+  @param[in]     blockSize  number of samples in each vector
+  @return        error status
+                   - \ref ARM_MATH_SUCCESS : all the angles are defined
+                   - \ref ARM_MATH_NANINF  : at least one pair is (0, 0); its angle is set to 0
+
+  @par           Details
+                   Same result as arm_atan2_q31 for each pair of coordinates.
+                   The computation is inlined in the loop. It relies on a
+                   fixed-point division, so there is no vector version.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_vatan2_q31(
+  const q31_t * pSrcY,
+  const q31_t * pSrcX,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+   uint32_t blkCnt = blockSize;
+   arm_status status = ARM_MATH_SUCCESS;
+   q31_t res;
+
+   while (blkCnt > 0U)
+   {
+      res = 0;
+      if (arm_atan2_core_q31(*pSrcY++, *pSrcX++, &res) != ARM_MATH_SUCCESS)
+      {
+         status = ARM_MATH_NANINF;
+      }
+      *pDst++ = res;
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   return (status);
+}
+
+/**
+  @} end of atan2 group
+ */
@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vdivide_q15.c
+ * Description:  Vectorized Q15 division
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/fast_math_functions.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup divide
+  @{
+ */
+
+/**
+  @brief         Fixed point division of vectors
+  @param[in]     pNumerator    points to the vector of numerators
+  @param[in]     pDenominator  points to the vector of denominators
+  @param[out]    pQuotient     points to the vector of quotients normalized between -1.0 and 1.0
+  @param[out]    pShift        points to the vector of left shifts to get the unnormalized quotients
+  @param[in]     blockSize     number of samples in each vector
+  @return        error status
+
+  @par           Details
+                   Same result as arm_divide_q15 for each pair of values.
+                   When at least one denominator is 0, ARM_MATH_NANINF is returned
+                   and the corresponding quotient is forced to the saturated negative
+                   or positive value.
+                   The quotients are exact, so the division cannot be replaced by a vector
+                   reciprocal approximation and there is no vector version.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_vdivide_q15(
+  const q15_t * pNumerator,
+  const q15_t * pDenominator,
+        q15_t * pQuotient,
+        int16_t * pShift,
+        uint32_t blockSize)
+{
+   uint32_t blkCnt = blockSize;
+   arm_status status = ARM_MATH_SUCCESS;
+
+   while (blkCnt > 0U)
+   {
+      if (arm_divide_q15(*pNumerator++, *pDenominator++, pQuotient++, pShift++) != ARM_MATH_SUCCESS)
+      {
+         status = ARM_MATH_NANINF;
+      }
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   return (status);
+}
+
+/**
+  @} end of divide group
+ */
@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsin_f32.c
+ * Description:  Vectorized sine
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/fast_math_functions.h"
+#include "arm_sincos.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+   @defgroup vsincos Vector Sine and Cosine
+
+   Computes the sine and cosine of a vector of angles.
+
+   Each angle is reduced to [-pi/4, pi/4] around the nearest multiple
+   of pi/2 and the sine and cosine of the reduced angle are approximated
+   with minimax polynomials. There is no table lookup, so the same
+   instructions are used for all the lanes of a vector.
+
+   The floating-point functions take angles in radians. The range
+   reduction is done with a 3 parts pi/2 and the absolute error is below
+   1e-7 for |x| < 8192. The f16 functions compute in single precision.
+
+   The Q31 and Q15 functions use the same input scaling as arm_sin_q31
+   and arm_sin_q15 : the input is in unit of 2*pi and negative
+   values are accepted. The range reduction is exact in fixed-point
+   and the polynomials are evaluated with Q31 rounding multiplications,
+   so no floating-point unit is needed. The absolute error is below
+   4 LSB in Q31. The Q15 results are the Q31 ones rounded to Q15.
+   Outputs are saturated.
+
+   When both the sine and the cosine are needed, arm_vsincos computes them
+   with one range reduction.
+*/
+
+/**
+  @addtogroup vsincos
+  @{
+ */
+
+/**
+  @brief         Floating-point vector of sine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+
+  @par           Details
+                   The angles are in radians.
+ */
+ARM_DSP_ATTRIBUTE void arm_vsin_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+   uint32_t blkCnt;
+   float32_t sinVal, cosVal;
+
+#if (defined(ARM_MATH_MVEF) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE)
+   f32x4_t vecSin, vecCos;
+
+   blkCnt = blockSize >> 2;
+
+   while (blkCnt > 0U)
+   {
+      vsincosq_f32(vld1q(pSrc), &vecSin, &vecCos);
+      vst1q(pDst, vecSin);
+      pSrc += 4;
+      pDst += 4;
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   blkCnt = blockSize & 3;
+#else
+   blkCnt = blockSize;
+#endif
+
+   while (blkCnt > 0U)
+   {
+      arm_sincos_core_f32(*pSrc++, &sinVal, &cosVal);
+      *pDst++ = sinVal;
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+}
+
+/**
+  @} end of vsincos group
+ */
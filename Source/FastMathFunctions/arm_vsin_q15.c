@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsin_q15.c
+ * Description:  Vectorized sine
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/fast_math_functions.h"
+#include "arm_sincos.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup vsincos
+  @{
+ */
+
+/**
+  @brief         Q15 vector of sine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+
+  @par           Details
+                   The angles are scaled like in arm_sin_q15.
+ */
+ARM_DSP_ATTRIBUTE void arm_vsin_q15(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+   uint32_t blkCnt;
+   q15_t sinVal, cosVal;
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+   q15x8_t vecSrc, vecDst = vdupq_n_s16(0);
+   q31x4_t vecSinB, vecCosB, vecSinT, vecCosT;
+
+   blkCnt = blockSize >> 3;
+
+   while (blkCnt > 0U)
+   {
+      vecSrc = vld1q(pSrc);
+
+      /* Even and odd samples are converted to Q31 angles */
+      vsincosq_q31(vshlq_n_s32(vmovlbq(vecSrc), 16), &vecSinB, &vecCosB);
+      vsincosq_q31(vshlq_n_s32(vmovltq(vecSrc), 16), &vecSinT, &vecCosT);
+      vecDst = vqrshrnbq_n_s32(vecDst, vecSinB, 16);
+      vecDst = vqrshrntq_n_s32(vecDst, vecSinT, 16);
+      vst1q(pDst, vecDst);
+      pSrc += 8;
+      pDst += 8;
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   blkCnt = blockSize & 7;
+#else
+   blkCnt = blockSize;
+#endif
+
+   while (blkCnt > 0U)
+   {
+      arm_sincos_core_q15(*pSrc++, &sinVal, &cosVal);
+      *pDst++ = sinVal;
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+}
+
+/**
+  @} end of vsincos group
+ */
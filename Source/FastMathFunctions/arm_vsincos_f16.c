@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsincos_f16.c
+ * Description:  Vectorized sine and cosine
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/fast_math_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+#include "arm_sincos.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup vsincos
+  @{
+ */
+
+/**
+  @brief         Floating-point vector of sine and cosine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pSin       points to the output vector of sines
+  @param[out]    pCos       points to the output vector of cosines
+  @param[in]     blockSize  number of samples in each vector
+
+  @par           Details
+                   The angles are in radians.
+ */
+ARM_DSP_ATTRIBUTE void arm_vsincos_f16(
+  const float16_t * pSrc,
+        float16_t * pSin,
+        float16_t * pCos,
+        uint32_t blockSize)
+{
+   uint32_t blkCnt;
+   float32_t sinVal, cosVal;
+
+#if defined(ARM_MATH_MVE_FLOAT16) && !defined(ARM_MATH_AUTOVECTORIZE)
+   f16x8_t vecSrc, vecDst = vdupq_n_f16((float16_t) 0.0f);
+   f32x4_t vecSinB, vecCosB, vecSinT, vecCosT;
+
+   blkCnt = blockSize >> 3;
+
+   while (blkCnt > 0U)
+   {
+      vecSrc = vld1q(pSrc);
+
+      /* Even and odd samples are computed in single precision */
+      vsincosq_f32(vcvtbq_f32_f16(vecSrc), &vecSinB, &vecCosB);
+      vsincosq_f32(vcvttq_f32_f16(vecSrc), &vecSinT, &vecCosT);
+      vecDst = vcvtbq_f16_f32(vecDst, vecSinB);
+      vecDst = vcvttq_f16_f32(vecDst, vecSinT);
+      vst1q(pSin, vecDst);
+      vecDst = vcvtbq_f16_f32(vecDst, vecCosB);
+      vecDst = vcvttq_f16_f32(vecDst, vecCosT);
+      vst1q(pCos, vecDst);
+      pSrc += 8;
+      pSin += 8;
+      pCos += 8;
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   blkCnt = blockSize & 7;
+#else
+   blkCnt = blockSize;
+#endif
+
+   while (blkCnt > 0U)
+   {
+      arm_sincos_core_f32((float32_t) *pSrc++, &sinVal, &cosVal);
+      *pSin++ = (float16_t) sinVal;
+      *pCos++ = (float16_t) cosVal;
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+}
+
+/**
+  @} end of vsincos group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
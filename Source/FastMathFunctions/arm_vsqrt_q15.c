@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsqrt_q15.c
+ * Description:  Vectorized Q15 square root
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/fast_math_functions.h"
+
+#if ((defined(ARM_MATH_MVEI) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE)) || defined(ARM_MATH_NEON) || defined(ARM_MATH_NEON_EXPERIMENTAL)
+#include "arm_helium_utils.h"
+#include "arm_vec_math.h"
+#endif
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup SQRT
+  @{
+ */
+
+/**
+  @brief         Q15 vector of square roots.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : all the input values are positive
+                   - \ref ARM_MATH_ARGUMENT_ERROR : at least one input value is negative; its square root is set to 0
+
+  @par           Details
+                   The Helium and Neon versions use a vector approximation which can
+                   differ from arm_sqrt_q15 by a few LSB.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_vsqrt_q15(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+   uint32_t blkCnt;
+   arm_status status = ARM_MATH_SUCCESS;
+
+#if (defined(ARM_MATH_MVEI) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE)
+   q15x8_t vecSrc;
+
+   blkCnt = blockSize >> 3;
+
+   while (blkCnt > 0U)
+   {
+      vecSrc = vld1q(pSrc);
+
+      if (vcmpltq_n_s16(vecSrc, 0) != 0U)
+      {
+         status = ARM_MATH_ARGUMENT_ERROR;
+      }
+
+      /* Negative values are set to 0 */
+      vst1q(pDst, FAST_VSQRT_Q15(vecSrc));
+
+      pSrc += 8;
+      pDst += 8;
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   blkCnt = blockSize & 7;
+#elif defined(ARM_MATH_NEON) || defined(ARM_MATH_NEON_EXPERIMENTAL)
+   int16x8_t vecSrc;
+   uint32x2_t vecMask;
+
+   blkCnt = blockSize >> 3;
+
+   while (blkCnt > 0U)
+   {
+      vecSrc = vld1q_s16(pSrc);
+
+      vecMask = vreinterpret_u32_u8(vmovn_u16(vcltq_s16(vecSrc, vdupq_n_s16(0))));
+      if ((vget_lane_u32(vecMask, 0) | vget_lane_u32(vecMask, 1)) != 0U)
+      {
+         status = ARM_MATH_ARGUMENT_ERROR;
+      }
+
+      /* Negative values are set to 0 */
+      vecSrc = vmaxq_s16(vecSrc, vdupq_n_s16(0));
+      vst1q_s16(pDst, __arm_vec_sqrt_q15_neon(vecSrc));
+
+      pSrc += 8;
+      pDst += 8;
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   blkCnt = blockSize & 7;
+#else
+   blkCnt = blockSize;
+#endif
+
+   while (blkCnt > 0U)
+   {
+      if (arm_sqrt_q15(*pSrc++, pDst++) != ARM_MATH_SUCCESS)
+      {
+         status = ARM_MATH_ARGUMENT_ERROR;
+      }
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   return (status);
+}
+
+/**
+  @} end of SQRT group
+ */
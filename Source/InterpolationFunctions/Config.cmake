@@ -12,13 +12,23 @@ if (FASTBUILD)
 else()
 
 target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_bilinear_interp_f32.c)
+target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_bilinear_interp_block_f32.c)
+target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_bilinear_interp_block_q15.c)
+target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_bilinear_interp_block_q31.c)
+target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_bilinear_interp_block_q7.c)
 target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_bilinear_interp_q15.c)
 target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_bilinear_interp_q31.c)
 target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_bilinear_interp_q7.c)
 target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_linear_interp_f32.c)
+target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_linear_interp_block_f32.c)
+target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_linear_interp_block_q15.c)
+target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_linear_interp_block_q31.c)
+target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_linear_interp_block_q7.c)
 target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_linear_interp_q15.c)
 target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_linear_interp_q31.c)
 target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_linear_interp_q7.c)
+target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_interp_index_init_f32.c)
+target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_linear_interp_nonuniform_f32.c)
 target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_spline_interp_f32.c)
 target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_spline_interp_init_f32.c)
 
@@ -30,10 +30,20 @@
 #include "arm_bilinear_interp_q15.c"
 #include "arm_bilinear_interp_q31.c"
 #include "arm_bilinear_interp_q7.c"
+#include "arm_bilinear_interp_block_f32.c"
+#include "arm_bilinear_interp_block_q15.c"
+#include "arm_bilinear_interp_block_q31.c"
+#include "arm_bilinear_interp_block_q7.c"
 #include "arm_linear_interp_f32.c"
 #include "arm_linear_interp_q15.c"
 #include "arm_linear_interp_q31.c"
 #include "arm_linear_interp_q7.c"
+#include "arm_linear_interp_block_f32.c"
+#include "arm_linear_interp_block_q15.c"
+#include "arm_linear_interp_block_q31.c"
+#include "arm_linear_interp_block_q7.c"
+#include "arm_linear_interp_nonuniform_f32.c"
+#include "arm_interp_index_init_f32.c"
 #include "arm_spline_interp_f32.c"
 #include "arm_spline_interp_init_f32.c"
 
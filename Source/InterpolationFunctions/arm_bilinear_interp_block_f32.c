@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_bilinear_interp_block_f32.c
+ * Description:  Floating-point block bilinear interpolation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/interpolation_functions.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup BilinearInterpolate
+  @{
+ */
+
+/**
+  @brief         Floating-point bilinear interpolation of a block of points.
+  @param[in]     S          points to an instance of the interpolation structure.
+  @param[in]     pX         points to the X coordinates
+  @param[in]     pY         points to the Y coordinates
+  @param[out]    pDst       points to the block of interpolated values
+  @param[in]     blockSize  number of points to process
+
+  @par           Details
+                   The result is the one of \ref arm_bilinear_interp_f32 for each point.
+ */
+ARM_DSP_ATTRIBUTE void arm_bilinear_interp_block_f32(
+  const arm_bilinear_interp_instance_f32 * S,
+  const float32_t * pX,
+  const float32_t * pY,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pData = S->pData;
+  const int32_t numCols = (int32_t) S->numCols;
+  const int32_t numRows = (int32_t) S->numRows;
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+  float32_t X, Y;
+  float32_t f00, f01, f10, f11;
+  int32_t xIndex, yIndex, index;
+  float32_t xdiff, ydiff;
+
+  while (blkCnt > 0U)
+  {
+    X = *pX++;
+    Y = *pY++;
+
+    xIndex = (int32_t) X;
+    yIndex = (int32_t) Y;
+
+    /* Returns zero output when values are outside table boundary */
+    if (xIndex < 0 || xIndex > (numCols - 2) || yIndex < 0 || yIndex > (numRows - 2))
+    {
+      *pDst++ = 0.0f;
+    }
+    else
+    {
+      /* Read the four nearest points */
+      index = xIndex + yIndex * numCols;
+      f00 = pData[index];
+      f01 = pData[index + 1];
+      f10 = pData[index + numCols];
+      f11 = pData[index + numCols + 1];
+
+      /* Calculation of fractional parts in X and Y */
+      xdiff = X - xIndex;
+      ydiff = Y - yIndex;
+
+      /* Calculation of bi-linear interpolated output */
+      *pDst++ = f00 + (f01 - f00) * xdiff + (f10 - f00) * ydiff + (f00 - f01 - f10 + f11) * xdiff * ydiff;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of BilinearInterpolate group
+ */
@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_bilinear_interp_block_q15.c
+ * Description:  Q15 block bilinear interpolation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/interpolation_functions.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup BilinearInterpolate
+  @{
+ */
+
+/**
+  @brief         Q15 bilinear interpolation of a block of points.
+  @param[in]     S          points to an instance of the interpolation structure.
+  @param[in]     pX         points to the X coordinates in 12.20 format
+  @param[in]     pY         points to the Y coordinates in 12.20 format
+  @param[out]    pDst       points to the block of interpolated values
+  @param[in]     blockSize  number of points to process
+
+  @par           Details
+                   The result is the one of \ref arm_bilinear_interp_q15 for each point.
+ */
+ARM_DSP_ATTRIBUTE void arm_bilinear_interp_block_q15(
+  const arm_bilinear_interp_instance_q15 * S,
+  const q31_t * pX,
+  const q31_t * pY,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  const q15_t *pYData = S->pData;                /* pointer to output table values */
+  const int32_t nCols = (int32_t) S->numCols;
+  const int32_t nRows = (int32_t) S->numRows;
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+  q31_t X, Y;                                    /* Coordinates */
+  q63_t acc;                                     /* output */
+  q31_t out;                                     /* Temporary output */
+  q31_t xfract, yfract;                          /* X, Y fractional parts */
+  q15_t x1, x2, y1, y2;                          /* Nearest output values */
+  int32_t rI, cI, index;                         /* Row and column indices */
+
+  while (blkCnt > 0U)
+  {
+    X = *pX++;
+    Y = *pY++;
+
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    rI = (X >> 20);
+    cI = (Y >> 20);
+
+    /* Returns zero output when values are outside table boundary */
+    if (rI < 0 || rI > (nCols - 2) || cI < 0 || cI > (nRows - 2))
+    {
+      *pDst++ = 0;
+    }
+    else
+    {
+      /* 20 bits for the fractional part in 12.20 format */
+      xfract = (X & 0x000FFFFF);
+      yfract = (Y & 0x000FFFFF);
+
+      /* Read the four nearest output values */
+      index = rI + nCols * cI;
+      x1 = pYData[index];
+      x2 = pYData[index + 1];
+      y1 = pYData[index + nCols];
+      y2 = pYData[index + nCols + 1];
+
+      /* x1 * (1-xfract) * (1-yfract) in 13.51 format */
+      out = (q31_t) (((q63_t) x1 * (0x0FFFFF - xfract)) >> 4U);
+      acc = ((q63_t) out * (0x0FFFFF - yfract));
+
+      /* x2 * (xfract) * (1-yfract) in 13.51 and adding to acc */
+      out = (q31_t) (((q63_t) x2 * (0x0FFFFF - yfract)) >> 4U);
+      acc += ((q63_t) out * (xfract));
+
+      /* y1 * (1 - xfract) * (yfract) in 13.51 and adding to acc */
+      out = (q31_t) (((q63_t) y1 * (0x0FFFFF - xfract)) >> 4U);
+      acc += ((q63_t) out * (yfract));
+
+      /* y2 * (xfract) * (yfract) in 13.51 and adding to acc */
+      out = (q31_t) (((q63_t) y2 * (xfract)) >> 4U);
+      acc += ((q63_t) out * (yfract));
+
+      /* Convert acc to 1.15 format */
+      *pDst++ = (q15_t) (acc >> 36);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of BilinearInterpolate group
+ */
@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_interp_index_init_f32.c
+ * Description:  Floating-point interval index initialization
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/interpolation_functions.h"
+#include "arm_interp_search.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @defgroup InterpIndex Interval Index
+
+  The interval index speeds up the search of the interval containing
+  a value in a table of x values which are not uniformly spaced. It is
+  used by the cubic spline and by the non-uniform linear interpolation.
+
+  The range [x(1), x(n)] is divided in buckets of same width and the
+  index records the first interval of each bucket. A lookup computes
+  the bucket of the value and then searches only the intervals between
+  the first interval of the bucket and the first interval of the next one.
+
+  When the number of buckets is of the order of the number of x values,
+  the lookup is O(1) for x values which are roughly uniformly distributed.
+  In the worst case, it is O(log(n)) since the search inside a bucket is
+  a binary search.
+ */
+
+/**
+  @addtogroup InterpIndex
+  @{
+ */
+
+/**
+ * @brief Initialization function for the floating-point interval index.
+ * @param[out] S           points to an instance of the interval index.
+ * @param[in]  x           points to the x values (strictly increasing).
+ * @param[in]  n           number of x values (at least 2).
+ * @param[in]  numBuckets  number of buckets (at least 1).
+ * @param[in]  pBuckets    buffer of numBuckets+1 values for the index.
+ *
+ * @par  The x values are not copied and must be available while the index is used.
+ */
+ARM_DSP_ATTRIBUTE void arm_interp_index_init_f32(
+        arm_interp_index_instance_f32 * S,
+  const float32_t * x,
+        uint32_t n,
+        uint32_t numBuckets,
+        uint32_t * pBuckets)
+{
+    const uint32_t last = n - 2U;   /* Last interval */
+    uint32_t i = 0U;
+    uint32_t k;
+
+    S->x = x;
+    S->n_x = n;
+    S->numBuckets = numBuckets;
+    S->invBucketWidth = (float32_t) numBuckets / (x[n - 1U] - x[0]);
+    S->pBuckets = pBuckets;
+
+    /* First interval i of bucket k : the first one whose end is in
+       bucket k or after. The bucket is computed with the function used
+       for the lookup so that the rounding errors are consistent. */
+    for (k = 0U; k < numBuckets; k++)
+    {
+        while ((i < last) && (arm_interp_index_bucket_f32(S, x[i + 1U]) < (int32_t) k))
+        {
+            i++;
+        }
+        pBuckets[k] = i;
+    }
+    pBuckets[numBuckets] = last;
+}
+
+/**
+  @} end of InterpIndex group
+ */
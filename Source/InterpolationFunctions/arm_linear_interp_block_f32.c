@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_linear_interp_block_f32.c
+ * Description:  Floating-point block linear interpolation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/interpolation_functions.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup LinearInterpolate
+  @{
+ */
+
+/**
+  @brief         Floating-point linear interpolation of a block of samples.
+  @param[in]     S          points to an instance of the floating-point Linear Interpolation structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[out]    pDst       points to the block of output samples
+  @param[in]     blockSize  number of samples to process
+
+  @par           Details
+                   The result is the one of \ref arm_linear_interp_f32 for each
+                   sample but the division by the spacing is replaced by a
+                   multiplication with its inverse and the out of range samples are
+                   handled by clamping the position in the table instead of branching.
+                   The table must contain at least 2 values.
+ */
+ARM_DSP_ATTRIBUTE void arm_linear_interp_block_f32(
+  const arm_linear_interp_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pYData = S->pYData;           /* pointer to output table */
+  const float32_t x1 = S->x1;                    /* first input value */
+  const float32_t invSpacing = 1.0f / S->xSpacing;
+  const float32_t last = (float32_t) (S->nValues - 1U);
+  const int32_t lastIndex = (int32_t) S->nValues - 2;
+  uint32_t blkCnt;                               /* Loop counter */
+  float32_t t, fract, y0, y1;
+  int32_t i;
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  f32x4_t vecT, vecFract, vecY0, vecY1;
+  int32x4_t vecIdx;
+
+  blkCnt = blockSize >> 2U;
+  while (blkCnt > 0U)
+  {
+    /* Position in the table clamped to [0, nValues-1] */
+    vecT = vmulq_n_f32(vsubq_n_f32(vld1q(pSrc), x1), invSpacing);
+    vecT = vmaxnmq(vecT, vdupq_n_f32(0.0f));
+    vecT = vminnmq(vecT, vdupq_n_f32(last));
+
+    vecIdx = vminq(vcvtq_s32_f32(vecT), vdupq_n_s32(lastIndex));
+    vecFract = vsubq(vecT, vcvtq_f32_s32(vecIdx));
+
+    vecY0 = vldrwq_gather_shifted_offset_f32(pYData, (uint32x4_t) vecIdx);
+    vecY1 = vldrwq_gather_shifted_offset_f32(pYData + 1, (uint32x4_t) vecIdx);
+
+    vst1q(pDst, vfmaq(vecY0, vecFract, vsubq(vecY1, vecY0)));
+
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize & 3U;
+#else
+  blkCnt = blockSize;
+#endif
+
+  while (blkCnt > 0U)
+  {
+    /* Position in the table clamped to [0, nValues-1] */
+    t = (*pSrc++ - x1) * invSpacing;
+    t = (t > 0.0f) ? t : 0.0f;
+    t = (t < last) ? t : last;
+
+    i = (int32_t) t;
+    i = (i < lastIndex) ? i : lastIndex;
+    fract = t - (float32_t) i;
+
+    /* Read of nearest output values */
+    y0 = pYData[i];
+    y1 = pYData[i + 1];
+
+    *pDst++ = y0 + fract * (y1 - y0);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of LinearInterpolate group
+ */
@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_linear_interp_block_q15.c
+ * Description:  Q15 block linear interpolation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/interpolation_functions.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup LinearInterpolate
+  @{
+ */
+
+/**
+  @brief         Q15 linear interpolation of a block of samples.
+  @param[in]     pYData     points to the Q15 Linear Interpolation table
+  @param[in]     nValues    number of table values
+  @param[in]     pSrc       points to the block of input samples in 12.20 format
+  @param[out]    pDst       points to the block of output samples
+  @param[in]     blockSize  number of samples to process
+
+  @par           Details
+                   The result is the one of \ref arm_linear_interp_q15 for each sample.
+                   This function can support maximum of table size 2^12.
+ */
+ARM_DSP_ATTRIBUTE void arm_linear_interp_block_q15(
+  const q15_t * pYData,
+        uint32_t nValues,
+  const q31_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  const int32_t lastIndex = (int32_t) nValues - 1;
+  const q15_t first = pYData[0];                 /* Output below the table range */
+  const q15_t last = pYData[lastIndex];          /* Output above the table range */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+  q63_t y;                                       /* output */
+  q15_t y0, y1;                                  /* Nearest output values */
+  q31_t x, fract;                                /* Input and fractional part */
+  int32_t index;                                 /* Index to read nearest output values */
+
+  while (blkCnt > 0U)
+  {
+    x = *pSrc++;
+
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    index = (x >> 20);
+
+    if (index >= lastIndex)
+    {
+      *pDst = last;
+    }
+    else if (index < 0)
+    {
+      *pDst = first;
+    }
+    else
+    {
+      /* 20 bits for the fractional part */
+      /* fract is in 12.20 format */
+      fract = (x & 0x000FFFFF);
+
+      /* Read two nearest output values from the index */
+      y0 = pYData[index];
+      y1 = pYData[index + 1];
+
+      /* Calculation of y0 * (1-fract) + y1 * fract in 13.35 format */
+      y = ((q63_t) y0 * (0xFFFFF - fract));
+      y += ((q63_t) y1 * (fract));
+
+      /* convert y to 1.15 format */
+      *pDst = (q15_t) (y >> 20);
+    }
+    pDst++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of LinearInterpolate group
+ */
@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_linear_interp_nonuniform_f32.c
+ * Description:  Floating-point linear interpolation on a non-uniform grid
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/interpolation_functions.h"
+#include "arm_interp_search.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup LinearInterpolate
+  @{
+ */
+
+/**
+ * @brief Floating-point linear interpolation on a non-uniform grid.
+ * @param[in]  S          points to an instance of the non-uniform linear interpolation structure.
+ * @param[in]  pSrc       points to the block of input samples.
+ * @param[out] pDst       points to the block of output samples.
+ * @param[in]  blockSize  number of samples to process.
+ *
+ * @par  Details
+ *       The x values must be strictly increasing and there must be at least 2 of them.
+ *       Like for the uniform linear interpolation, the first y value is returned for
+ *       inputs below the first x value and the last y value is returned for inputs above
+ *       the last x value.
+ *
+ * @par
+ *       The interval of an input is searched only when the input is not in the interval
+ *       of the previous one. When <code>pIndex</code> is not NULL, the search
+ *       uses the \ref InterpIndex "interval index". Otherwise, it is an exponential search
+ *       starting from the previous interval, which is efficient for increasing inputs.
+ */
+ARM_DSP_ATTRIBUTE void arm_linear_interp_nonuniform_f32(
+  const arm_linear_interp_nonuniform_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+    const float32_t *x = S->x;
+    const float32_t *y = S->y;
+    const int32_t last = (int32_t) S->n_x - 2;   /* Last interval */
+    const float32_t xFirst = x[0];
+    const float32_t xLast = x[last + 1];
+    uint32_t blkCnt = blockSize;                 /* Loop counter */
+    int32_t i = 0;                               /* Current interval */
+    float32_t xq;
+
+    while (blkCnt > 0U)
+    {
+        xq = *pSrc++;
+
+        if (xq < xFirst)
+        {
+            *pDst++ = y[0];
+        }
+        else if (xq > xLast)
+        {
+            *pDst++ = y[last + 1];
+        }
+        else
+        {
+            /* Search of the interval when xq is not in the current one */
+            if ((xq > x[i + 1]) || ((i > 0) && (xq <= x[i])))
+            {
+                if (S->pIndex != NULL)
+                {
+                    i = arm_interp_index_lookup_f32(S->pIndex, xq);
+                }
+                else if (xq > x[i + 1])
+                {
+                    i = arm_interp_interval_f32(x, i + 1, last, xq);
+                }
+                else
+                {
+                    i = arm_interp_interval_f32(x, 0, i - 1, xq);
+                }
+            }
+
+            *pDst++ = y[i] + (xq - x[i]) * ((y[i + 1] - y[i]) / (x[i + 1] - x[i]));
+        }
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of LinearInterpolate group
+ */
@@ -30,6 +30,7 @@
 
 
 #include "dsp/interpolation_functions.h"
+#include "arm_interp_search.h"
 
 /**
   @ingroup groupInterpolation
@@ -130,6 +131,15 @@
   input range (xq<x(1); xq>x(n)). The coefficients used to compute the y values for
   xq<x(1) are going to be the ones used for the first interval, while for xq>x(n) the 
   coefficients used for the last interval.
+
+ @par Interval search
+
+  The x values of the interpolated data points can be in any order but
+  increasing order is the most efficient. The interval is searched only
+  when a query is not in the interval of the previous one. When the instance
+  has an \ref InterpIndex "interval index", the search uses it. Otherwise,
+  it is an exponential search starting from the previous interval, so the cost
+  is logarithmic in the number of intervals which are skipped.
  
  */
 
@@ -138,6 +148,11 @@
   @{
  */
 
+/* Query in the current interval x(i)<xq<=x(i+1). Queries outside of the range
+   of x values are in the first or last interval. The comparisons are written
+   so that a query which is not a number is in the current interval. */
+#define ARM_SPLINE_IN_INTERVAL(XQ) (!(((XQ) <= xStart) && (i > 0)) && !(((XQ) > xEnd) && (i < last)))
+
 /**
  * @brief Processing function for the floating-point cubic spline interpolation.
  * @param[in]  S          points to an instance of the floating-point spline structure.
@@ -161,11 +176,16 @@ ARM_DSP_ATTRIBUTE void arm_spline_f32(
     float32_t * c = (S->coeffs)+(n-1);
     float32_t * d = (S->coeffs)+(2*(n-1));    
 
+    /* Last interval. It is also used for x>x(n) */
+    const int32_t last = n-2;
+
     const float32_t * pXq = xq;
     int32_t blkCnt = (int32_t)blockSize;
-    int32_t blkCnt2;
-    int32_t i;
-    float32_t x_sc;
+    int32_t i = 0;
+    float32_t x_sc, diff;
+    float32_t xi, ai, bi, ci, di;
+    float32_t xStart = x[0];
+    float32_t xEnd = x[1];
 
 #if defined(ARM_MATH_NEON)
     float32x4_t xiv = vdupq_n_f32(0.0f);
@@ -177,40 +197,66 @@ ARM_DSP_ATTRIBUTE void arm_spline_f32(
     float32x4_t xqv = vdupq_n_f32(0.0f);
 
     float32x4_t temp = vdupq_n_f32(0.0f);
-    float32x4_t diff = vdupq_n_f32(0.0f);
+    float32x4_t diffv = vdupq_n_f32(0.0f);
     float32x4_t yv = vdupq_n_f32(0.0f);
 #endif
 
-    /* Create output for x(i)<x<x(i+1) */
-    for (i=0; i<n-1; i++)
+    while (blkCnt > 0)
     {
+        /* Move to the interval of the next query */
+        x_sc = *pXq;
+        if (!ARM_SPLINE_IN_INTERVAL(x_sc))
+        {
+            if (S->pIndex != NULL)
+            {
+                i = arm_interp_index_lookup_f32(S->pIndex, x_sc);
+            }
+            else if (x_sc > x[i+1])
+            {
+                i = arm_interp_interval_f32(x, i+1, last, x_sc);
+            }
+            else
+            {
+                i = arm_interp_interval_f32(x, 0, i-1, x_sc);
+            }
+        }
+
+        xi = x[i];
+        ai = y[i];
+        bi = b[i];
+        ci = c[i];
+        di = d[i];
+        xStart = xi;
+        xEnd = x[i+1];
+
 #if defined(ARM_MATH_NEON)
-        xiv = vdupq_n_f32(x[i]);
+        xiv = vdupq_n_f32(xi);
 
-        aiv = vdupq_n_f32(y[i]);
-        biv = vdupq_n_f32(b[i]);
-        civ = vdupq_n_f32(c[i]);
-        div = vdupq_n_f32(d[i]);
+        aiv = vdupq_n_f32(ai);
+        biv = vdupq_n_f32(bi);
+        civ = vdupq_n_f32(ci);
+        div = vdupq_n_f32(di);
 
-        while( *(pXq+4) <= x[i+1] && blkCnt > 4 )
+        while( blkCnt >= 4 && ARM_SPLINE_IN_INTERVAL(*(pXq  )) && ARM_SPLINE_IN_INTERVAL(*(pXq+1))
+                           && ARM_SPLINE_IN_INTERVAL(*(pXq+2)) && ARM_SPLINE_IN_INTERVAL(*(pXq+3)) )
         {
             /* Load [xq(k) xq(k+1) xq(k+2) xq(k+3)] */
             xqv = vld1q_f32(pXq);
             pXq+=4;
         
             /* Compute [xq(k)-x(i) xq(k+1)-x(i) xq(k+2)-x(i) xq(k+3)-x(i)] */
-            diff = vsubq_f32(xqv, xiv);
-            temp = diff;
+            diffv = vsubq_f32(xqv, xiv);
+            temp = diffv;
         
             /* y(i) = a(i) + ... */
             yv = aiv;
             /* ... + b(i)*(x-x(i)) + ... */
             yv = vmlaq_f32(yv, biv, temp);
             /* ... + c(i)*(x-x(i))^2 + ... */
-            temp = vmulq_f32(temp, diff);
+            temp = vmulq_f32(temp, diffv);
             yv = vmlaq_f32(yv, civ, temp);
             /* ... + d(i)*(x-x(i))^3 */
-            temp = vmulq_f32(temp, diff);
+            temp = vmulq_f32(temp, diffv);
             yv = vmlaq_f32(yv, div, temp);
         
             /* Store [y(k) y(k+1) y(k+2) y(k+3)] */
@@ -220,65 +266,17 @@ ARM_DSP_ATTRIBUTE void arm_spline_f32(
             blkCnt-=4;
         }
 #endif
-        while( *pXq <= x[i+1] && blkCnt > 0 )
+        while( blkCnt > 0 && ARM_SPLINE_IN_INTERVAL(*pXq) )
         {
             x_sc = *pXq++;
+            diff = x_sc - xi;
 
-            *pDst = y[i]+b[i]*(x_sc-x[i])+c[i]*(x_sc-x[i])*(x_sc-x[i])+d[i]*(x_sc-x[i])*(x_sc-x[i])*(x_sc-x[i]);
+            *pDst = ai+bi*diff+ci*diff*diff+di*diff*diff*diff;
 
             pDst++;
             blkCnt--;
         }
     }
-
-    /* Create output for remaining samples (x>=x(n)) */
-#if defined(ARM_MATH_NEON)
-    /* Compute 4 outputs at a time */
-    blkCnt2 = blkCnt >> 2;
-
-    while(blkCnt2 > 0) 
-    { 
-        /* Load [xq(k) xq(k+1) xq(k+2) xq(k+3)] */ 
-        xqv = vld1q_f32(pXq);
-        pXq+=4;
-                                                         
-        /* Compute [xq(k)-x(i) xq(k+1)-x(i) xq(k+2)-x(i) xq(k+3)-x(i)] */
-        diff = vsubq_f32(xqv, xiv);
-        temp = diff; 
-
-        /* y(i) = a(i) + ... */ 
-        yv = aiv; 
-        /* ... + b(i)*(x-x(i)) + ... */ 
-        yv = vmlaq_f32(yv, biv, temp);
-        /* ... + c(i)*(x-x(i))^2 + ... */
-        temp = vmulq_f32(temp, diff);
-        yv = vmlaq_f32(yv, civ, temp);
-        /* ... + d(i)*(x-x(i))^3 */
-        temp = vmulq_f32(temp, diff);
-        yv = vmlaq_f32(yv, div, temp);
-
-        /* Store [y(k) y(k+1) y(k+2) y(k+3)] */
-        vst1q_f32(pDst, yv);
-        pDst+=4;
-
-        blkCnt2--;
-    } 
-
-    /* Tail */
-    blkCnt2 = blkCnt & 3;                                      
-#else                                                        
-    blkCnt2 = blkCnt;                                          
-#endif
-
-    while(blkCnt2 > 0)                                       
-    { 
-        x_sc = *pXq++; 
-  
-        *pDst = y[i-1]+b[i-1]*(x_sc-x[i-1])+c[i-1]*(x_sc-x[i-1])*(x_sc-x[i-1])+d[i-1]*(x_sc-x[i-1])*(x_sc-x[i-1])*(x_sc-x[i-1]);
- 
-        pDst++; 
-        blkCnt2--;   
-    }   
 }
 
 /**
@@ -50,6 +50,12 @@
 
   The x input array must be strictly sorted in ascending order and it must
   not contain twice the same value (x(i)<x(i+1)).
+
+  @par
+
+  The instance is initialized without interval index. For large tables,
+  <code>pIndex</code> can then be set to an \ref InterpIndex "interval index"
+  built with \ref arm_interp_index_init_f32 on the same x values.
  
 */
 
@@ -97,6 +103,7 @@ ARM_DSP_ATTRIBUTE void arm_spline_init_f32(
     S->x = x;
     S->y = y;
     S->n_x = n;
+    S->pIndex = NULL;
 
     /* == Solve LZ=B to obtain z(i) and u(i) == */
 
@@ -21,6 +21,21 @@ MatrixFunctions/arm_mat_trans_f64.c
 MatrixFunctions/arm_mat_qr_f64.c
 MatrixFunctions/arm_householder_f64.c
 MatrixFunctions/arm_mat_init_f64.c
+MatrixFunctions/arm_mat_init_large_f64.c
+MatrixFunctions/arm_mat_sub_large_f64.c
+MatrixFunctions/arm_mat_trans_large_f64.c
+MatrixFunctions/arm_mat_mult_large_f64.c
+MatrixFunctions/arm_mat_gemm_f64.c
+MatrixFunctions/arm_mat_strided_init_f64.c
+MatrixFunctions/arm_mat_gemm_strided_f64.c
+MatrixFunctions/arm_mat_cholesky_blocked_f64.c
+MatrixFunctions/arm_mat_ldlt_blocked_f64.c
+MatrixFunctions/arm_mat_lu_f64.c
+MatrixFunctions/arm_mat_lu_solve_f64.c
+MatrixFunctions/arm_mat_eig_sym_f64.c
+MatrixFunctions/arm_mat_svd_f64.c
+MatrixFunctions/arm_mat_qr_blocked_f64.c
+MatrixFunctions/arm_mat_qr_solve_f64.c
 )
 
 set(SRCF32 MatrixFunctions/arm_mat_add_f32.c
@@ -39,6 +54,34 @@ MatrixFunctions/arm_mat_trans_f32.c
 MatrixFunctions/arm_mat_vec_mult_f32.c
 MatrixFunctions/arm_mat_qr_f32.c
 MatrixFunctions/arm_householder_f32.c
+MatrixFunctions/arm_mat_strided_init_f32.c
+MatrixFunctions/arm_mat_add_strided_f32.c
+MatrixFunctions/arm_mat_mult_strided_f32.c
+MatrixFunctions/arm_mat_trans_strided_f32.c
+MatrixFunctions/arm_mat_vec_mult_strided_f32.c
+MatrixFunctions/arm_mat_solve_upper_triangular_strided_f32.c
+MatrixFunctions/arm_mat_solve_lower_triangular_strided_f32.c
+MatrixFunctions/arm_mat_init_large_f32.c
+MatrixFunctions/arm_mat_add_large_f32.c
+MatrixFunctions/arm_mat_sub_large_f32.c
+MatrixFunctions/arm_mat_scale_large_f32.c
+MatrixFunctions/arm_mat_trans_large_f32.c
+MatrixFunctions/arm_mat_mult_large_f32.c
+MatrixFunctions/arm_mat_vec_mult_large_f32.c
+MatrixFunctions/arm_mat_gemm_f32.c
+MatrixFunctions/arm_mat_gemm_strided_f32.c
+MatrixFunctions/arm_mat_cholesky_blocked_f32.c
+MatrixFunctions/arm_mat_ldlt_blocked_f32.c
+MatrixFunctions/arm_mat_lu_f32.c
+MatrixFunctions/arm_mat_lu_solve_f32.c
+MatrixFunctions/arm_mat_eig_sym_f32.c
+MatrixFunctions/arm_mat_svd_f32.c
+MatrixFunctions/arm_mat_qr_blocked_f32.c
+MatrixFunctions/arm_mat_qr_solve_f32.c
+MatrixFunctions/arm_mat_batch_init_f32.c
+MatrixFunctions/arm_mat_batch_mult_f32.c
+MatrixFunctions/arm_mat_batch_inverse_f32.c
+MatrixFunctions/arm_mat_batch_solve_f32.c
 )
 
 set(SRCQ31 MatrixFunctions/arm_mat_add_q31.c
@@ -52,6 +95,14 @@ MatrixFunctions/arm_mat_scale_q31.c
 MatrixFunctions/arm_mat_sub_q31.c
 MatrixFunctions/arm_mat_trans_q31.c
 MatrixFunctions/arm_mat_vec_mult_q31.c
+MatrixFunctions/arm_mat_init_large_q31.c
+MatrixFunctions/arm_mat_add_large_q31.c
+MatrixFunctions/arm_mat_sub_large_q31.c
+MatrixFunctions/arm_mat_scale_large_q31.c
+MatrixFunctions/arm_mat_trans_large_q31.c
+MatrixFunctions/arm_mat_mult_large_q31.c
+MatrixFunctions/arm_mat_vec_mult_large_q31.c
+MatrixFunctions/arm_mat_gemm_q31.c
 )
 
 set(SRCQ15 MatrixFunctions/arm_mat_add_q15.c
@@ -64,12 +115,24 @@ MatrixFunctions/arm_mat_scale_q15.c
 MatrixFunctions/arm_mat_sub_q15.c
 MatrixFunctions/arm_mat_trans_q15.c
 MatrixFunctions/arm_mat_vec_mult_q15.c
+MatrixFunctions/arm_mat_init_large_q15.c
+MatrixFunctions/arm_mat_add_large_q15.c
+MatrixFunctions/arm_mat_sub_large_q15.c
+MatrixFunctions/arm_mat_scale_large_q15.c
+MatrixFunctions/arm_mat_trans_large_q15.c
+MatrixFunctions/arm_mat_mult_large_q15.c
+MatrixFunctions/arm_mat_vec_mult_large_q15.c
+MatrixFunctions/arm_mat_gemm_q15.c
 )
 
 set(SRCQ7  MatrixFunctions/arm_mat_mult_q7.c   
     MatrixFunctions/arm_mat_init_q7.c
     MatrixFunctions/arm_mat_vec_mult_q7.c
     MatrixFunctions/arm_mat_trans_q7.c
+    MatrixFunctions/arm_mat_init_large_q7.c
+    MatrixFunctions/arm_mat_trans_large_q7.c
+    MatrixFunctions/arm_mat_mult_large_q7.c
+    MatrixFunctions/arm_mat_vec_mult_large_q7.c
 )
 
 
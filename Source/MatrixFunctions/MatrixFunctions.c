@@ -78,6 +78,69 @@
 #include "arm_mat_qr_f64.c"
 #include "arm_householder_f64.c"
 #include "arm_householder_f32.c"
+#include "arm_mat_strided_init_f32.c"
+#include "arm_mat_add_strided_f32.c"
+#include "arm_mat_mult_strided_f32.c"
+#include "arm_mat_trans_strided_f32.c"
+#include "arm_mat_vec_mult_strided_f32.c"
+#include "arm_mat_solve_upper_triangular_strided_f32.c"
+#include "arm_mat_solve_lower_triangular_strided_f32.c"
+#include "arm_mat_init_large_f32.c"
+#include "arm_mat_init_large_f64.c"
+#include "arm_mat_init_large_q31.c"
+#include "arm_mat_init_large_q15.c"
+#include "arm_mat_init_large_q7.c"
+#include "arm_mat_add_large_f32.c"
+#include "arm_mat_add_large_q31.c"
+#include "arm_mat_add_large_q15.c"
+#include "arm_mat_sub_large_f32.c"
+#include "arm_mat_sub_large_f64.c"
+#include "arm_mat_sub_large_q31.c"
+#include "arm_mat_sub_large_q15.c"
+#include "arm_mat_scale_large_f32.c"
+#include "arm_mat_scale_large_q31.c"
+#include "arm_mat_scale_large_q15.c"
+#include "arm_mat_trans_large_f32.c"
+#include "arm_mat_trans_large_f64.c"
+#include "arm_mat_trans_large_q31.c"
+#include "arm_mat_trans_large_q15.c"
+#include "arm_mat_trans_large_q7.c"
+#include "arm_mat_mult_large_f32.c"
+#include "arm_mat_mult_large_f64.c"
+#include "arm_mat_mult_large_q31.c"
+#include "arm_mat_mult_large_q15.c"
+#include "arm_mat_mult_large_q7.c"
+#include "arm_mat_vec_mult_large_f32.c"
+#include "arm_mat_vec_mult_large_q31.c"
+#include "arm_mat_vec_mult_large_q15.c"
+#include "arm_mat_vec_mult_large_q7.c"
+#include "arm_mat_gemm_f32.c"
+#include "arm_mat_gemm_strided_f32.c"
+#include "arm_mat_gemm_f64.c"
+#include "arm_mat_gemm_q31.c"
+#include "arm_mat_gemm_q15.c"
+#include "arm_mat_strided_init_f64.c"
+#include "arm_mat_gemm_strided_f64.c"
+#include "arm_mat_cholesky_blocked_f32.c"
+#include "arm_mat_cholesky_blocked_f64.c"
+#include "arm_mat_ldlt_blocked_f32.c"
+#include "arm_mat_ldlt_blocked_f64.c"
+#include "arm_mat_lu_f32.c"
+#include "arm_mat_lu_f64.c"
+#include "arm_mat_lu_solve_f32.c"
+#include "arm_mat_lu_solve_f64.c"
+#include "arm_mat_eig_sym_f32.c"
+#include "arm_mat_eig_sym_f64.c"
+#include "arm_mat_svd_f32.c"
+#include "arm_mat_svd_f64.c"
+#include "arm_mat_qr_blocked_f32.c"
+#include "arm_mat_qr_blocked_f64.c"
+#include "arm_mat_qr_solve_f32.c"
+#include "arm_mat_qr_solve_f64.c"
+#include "arm_mat_batch_init_f32.c"
+#include "arm_mat_batch_mult_f32.c"
+#include "arm_mat_batch_inverse_f32.c"
+#include "arm_mat_batch_solve_f32.c"
 #if defined(ARM_MATH_NEON)
 #include "_arm_mat_mult_neon_buffers.c"
 #endif
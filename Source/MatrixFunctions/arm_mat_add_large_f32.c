@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_add_large_f32.c
+ * Description:  Floating-point large matrix addition
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+#include "dsp/basic_math_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixAdd
+  @{
+ */
+
+/**
+  @brief         Floating-point large matrix addition.
+  @param[in]     pSrcA      points to first input large matrix structure
+  @param[in]     pSrcB      points to second input large matrix structure
+  @param[out]    pDst       points to output large matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_add_large_f32(
+  const arm_matrix_instance_large_f32 * pSrcA,
+  const arm_matrix_instance_large_f32 * pSrcB,
+        arm_matrix_instance_large_f32 * pDst)
+{
+  const float32_t *pInA = pSrcA->pData;            /* input data matrix pointer A */
+  const float32_t *pInB = pSrcB->pData;            /* input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                   /* output data matrix pointer */
+  size_t numSamples;                             /* total number of elements in the matrix */
+  uint32_t blkCnt;                               /* number of elements in a block */
+  arm_status status;                             /* status of matrix addition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numRows != pSrcB->numRows) ||
+      (pSrcA->numCols != pSrcB->numCols) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcA->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* Total number of samples in input matrix */
+    numSamples = (size_t) pSrcA->numRows * pSrcA->numCols;
+
+    /* The matrix is processed in blocks whose size fits in 32 bits */
+    while (numSamples > 0U)
+    {
+      blkCnt = (numSamples > ARM_MAT_LARGE_BLOCK_SIZE) ? ARM_MAT_LARGE_BLOCK_SIZE : (uint32_t) numSamples;
+
+      /* C(m,n) = A(m,n) + B(m,n) */
+      arm_add_f32(pInA, pInB, pOut, blkCnt);
+
+      pInA += blkCnt;
+      pInB += blkCnt;
+      pOut += blkCnt;
+      numSamples -= blkCnt;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixAdd group
+ */
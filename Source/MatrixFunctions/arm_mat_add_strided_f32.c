@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_add_strided_f32.c
+ * Description:  Floating-point strided matrix addition
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixAdd
+  @{
+ */
+
+/**
+  @brief         Floating-point matrix addition of strided matrices.
+  @param[in]     pSrcA      points to first input strided matrix structure
+  @param[in]     pSrcB      points to second input strided matrix structure
+  @param[out]    pDst       points to output strided matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Details
+                   The matrices can be \ref MatrixStrided "views" of bigger matrices.
+                   The destination can be one of the sources.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_add_strided_f32(
+  const arm_matrix_strided_instance_f32 * pSrcA,
+  const arm_matrix_strided_instance_f32 * pSrcB,
+        arm_matrix_strided_instance_f32 * pDst)
+{
+  const float32_t *pInA = pSrcA->pData;          /* Row of input matrix A */
+  const float32_t *pInB = pSrcB->pData;          /* Row of input matrix B */
+  float32_t *pOut = pDst->pData;                 /* Row of output matrix */
+  uint16_t numRows = pDst->numRows;
+  uint16_t numCols = pDst->numCols;
+  uint32_t row;
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  const float32_t *pA, *pB;
+  float32_t *pC;
+  int32_t blkCnt;
+  mve_pred16_t p0;
+#else
+  uint32_t col;
+#endif
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numRows != pSrcB->numRows) ||
+      (pSrcA->numCols != pSrcB->numCols) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcA->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  for (row = 0U; row < numRows; row++)
+  {
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+    pA = pInA;
+    pB = pInB;
+    pC = pOut;
+
+    blkCnt = (int32_t) numCols;
+    while (blkCnt > 0)
+    {
+      p0 = vctp32q((uint32_t) blkCnt);
+      vstrwq_p_f32(pC, vaddq(vldrwq_z_f32(pA, p0), vldrwq_z_f32(pB, p0)), p0);
+
+      pA += 4;
+      pB += 4;
+      pC += 4;
+      blkCnt -= 4;
+    }
+#else
+    for (col = 0U; col < numCols; col++)
+    {
+      /* C(m,n) = A(m,n) + B(m,n) */
+      pOut[col] = pInA[col] + pInB[col];
+    }
+#endif
+
+    pInA += pSrcA->stride;
+    pInB += pSrcB->stride;
+    pOut += pDst->stride;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MatrixAdd group
+ */
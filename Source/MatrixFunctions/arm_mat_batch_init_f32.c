@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_batch_init_f32.c
+ * Description:  Floating-point batch of matrices initialization
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixBatch Batched Small Matrices
+
+  A batch is an array of matrices having the same dimensions.
+  The matrices are interleaved: the element (i,j) of the matrix k is at
+  <code>pData[(i * numCols + j) * batchSize + k]</code>.
+  The same element of all the matrices is contiguous in memory so that
+  the SIMD lanes process different matrices. There is no
+  dependency between the lanes and no per-matrix call overhead.
+
+  This layout is intended for the many tiny matrices of sensor fusion
+  or Kalman filters (2x2 to 8x8). The kernels are specialized at compile time
+  for the dimensions 1 to \ref ARM_MAT_BATCH_MAX_DIM.
+
+  \ref arm_mat_batch_set_f32 and \ref arm_mat_batch_get_f32 copy one
+  matrix of the batch from / to a standard matrix.
+ */
+
+/**
+  @addtogroup MatrixBatch
+  @{
+ */
+
+/**
+  @brief         Floating-point batch of matrices initialization.
+  @param[in,out] S          points to an instance of the floating-point batch of matrices structure
+  @param[in]     nRows      number of rows of each matrix
+  @param[in]     nColumns   number of columns of each matrix
+  @param[in]     batchSize  number of matrices in the batch
+  @param[in]     pData      points to the interleaved data array of size nRows * nColumns * batchSize
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_batch_init_f32(
+  arm_matrix_batch_instance_f32 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint32_t batchSize,
+  float32_t * pData)
+{
+  S->numRows = nRows;
+  S->numCols = nColumns;
+  S->batchSize = batchSize;
+  S->pData = pData;
+}
+
+/**
+  @brief         Copy a matrix into a batch of matrices.
+  @param[in,out] S       points to the batch of matrices
+  @param[in]     index   index of the matrix in the batch
+  @param[in]     pSrc    points to the matrix to copy
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_batch_set_f32(
+        arm_matrix_batch_instance_f32 * S,
+        uint32_t index,
+  const arm_matrix_instance_f32 * pSrc)
+{
+  uint32_t nbElems = (uint32_t) S->numRows * S->numCols;
+  uint32_t e;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  if ((pSrc->numRows != S->numRows) ||
+      (pSrc->numCols != S->numCols) ||
+      (index >= S->batchSize))
+  {
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  for (e = 0U; e < nbElems; e++)
+  {
+    S->pData[e * S->batchSize + index] = pSrc->pData[e];
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @brief         Copy a matrix of a batch of matrices.
+  @param[in]     S       points to the batch of matrices
+  @param[in]     index   index of the matrix in the batch
+  @param[out]    pDst    points to the destination matrix
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_batch_get_f32(
+  const arm_matrix_batch_instance_f32 * S,
+        uint32_t index,
+        arm_matrix_instance_f32 * pDst)
+{
+  uint32_t nbElems = (uint32_t) S->numRows * S->numCols;
+  uint32_t e;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+  if ((pDst->numRows != S->numRows) ||
+      (pDst->numCols != S->numCols) ||
+      (index >= S->batchSize))
+  {
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  for (e = 0U; e < nbElems; e++)
+  {
+    pDst->pData[e] = S->pData[e * S->batchSize + index];
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MatrixBatch group
+ */
@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_batch_inverse_f32.c
+ * Description:  Floating-point inverse of a batch of small matrices
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+#include "arm_mat_batch.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixBatch
+  @{
+ */
+
+/**
+  @brief         Floating-point inverse of a batch of matrices.
+  @param[in]     pSrc      points to the batch of matrices to invert
+  @param[out]    pDst      points to the batch of inverses
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH  : Matrix size check failed
+                   - \ref ARM_MATH_ARGUMENT_ERROR : Dimension bigger than \ref ARM_MAT_BATCH_MAX_DIM
+                   - \ref ARM_MATH_SINGULAR       : At least one of the matrices is singular
+
+  @par           The inverses are computed with a Gauss-Jordan elimination
+                 with partial pivoting. The pivoting is done lane by lane
+                 without branches so that several matrices are processed
+                 by the same instructions.
+                 A matrix is considered singular when a pivot is smaller
+                 than n * 2^-23 times its biggest element.
+                 When a matrix is singular, the other matrices of the batch
+                 are still inverted.
+                 The destination can be the same batch as the source.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_batch_inverse_f32(
+  const arm_matrix_batch_instance_f32 * pSrc,
+        arm_matrix_batch_instance_f32 * pDst)
+{
+  const float32_t *pA = pSrc->pData;
+  float32_t *pX = pDst->pData;
+  uint32_t batchSize = pSrc->batchSize;
+  int n = pSrc->numRows;
+  int singular;
+  arm_status status;                             /* status of matrix inverse */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pDst->numRows != pDst->numCols) ||
+      (pSrc->numRows != pDst->numRows) ||
+      (pSrc->batchSize != pDst->batchSize))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  if (n > (int) ARM_MAT_BATCH_MAX_DIM)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    switch (n)
+    {
+      case 1:
+        singular = arm_mat_batch_solve_kernel_f32(1, 1, pA, NULL, pX, batchSize);
+        break;
+      case 2:
+        singular = arm_mat_batch_solve_kernel_f32(2, 2, pA, NULL, pX, batchSize);
+        break;
+      case 3:
+        singular = arm_mat_batch_solve_kernel_f32(3, 3, pA, NULL, pX, batchSize);
+        break;
+      case 4:
+        singular = arm_mat_batch_solve_kernel_f32(4, 4, pA, NULL, pX, batchSize);
+        break;
+      case 5:
+        singular = arm_mat_batch_solve_kernel_f32(5, 5, pA, NULL, pX, batchSize);
+        break;
+      case 6:
+        singular = arm_mat_batch_solve_kernel_f32(6, 6, pA, NULL, pX, batchSize);
+        break;
+      case 7:
+        singular = arm_mat_batch_solve_kernel_f32(7, 7, pA, NULL, pX, batchSize);
+        break;
+      case 8:
+        singular = arm_mat_batch_solve_kernel_f32(8, 8, pA, NULL, pX, batchSize);
+        break;
+      default:
+        /* Empty matrices */
+        singular = 0;
+        break;
+    }
+
+    status = singular ? ARM_MATH_SINGULAR : ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixBatch group
+ */
@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_batch_mult_f32.c
+ * Description:  Floating-point multiplication of batches of small matrices
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixBatch
+  @{
+ */
+
+/*
+
+C = A B for all the matrices of the batch. The loop on the matrices is
+the inner loop: the accesses are contiguous and the loop can be
+vectorized whatever the dimensions. When the dimensions are constant,
+the other loops are unrolled.
+The matrices are processed by blocks of ARM_MAT_BATCH_BLOCK so that the
+elements of C being accumulated stay in the cache.
+
+*/
+#define ARM_MAT_BATCH_BLOCK 64U
+
+__STATIC_FORCEINLINE void arm_mat_batch_mult_kernel_f32(
+  const int numRows,
+  const int numInner,
+  const int numCols,
+  const float32_t * pA,
+  const float32_t * pB,
+  float32_t * pC,
+  uint32_t batchSize)
+{
+  const float32_t *pRowA, *pColB;
+  const float32_t *pa, *pb;
+  float32_t *pOut;
+  uint32_t k, k0, blockSize;
+  uint32_t strideB = (uint32_t) numCols * batchSize;
+  int i, j, l;
+
+  for (k0 = 0U; k0 < batchSize; k0 += ARM_MAT_BATCH_BLOCK)
+  {
+    blockSize = (batchSize - k0 < ARM_MAT_BATCH_BLOCK) ? batchSize - k0 : ARM_MAT_BATCH_BLOCK;
+
+    for (i = 0; i < numRows; i++)
+    {
+      pRowA = pA + (uint32_t) (i * numInner) * batchSize + k0;
+      for (j = 0; j < numCols; j++)
+      {
+        pColB = pB + (uint32_t) j * batchSize + k0;
+        pOut = pC + (uint32_t) (i * numCols + j) * batchSize + k0;
+        /* C(i,j) = sum on l of A(i,l) B(l,j) for all the matrices of the block */
+        pa = pRowA;
+        pb = pColB;
+        for (k = 0U; k < blockSize; k++)
+        {
+          pOut[k] = pa[k] * pb[k];
+        }
+        for (l = 1; l < numInner; l++)
+        {
+          pa += batchSize;
+          pb += strideB;
+          for (k = 0U; k < blockSize; k++)
+          {
+            pOut[k] += pa[k] * pb[k];
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+  @brief         Floating-point multiplication of batches of matrices.
+  @param[in]     pSrcA      points to the first batch of matrices
+  @param[in]     pSrcB      points to the second batch of matrices
+  @param[out]    pDst       points to the output batch of matrices
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           The matrix k of the destination is the product of the
+                 matrices k of the sources. The destination must not
+                 overlap the sources.
+                 Square matrices of dimension 2 to \ref ARM_MAT_BATCH_MAX_DIM
+                 use kernels specialized for their dimension.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_batch_mult_f32(
+  const arm_matrix_batch_instance_f32 * pSrcA,
+  const arm_matrix_batch_instance_f32 * pSrcB,
+        arm_matrix_batch_instance_f32 * pDst)
+{
+  const float32_t *pA = pSrcA->pData;
+  const float32_t *pB = pSrcB->pData;
+  float32_t *pC = pDst->pData;
+  uint32_t batchSize = pDst->batchSize;
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)  ||
+      (pSrcA->batchSize != batchSize)    ||
+      (pSrcB->batchSize != batchSize)      )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    int n = pSrcA->numRows;
+
+    if ((pSrcA->numCols == n) && (pSrcB->numCols == n))
+    {
+      switch (n)
+      {
+        case 2:
+          arm_mat_batch_mult_kernel_f32(2, 2, 2, pA, pB, pC, batchSize);
+          break;
+        case 3:
+          arm_mat_batch_mult_kernel_f32(3, 3, 3, pA, pB, pC, batchSize);
+          break;
+        case 4:
+          arm_mat_batch_mult_kernel_f32(4, 4, 4, pA, pB, pC, batchSize);
+          break;
+        case 5:
+          arm_mat_batch_mult_kernel_f32(5, 5, 5, pA, pB, pC, batchSize);
+          break;
+        case 6:
+          arm_mat_batch_mult_kernel_f32(6, 6, 6, pA, pB, pC, batchSize);
+          break;
+        case 7:
+          arm_mat_batch_mult_kernel_f32(7, 7, 7, pA, pB, pC, batchSize);
+          break;
+        case 8:
+          arm_mat_batch_mult_kernel_f32(8, 8, 8, pA, pB, pC, batchSize);
+          break;
+        default:
+          arm_mat_batch_mult_kernel_f32(n, n, n, pA, pB, pC, batchSize);
+          break;
+      }
+    }
+    else
+    {
+      arm_mat_batch_mult_kernel_f32(pSrcA->numRows, pSrcA->numCols, pSrcB->numCols, pA, pB, pC, batchSize);
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixBatch group
+ */
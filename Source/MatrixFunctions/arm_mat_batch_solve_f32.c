@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_batch_solve_f32.c
+ * Description:  Floating-point linear solve of a batch of small matrices
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+#include "arm_mat_batch.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixBatch
+  @{
+ */
+
+/**
+  @brief         Solve A X = B for a batch of floating-point matrices.
+  @param[in]     pSrcA     points to the batch of square matrices A
+  @param[in]     pSrcB     points to the batch of right hand sides B
+  @param[out]    pDst      points to the batch of solutions X
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH  : Matrix size check failed
+                   - \ref ARM_MATH_ARGUMENT_ERROR : Dimension bigger than \ref ARM_MAT_BATCH_MAX_DIM
+                   - \ref ARM_MATH_SINGULAR       : At least one of the matrices A is singular
+
+  @par           The systems are solved with the same Gauss-Jordan elimination
+                 as \ref arm_mat_batch_inverse_f32 without computing
+                 the inverses. The matrices B can have up to
+                 \ref ARM_MAT_BATCH_MAX_DIM columns.
+                 The destination can be the same batch as B.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_batch_solve_f32(
+  const arm_matrix_batch_instance_f32 * pSrcA,
+  const arm_matrix_batch_instance_f32 * pSrcB,
+        arm_matrix_batch_instance_f32 * pDst)
+{
+  const float32_t *pA = pSrcA->pData;
+  const float32_t *pB = pSrcB->pData;
+  float32_t *pX = pDst->pData;
+  uint32_t batchSize = pSrcA->batchSize;
+  int n = pSrcA->numRows;
+  int m = pSrcB->numCols;
+  int singular;
+  arm_status status;                             /* status of matrix solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numRows != pSrcA->numCols) ||
+      (pSrcB->numRows != pSrcA->numRows) ||
+      (pDst->numRows != pSrcB->numRows)  ||
+      (pDst->numCols != pSrcB->numCols)  ||
+      (pSrcB->batchSize != batchSize)    ||
+      (pDst->batchSize != batchSize))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  if ((n > (int) ARM_MAT_BATCH_MAX_DIM) || (m > (int) ARM_MAT_BATCH_MAX_DIM))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Only the dimension of A is specialized */
+    switch (n)
+    {
+      case 1:
+        singular = arm_mat_batch_solve_kernel_f32(1, m, pA, pB, pX, batchSize);
+        break;
+      case 2:
+        singular = arm_mat_batch_solve_kernel_f32(2, m, pA, pB, pX, batchSize);
+        break;
+      case 3:
+        singular = arm_mat_batch_solve_kernel_f32(3, m, pA, pB, pX, batchSize);
+        break;
+      case 4:
+        singular = arm_mat_batch_solve_kernel_f32(4, m, pA, pB, pX, batchSize);
+        break;
+      case 5:
+        singular = arm_mat_batch_solve_kernel_f32(5, m, pA, pB, pX, batchSize);
+        break;
+      case 6:
+        singular = arm_mat_batch_solve_kernel_f32(6, m, pA, pB, pX, batchSize);
+        break;
+      case 7:
+        singular = arm_mat_batch_solve_kernel_f32(7, m, pA, pB, pX, batchSize);
+        break;
+      case 8:
+        singular = arm_mat_batch_solve_kernel_f32(8, m, pA, pB, pX, batchSize);
+        break;
+      default:
+        /* Empty matrices */
+        singular = 0;
+        break;
+    }
+
+    status = singular ? ARM_MATH_SINGULAR : ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixBatch group
+ */
@@ -0,0 +1,177 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_blocked_f64.c
+ * Description:  Floating-point blocked Cholesky decomposition
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+#include "dsp/matrix_utils.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixChol
+  @{
+ */
+
+/**
+   * @brief Floating-point blocked Cholesky decomposition of positive-definite matrix.
+   * @param[in]  pSrc       points to the instance of the input floating-point matrix structure.
+   * @param[out] pDst       points to the instance of the output floating-point matrix structure.
+   * @param[in]  panelSize  number of columns of the panels
+   * @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_ARGUMENT_ERROR : panelSize is 0
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE      : Input matrix cannot be decomposed
+   * @par
+   * The result is the same as the one of \ref arm_mat_cholesky_f64 but the computation
+   * is organized for big matrices. The columns are factorized by panels of
+   * panelSize columns. Once a panel is factorized, the trailing sub-matrix is
+   * updated by blocks with \ref arm_mat_gemm_strided_f64 so that each panel is
+   * read from memory a few times only instead of once per column.
+   * \ref ARM_MAT_DEFAULT_PANEL_SIZE is a good starting point for the panel size.
+   *
+   * @par
+   * Only the lower triangular part of the destination matrix is written.
+   * The destination matrix should be set to 0 before calling the functions because
+   * the function may not overwrite all output elements.
+   */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_cholesky_blocked_f64(
+                                const arm_matrix_instance_f64 * pSrc,
+                                arm_matrix_instance_f64 * pDst,
+                                uint16_t panelSize)
+{
+
+    arm_status status;                             /* status of matrix inverse */
+
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+    /* Check for matrix mismatch condition */
+    if ((pSrc->numRows != pSrc->numCols) ||
+        (pDst->numRows != pDst->numCols) ||
+        (pSrc->numRows != pDst->numRows)   )
+    {
+        /* Set status as ARM_MATH_SIZE_MISMATCH */
+        status = ARM_MATH_SIZE_MISMATCH;
+    }
+    else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+    if (panelSize == 0U)
+    {
+        status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else
+    {
+        int i,j;
+        int k0,k1,r0,r1;
+        int n = pSrc->numRows;
+        float64_t invSqrtVj;
+        float64_t *pA,*pG;
+        arm_matrix_strided_instance_f64 sl, sr, sc;
+
+        pA = pSrc->pData;
+        pG = pDst->pData;
+
+        /* Only the lower triangular part of the source is used */
+        for(i=0 ; i < n ; i++)
+        {
+            for(j=0 ; j <= i ; j++)
+            {
+                pG[i * n + j] = pA[i * n + j];
+            }
+        }
+
+        for(k0=0 ; k0 < n ; k0 += panelSize)
+        {
+            k1 = (k0 + panelSize < n) ? k0 + panelSize : n;
+
+            /* Panel factorization : the columns of the panel are updated
+               with the previous columns of the panel only since the
+               columns on the left of the panel have already been applied */
+            for(i=k0 ; i < k1 ; i++)
+            {
+                if (i > k0)
+                {
+                    arm_mat_strided_init_f64(&sl, n - i, i - k0, n, pG + i * n + k0);
+                    arm_mat_strided_init_f64(&sr, 1, i - k0, n, pG + i * n + k0);
+                    arm_mat_strided_init_f64(&sc, n - i, 1, n, pG + i * n + i);
+                    arm_mat_gemm_strided_f64(ARM_MAT_NO_TRANS, ARM_MAT_TRANS, -1.0, &sl, &sr, 1.0, &sc);
+                }
+
+                if (pG[i * n + i] <= 0.0)
+                {
+                    return(ARM_MATH_DECOMPOSITION_FAILURE);
+                }
+
+                invSqrtVj = 1.0/sqrt(pG[i * n + i]);
+                SCALE_COL_F64(pDst,i,invSqrtVj,i);
+            }
+
+            /* Update of the lower part of the trailing sub-matrix
+               by blocks of rows */
+            for(r0=k1 ; r0 < n ; r0 += panelSize)
+            {
+                r1 = (r0 + panelSize < n) ? r0 + panelSize : n;
+
+                /* Block on the left of the diagonal */
+                if (r0 > k1)
+                {
+                    arm_mat_strided_init_f64(&sl, r1 - r0, k1 - k0, n, pG + r0 * n + k0);
+                    arm_mat_strided_init_f64(&sr, r0 - k1, k1 - k0, n, pG + k1 * n + k0);
+                    arm_mat_strided_init_f64(&sc, r1 - r0, r0 - k1, n, pG + r0 * n + k1);
+                    arm_mat_gemm_strided_f64(ARM_MAT_NO_TRANS, ARM_MAT_TRANS, -1.0, &sl, &sr, 1.0, &sc);
+                }
+
+                /* Lower part of the diagonal block */
+                for(i=r0 ; i < r1 ; i++)
+                {
+                    arm_mat_strided_init_f64(&sl, 1, k1 - k0, n, pG + i * n + k0);
+                    arm_mat_strided_init_f64(&sr, i - r0 + 1, k1 - k0, n, pG + r0 * n + k0);
+                    arm_mat_strided_init_f64(&sc, 1, i - r0 + 1, n, pG + i * n + r0);
+                    arm_mat_gemm_strided_f64(ARM_MAT_NO_TRANS, ARM_MAT_TRANS, -1.0, &sl, &sr, 1.0, &sc);
+                }
+            }
+        }
+
+        status = ARM_MATH_SUCCESS;
+
+    }
+
+
+    /* Return to application */
+    return (status);
+}
+
+/**
+  @} end of MatrixChol group
+ */
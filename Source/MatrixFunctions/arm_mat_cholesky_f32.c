@@ -398,10 +398,11 @@ ARM_DSP_ATTRIBUTE arm_status arm_mat_cholesky_f32(
 #endif /* #ifdef ARM_MATH_MATRIX_CHECK */
 
   {
-    int i,j,k;
+    int i,j;
     int n = pSrc->numRows;
     float32_t invSqrtVj;
     float32_t *pA,*pG;
+    arm_matrix_strided_instance_f32 sl,sr,sc;
 
     pA = pSrc->pData;
     pG = pDst->pData;
@@ -412,13 +413,14 @@ ARM_DSP_ATTRIBUTE arm_status arm_mat_cholesky_f32(
        for(j=i ; j < n ; j++)
        {
           pG[j * n + i] = pA[j * n + i];
-
-          for(k=0; k < i ; k++)
-          {
-             pG[j * n + i] = pG[j * n + i] - pG[i * n + k] * pG[j * n + k];
-          }
        }
 
+       /* G(i:,i) = G(i:,i) - G(i:,0:i) G(i,0:i)^t */
+       arm_mat_strided_init_f32(&sl,n - i,i,n,pG + i * n);
+       arm_mat_strided_init_f32(&sr,1,i,n,pG + i * n);
+       arm_mat_strided_init_f32(&sc,n - i,1,n,pG + i * n + i);
+       arm_mat_gemm_strided_f32(ARM_MAT_NO_TRANS,ARM_MAT_TRANS,-1.0f,&sl,&sr,1.0f,&sc);
+
        if (pG[i * n + i] <= 0.0f)
        {
          return(ARM_MATH_DECOMPOSITION_FAILURE);
@@ -0,0 +1,346 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_eig_sym_f64.c
+ * Description:  Floating-point symmetric eigen-decomposition
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+#include "dsp/basic_math_functions.h"
+
+#include <math.h>
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixEig
+  @{
+ */
+
+/* sqrt(a^2 + b^2) without overflow */
+static float64_t arm_mat_eig_pythag_f64(float64_t a, float64_t b)
+{
+  float64_t absa = fabs(a);
+  float64_t absb = fabs(b);
+  float64_t r;
+
+  if (absa > absb)
+  {
+    r = absb / absa;
+    return (absa * sqrt(1.0 + r * r));
+  }
+  if (absb == 0.0)
+  {
+    return (0.0);
+  }
+  r = absa / absb;
+  return (absb * sqrt(1.0 + r * r));
+}
+
+/**
+  @brief         Floating-point eigen-decomposition of a symmetric matrix.
+  @param[in]     pSrc           points to the input symmetric matrix of dimension n x n
+  @param[out]    pEigenValues   points to the eigenvalues of dimension n, in increasing order
+  @param[out]    pEigenVectors  points to the output matrix of dimension n x n. Column k is the eigenvector for the eigenvalue k.
+  @param[inout]  pTmp           points to a temporary buffer of dimension 3 * n
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE : The QL iterations did not converge
+
+  @par
+                   Computes A = V diag(w) V^t where V is orthogonal.
+  @par
+                   The source matrix is not modified. The tridiagonalization
+                   is done in the eigenvector matrix which must not be the
+                   source matrix.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_eig_sym_f64(
+  const arm_matrix_instance_f64 * pSrc,
+        float64_t * pEigenValues,
+        arm_matrix_instance_f64 * pEigenVectors,
+        float64_t * pTmp)
+{
+  arm_status status;                             /* status of matrix decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pEigenVectors->numRows != pEigenVectors->numCols) ||
+      (pSrc->numRows != pEigenVectors->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const int n = pSrc->numRows;
+    float64_t *pQ = pEigenVectors->pData;
+    float64_t *pD = pEigenValues;
+    float64_t *pE = pTmp;
+    float64_t *pV = pTmp + n;
+    float64_t *pW = pTmp + 2 * n;
+    float64_t tau, vx, f, g, p, r, s, c, b, dd;
+    int k, i, j, m, l, size, iter;
+
+    if (n == 0)
+    {
+      return (ARM_MATH_SUCCESS);
+    }
+
+    /* The source is reduced in the eigenvector matrix */
+    memcpy(pQ, pSrc->pData, n * n * sizeof(float64_t));
+
+    /*
+     * Householder tridiagonalization : A = Q T Q^t
+     * The reflection k is kept in the column k below the diagonal
+     * and its tau on the diagonal.
+     */
+    for (k = 0; k < n - 2; k++)
+    {
+      size = n - k - 1;
+      for (i = 0; i < size; i++)
+      {
+        pW[i] = pQ[(k + 1 + i) * n + k];
+      }
+
+      pD[k] = pQ[k * n + k];
+
+      tau = arm_householder_f64(pW, 0.0, size, pV);
+      pQ[k * n + k] = tau;
+      if (tau == 0.0)
+      {
+        pE[k] = pW[0];
+        continue;
+      }
+
+      /* Sub-diagonal element of the reflected column */
+      arm_dot_prod_f64(pV, pW, size, &vx);
+      pE[k] = pW[0] - tau * vx;
+
+      /* w = tau A22 v - (tau^2 / 2) (v^t A22 v) v */
+      for (i = 0; i < size; i++)
+      {
+        arm_dot_prod_f64(pQ + (k + 1 + i) * n + k + 1, pV, size, &s);
+        pW[i] = tau * s;
+      }
+      arm_dot_prod_f64(pW, pV, size, &s);
+      s = 0.5 * tau * s;
+      for (i = 0; i < size; i++)
+      {
+        pW[i] -= s * pV[i];
+      }
+
+      /* A22 = H A22 H = A22 - v w^t - w v^t */
+      for (i = 0; i < size; i++)
+      {
+        float64_t *pRow = pQ + (k + 1 + i) * n + k + 1;
+        for (j = 0; j < size; j++)
+        {
+          pRow[j] -= pV[i] * pW[j] + pW[i] * pV[j];
+        }
+      }
+
+      for (i = 0; i < size; i++)
+      {
+        pQ[(k + 1 + i) * n + k] = pV[i];
+      }
+    }
+
+    if (n >= 2)
+    {
+      pD[n - 2] = pQ[(n - 2) * n + n - 2];
+      pE[n - 2] = pQ[(n - 1) * n + n - 2];
+    }
+    pD[n - 1] = pQ[(n - 1) * n + n - 1];
+    pE[n - 1] = 0.0;
+
+    /*
+     * Q = H0 H1 ... is accumulated in place from the last reflection.
+     * Before the reflection k - 1 is applied to the rows and columns
+     * k to n - 1, the row and the column k are set to the identity.
+     */
+    for (k = n - 1; k >= 0; k--)
+    {
+      size = n - k;
+      tau = 0.0;
+      if ((k >= 1) && (k <= n - 2))
+      {
+        tau = pQ[(k - 1) * n + k - 1];
+        for (i = 0; i < size; i++)
+        {
+          pV[i] = pQ[(k + i) * n + k - 1];
+        }
+      }
+
+      pQ[k * n + k] = 1.0;
+      for (i = k + 1; i < n; i++)
+      {
+        pQ[k * n + i] = 0.0;
+        pQ[i * n + k] = 0.0;
+      }
+
+      if (tau != 0.0)
+      {
+        /* w^t = tau v^t Q22 and Q22 = Q22 - v w^t */
+        for (j = 0; j < size; j++)
+        {
+          s = 0.0;
+          for (i = 0; i < size; i++)
+          {
+            s += pV[i] * pQ[(k + i) * n + k + j];
+          }
+          pW[j] = tau * s;
+        }
+        for (i = 0; i < size; i++)
+        {
+          float64_t *pRow = pQ + (k + i) * n + k;
+          for (j = 0; j < size; j++)
+          {
+            pRow[j] -= pV[i] * pW[j];
+          }
+        }
+      }
+    }
+
+    /*
+     * Implicit QL iterations on the tridiagonal matrix.
+     * pE[i] is the element between pD[i] and pD[i + 1].
+     */
+    for (l = 0; l < n; l++)
+    {
+      iter = 0;
+      do
+      {
+        /* Look for a small sub-diagonal element */
+        for (m = l; m < n - 1; m++)
+        {
+          dd = fabs(pD[m]) + fabs(pD[m + 1]);
+          if ((float64_t) (fabs(pE[m]) + dd) == dd)
+          {
+            break;
+          }
+        }
+
+        if (m != l)
+        {
+          if (iter++ == (int) ARM_MAT_EIG_MAX_ITERATIONS)
+          {
+            return (ARM_MATH_DECOMPOSITION_FAILURE);
+          }
+
+          /* Wilkinson shift */
+          g = (pD[l + 1] - pD[l]) / (2.0 * pE[l]);
+          r = arm_mat_eig_pythag_f64(g, 1.0);
+          g = pD[m] - pD[l] + pE[l] / (g + ((g >= 0.0) ? r : -r));
+
+          s = 1.0;
+          c = 1.0;
+          p = 0.0;
+          for (i = m - 1; i >= l; i--)
+          {
+            f = s * pE[i];
+            b = c * pE[i];
+            r = arm_mat_eig_pythag_f64(f, g);
+            pE[i + 1] = r;
+            if (r == 0.0)
+            {
+              /* Underflow : deflate and restart */
+              pD[i + 1] -= p;
+              pE[m] = 0.0;
+              break;
+            }
+            s = f / r;
+            c = g / r;
+            g = pD[i + 1] - p;
+            r = (pD[i] - g) * s + 2.0 * c * b;
+            p = s * r;
+            pD[i + 1] = g + p;
+            g = c * r - b;
+
+            /* Apply the rotation to the eigenvectors */
+            for (k = 0; k < n; k++)
+            {
+              f = pQ[k * n + i + 1];
+              pQ[k * n + i + 1] = s * pQ[k * n + i] + c * f;
+              pQ[k * n + i] = c * pQ[k * n + i] - s * f;
+            }
+          }
+
+          if ((r == 0.0) && (i >= l))
+          {
+            continue;
+          }
+
+          pD[l] -= p;
+          pE[l] = g;
+          pE[m] = 0.0;
+        }
+      } while (m != l);
+    }
+
+    /* Sort the eigenvalues in increasing order */
+    for (i = 0; i < n - 1; i++)
+    {
+      k = i;
+      p = pD[i];
+      for (j = i + 1; j < n; j++)
+      {
+        if (pD[j] < p)
+        {
+          k = j;
+          p = pD[j];
+        }
+      }
+      if (k != i)
+      {
+        pD[k] = pD[i];
+        pD[i] = p;
+        for (j = 0; j < n; j++)
+        {
+          p = pQ[j * n + i];
+          pQ[j * n + i] = pQ[j * n + k];
+          pQ[j * n + k] = p;
+        }
+      }
+    }
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixEig group
+ */
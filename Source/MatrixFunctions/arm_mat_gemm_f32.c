@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_gemm_f32.c
+ * Description:  Floating-point general matrix multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixGemm General Matrix Multiplication
+
+  Computes
+  \f[
+      C = \alpha \, op(A) \, op(B) + \beta \, C
+  \f]
+  where op(X) is X or its transpose \f$X^T\f$ according to the
+  \ref arm_mat_trans_op flags.
+
+  This avoids the transposition of an operand and the additional matrix
+  addition that would be needed with \ref arm_mat_mult_f32 to compute
+  for instance \f$A^T B\f$ or \f$C + A B\f$.
+
+  When \f$\beta\f$ is 0, C is not read and does not need to be initialized.
+
+  The operands are traversed so that the inner loops access
+  contiguous memory: when B is used as it is, a row of C is updated
+  from the rows of B. When B is transposed, the elements of C are dot
+  products of rows of op(A) and of rows of B.
+
+  The destination must not overlap the sources.
+
+  The fixed-point versions compute the product op(A) op(B)
+  like \ref arm_mat_mult_q31 and \ref arm_mat_mult_q15 with a 64-bit
+  accumulator. \f$\alpha\f$ and \f$\beta\f$ are fractional values.
+  The scaling by \f$\alpha\f$ and \f$\beta\f$ and the sum are rounded
+  once and saturated.
+ */
+
+/**
+  @addtogroup MatrixGemm
+  @{
+ */
+
+/**
+  @brief         Floating-point general matrix multiplication.
+  @param[in]     transA     \ref ARM_MAT_TRANS if A must be transposed
+  @param[in]     transB     \ref ARM_MAT_TRANS if B must be transposed
+  @param[in]     alpha      scaling of the product
+  @param[in]     pSrcA      points to the first input matrix structure
+  @param[in]     pSrcB      points to the second input matrix structure
+  @param[in]     beta       scaling of the destination
+  @param[in,out] pDst       points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_gemm_f32(
+        arm_mat_trans_op transA,
+        arm_mat_trans_op transB,
+        float32_t alpha,
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        float32_t beta,
+        arm_matrix_instance_f32 * pDst)
+{
+  arm_matrix_strided_instance_f32 sa, sb, sc;
+
+  /* Compact matrices are strided matrices whose stride is the number of columns */
+  arm_mat_strided_init_f32(&sa, pSrcA->numRows, pSrcA->numCols, pSrcA->numCols, pSrcA->pData);
+  arm_mat_strided_init_f32(&sb, pSrcB->numRows, pSrcB->numCols, pSrcB->numCols, pSrcB->pData);
+  arm_mat_strided_init_f32(&sc, pDst->numRows, pDst->numCols, pDst->numCols, pDst->pData);
+
+  return (arm_mat_gemm_strided_f32(transA, transB, alpha, &sa, &sb, beta, &sc));
+}
+
+/**
+  @} end of MatrixGemm group
+ */
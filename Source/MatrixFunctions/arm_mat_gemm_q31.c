@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_gemm_q31.c
+ * Description:  Q31 general matrix multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixGemm
+  @{
+ */
+
+/**
+  @brief         Q31 general matrix multiplication.
+  @param[in]     transA     \ref ARM_MAT_TRANS if A must be transposed
+  @param[in]     transB     \ref ARM_MAT_TRANS if B must be transposed
+  @param[in]     alpha      scaling of the product in 1.31 format
+  @param[in]     pSrcA      points to the first input matrix structure
+  @param[in]     pSrcB      points to the second input matrix structure
+  @param[in]     beta       scaling of the destination in 1.31 format
+  @param[in,out] pDst       points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Scaling and Overflow Behavior
+                   The product op(A) op(B) is accumulated in a 64-bit accumulator and
+                   converted to 1.31 format with saturation. The result
+                   alpha * op(A) op(B) + beta * C is computed in a 64-bit accumulator
+                   and is rounded once and saturated.
+                   The maximum value of alpha and beta is just below 1 :
+                   \ref ARM_MAT_GEMM_ONE_Q31. With rounding, it leaves the values
+                   unchanged except the biggest ones whose magnitude may
+                   decrease by one LSB.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_gemm_q31(
+        arm_mat_trans_op transA,
+        arm_mat_trans_op transB,
+        q31_t alpha,
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+        q31_t beta,
+        arm_matrix_instance_q31 * pDst)
+{
+  const q31_t *pRowA;                          /* Row of op(A) */
+  const q31_t *pColB;                          /* Column of op(B) */
+  q31_t *pC = pDst->pData;                     /* output data matrix pointer */
+  q63_t sum;                                     /* Accumulator */
+  q63_t acc;                                     /* Scaled result */
+  uint32_t numRows = pDst->numRows;              /* Number of rows of op(A) and C */
+  uint32_t numCols = pDst->numCols;              /* Number of columns of op(B) and C */
+  uint32_t numInner;                             /* Number of columns of op(A) */
+  uint32_t incA, incB;                           /* Distances between elements of a row of op(A) and a column of op(B) */
+  uint32_t i, j, k;                              /* Loop counters */
+  arm_status status;                             /* Status of matrix multiplication */
+
+  numInner = (transA == ARM_MAT_NO_TRANS) ? pSrcA->numCols : pSrcA->numRows;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((((transA == ARM_MAT_NO_TRANS) ? pSrcA->numRows : pSrcA->numCols) != numRows) ||
+      (((transB == ARM_MAT_NO_TRANS) ? pSrcB->numRows : pSrcB->numCols) != numInner) ||
+      (((transB == ARM_MAT_NO_TRANS) ? pSrcB->numCols : pSrcB->numRows) != numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    incA = (transA == ARM_MAT_NO_TRANS) ? 1U : pSrcA->numCols;
+    incB = (transB == ARM_MAT_NO_TRANS) ? pSrcB->numCols : 1U;
+
+    for (i = 0U; i < numRows; i++)
+    {
+      pRowA = (transA == ARM_MAT_NO_TRANS) ? pSrcA->pData + (size_t) i * pSrcA->numCols : pSrcA->pData + i;
+
+      for (j = 0U; j < numCols; j++)
+      {
+        pColB = (transB == ARM_MAT_NO_TRANS) ? pSrcB->pData + j : pSrcB->pData + (size_t) j * pSrcB->numCols;
+
+        /* op(A)(i,:) . op(B)(:,j) */
+        sum = 0;
+        for (k = 0U; k < numInner; k++)
+        {
+          sum += (q63_t) pRowA[k * incA] * pColB[k * incB];
+        }
+
+        /* alpha * op(A) op(B) + beta * C with rounding. C is not read when beta is 0 */
+        acc = (q63_t) clip_q63_to_q31(sum >> 31) * alpha + 0x40000000;
+        if (beta != 0)
+        {
+          acc += (q63_t) *pC * beta;
+        }
+
+        *pC++ = clip_q63_to_q31(acc >> 31);
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixGemm group
+ */
@@ -0,0 +1,199 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_gemm_strided_f32.c
+ * Description:  Floating-point general matrix multiplication of strided matrices
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixGemm
+  @{
+ */
+
+/**
+  @brief         Floating-point general matrix multiplication of strided matrices.
+  @param[in]     transA     \ref ARM_MAT_TRANS if A must be transposed
+  @param[in]     transB     \ref ARM_MAT_TRANS if B must be transposed
+  @param[in]     alpha      scaling of the product
+  @param[in]     pSrcA      points to the first input strided matrix structure
+  @param[in]     pSrcB      points to the second input strided matrix structure
+  @param[in]     beta       scaling of the destination
+  @param[in,out] pDst       points to output strided matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Details
+                   The matrices can be \ref MatrixStrided "views" of bigger matrices.
+                   It is used for the updates of the trailing sub-matrices in
+                   \ref arm_mat_qr_f32 and \ref arm_mat_cholesky_f32.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_gemm_strided_f32(
+        arm_mat_trans_op transA,
+        arm_mat_trans_op transB,
+        float32_t alpha,
+  const arm_matrix_strided_instance_f32 * pSrcA,
+  const arm_matrix_strided_instance_f32 * pSrcB,
+        float32_t beta,
+        arm_matrix_strided_instance_f32 * pDst)
+{
+  const float32_t *pA = pSrcA->pData;                 /* input data matrix pointer A */
+  const float32_t *pB = pSrcB->pData;                 /* input data matrix pointer B */
+  float32_t *pC;                                      /* Row of output matrix */
+  const float32_t *pB0, *pB1, *pB2, *pB3;             /* Rows of matrix B */
+  float32_t a0, a1, a2, a3;                           /* Elements of alpha * op(A) */
+  float32_t sum;                                      /* Accumulator */
+  uint32_t numRows = pDst->numRows;              /* Number of rows of op(A) and C */
+  uint32_t numCols = pDst->numCols;              /* Number of columns of op(B) and C */
+  uint32_t numInner;                             /* Number of columns of op(A) */
+  uint32_t lda = pSrcA->stride;                  /* Distance between rows of A */
+  uint32_t ldb = pSrcB->stride;                  /* Distance between rows of B */
+  uint32_t ldc = pDst->stride;                   /* Distance between rows of C */
+  uint32_t incA;                                 /* Distance between two elements of a row of op(A) */
+  uint32_t i, j, k;                              /* Loop counters */
+  arm_status status;                             /* Status of matrix multiplication */
+
+  numInner = (transA == ARM_MAT_NO_TRANS) ? pSrcA->numCols : pSrcA->numRows;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((((transA == ARM_MAT_NO_TRANS) ? pSrcA->numRows : pSrcA->numCols) != numRows) ||
+      (((transB == ARM_MAT_NO_TRANS) ? pSrcB->numRows : pSrcB->numCols) != numInner) ||
+      (((transB == ARM_MAT_NO_TRANS) ? pSrcB->numCols : pSrcB->numRows) != numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* op(A)(i,k) is at pRowA[k * incA] */
+    incA = (transA == ARM_MAT_NO_TRANS) ? 1U : lda;
+
+    for (i = 0U; i < numRows; i++)
+    {
+      const float32_t *pRowA = (transA == ARM_MAT_NO_TRANS) ? pA + (size_t) i * lda : pA + i;
+
+      pC = pDst->pData + (size_t) i * ldc;
+
+      /* C(i,:) = beta * C(i,:). C is not read when beta is 0 */
+      if (beta == 0.0f)
+      {
+        for (j = 0U; j < numCols; j++)
+        {
+          pC[j] = 0.0f;
+        }
+      }
+      else if (beta != 1.0f)
+      {
+        for (j = 0U; j < numCols; j++)
+        {
+          pC[j] = beta * pC[j];
+        }
+      }
+
+      if (transB == ARM_MAT_NO_TRANS)
+      {
+        /* C(i,:) += alpha * op(A)(i,k) * B(k,:)
+           All the accesses to B and C are contiguous.
+           Four rows of B are used at each iteration. */
+        k = 0U;
+        while (k + 4U <= numInner)
+        {
+          a0 = alpha * pRowA[(k     ) * incA];
+          a1 = alpha * pRowA[(k + 1U) * incA];
+          a2 = alpha * pRowA[(k + 2U) * incA];
+          a3 = alpha * pRowA[(k + 3U) * incA];
+          pB0 = pB + (size_t) k * ldb;
+          pB1 = pB0 + ldb;
+          pB2 = pB1 + ldb;
+          pB3 = pB2 + ldb;
+
+          for (j = 0U; j < numCols; j++)
+          {
+            sum = pC[j];
+            sum += a0 * pB0[j];
+            sum += a1 * pB1[j];
+            sum += a2 * pB2[j];
+            sum += a3 * pB3[j];
+            pC[j] = sum;
+          }
+
+          k += 4U;
+        }
+
+        while (k < numInner)
+        {
+          a0 = alpha * pRowA[k * incA];
+          pB0 = pB + (size_t) k * ldb;
+
+          for (j = 0U; j < numCols; j++)
+          {
+            pC[j] += a0 * pB0[j];
+          }
+
+          k++;
+        }
+      }
+      else
+      {
+        /* The columns of op(B) are the rows of B :
+           C(i,j) += alpha * (op(A)(i,:) . B(j,:)) */
+        for (j = 0U; j < numCols; j++)
+        {
+          pB0 = pB + (size_t) j * ldb;
+          sum = 0.0f;
+
+          for (k = 0U; k < numInner; k++)
+          {
+            sum += pRowA[k * incA] * pB0[k];
+          }
+
+          pC[j] += alpha * sum;
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixGemm group
+ */
@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_init_large_f32.c
+ * Description:  Floating-point large matrix initialization
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixLarge Large Matrices
+
+  The large matrix structures have 32-bit dimensions and can describe
+  matrices with more than 65535 rows or columns:
+  <pre>
+      typedef struct
+      {
+        uint32_t numRows;     // number of rows of the matrix.
+        uint32_t numCols;     // number of columns of the matrix.
+        float32_t *pData;     // points to the data of the matrix.
+      } arm_matrix_instance_large_f32;
+  </pre>
+  The layout of the data is the same as for the other matrices.
+  The offsets in the data array are computed with <code>size_t</code>
+  so the number of elements can be bigger than 2^32 on 64-bit hosts.
+
+  The large variants of the matrix functions have the same arguments and
+  the same results as the other matrix functions. The element-wise
+  functions are computed with the vector functions of the
+  \ref groupMath "Basic Math" group. The matrix products compute each
+  output element with the same order of operations as the generic
+  C implementation of the normal functions.
+ */
+
+/**
+  @addtogroup MatrixLarge
+  @{
+ */
+
+/**
+  @brief         Floating-point large matrix initialization.
+  @param[in,out] S         points to an instance of the floating-point large matrix structure
+  @param[in]     nRows     number of rows in the matrix
+  @param[in]     nColumns  number of columns in the matrix
+  @param[in]     pData     points to the matrix data array
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_init_large_f32(
+  arm_matrix_instance_large_f32 * S,
+  uint32_t nRows,
+  uint32_t nColumns,
+  float32_t * pData)
+{
+  /* Assign Number of Rows */
+  S->numRows = nRows;
+
+  /* Assign Number of Columns */
+  S->numCols = nColumns;
+
+  /* Assign Data pointer */
+  S->pData = pData;
+}
+
+/**
+  @} end of MatrixLarge group
+ */
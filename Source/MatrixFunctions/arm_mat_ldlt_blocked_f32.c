@@ -0,0 +1,276 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_ldlt_blocked_f32.c
+ * Description:  Floating-point blocked LDL decomposition
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+#include "dsp/matrix_utils.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixChol
+  @{
+ */
+
+/**
+   * @brief Floating-point blocked LDL^t decomposition of positive semi-definite matrix.
+   * @param[in]  pSrc       points to the instance of the input floating-point matrix structure.
+   * @param[out] pl         points to the instance of the output floating-point triangular matrix structure.
+   * @param[out] pd         points to the instance of the output floating-point diagonal matrix structure.
+   * @param[out] pp         points to the instance of the output floating-point permutation vector.
+   * @param[in]  panelSize  number of columns of the panels
+   * @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_ARGUMENT_ERROR : panelSize is 0
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE      : Input matrix cannot be decomposed
+   * @par
+   *  Computes the LDL^t decomposition of a matrix A such that P A P^t = L D L^t.
+   *
+   * @par
+   *  The pivoting and the result are the same as the ones of \ref arm_mat_ldlt_f32
+   *  but the computation is organized for big matrices. Only the lower
+   *  triangular part of the matrix is updated. The columns are factorized by
+   *  panels of panelSize columns and, once a panel is factorized, the
+   *  trailing sub-matrix is updated by blocks with \ref arm_mat_gemm_strided_f32.
+   *  The diagonal matrix pd is used as a temporary buffer during the computation.
+   *  \ref ARM_MAT_DEFAULT_PANEL_SIZE is a good starting point for the panel size.
+   */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_ldlt_blocked_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pl,
+  arm_matrix_instance_f32 * pd,
+  uint16_t * pp,
+  uint16_t panelSize)
+{
+
+  arm_status status;                             /* status of matrix inverse */
+
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pl->numRows != pl->numCols) ||
+      (pd->numRows != pd->numCols) ||
+      (pl->numRows != pd->numRows)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  if (panelSize == 0U)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+
+    const int n=pSrc->numRows;
+    int fullRank = 1, diag,k;
+    int k0,k1,r0,r1;
+    float32_t *pA,*pU;
+    float32_t tmp;
+    int row,col,d;
+    arm_matrix_strided_instance_f32 sl, sr, sc;
+
+    memcpy(pl->pData,pSrc->pData,n*n*sizeof(float32_t));
+    pA = pl->pData;
+
+    /* Column k of D L^t is kept in column k of pd until the end
+       of the panel */
+    pU = pd->pData;
+
+    for(k=0;k < n; k++)
+    {
+      pp[k] = k;
+    }
+
+    k = 0;
+    for(k0=0; k0 < n; k0 += panelSize)
+    {
+      k1 = (k0 + panelSize < n) ? k0 + panelSize : n;
+
+      for(k=k0;k < k1; k++)
+      {
+        /* Find pivot. The diagonal is always up to date. */
+        float32_t m=F32_MIN,a,u;
+        int j=k;
+        int r;
+
+        for(r=k;r<n;r++)
+        {
+           if (pA[r*n+r] > m)
+           {
+             m = pA[r*n+r];
+             j = r;
+           }
+        }
+
+        if(j != k)
+        {
+          /* Symmetric permutation of the lower triangular part */
+          for(col=0;col<k;col++)
+          {
+            tmp = pA[k*n+col];
+            pA[k*n+col] = pA[j*n+col];
+            pA[j*n+col] = tmp;
+          }
+          for(col=k0;col<k;col++)
+          {
+            tmp = pU[k*n+col];
+            pU[k*n+col] = pU[j*n+col];
+            pU[j*n+col] = tmp;
+          }
+
+          tmp = pA[k*n+k];
+          pA[k*n+k] = pA[j*n+j];
+          pA[j*n+j] = tmp;
+
+          for(row=k+1;row<j;row++)
+          {
+            tmp = pA[row*n+k];
+            pA[row*n+k] = pA[j*n+row];
+            pA[j*n+row] = tmp;
+          }
+          for(row=j+1;row<n;row++)
+          {
+            tmp = pA[row*n+k];
+            pA[row*n+k] = pA[row*n+j];
+            pA[row*n+j] = tmp;
+          }
+        }
+
+
+        pp[k] = j;
+
+        a = pA[k*n+k];
+
+        if (fabsf(a) < 1.0e-8f)
+        {
+
+            fullRank = 0;
+            break;
+        }
+
+        /* Apply the previous columns of the panel to column k */
+        if (k > k0)
+        {
+          arm_mat_strided_init_f32(&sl, n - k - 1, k - k0, n, pA + (k + 1) * n + k0);
+          arm_mat_strided_init_f32(&sr, 1, k - k0, n, pU + k * n + k0);
+          arm_mat_strided_init_f32(&sc, n - k - 1, 1, n, pA + (k + 1) * n + k);
+          arm_mat_gemm_strided_f32(ARM_MAT_NO_TRANS, ARM_MAT_TRANS, -1.0f, &sl, &sr, 1.0f, &sc);
+        }
+
+        for(int w=k+1;w<n;w++)
+        {
+          u = pA[w*n+k];
+          pU[w*n+k] = u;
+          pA[w*n+w] = pA[w*n+w] - u * u / a;
+          pA[w*n+k] = u / a;
+        }
+
+      }
+
+      if (!fullRank)
+      {
+        break;
+      }
+
+      /* Update of the strictly lower part of the trailing sub-matrix
+         by blocks of rows. The diagonal has already been updated. */
+      for(r0=k1 ; r0 < n ; r0 += panelSize)
+      {
+        r1 = (r0 + panelSize < n) ? r0 + panelSize : n;
+
+        if (r0 > k1)
+        {
+          arm_mat_strided_init_f32(&sl, r1 - r0, k1 - k0, n, pA + r0 * n + k0);
+          arm_mat_strided_init_f32(&sr, r0 - k1, k1 - k0, n, pU + k1 * n + k0);
+          arm_mat_strided_init_f32(&sc, r1 - r0, r0 - k1, n, pA + r0 * n + k1);
+          arm_mat_gemm_strided_f32(ARM_MAT_NO_TRANS, ARM_MAT_TRANS, -1.0f, &sl, &sr, 1.0f, &sc);
+        }
+
+        for(row=r0+1 ; row < r1 ; row++)
+        {
+          arm_mat_strided_init_f32(&sl, 1, k1 - k0, n, pA + row * n + k0);
+          arm_mat_strided_init_f32(&sr, row - r0, k1 - k0, n, pU + r0 * n + k0);
+          arm_mat_strided_init_f32(&sc, 1, row - r0, n, pA + row * n + r0);
+          arm_mat_gemm_strided_f32(ARM_MAT_NO_TRANS, ARM_MAT_TRANS, -1.0f, &sl, &sr, 1.0f, &sc);
+        }
+      }
+    }
+
+
+
+    diag=k;
+    if (!fullRank)
+    {
+      diag--;
+      for(row=0; row < n;row++)
+      {
+        for(col=k; col < n;col++)
+        {
+           pl->pData[row*n+col]=0.0;
+        }
+      }
+    }
+
+    for(row=0; row < n;row++)
+    {
+       for(col=row+1; col < n;col++)
+       {
+         pl->pData[row*n+col] = 0.0;
+       }
+    }
+
+    memset(pd->pData,0,sizeof(float32_t)*n*n);
+    for(d=0; d < diag;d++)
+    {
+      pd->pData[d*n+d] = pl->pData[d*n+d];
+      pl->pData[d*n+d] = 1.0;
+    }
+
+    status = ARM_MATH_SUCCESS;
+
+  }
+
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixChol group
+ */
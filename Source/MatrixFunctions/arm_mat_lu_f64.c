@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_lu_f64.c
+ * Description:  Floating-point LU decomposition
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+#include "dsp/matrix_utils.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixLU
+  @{
+ */
+
+/**
+  @brief         Floating-point LU decomposition with partial pivoting.
+  @param[in]     pSrc    points to the input matrix structure
+  @param[out]    pLU     points to the output matrix structure for the packed L and U factors
+  @param[out]    pPivot  points to the pivot vector of dimension n
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : Input matrix is found to be singular
+
+  @par
+                   Computes P A = L U. U is stored in the upper triangular part of pLU
+                   and L, without its unit diagonal, in the strictly lower triangular part.
+                   At step k, the rows k and pPivot[k] have been swapped.
+  @par
+                   pLU may be the same matrix as pSrc.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_lu_f64(
+  const arm_matrix_instance_f64 * pSrc,
+        arm_matrix_instance_f64 * pLU,
+        uint16_t * pPivot)
+{
+  arm_status status;                             /* status of matrix decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pLU->numRows != pLU->numCols) ||
+      (pSrc->numRows != pLU->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const int n = pSrc->numRows;
+    int k0, k1, k, r, c, p;
+    float64_t *pA = pLU->pData;
+    float64_t m, v, invPivot;
+    arm_matrix_strided_instance_f64 sl, su, sc;
+
+    if (pLU->pData != pSrc->pData)
+    {
+      memcpy(pLU->pData, pSrc->pData, n * n * sizeof(float64_t));
+    }
+
+    for (k0 = 0; k0 < n; k0 += ARM_MAT_DEFAULT_PANEL_SIZE)
+    {
+      k1 = (k0 + (int) ARM_MAT_DEFAULT_PANEL_SIZE < n) ? k0 + (int) ARM_MAT_DEFAULT_PANEL_SIZE : n;
+
+      /* Factorization of the panel of columns k0 to k1 - 1 */
+      for (k = k0; k < k1; k++)
+      {
+        /* Find pivot */
+        m = 0.0;
+        p = k;
+        for (r = k; r < n; r++)
+        {
+          v = fabs(pA[r * n + k]);
+          if (v > m)
+          {
+            m = v;
+            p = r;
+          }
+        }
+
+        if (m == 0.0)
+        {
+          return (ARM_MATH_SINGULAR);
+        }
+
+        pPivot[k] = (uint16_t) p;
+        if (p != k)
+        {
+          SWAP_ROWS_F64(pLU, 0, k, p);
+        }
+
+        invPivot = 1.0 / pA[k * n + k];
+        for (r = k + 1; r < n; r++)
+        {
+          pA[r * n + k] *= invPivot;
+        }
+
+        /* Rank-1 update of the remaining columns of the panel */
+        for (r = k + 1; r < n; r++)
+        {
+          v = pA[r * n + k];
+          for (c = k + 1; c < k1; c++)
+          {
+            pA[r * n + c] -= v * pA[k * n + c];
+          }
+        }
+      }
+
+      if (k1 < n)
+      {
+        /* Rows of U on the right of the panel : solve with the unit
+           lower triangular diagonal block of the panel */
+        for (r = k0 + 1; r < k1; r++)
+        {
+          arm_mat_strided_init_f64(&sl, 1, r - k0, n, pA + r * n + k0);
+          arm_mat_strided_init_f64(&su, r - k0, n - k1, n, pA + k0 * n + k1);
+          arm_mat_strided_init_f64(&sc, 1, n - k1, n, pA + r * n + k1);
+          arm_mat_gemm_strided_f64(ARM_MAT_NO_TRANS, ARM_MAT_NO_TRANS, -1.0, &sl, &su, 1.0, &sc);
+        }
+
+        /* Update of the trailing sub-matrix */
+        arm_mat_strided_init_f64(&sl, n - k1, k1 - k0, n, pA + k1 * n + k0);
+        arm_mat_strided_init_f64(&su, k1 - k0, n - k1, n, pA + k0 * n + k1);
+        arm_mat_strided_init_f64(&sc, n - k1, n - k1, n, pA + k1 * n + k1);
+        arm_mat_gemm_strided_f64(ARM_MAT_NO_TRANS, ARM_MAT_NO_TRANS, -1.0, &sl, &su, 1.0, &sc);
+      }
+    }
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixLU group
+ */
@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_lu_solve_f32.c
+ * Description:  Floating-point linear system solve with a LU decomposition
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixLU
+  @{
+ */
+
+/**
+  @brief         Solve A X = B using the floating-point LU decomposition of A.
+  @param[in]     pLU     points to the packed L and U factors computed by \ref arm_mat_lu_f32
+  @param[in]     pPivot  points to the pivot vector computed by \ref arm_mat_lu_f32
+  @param[in]     pSrc    points to the right hand sides B (one per column)
+  @param[out]    pDst    points to the solutions X
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par
+                   A single right hand side is a matrix with one column.
+                   pDst may be the same matrix as pSrc.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_lu_solve_f32(
+  const arm_matrix_instance_f32 * pLU,
+  const uint16_t * pPivot,
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  arm_status status;                             /* status of matrix solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pLU->numRows != pLU->numCols) ||
+      (pLU->numRows != pSrc->numRows) ||
+      (pSrc->numRows != pDst->numRows) ||
+      (pSrc->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const int n = pLU->numRows;
+    const int nrhs = pSrc->numCols;
+    const float32_t *pA = pLU->pData;
+    float32_t *pX = pDst->pData;
+    float32_t tmp, invPivot;
+    int i, j, c;
+    arm_matrix_strided_instance_f32 sl, sx, sc;
+
+    if (pDst->pData != pSrc->pData)
+    {
+      memcpy(pDst->pData, pSrc->pData, n * nrhs * sizeof(float32_t));
+    }
+
+    /* Apply the row permutation */
+    for (i = 0; i < n; i++)
+    {
+      j = pPivot[i];
+      if (j != i)
+      {
+        for (c = 0; c < nrhs; c++)
+        {
+          tmp = pX[i * nrhs + c];
+          pX[i * nrhs + c] = pX[j * nrhs + c];
+          pX[j * nrhs + c] = tmp;
+        }
+      }
+    }
+
+    /* Forward substitution with the unit lower triangular L */
+    for (i = 1; i < n; i++)
+    {
+      arm_mat_strided_init_f32(&sl, 1, i, n, (float32_t *) pA + i * n);
+      arm_mat_strided_init_f32(&sx, i, nrhs, nrhs, pX);
+      arm_mat_strided_init_f32(&sc, 1, nrhs, nrhs, pX + i * nrhs);
+      arm_mat_gemm_strided_f32(ARM_MAT_NO_TRANS, ARM_MAT_NO_TRANS, -1.0f, &sl, &sx, 1.0f, &sc);
+    }
+
+    /* Backward substitution with U */
+    for (i = n - 1; i >= 0; i--)
+    {
+      if (i < n - 1)
+      {
+        arm_mat_strided_init_f32(&sl, 1, n - 1 - i, n, (float32_t *) pA + i * n + i + 1);
+        arm_mat_strided_init_f32(&sx, n - 1 - i, nrhs, nrhs, pX + (i + 1) * nrhs);
+        arm_mat_strided_init_f32(&sc, 1, nrhs, nrhs, pX + i * nrhs);
+        arm_mat_gemm_strided_f32(ARM_MAT_NO_TRANS, ARM_MAT_NO_TRANS, -1.0f, &sl, &sx, 1.0f, &sc);
+      }
+
+      invPivot = 1.0f / pA[i * n + i];
+      for (c = 0; c < nrhs; c++)
+      {
+        pX[i * nrhs + c] *= invPivot;
+      }
+    }
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixLU group
+ */
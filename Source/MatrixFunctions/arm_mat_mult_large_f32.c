@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_large_f32.c
+ * Description:  Floating-point large matrix multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/**
+  @brief         Floating-point large matrix multiplication.
+  @param[in]     pSrcA      points to the first input large matrix structure
+  @param[in]     pSrcB      points to the second input large matrix structure
+  @param[out]    pDst       points to output large matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Details
+                   A row of the output is accumulated from the rows of B
+                   so that all the accesses are contiguous. Each output element
+                   is computed with the same order of operations as the generic
+                   implementation of \ref arm_mat_mult_f32.
+                   The output must not be one of the inputs.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_large_f32(
+  const arm_matrix_instance_large_f32 * pSrcA,
+  const arm_matrix_instance_large_f32 * pSrcB,
+        arm_matrix_instance_large_f32 * pDst)
+{
+  const float32_t *pInA = pSrcA->pData;            /* input data matrix pointer A */
+  const float32_t *pInB;                           /* input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                   /* output data matrix pointer */
+  float32_t *px;                                   /* Temporary output data matrix pointer */
+  float32_t a;                                     /* Element of A */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t row, k, col;                          /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    for (row = 0U; row < numRowsA; row++)
+    {
+      px = pOut + (size_t) row * numColsB;
+
+      for (col = 0U; col < numColsB; col++)
+      {
+        px[col] = 0.0f;
+      }
+
+      /* C(row,:) += A(row,k) * B(k,:) */
+      pInB = pSrcB->pData;
+      for (k = 0U; k < numColsA; k++)
+      {
+        a = *pInA++;
+
+        for (col = 0U; col < numColsB; col++)
+        {
+          px[col] += a * pInB[col];
+        }
+
+        pInB += numColsB;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixMult group
+ */
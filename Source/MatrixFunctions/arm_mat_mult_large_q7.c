@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_large_q7.c
+ * Description:  Q7 large matrix multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/**
+  @brief         Q7 large matrix multiplication.
+  @param[in]     pSrcA      points to the first input large matrix structure
+  @param[in]     pSrcB      points to the second input large matrix structure
+  @param[out]    pDst       points to output large matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator
+                   (instead of 32-bit for \ref arm_mat_mult_q7) so that the long inner
+                   products cannot overflow. The result is saturated to 1.7 format.
+                   There is no need for a state buffer.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_large_q7(
+  const arm_matrix_instance_large_q7 * pSrcA,
+  const arm_matrix_instance_large_q7 * pSrcB,
+        arm_matrix_instance_large_q7 * pDst)
+{
+  const q7_t *pInA = pSrcA->pData;            /* input data matrix pointer A */
+  const q7_t *pIn1;                           /* Row of matrix A */
+  const q7_t *pIn2;                           /* Column of matrix B */
+  q7_t *px = pDst->pData;                     /* output data matrix pointer */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t row, col, colCnt;                     /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    for (row = 0U; row < numRowsA; row++)
+    {
+      for (col = 0U; col < numColsB; col++)
+      {
+        pIn1 = pInA;
+        pIn2 = pSrcB->pData + col;
+
+        /* Set the variable sum, that acts as accumulator, to zero */
+        sum = 0;
+
+        for (colCnt = 0U; colCnt < numColsA; colCnt++)
+        {
+          /* c(m,n) = a(1,1) * b(1,1) + a(1,2) * b(2,1) + .... + a(m,p) * b(p,n) */
+          sum += (q63_t) *pIn1++ * *pIn2;
+          pIn2 += numColsB;
+        }
+
+        /* Convert result and store it in destination buffer */
+        *px++ = (q7_t) __SSAT((q31_t) clip_q63_to_q31(sum >> 7), 8);
+      }
+
+      /* Next row of A */
+      pInA += numColsA;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixMult group
+ */
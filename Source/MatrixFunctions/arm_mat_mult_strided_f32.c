@@ -0,0 +1,215 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_strided_f32.c
+ * Description:  Floating-point strided matrix multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/**
+  @brief         Floating-point matrix multiplication of strided matrices.
+  @param[in]     pSrcA      points to the first input strided matrix structure
+  @param[in]     pSrcB      points to the second input strided matrix structure
+  @param[out]    pDst       points to output strided matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Details
+                   The result is the one of \ref arm_mat_mult_f32 but the matrices
+                   can be \ref MatrixStrided "views" of bigger matrices.
+                   The destination must not overlap the sources.
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_strided_f32(
+  const arm_matrix_strided_instance_f32 * pSrcA,
+  const arm_matrix_strided_instance_f32 * pSrcB,
+        arm_matrix_strided_instance_f32 * pDst)
+{
+  const float32_t *pInA = pSrcA->pData;          /* Row of matrix A */
+  const float32_t *pInB;                         /* Columns of matrix B */
+  const float32_t *pIn2;
+  float32_t *pOut = pDst->pData;                 /* Row of output matrix */
+  float32_t *px;
+  uint16_t numRowsA = pSrcA->numRows;            /* Number of rows of input matrix A */
+  uint16_t numColsB = pSrcB->numCols;            /* Number of columns of input matrix B */
+  uint16_t numColsA = pSrcA->numCols;            /* Number of columns of input matrix A */
+  uint32_t strideB = pSrcB->stride;
+  uint32_t row, k;                               /* Loop counters */
+  int32_t blkCnt;
+  f32x4_t acc;
+  mve_pred16_t p0;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  for (row = 0U; row < numRowsA; row++)
+  {
+    px = pOut;
+    pInB = pSrcB->pData;
+
+    /* 4 columns of the output row are computed at a time */
+    blkCnt = (int32_t) numColsB;
+    while (blkCnt > 0)
+    {
+      p0 = vctp32q((uint32_t) blkCnt);
+      acc = vdupq_n_f32(0.0f);
+      pIn2 = pInB;
+
+      for (k = 0U; k < numColsA; k++)
+      {
+        acc = vfmaq_n_f32(acc, vldrwq_z_f32(pIn2, p0), pInA[k]);
+        pIn2 += strideB;
+      }
+
+      vstrwq_p_f32(px, acc, p0);
+
+      px += 4;
+      pInB += 4;
+      blkCnt -= 4;
+    }
+
+    pInA += pSrcA->stride;
+    pOut += pDst->stride;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+#else
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_strided_f32(
+  const arm_matrix_strided_instance_f32 * pSrcA,
+  const arm_matrix_strided_instance_f32 * pSrcB,
+        arm_matrix_strided_instance_f32 * pDst)
+{
+  const float32_t *pInA = pSrcA->pData;          /* Row of matrix A */
+  const float32_t *pIn1, *pIn2;
+  float32_t *pOut = pDst->pData;                 /* Row of output matrix */
+  float32_t sum;                                 /* Accumulator */
+  uint16_t numRowsA = pSrcA->numRows;            /* Number of rows of input matrix A */
+  uint16_t numColsB = pSrcB->numCols;            /* Number of columns of input matrix B */
+  uint16_t numColsA = pSrcA->numCols;            /* Number of columns of input matrix A */
+  uint32_t strideB = pSrcB->stride;
+  uint32_t row, col, colCnt;                     /* Loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  for (row = 0U; row < numRowsA; row++)
+  {
+    for (col = 0U; col < numColsB; col++)
+    {
+      /* c(m,p) = a(m,1) * b(1,p) + a(m,2) * b(2,p) + .... + a(m,n) * b(n,p) */
+      sum = 0.0f;
+      pIn1 = pInA;
+      pIn2 = pSrcB->pData + col;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+      /* Loop unrolling: Compute 4 MACs at a time. */
+      colCnt = numColsA >> 2U;
+
+      while (colCnt > 0U)
+      {
+        sum += *pIn1++ * *pIn2;
+        pIn2 += strideB;
+
+        sum += *pIn1++ * *pIn2;
+        pIn2 += strideB;
+
+        sum += *pIn1++ * *pIn2;
+        pIn2 += strideB;
+
+        sum += *pIn1++ * *pIn2;
+        pIn2 += strideB;
+
+        /* Decrement loop counter */
+        colCnt--;
+      }
+
+      /* Loop unrolling: Compute remaining MACs */
+      colCnt = numColsA % 0x4U;
+
+#else
+
+      /* Initialize cntCnt with number of columns */
+      colCnt = numColsA;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+      while (colCnt > 0U)
+      {
+        sum += *pIn1++ * *pIn2;
+        pIn2 += strideB;
+
+        /* Decrement loop counter */
+        colCnt--;
+      }
+
+      pOut[col] = sum;
+    }
+
+    /* Next rows of A and of the output */
+    pInA += pSrcA->stride;
+    pOut += pDst->stride;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of MatrixMult group
+ */
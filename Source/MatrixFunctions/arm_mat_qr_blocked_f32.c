@@ -0,0 +1,371 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_qr_blocked_f32.c
+ * Description:  Floating-point blocked QR decomposition
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+#include "dsp/matrix_utils.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixQR
+  @{
+ */
+
+/*
+
+Triangular factor T of the block reflector H_k0 ... H_(k0+kb-1) = I - V T V^t.
+The reflectors are stored in the columns k0 to k0+kb-1 of R
+with an implicit unit diagonal.
+
+*/
+static void arm_mat_qr_block_t_f32(
+  const arm_matrix_instance_f32 * pR,
+  const float32_t * pTau,
+  int k0,
+  int kb,
+  float32_t * pT)
+{
+  const int m = pR->numRows;
+  const int n = pR->numCols;
+  const float32_t *pV = pR->pData;
+  int i, j, l, r, c;
+  float32_t sum;
+
+  for (i = 0; i < kb; i++)
+  {
+    c = k0 + i;
+
+    /* z = V(:,0:i)^t v_i */
+    for (j = 0; j < i; j++)
+    {
+      sum = pV[c * n + k0 + j];
+      for (r = c + 1; r < m; r++)
+      {
+        sum += pV[r * n + k0 + j] * pV[r * n + c];
+      }
+      pT[j * kb + i] = sum;
+    }
+
+    /* T(0:i,i) = -tau_i T(0:i,0:i) z */
+    for (j = 0; j < i; j++)
+    {
+      sum = 0.0f;
+      for (l = j; l < i; l++)
+      {
+        sum += pT[j * kb + l] * pT[l * kb + i];
+      }
+      pT[j * kb + i] = -pTau[c] * sum;
+    }
+
+    pT[i * kb + i] = pTau[c];
+  }
+}
+
+/*
+
+Apply the block reflector (I - V T V^t) or its transpose
+to the rows k0 to m-1 of a block C with nc columns.
+pW is a temporary buffer of kb * nc elements.
+
+*/
+static void arm_mat_qr_apply_block_f32(
+  const arm_matrix_instance_f32 * pR,
+  int k0,
+  int kb,
+  const float32_t * pT,
+  int transT,
+  float32_t * pC,
+  int ldc,
+  int nc,
+  float32_t * pW)
+{
+  const int m = pR->numRows;
+  const int n = pR->numCols;
+  const int k1 = k0 + kb;
+  float32_t *pV = pR->pData;
+  int i, j, c;
+  float32_t f, f0, f1, f2, f3;
+  float32_t *pC0, *pC1, *pC2, *pC3;
+  const float32_t *pV0;
+  arm_matrix_strided_instance_f32 sv, sc, sw;
+
+  arm_mat_strided_init_f32(&sw, kb, nc, nc, pW);
+
+  /* W = V^t C. The rows of C are read only once and the
+     accumulation is done in W which stays in the cache.
+     Upper part where V is unit lower triangular. */
+  memset(pW, 0, kb * nc * sizeof(float32_t));
+  for (i = 0; i < kb; i++)
+  {
+    for (j = 0; j <= i; j++)
+    {
+      f = (i == j) ? 1.0f : pV[(k0 + i) * n + k0 + j];
+      for (c = 0; c < nc; c++)
+      {
+        pW[j * nc + c] += f * pC[i * ldc + c];
+      }
+    }
+  }
+
+  /* Rectangular part. Four rows of C are used at each iteration. */
+  i = kb;
+  while (i + 4 <= m - k0)
+  {
+    pC0 = pC + i * ldc;
+    pC1 = pC0 + ldc;
+    pC2 = pC1 + ldc;
+    pC3 = pC2 + ldc;
+    pV0 = pV + (k0 + i) * n + k0;
+    for (j = 0; j < kb; j++)
+    {
+      f0 = pV0[j];
+      f1 = pV0[n + j];
+      f2 = pV0[2 * n + j];
+      f3 = pV0[3 * n + j];
+      for (c = 0; c < nc; c++)
+      {
+        pW[j * nc + c] += f0 * pC0[c] + f1 * pC1[c] + f2 * pC2[c] + f3 * pC3[c];
+      }
+    }
+    i += 4;
+  }
+  while (i < m - k0)
+  {
+    pC0 = pC + i * ldc;
+    pV0 = pV + (k0 + i) * n + k0;
+    for (j = 0; j < kb; j++)
+    {
+      f0 = pV0[j];
+      for (c = 0; c < nc; c++)
+      {
+        pW[j * nc + c] += f0 * pC0[c];
+      }
+    }
+    i++;
+  }
+
+  /* W = T W or W = T^t W */
+  if (transT)
+  {
+    for (j = kb - 1; j >= 0; j--)
+    {
+      for (c = 0; c < nc; c++)
+      {
+        pW[j * nc + c] *= pT[j * kb + j];
+      }
+      for (i = 0; i < j; i++)
+      {
+        f = pT[i * kb + j];
+        for (c = 0; c < nc; c++)
+        {
+          pW[j * nc + c] += f * pW[i * nc + c];
+        }
+      }
+    }
+  }
+  else
+  {
+    for (j = 0; j < kb; j++)
+    {
+      for (c = 0; c < nc; c++)
+      {
+        pW[j * nc + c] *= pT[j * kb + j];
+      }
+      for (i = j + 1; i < kb; i++)
+      {
+        f = pT[j * kb + i];
+        for (c = 0; c < nc; c++)
+        {
+          pW[j * nc + c] += f * pW[i * nc + c];
+        }
+      }
+    }
+  }
+
+  /* C = C - V W */
+  if (m > k1)
+  {
+    arm_mat_strided_init_f32(&sv, m - k1, kb, n, pV + k1 * n + k0);
+    arm_mat_strided_init_f32(&sc, m - k1, nc, ldc, pC + kb * ldc);
+    arm_mat_gemm_strided_f32(ARM_MAT_NO_TRANS, ARM_MAT_NO_TRANS, -1.0f, &sv, &sw, 1.0f, &sc);
+  }
+
+  /* Upper part where V is unit lower triangular */
+  for (i = 0; i < kb; i++)
+  {
+    for (j = 0; j <= i; j++)
+    {
+      f = (i == j) ? 1.0f : pV[(k0 + i) * n + k0 + j];
+      for (c = 0; c < nc; c++)
+      {
+        pC[i * ldc + c] -= f * pW[j * nc + c];
+      }
+    }
+  }
+}
+
+/**
+  @brief         Blocked QR decomposition of a m x n floating point matrix with m >= n.
+  @param[in]     pSrc       points to input matrix structure
+  @param[in]     threshold  norm2 threshold.
+  @param[out]    pOutR      points to output R matrix structure of dimension m x n
+  @param[out]    pOutQ      points to output Q matrix structure of dimension m x m (can be NULL)
+  @param[out]    pOutTau    points to Householder scaling factors of dimension n
+  @param[inout]  pTmp       points to a temporary buffer of dimension m + panelSize * (panelSize + n)
+  @param[in]     panelSize  number of columns of the panels
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH  : Matrix size check failed
+                   - \ref ARM_MATH_ARGUMENT_ERROR : panelSize is 0
+
+  @par           The outputs have the same format as the ones of \ref arm_mat_qr_f32.
+                 The reflectors of a panel of panelSize columns are
+                 accumulated in the compact WY form I - V T V^t. Then they
+                 are applied to the trailing columns with matrix products
+                 instead of one rank-1 update per reflector. It is faster
+                 for tall matrices which do not fit in the cache.
+                 The panels are factorized with the unblocked algorithm so
+                 small panels (8 to 16 columns) are generally the fastest.
+
+  @par           pOutQ is optional:
+                 pOutQ can be a NULL pointer.
+                 In this case, the argument will be ignored
+                 and the output Q matrix won't be computed.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_qr_blocked_f32(
+    const arm_matrix_instance_f32 * pSrc,
+    const float32_t threshold,
+    arm_matrix_instance_f32 * pOutR,
+    arm_matrix_instance_f32 * pOutQ,
+    float32_t * pOutTau,
+    float32_t * pTmp,
+    uint16_t panelSize
+    )
+{
+  const int m = pSrc->numRows;
+  const int n = pSrc->numCols;
+  float32_t *pX = pTmp;
+  float32_t *pT = pTmp + m;
+  float32_t *pW = pTmp + m + panelSize * panelSize;
+  float32_t *p = pOutR->pData;
+  float32_t beta;
+  int k0, k1, kb, col, k, c0, nc;
+  arm_matrix_strided_instance_f32 sa, sv, sw;
+
+  if (pSrc->numRows < pSrc->numCols)
+  {
+    return(ARM_MATH_SIZE_MISMATCH);
+  }
+
+  if (panelSize == 0U)
+  {
+    return(ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  memcpy(pOutR->pData, pSrc->pData, m * n * sizeof(float32_t));
+  pOutR->numCols = n;
+  pOutR->numRows = m;
+
+  for (k0 = 0; k0 < n; k0 += panelSize)
+  {
+    k1 = (k0 + panelSize < n) ? k0 + panelSize : n;
+    kb = k1 - k0;
+
+    /* Factorization of the panel with rank-1 updates limited to the panel */
+    for (col = k0; col < k1; col++)
+    {
+      COPY_COL_F32(pOutR, col, col, pX);
+
+      beta = arm_householder_f32(pX, threshold, m - col, pX);
+      pOutTau[col] = beta;
+
+      arm_mat_strided_init_f32(&sa, m - col, k1 - col, n, p + col * n + col);
+      arm_mat_strided_init_f32(&sv, m - col, 1, 1, pX);
+      arm_mat_strided_init_f32(&sw, 1, k1 - col, k1 - col, pW);
+
+      /* v.T A(col:,col:k1) -> w */
+      arm_mat_gemm_strided_f32(ARM_MAT_TRANS, ARM_MAT_NO_TRANS, 1.0f, &sv, &sa, 0.0f, &sw);
+
+      /* A(col:,col:k1) - beta v w */
+      arm_mat_gemm_strided_f32(ARM_MAT_NO_TRANS, ARM_MAT_NO_TRANS, -beta, &sv, &sw, 1.0f, &sa);
+
+      /* Copy Householder reflectors into R matrix */
+      for (k = 1; k < m - col; k++)
+      {
+        p[(col + k) * n + col] = pX[k];
+      }
+    }
+
+    /* Update of the trailing columns with the block reflector */
+    if (k1 < n)
+    {
+      arm_mat_qr_block_t_f32(pOutR, pOutTau, k0, kb, pT);
+      arm_mat_qr_apply_block_f32(pOutR, k0, kb, pT, 1, p + k0 * n + k1, n, n - k1, pW);
+    }
+  }
+
+  /* Generate Q if requested by user matrix */
+  if (pOutQ != NULL)
+  {
+    float32_t *pQ = pOutQ->pData;
+
+    /* Initialize Q matrix to identity */
+    memset(pQ, 0, sizeof(float32_t) * m * m);
+    for (col = 0; col < m; col++)
+    {
+      pQ[col * m + col] = 1.0f;
+    }
+
+    /* Q = H_0 H_1 ... H_(n-1) is accumulated from the last panel.
+       Columns are processed by blocks of n columns to bound the
+       size of the temporary buffer. */
+    for (k0 = ((n - 1) / panelSize) * panelSize; k0 >= 0; k0 -= panelSize)
+    {
+      k1 = (k0 + panelSize < n) ? k0 + panelSize : n;
+      kb = k1 - k0;
+
+      arm_mat_qr_block_t_f32(pOutR, pOutTau, k0, kb, pT);
+      for (c0 = k0; c0 < m; c0 += n)
+      {
+        nc = (c0 + n < m) ? n : m - c0;
+        arm_mat_qr_apply_block_f32(pOutR, k0, kb, pT, 0, pQ + k0 * m + c0, m, nc, pW);
+      }
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MatrixQR group
+ */
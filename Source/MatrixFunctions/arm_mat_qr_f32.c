@@ -629,9 +629,8 @@ ARM_DSP_ATTRIBUTE arm_status arm_mat_qr_f32(
   int32_t nb,pos;
   float32_t *pa,*pc;
   float32_t beta;
-  float32_t *pv;
-  float32_t *pdst;
   float32_t *p;
+  arm_matrix_strided_instance_f32 sa,sv,sw;
 
   if (pSrc->numRows < pSrc->numCols)
   {
@@ -647,84 +646,22 @@ ARM_DSP_ATTRIBUTE arm_status arm_mat_qr_f32(
   pc = pOutTau;
   for(col=0 ; col < pSrc->numCols; col++)
   {
-      int32_t i,j,k,blkCnt;
-      float32_t *pa0,*pa1,*pa2,*pa3;
+      int32_t k;
       COPY_COL_F32(pOutR,col,col,pTmpA);
 
       beta = arm_householder_f32(pTmpA,threshold,pSrc->numRows - col,pTmpA);
       *pc++ = beta;
     
-      pdst = pTmpB;
+      /* Trailing sub-matrix A(col:,col:) and reflector v */
+      arm_mat_strided_init_f32(&sa,pSrc->numRows - col,pSrc->numCols - col,pOutR->numCols,p);
+      arm_mat_strided_init_f32(&sv,pSrc->numRows - col,1,1,pTmpA);
+      arm_mat_strided_init_f32(&sw,1,pSrc->numCols - col,pSrc->numCols - col,pTmpB);
 
       /* v.T A(col:,col:) -> tmpb */
-      pv = pTmpA;
-      pa = p;
-      for(j=0;j<pSrc->numCols-col; j++)
-      {
-              *pdst++ = *pv * *pa++; 
-      }
-      pa += col;
-      pv++;
-      pdst = pTmpB;
-
-      pa0 = pa;
-      pa1 = pa0 + pSrc->numCols;
-      pa2 = pa1 + pSrc->numCols;
-      pa3 = pa2 + pSrc->numCols;
-
-      /* Unrolled loop */
-      blkCnt = (pSrc->numRows-col - 1) >> 2;
-      k=1;
-      while(blkCnt > 0)
-      {
-          float32_t sum;
-
-          for(j=0;j<pSrc->numCols-col; j++)
-          {
-              sum = *pdst;
-
-              sum += pv[0] * *pa0++;
-              sum += pv[1] * *pa1++;
-              sum += pv[2] * *pa2++;
-              sum += pv[3] * *pa3++;
-              
-              *pdst++ = sum; 
-          }
-          pa0 += col + 3*pSrc->numCols;
-          pa1 += col + 3*pSrc->numCols;
-          pa2 += col + 3*pSrc->numCols;
-          pa3 += col + 3*pSrc->numCols;
-          pv  += 4;
-          pdst = pTmpB;
-          k += 4;
-          blkCnt--;
-      }
-
-      pa = pa0;
-      for(;k<pSrc->numRows-col; k++)
-      {
-          for(j=0;j<pSrc->numCols-col; j++)
-          {
-              *pdst++ += *pv * *pa++; 
-          }
-          pa += col;
-          pv++;
-          pdst = pTmpB;
-      }
+      arm_mat_gemm_strided_f32(ARM_MAT_TRANS,ARM_MAT_NO_TRANS,1.0f,&sv,&sa,0.0f,&sw);
 
       /* A(col:,col:) - beta v tmpb */
-      pa = p;
-      for(j=0;j<pSrc->numRows-col; j++)
-      {
-        float32_t f = beta * pTmpA[j];
-
-        for(i=0;i<pSrc->numCols-col; i++)
-        {
-          *pa = *pa - f * pTmpB[i] ;
-          pa++;
-        }
-        pa += col;
-      } 
+      arm_mat_gemm_strided_f32(ARM_MAT_NO_TRANS,ARM_MAT_NO_TRANS,-beta,&sv,&sw,1.0f,&sa);
 
       /* Copy Householder reflectors into R matrix */
       pa = p + pOutR->numCols;
@@ -756,86 +693,24 @@ ARM_DSP_ATTRIBUTE arm_status arm_mat_qr_f32(
      pc = pOutTau + pOutQ->numCols - 1;
      for(col=0 ; col < pOutQ->numCols; col++)
      {
-       int32_t i,j,k, blkCnt;
-       float32_t *pa0,*pa1,*pa2,*pa3;
        pos = pSrc->numRows - nb;
        p = pOutQ->pData + pos + pOutQ->numCols*pos ;
    
        
        COPY_COL_F32(pOutR,pos,pos,pTmpA);
        pTmpA[0] = 1.0f;
-       pdst = pTmpB;
-      
-       /* v.T A(col:,col:) -> tmpb */
-       
-       pv = pTmpA;
-       pa = p;
-       for(j=0;j<pOutQ->numRows-pos; j++)
-       {
-               *pdst++ = *pv * *pa++; 
-       }
-       pa += pos;
-       pv++;
-       pdst = pTmpB;
-       pa0 = pa;
-       pa1 = pa0 + pOutQ->numRows;
-       pa2 = pa1 + pOutQ->numRows;
-       pa3 = pa2 + pOutQ->numRows;
 
-       /* Unrolled loop */
-       blkCnt = (pOutQ->numRows-pos - 1) >> 2;
-       k=1;
-       while(blkCnt > 0)
-       {
-           float32_t sum;
+       /* Trailing sub-matrix Q(pos:,pos:) and reflector v */
+       arm_mat_strided_init_f32(&sa,pOutQ->numRows - pos,pOutQ->numCols - pos,pOutQ->numCols,p);
+       arm_mat_strided_init_f32(&sv,pOutQ->numRows - pos,1,1,pTmpA);
+       arm_mat_strided_init_f32(&sw,1,pOutQ->numCols - pos,pOutQ->numCols - pos,pTmpB);
 
-           for(j=0;j<pOutQ->numRows-pos; j++)
-           {
-              sum = *pdst;
+       /* v.T Q(pos:,pos:) -> tmpb */
+       arm_mat_gemm_strided_f32(ARM_MAT_TRANS,ARM_MAT_NO_TRANS,1.0f,&sv,&sa,0.0f,&sw);
 
-              sum += pv[0] * *pa0++;
-              sum += pv[1] * *pa1++;
-              sum += pv[2] * *pa2++;
-              sum += pv[3] * *pa3++;
-              
-              *pdst++ = sum; 
-           }
-           pa0 += pos + 3*pOutQ->numRows;
-           pa1 += pos + 3*pOutQ->numRows;
-           pa2 += pos + 3*pOutQ->numRows;
-           pa3 += pos + 3*pOutQ->numRows;
-           pv  += 4;
-           pdst = pTmpB;
-           k += 4;
-           blkCnt--;
-       }
-
-       pa = pa0;
-       for(;k<pOutQ->numRows-pos; k++)
-       {
-           for(j=0;j<pOutQ->numRows-pos; j++)
-           {
-               *pdst++ += *pv * *pa++; 
-           }
-           pa += pos;
-           pv++;
-           pdst = pTmpB;
-       }
-   
-       pa = p;
+       /* Q(pos:,pos:) - beta v tmpb */
        beta = *pc--;
-       for(j=0;j<pOutQ->numRows-pos; j++)
-       {
-           float32_t f = beta * pTmpA[j];
-
-           for(i=0;i<pOutQ->numCols-pos; i++)
-           {
-             *pa = *pa - f * pTmpB[i] ;
-             pa++;
-           }
-           pa += pos;
-       } 
-   
+       arm_mat_gemm_strided_f32(ARM_MAT_NO_TRANS,ARM_MAT_NO_TRANS,-beta,&sv,&sw,1.0f,&sa);
    
        nb++;
      }
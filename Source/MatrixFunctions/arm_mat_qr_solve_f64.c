@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_qr_solve_f64.c
+ * Description:  Floating-point least squares solve with a QR decomposition
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixQR
+  @{
+ */
+
+/**
+  @brief         Least squares solution of A X = B using the QR decomposition of A.
+  @param[in]     pR     points to the R matrix with the reflectors computed by \ref arm_mat_qr_f64 or \ref arm_mat_qr_blocked_f64 (m x n)
+  @param[in]     pTau   points to the Householder scaling factors (dimension n)
+  @param[in]     pSrc   points to the right hand sides B (m x nrhs)
+  @param[out]    pDst   points to the solutions X (n x nrhs)
+  @param[inout]  pTmp   points to a temporary buffer of dimension m * nrhs
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : R is singular
+
+  @par           X minimizes the norm of A X - B. Q^t B is computed by applying the
+                 reflectors to B so the matrix Q is not needed. Then R X = (Q^t B)(0:n)
+                 is solved with \ref arm_mat_solve_upper_triangular_f64.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_qr_solve_f64(
+  const arm_matrix_instance_f64 * pR,
+  const float64_t * pTau,
+  const arm_matrix_instance_f64 * pSrc,
+        arm_matrix_instance_f64 * pDst,
+        float64_t * pTmp)
+{
+  arm_status status;                             /* status of matrix solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pR->numRows < pR->numCols) ||
+      (pSrc->numRows != pR->numRows) ||
+      (pDst->numRows != pR->numCols) ||
+      (pDst->numCols != pSrc->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const int m = pR->numRows;
+    const int n = pR->numCols;
+    const int nrhs = pSrc->numCols;
+    const float64_t *pV = pR->pData;
+    float64_t *pW = pDst->pData;
+    float64_t f;
+    int col, r, c;
+    arm_matrix_instance_f64 rTop, yTop;
+
+    memcpy(pTmp, pSrc->pData, m * nrhs * sizeof(float64_t));
+
+    /* Y = H_(n-1) ... H_0 B = Q^t B. The first row of the destination
+       is used as temporary buffer for v^t Y. */
+    for (col = 0; col < n; col++)
+    {
+      if (pTau[col] == 0.0)
+      {
+        continue;
+      }
+
+      for (c = 0; c < nrhs; c++)
+      {
+        pW[c] = pTmp[col * nrhs + c];
+      }
+      for (r = col + 1; r < m; r++)
+      {
+        f = pV[r * n + col];
+        for (c = 0; c < nrhs; c++)
+        {
+          pW[c] += f * pTmp[r * nrhs + c];
+        }
+      }
+
+      for (c = 0; c < nrhs; c++)
+      {
+        pW[c] *= pTau[col];
+        pTmp[col * nrhs + c] -= pW[c];
+      }
+      for (r = col + 1; r < m; r++)
+      {
+        f = pV[r * n + col];
+        for (c = 0; c < nrhs; c++)
+        {
+          pTmp[r * nrhs + c] -= f * pW[c];
+        }
+      }
+    }
+
+    /* R is the upper part of the n first rows */
+    rTop.numRows = n;
+    rTop.numCols = n;
+    rTop.pData = (float64_t *) pV;
+
+    yTop.numRows = n;
+    yTop.numCols = nrhs;
+    yTop.pData = pTmp;
+
+    status = arm_mat_solve_upper_triangular_f64(&rTop, &yTop, pDst);
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixQR group
+ */
@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_solve_upper_triangular_strided_f32.c
+ * Description:  Solve UT . X = A where UT is an upper triangular matrix (strided matrices)
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixInv
+  @{
+ */
+
+/**
+  @brief         Solve UT . X = A where UT is an upper triangular matrix
+  @param[in]     ut   The upper triangular strided matrix
+  @param[in]     a    The strided matrix a
+  @param[out]    dst  The solution X of UT . X = A
+  @return        The function returns ARM_MATH_SINGULAR, if the system can't be solved.
+
+  @par           Details
+                   The matrices can be \ref MatrixStrided "views" of bigger matrices.
+                   The solve can be done in place: dst can be the same matrix as a.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_solve_upper_triangular_strided_f32(
+  const arm_matrix_strided_instance_f32 * ut,
+  const arm_matrix_strided_instance_f32 * a,
+        arm_matrix_strided_instance_f32 * dst)
+{
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((ut->numRows != ut->numCols) ||
+      (ut->numRows != a->numRows)   ||
+      (a->numRows != dst->numRows)  ||
+      (a->numCols != dst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    int32_t i,j,k,n,cols;
+
+    float32_t *pX = dst->pData;
+    const float32_t *pUT = ut->pData;
+    const float32_t *pA = a->pData;
+    const int32_t strideUT = ut->stride;
+    const int32_t strideA = a->stride;
+    const int32_t strideX = dst->stride;
+
+    const float32_t *ut_row;
+
+    n = dst->numRows;
+    cols = dst->numCols;
+
+    for(j=0; j < cols; j ++)
+    {
+       for(i=n-1; i >= 0 ; i--)
+       {
+            float32_t tmp = pA[i * strideA + j];
+
+            ut_row = &pUT[strideUT * i];
+
+            for(k=n-1; k > i; k--)
+            {
+                tmp -= ut_row[k] * pX[strideX * k + j];
+            }
+
+            if (ut_row[i]==0.0f)
+            {
+              return(ARM_MATH_SINGULAR);
+            }
+            tmp = tmp / ut_row[i];
+            pX[strideX * i + j] = tmp;
+       }
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MatrixInv group
+ */
@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_strided_init_f32.c
+ * Description:  Floating-point strided matrix initialization
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixStrided Strided Matrix Views
+
+  A strided matrix is a view of a matrix whose rows are not contiguous.
+  The element (i,j) is at <code>pData[i * stride + j]</code> where the
+  stride (also named leading dimension) is at least the number of columns.
+
+  A strided view can describe a sub-matrix or a panel of columns of a bigger
+  matrix without copying it. A matrix stored contiguously is a strided
+  matrix whose stride is the number of columns.
+
+  The strided variants of the matrix functions have the same behavior as the
+  compact ones. The destination can be a view of the same matrix as a source
+  when the function can work in place. The triangular solvers can work in place.
+ */
+
+/**
+  @addtogroup MatrixStrided
+  @{
+ */
+
+/**
+  @brief         Floating-point strided matrix initialization.
+  @param[in,out] S         points to an instance of the floating-point strided matrix structure
+  @param[in]     nRows     number of rows in the matrix
+  @param[in]     nColumns  number of columns in the matrix
+  @param[in]     stride    distance between the starts of two consecutive rows (at least nColumns)
+  @param[in]     pData     points to the matrix data array
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_strided_init_f32(
+  arm_matrix_strided_instance_f32 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint16_t stride,
+  float32_t * pData)
+{
+  S->numRows = nRows;
+  S->numCols = nColumns;
+  S->stride = stride;
+  S->pData = pData;
+}
+
+/**
+  @brief         View of a block of a floating-point strided matrix.
+  @param[in]     pSrc      points to the strided matrix
+  @param[in]     row       first row of the block
+  @param[in]     col       first column of the block
+  @param[in]     nRows     number of rows of the block
+  @param[in]     nColumns  number of columns of the block
+  @param[out]    pDst      points to the view of the block
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Block outside of the matrix
+
+  @par           The data is not copied: the view shares the data of the source matrix.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_strided_sub_f32(
+  const arm_matrix_strided_instance_f32 * pSrc,
+        uint16_t row,
+        uint16_t col,
+        uint16_t nRows,
+        uint16_t nColumns,
+        arm_matrix_strided_instance_f32 * pDst)
+{
+#ifdef ARM_MATH_MATRIX_CHECK
+  if (((uint32_t) row + nRows > pSrc->numRows) ||
+      ((uint32_t) col + nColumns > pSrc->numCols))
+  {
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  pDst->numRows = nRows;
+  pDst->numCols = nColumns;
+  pDst->stride = pSrc->stride;
+  pDst->pData = pSrc->pData + (uint32_t) row * pSrc->stride + col;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MatrixStrided group
+ */
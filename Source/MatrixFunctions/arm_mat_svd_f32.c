@@ -0,0 +1,220 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_svd_f32.c
+ * Description:  Floating-point singular value decomposition
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+#include <math.h>
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixEig
+  @{
+ */
+
+/**
+  @brief         Floating-point singular value decomposition.
+  @param[in]     pSrc  points to the input matrix of dimension m x n with m >= n
+  @param[out]    pU    points to the output matrix U of dimension m x n
+  @param[out]    pS    points to the singular values of dimension n, in decreasing order
+  @param[out]    pV    points to the output matrix V of dimension n x n
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE : The Jacobi sweeps did not converge
+
+  @par
+                   Computes the thin decomposition A = U diag(s) V^t. The columns of U and V
+                   are orthonormal. The columns of U for null singular values are set to 0.
+  @par
+                   U and V are used as temporary buffers so no other buffer is needed.
+                   The iterations stop when, for all pairs of columns, the cosine of the
+                   angle between the columns is below \ref ARM_MAT_JACOBI_TOLERANCE_F32.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_svd_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pU,
+        float32_t * pS,
+        arm_matrix_instance_f32 * pV)
+{
+  arm_status status;                             /* status of matrix decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows < pSrc->numCols) ||
+      (pU->numRows != pSrc->numRows) ||
+      (pU->numCols != pSrc->numCols) ||
+      (pV->numRows != pSrc->numCols) ||
+      (pV->numCols != pSrc->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const int m = pSrc->numRows;
+    const int n = pSrc->numCols;
+    float32_t *pA = pU->pData;
+    float32_t *pB = pV->pData;
+    float32_t alpha, beta, gamma, zeta, t, c, s, x, y;
+    int i, j, k, sweep, rotated;
+
+    memcpy(pA, pSrc->pData, m * n * sizeof(float32_t));
+    memset(pB, 0, n * n * sizeof(float32_t));
+    for (k = 0; k < n; k++)
+    {
+      pB[k * n + k] = 1.0f;
+    }
+
+    rotated = 1;
+    for (sweep = 0; (sweep < (int) ARM_MAT_EIG_MAX_ITERATIONS) && rotated; sweep++)
+    {
+      rotated = 0;
+      for (i = 0; i < n - 1; i++)
+      {
+        for (j = i + 1; j < n; j++)
+        {
+          alpha = 0.0f;
+          beta = 0.0f;
+          gamma = 0.0f;
+          for (k = 0; k < m; k++)
+          {
+            x = pA[k * n + i];
+            y = pA[k * n + j];
+            alpha += x * x;
+            beta += y * y;
+            gamma += x * y;
+          }
+
+          if (fabsf(gamma) <= ARM_MAT_JACOBI_TOLERANCE_F32 * sqrtf(alpha * beta))
+          {
+            continue;
+          }
+          rotated = 1;
+
+          /* Rotation orthogonalizing the columns i and j */
+          zeta = (beta - alpha) / (2.0f * gamma);
+          t = 1.0f / (fabsf(zeta) + sqrtf(1.0f + zeta * zeta));
+          if (zeta < 0.0f)
+          {
+            t = -t;
+          }
+          c = 1.0f / sqrtf(1.0f + t * t);
+          s = c * t;
+
+          for (k = 0; k < m; k++)
+          {
+            x = pA[k * n + i];
+            y = pA[k * n + j];
+            pA[k * n + i] = c * x - s * y;
+            pA[k * n + j] = s * x + c * y;
+          }
+          for (k = 0; k < n; k++)
+          {
+            x = pB[k * n + i];
+            y = pB[k * n + j];
+            pB[k * n + i] = c * x - s * y;
+            pB[k * n + j] = s * x + c * y;
+          }
+        }
+      }
+    }
+
+    if (rotated)
+    {
+      return (ARM_MATH_DECOMPOSITION_FAILURE);
+    }
+
+    /* Singular values are the norms of the columns */
+    for (i = 0; i < n; i++)
+    {
+      alpha = 0.0f;
+      for (k = 0; k < m; k++)
+      {
+        alpha += pA[k * n + i] * pA[k * n + i];
+      }
+      alpha = sqrtf(alpha);
+      pS[i] = alpha;
+
+      x = (alpha > 0.0f) ? 1.0f / alpha : 0.0f;
+      for (k = 0; k < m; k++)
+      {
+        pA[k * n + i] *= x;
+      }
+    }
+
+    /* Sort the singular values in decreasing order */
+    for (i = 0; i < n - 1; i++)
+    {
+      j = i;
+      alpha = pS[i];
+      for (k = i + 1; k < n; k++)
+      {
+        if (pS[k] > alpha)
+        {
+          j = k;
+          alpha = pS[k];
+        }
+      }
+      if (j != i)
+      {
+        pS[j] = pS[i];
+        pS[i] = alpha;
+        for (k = 0; k < m; k++)
+        {
+          x = pA[k * n + i];
+          pA[k * n + i] = pA[k * n + j];
+          pA[k * n + j] = x;
+        }
+        for (k = 0; k < n; k++)
+        {
+          x = pB[k * n + i];
+          pB[k * n + i] = pB[k * n + j];
+          pB[k * n + j] = x;
+        }
+      }
+    }
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixEig group
+ */
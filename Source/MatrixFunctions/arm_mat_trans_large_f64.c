@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_trans_large_f64.c
+ * Description:  Floating-point large matrix transpose
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixTrans
+  @{
+ */
+
+/**
+  @brief         Floating-point large matrix transpose.
+  @param[in]     pSrc      points to input large matrix
+  @param[out]    pDst      points to output large matrix
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Details
+                   The matrix is transposed by tiles of ARM_MAT_LARGE_TRANS_TILE x ARM_MAT_LARGE_TRANS_TILE
+                   elements so that the rows of the source and of the destination
+                   stay in the cache while a tile is processed.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_trans_large_f64(
+  const arm_matrix_instance_large_f64 * pSrc,
+        arm_matrix_instance_large_f64 * pDst)
+{
+  const float64_t *pIn = pSrc->pData;              /* input data matrix pointer */
+  float64_t *pOut = pDst->pData;                   /* output data matrix pointer */
+  uint32_t nRows = pSrc->numRows;                /* number of rows */
+  uint32_t nCols = pSrc->numCols;                /* number of columns */
+  uint32_t rowTile, colTile;                     /* first row and column of the tile */
+  uint32_t rowEnd, colEnd;                       /* end of the tile */
+  uint32_t i, j;                                 /* loop counters */
+  arm_status status;                             /* status of matrix transpose */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pDst->numCols) ||
+      (pSrc->numCols != pDst->numRows)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    for (rowTile = 0U; rowTile < nRows; rowTile += rowEnd - rowTile)
+    {
+      rowEnd = (nRows - rowTile > ARM_MAT_LARGE_TRANS_TILE) ? rowTile + ARM_MAT_LARGE_TRANS_TILE : nRows;
+
+      for (colTile = 0U; colTile < nCols; colTile += colEnd - colTile)
+      {
+        colEnd = (nCols - colTile > ARM_MAT_LARGE_TRANS_TILE) ? colTile + ARM_MAT_LARGE_TRANS_TILE : nCols;
+
+        for (i = rowTile; i < rowEnd; i++)
+        {
+          const float64_t *px = pIn + (size_t) i * nCols + colTile;
+          float64_t *py = pOut + (size_t) colTile * nRows + i;
+
+          for (j = colTile; j < colEnd; j++)
+          {
+            /* B(j,i) = A(i,j) */
+            *py = *px++;
+            py += nRows;
+          }
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixTrans group
+ */
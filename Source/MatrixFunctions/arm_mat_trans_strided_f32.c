@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_trans_strided_f32.c
+ * Description:  Floating-point strided matrix transpose
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixTrans
+  @{
+ */
+
+/**
+  @brief         Floating-point matrix transpose of a strided matrix.
+  @param[in]     pSrc      points to input strided matrix
+  @param[out]    pDst      points to output strided matrix
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Details
+                   The matrices can be \ref MatrixStrided "views" of bigger matrices.
+                   The destination must not overlap the source.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_trans_strided_f32(
+  const arm_matrix_strided_instance_f32 * pSrc,
+        arm_matrix_strided_instance_f32 * pDst)
+{
+  const float32_t *pIn = pSrc->pData;            /* Row of input matrix */
+  float32_t *pOut;                               /* Column of output matrix */
+  uint16_t nRows = pSrc->numRows;                /* number of rows */
+  uint16_t nCols = pSrc->numCols;                /* number of columns */
+  uint32_t dstStride = pDst->stride;
+  uint32_t row, col;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pDst->numCols) ||
+      (pSrc->numCols != pDst->numRows)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  for (row = 0U; row < nRows; row++)
+  {
+    /* Row of the input is written to the column of the output */
+    pOut = pDst->pData + row;
+
+    for (col = 0U; col < nCols; col++)
+    {
+      *pOut = pIn[col];
+      pOut += dstStride;
+    }
+
+    pIn += pSrc->stride;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MatrixTrans group
+ */
@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_large_f32.c
+ * Description:  Floating-point large matrix and vector multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+#include "dsp/basic_math_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+  @brief         Floating-point large matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the input large matrix structure
+  @param[in]     pVec     points to input vector
+  @param[out]    pDst     points to output vector
+
+  @par           Details
+                   Each output element is computed with \ref arm_dot_prod_f32.
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_vec_mult_large_f32(
+  const arm_matrix_instance_large_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst)
+{
+  const float32_t *pInA = pSrcMat->pData;        /* input data matrix pointer */
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row;                                  /* loop counter */
+
+  for (row = 0U; row < numRows; row++)
+  {
+    arm_dot_prod_f32(pInA, pVec, numCols, pDst++);
+    pInA += numCols;
+  }
+}
+
+/**
+  @} end of MatrixVectMult group
+ */
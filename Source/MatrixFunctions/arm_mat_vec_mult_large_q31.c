@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_large_q31.c
+ * Description:  Q31 large matrix and vector multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+  @brief         Q31 large matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the input large matrix structure
+  @param[in]     pVec     points to input vector
+  @param[out]    pDst     points to output vector
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator
+                   and computes the same results as \ref arm_mat_vec_mult_q31.
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_vec_mult_large_q31(
+  const arm_matrix_instance_large_q31 * pSrcMat,
+  const q31_t * pVec,
+        q31_t * pDst)
+{
+  const q31_t *pInA = pSrcMat->pData;          /* input data matrix pointer */
+  const q31_t *pInVec;                         /* input vector pointer */
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row, colCnt;                          /* loop counters */
+  q63_t sum;                                     /* Accumulator */
+
+  for (row = 0U; row < numRows; row++)
+  {
+    pInVec = pVec;
+
+    /* Initialize accumulator */
+    sum = 0;
+
+    colCnt = numCols;
+    while (colCnt > 0U)
+    {
+      sum += (q63_t) *pInA++ * *pInVec++;
+
+      /* Decrement loop counter */
+      colCnt--;
+    }
+
+    /* Convert result and store it in destination buffer */
+    *pDst++ = (q31_t) (sum >> 31);
+  }
+}
+
+/**
+  @} end of MatrixVectMult group
+ */
@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_large_q7.c
+ * Description:  Q7 large matrix and vector multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+  @brief         Q7 large matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the input large matrix structure
+  @param[in]     pVec     points to input vector
+  @param[out]    pDst     points to output vector
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator
+                   (instead of 32-bit for \ref arm_mat_vec_mult_q7) so that the long inner
+                   products cannot overflow. The result is saturated to 1.7 format.
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_vec_mult_large_q7(
+  const arm_matrix_instance_large_q7 * pSrcMat,
+  const q7_t * pVec,
+        q7_t * pDst)
+{
+  const q7_t *pInA = pSrcMat->pData;          /* input data matrix pointer */
+  const q7_t *pInVec;                         /* input vector pointer */
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row, colCnt;                          /* loop counters */
+  q63_t sum;                                     /* Accumulator */
+
+  for (row = 0U; row < numRows; row++)
+  {
+    pInVec = pVec;
+
+    /* Initialize accumulator */
+    sum = 0;
+
+    colCnt = numCols;
+    while (colCnt > 0U)
+    {
+      sum += (q63_t) *pInA++ * *pInVec++;
+
+      /* Decrement loop counter */
+      colCnt--;
+    }
+
+    /* Convert result and store it in destination buffer */
+    *pDst++ = (q7_t) __SSAT((q31_t) clip_q63_to_q31(sum >> 7), 8);
+  }
+}
+
+/**
+  @} end of MatrixVectMult group
+ */
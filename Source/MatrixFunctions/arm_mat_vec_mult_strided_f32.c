@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_strided_f32.c
+ * Description:  Floating-point strided matrix and vector multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/matrix_functions.h"
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_helium_utils.h"
+#endif
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+  @brief         Floating-point multiplication of a strided matrix and a vector.
+  @param[in]     pSrcMat  points to the input strided matrix structure
+  @param[in]     pVec     points to the input vector
+  @param[out]    pDst     points to the output vector
+
+  @par           Details
+                   The matrix can be a \ref MatrixStrided "view" of a bigger matrix.
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_vec_mult_strided_f32(
+  const arm_matrix_strided_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst)
+{
+  const float32_t *pInA = pSrcMat->pData;        /* Row of the matrix */
+  const float32_t *pIn1, *pIn2;
+  uint16_t numRows = pSrcMat->numRows;
+  uint16_t numCols = pSrcMat->numCols;
+  uint32_t row;
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  int32_t blkCnt;
+  f32x4_t acc;
+  mve_pred16_t p0;
+#else
+  uint32_t colCnt;
+  float32_t sum;
+#endif
+
+  for (row = 0U; row < numRows; row++)
+  {
+    pIn1 = pInA;
+    pIn2 = pVec;
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+    acc = vdupq_n_f32(0.0f);
+
+    blkCnt = (int32_t) numCols;
+    while (blkCnt > 0)
+    {
+      p0 = vctp32q((uint32_t) blkCnt);
+      acc = vfmaq(acc, vldrwq_z_f32(pIn1, p0), vldrwq_z_f32(pIn2, p0));
+
+      pIn1 += 4;
+      pIn2 += 4;
+      blkCnt -= 4;
+    }
+
+    *pDst++ = vecAddAcrossF32Mve(acc);
+#else
+    sum = 0.0f;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 4 MACs at a time. */
+    colCnt = numCols >> 2U;
+
+    while (colCnt > 0U)
+    {
+      sum += *pIn1++ * *pIn2++;
+      sum += *pIn1++ * *pIn2++;
+      sum += *pIn1++ * *pIn2++;
+      sum += *pIn1++ * *pIn2++;
+
+      /* Decrement loop counter */
+      colCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining MACs */
+    colCnt = numCols % 0x4U;
+
+#else
+
+    colCnt = numCols;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (colCnt > 0U)
+    {
+      sum += *pIn1++ * *pIn2++;
+
+      /* Decrement loop counter */
+      colCnt--;
+    }
+
+    *pDst++ = sum;
+#endif
+
+    pInA += pSrcMat->stride;
+  }
+}
+
+/**
+  @} end of MatrixVectMult group
+ */
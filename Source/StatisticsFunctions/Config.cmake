@@ -90,6 +90,21 @@ target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_mse_f32.c)
 target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_mse_f64.c)
 target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_accumulate_f64.c)
 target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_accumulate_f32.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_stats_f32.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_stats_q31.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_stats_q15.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_running_stats_init_f32.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_running_stats_f32.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_running_stats_init_q31.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_running_stats_q31.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_running_stats_init_q15.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_running_stats_q15.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_sliding_window_init_f32.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_sliding_window_f32.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_sliding_window_init_q31.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_sliding_window_q31.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_sliding_window_init_q15.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_sliding_window_q15.c)
 
 
 if ((NOT ARMAC5) AND (NOT DISABLEFLOAT16))
@@ -100,5 +100,20 @@
 #include "arm_mse_f64.c"
 #include "arm_accumulate_f32.c"
 #include "arm_accumulate_f64.c"
+#include "arm_stats_f32.c"
+#include "arm_stats_q31.c"
+#include "arm_stats_q15.c"
+#include "arm_running_stats_init_f32.c"
+#include "arm_running_stats_f32.c"
+#include "arm_running_stats_init_q31.c"
+#include "arm_running_stats_q31.c"
+#include "arm_running_stats_init_q15.c"
+#include "arm_running_stats_q15.c"
+#include "arm_sliding_window_init_f32.c"
+#include "arm_sliding_window_f32.c"
+#include "arm_sliding_window_init_q31.c"
+#include "arm_sliding_window_q31.c"
+#include "arm_sliding_window_init_q15.c"
+#include "arm_sliding_window_q15.c"
 
 
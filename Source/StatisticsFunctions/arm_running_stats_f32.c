@@ -0,0 +1,205 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_running_stats_f32.c
+ * Description:  Floating-point running statistics
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup RunningStats Running statistics
+
+  Statistics of a stream of samples processed block by block.
+
+  The running statistics are updated with each new block of samples
+  and describe all the samples received since the initialization.
+  The cost of an update only depends on the size of the new block.
+
+  The sliding window statistics only describe the last windowSize
+  samples. Mean, variance, standard deviation and RMS are updated in O(1)
+  per sample by adding the new sample to the sums and removing the
+  sample leaving the window. The minimum and maximum are tracked with
+  monotonic queues of candidate positions (amortized O(1) per sample).
+
+  The statistics are returned in the same structure as the one used
+  by the arm_stats functions. The power (sum of squares) of the window
+  is count * rms^2.
+
+  For the floating-point sliding window, the sums are recomputed from
+  the state buffer every windowSize samples so that the rounding errors
+  of the additions and subtractions do not accumulate.
+
+  The minIndex and maxIndex fields are the number of samples received
+  before the minimum / maximum for the running statistics and the position
+  in the window (0 for the oldest sample) for the sliding window statistics.
+ */
+
+/**
+  @addtogroup RunningStats
+  @{
+ */
+
+/* Number of samples processed before merging the partial sums */
+#define ARM_RUNNING_STATS_CHUNK_F32 256U
+
+/**
+  @brief         Update the floating-point running statistics with new samples.
+  @param[in,out] S          points to an instance of the running statistics structure.
+  @param[in]     pSrc       points to the new samples
+  @param[in]     blockSize  number of new samples
+
+  @par           Algorithm
+                   The new samples are accumulated by chunks after
+                   subtraction of the first sample of the chunk and each chunk
+                   is merged with the pairwise update of Chan et al.
+ */
+ARM_DSP_ATTRIBUTE void arm_running_stats_f32(
+  arm_running_stats_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+  uint32_t chunkSize;
+  uint32_t index = S->count;                     /* Index of current sample */
+  float32_t shift, s, q, in;
+  float32_t nb, nbChunk, total, delta;
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  if (S->count == 0U)
+  {
+    S->min = pSrc[0];
+    S->max = pSrc[0];
+    S->minIndex = 0U;
+    S->maxIndex = 0U;
+  }
+
+  while (blockSize > 0U)
+  {
+    chunkSize = blockSize;
+    if (chunkSize > ARM_RUNNING_STATS_CHUNK_F32)
+    {
+      chunkSize = ARM_RUNNING_STATS_CHUNK_F32;
+    }
+
+    shift = pSrc[0];
+    s = 0.0f;
+    q = 0.0f;
+
+    blkCnt = chunkSize;
+    while (blkCnt > 0U)
+    {
+      in = *pSrc++;
+
+      /* compare for the minimum and maximum values */
+      if (in < S->min)
+      {
+        S->min = in;
+        S->minIndex = index;
+      }
+      if (in > S->max)
+      {
+        S->max = in;
+        S->maxIndex = index;
+      }
+
+      in = in - shift;
+      s += in;
+      q += in * in;
+
+      index++;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    /* Merge the chunk with the previous samples */
+    nb = (float32_t) S->count;
+    nbChunk = (float32_t) chunkSize;
+    total = nb + nbChunk;
+    delta = shift + s / nbChunk - S->mean;
+
+    S->mean += delta * nbChunk / total;
+    S->m2 += (q - s * s / nbChunk) + delta * delta * nb * nbChunk / total;
+    S->count += chunkSize;
+
+    blockSize -= chunkSize;
+  }
+}
+
+/**
+  @brief         Statistics of all the samples processed by the floating-point running statistics.
+  @param[in]     S          points to an instance of the running statistics structure.
+  @param[out]    pResult    statistics returned here
+
+  @par           When no sample has been processed, all the statistics are 0.
+ */
+ARM_DSP_ATTRIBUTE void arm_running_stats_result_f32(
+  const arm_running_stats_instance_f32 * S,
+        arm_stats_result_f32 * pResult)
+{
+  float32_t m2 = S->m2;
+
+  if (S->count == 0U)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_f32));
+    return;
+  }
+
+  if (m2 < 0.0f)
+  {
+    m2 = 0.0f;
+  }
+
+  pResult->mean = S->mean;
+  if (S->count > 1U)
+  {
+    pResult->var = m2 / (float32_t) (S->count - 1U);
+  }
+  else
+  {
+    pResult->var = 0.0f;
+  }
+  arm_sqrt_f32(pResult->var, &pResult->std);
+  arm_sqrt_f32(S->mean * S->mean + m2 / (float32_t) S->count, &pResult->rms);
+
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**
+  @} end of RunningStats group
+ */
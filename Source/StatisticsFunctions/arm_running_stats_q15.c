@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_running_stats_q15.c
+ * Description:  Q15 running statistics
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup RunningStats
+  @{
+ */
+
+/**
+  @brief         Update the Q15 running statistics with new samples.
+  @param[in,out] S          points to an instance of the running statistics structure.
+  @param[in]     pSrc       points to the new samples
+  @param[in]     blockSize  number of new samples
+ */
+ARM_DSP_ATTRIBUTE void arm_running_stats_q15(
+  arm_running_stats_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+  q15_t in;
+
+  if ((S->count == 0U) && (blockSize > 0U))
+  {
+    S->min = pSrc[0];
+    S->max = pSrc[0];
+    S->minIndex = 0U;
+    S->maxIndex = 0U;
+  }
+
+  while (blkCnt > 0U)
+  {
+      in = *pSrc++;
+
+      /* compare for the minimum and maximum values */
+      if (in < S->min)
+      {
+        S->min = in;
+        S->minIndex = S->count;
+      }
+      if (in > S->max)
+      {
+        S->max = in;
+        S->maxIndex = S->count;
+      }
+
+      S->sum += in;
+      S->sumOfSquares += ((q31_t) in * in);
+
+      S->count++;
+
+      /* Decrement loop counter */
+      blkCnt--;
+  }
+}
+
+/**
+  @brief         Statistics of all the samples processed by the Q15 running statistics.
+  @param[in]     S          points to an instance of the running statistics structure.
+  @param[out]    pResult    statistics returned here
+
+  @par           Scaling and Overflow Behavior
+                   The statistics are computed like in arm_stats_q15 with blockSize
+                   being the number of samples processed. The sums are accumulated
+                   in 64-bit accumulators.
+                   When no sample has been processed, all the statistics are 0.
+ */
+ARM_DSP_ATTRIBUTE void arm_running_stats_result_q15(
+  const arm_running_stats_instance_q15 * S,
+        arm_stats_result_q15 * pResult)
+{
+  const uint32_t count = S->count;
+  q31_t meanOfSquares, squareOfMean;             /* Square of mean and mean of square */
+  q31_t var = 0;
+
+  if (count == 0U)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_q15));
+    return;
+  }
+
+  pResult->mean = (q15_t) (S->sum / (q63_t) count);
+
+  if (count > 1U)
+  {
+    /* Compute Mean of squares and square of mean */
+    meanOfSquares = (q31_t) (S->sumOfSquares / (q63_t)(count - 1U));
+    squareOfMean = (q31_t) (S->sum * S->sum / ((q63_t)count * (count - 1U)));
+
+    var = meanOfSquares - squareOfMean;
+  }
+  pResult->var = (q15_t) (var >> 15U);
+  arm_sqrt_q15((q15_t) __SSAT(var >> 15U, 16U), &pResult->std);
+
+  arm_sqrt_q15((q15_t) __SSAT((S->sumOfSquares / (q63_t) count) >> 15, 16), &pResult->rms);
+
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**
+  @} end of RunningStats group
+ */
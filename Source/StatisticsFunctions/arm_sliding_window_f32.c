@@ -0,0 +1,228 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_window_f32.c
+ * Description:  Floating-point sliding window statistics
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup RunningStats
+  @{
+ */
+
+/* Recompute the shifted sums from the samples in the window.
+   The shift is set to the current mean to minimize the
+   cancellation errors. */
+static void arm_sliding_window_resync_f32(
+  arm_sliding_window_instance_f32 * S)
+{
+  const float32_t *pState = S->pState;
+  uint32_t blkCnt = S->count;
+  float32_t s = 0.0f, q = 0.0f, in;
+
+  S->shift = S->shift + S->sum / (float32_t) S->count;
+
+  while (blkCnt > 0U)
+  {
+    in = *pState++ - S->shift;
+    s += in;
+    q += in * in;
+    blkCnt--;
+  }
+
+  S->sum = s;
+  S->sumOfSquares = q;
+  S->nbUpdates = 0U;
+}
+
+/**
+  @brief         Add new samples to the floating-point sliding window statistics.
+  @param[in,out] S          points to an instance of the sliding window statistics structure.
+  @param[in]     pSrc       points to the new samples
+  @param[in]     blockSize  number of new samples
+
+  @par           Details
+                   When the window is full, each new sample replaces
+                   the oldest one.
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_window_f32(
+  arm_sliding_window_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+  const uint32_t windowSize = S->windowSize;
+  float32_t *pState = S->pState;
+  uint32_t *pMinQueue = S->pMinQueue;
+  uint32_t *pMaxQueue = S->pMaxQueue;
+  uint32_t pos, back;
+  float32_t in, old;
+
+  if ((S->count == 0U) && (blockSize > 0U))
+  {
+    S->shift = pSrc[0];
+  }
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+    pos = S->writeIndex;
+
+    if (S->count == windowSize)
+    {
+      /* Remove the oldest sample */
+      old = pState[pos] - S->shift;
+      S->sum -= old;
+      S->sumOfSquares -= old * old;
+
+      if ((S->minCount > 0U) && (pMinQueue[S->minHead] == pos))
+      {
+        S->minHead = (S->minHead + 1U == windowSize) ? 0U : S->minHead + 1U;
+        S->minCount--;
+      }
+      if ((S->maxCount > 0U) && (pMaxQueue[S->maxHead] == pos))
+      {
+        S->maxHead = (S->maxHead + 1U == windowSize) ? 0U : S->maxHead + 1U;
+        S->maxCount--;
+      }
+    }
+    else
+    {
+      S->count++;
+    }
+
+    pState[pos] = in;
+    old = in - S->shift;
+    S->sum += old;
+    S->sumOfSquares += old * old;
+
+    /* Remove the candidates which can no more be the minimum.
+       Equal values are kept so that the oldest one is reported. */
+    while (S->minCount > 0U)
+    {
+      back = S->minHead + S->minCount - 1U;
+      back = (back >= windowSize) ? back - windowSize : back;
+      if (pState[pMinQueue[back]] <= in)
+      {
+        break;
+      }
+      S->minCount--;
+    }
+    back = S->minHead + S->minCount;
+    back = (back >= windowSize) ? back - windowSize : back;
+    pMinQueue[back] = pos;
+    S->minCount++;
+
+    while (S->maxCount > 0U)
+    {
+      back = S->maxHead + S->maxCount - 1U;
+      back = (back >= windowSize) ? back - windowSize : back;
+      if (pState[pMaxQueue[back]] >= in)
+      {
+        break;
+      }
+      S->maxCount--;
+    }
+    back = S->maxHead + S->maxCount;
+    back = (back >= windowSize) ? back - windowSize : back;
+    pMaxQueue[back] = pos;
+    S->maxCount++;
+
+    S->writeIndex = (pos + 1U == windowSize) ? 0U : pos + 1U;
+
+    S->nbUpdates++;
+    if (S->nbUpdates >= windowSize)
+    {
+      arm_sliding_window_resync_f32(S);
+    }
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @brief         Statistics of the samples in the floating-point sliding window.
+  @param[in]     S          points to an instance of the sliding window statistics structure.
+  @param[out]    pResult    statistics returned here
+
+  @par           Details
+                   When the window is empty, all the statistics are 0.
+                   minIndex and maxIndex are relative to the oldest sample in the window.
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_window_result_f32(
+  const arm_sliding_window_instance_f32 * S,
+        arm_stats_result_f32 * pResult)
+{
+  float32_t nb, m2;
+  uint32_t oldest, pos;
+
+  if (S->count == 0U)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_f32));
+    return;
+  }
+
+  nb = (float32_t) S->count;
+  m2 = S->sumOfSquares - S->sum * S->sum / nb;
+  if (m2 < 0.0f)
+  {
+    m2 = 0.0f;
+  }
+
+  pResult->mean = S->shift + S->sum / nb;
+  if (S->count > 1U)
+  {
+    pResult->var = m2 / (nb - 1.0f);
+  }
+  else
+  {
+    pResult->var = 0.0f;
+  }
+  arm_sqrt_f32(pResult->var, &pResult->std);
+  arm_sqrt_f32(pResult->mean * pResult->mean + m2 / nb, &pResult->rms);
+
+  /* Position of the oldest sample in the state buffer */
+  oldest = (S->count == S->windowSize) ? S->writeIndex : 0U;
+
+  pos = S->pMinQueue[S->minHead];
+  pResult->min = S->pState[pos];
+  pResult->minIndex = (pos < oldest) ? pos + S->windowSize - oldest : pos - oldest;
+
+  pos = S->pMaxQueue[S->maxHead];
+  pResult->max = S->pState[pos];
+  pResult->maxIndex = (pos < oldest) ? pos + S->windowSize - oldest : pos - oldest;
+}
+
+/**
+  @} end of RunningStats group
+ */
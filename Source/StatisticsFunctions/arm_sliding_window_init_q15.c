@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_window_init_q15.c
+ * Description:  Initialization function for the Q15 sliding window statistics
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup RunningStats
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 sliding window statistics.
+  @param[out]    S           points to an instance of the sliding window statistics structure.
+  @param[in]     windowSize  number of samples in the window
+  @param[in]     pState      points to the state buffer of length windowSize
+  @param[in]     pMinQueue   points to a buffer of length windowSize
+  @param[in]     pMaxQueue   points to a buffer of length windowSize
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : windowSize is 0
+
+  @par           Details
+                   The window is empty after initialization. Until windowSize
+                   samples have been received, the statistics are computed
+                   on the samples received.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_sliding_window_init_q15(
+  arm_sliding_window_instance_q15 * S,
+  uint32_t windowSize,
+  q15_t * pState,
+  uint32_t * pMinQueue,
+  uint32_t * pMaxQueue)
+{
+  if (windowSize == 0U)
+  {
+    return(ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->windowSize = windowSize;
+  S->count = 0U;
+  S->writeIndex = 0U;
+  S->pState = pState;
+  S->pMinQueue = pMinQueue;
+  S->pMaxQueue = pMaxQueue;
+  S->minHead = 0U;
+  S->minCount = 0U;
+  S->maxHead = 0U;
+  S->maxCount = 0U;
+  S->sum = 0;
+  S->sumOfSquares = 0;
+
+  return(ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of RunningStats group
+ */
@@ -0,0 +1,203 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_window_q31.c
+ * Description:  Q31 sliding window statistics
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup RunningStats
+  @{
+ */
+
+/**
+  @brief         Add new samples to the Q31 sliding window statistics.
+  @param[in,out] S          points to an instance of the sliding window statistics structure.
+  @param[in]     pSrc       points to the new samples
+  @param[in]     blockSize  number of new samples
+
+  @par           Details
+                   When the window is full, each new sample replaces
+                   the oldest one. The integer sums are updated exactly so there is
+                   no accumulation of rounding errors.
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_window_q31(
+  arm_sliding_window_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+  const uint32_t windowSize = S->windowSize;
+  q31_t *pState = S->pState;
+  uint32_t *pMinQueue = S->pMinQueue;
+  uint32_t *pMaxQueue = S->pMaxQueue;
+  uint32_t pos, back;
+  q31_t old;
+  q31_t in, in8;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+    pos = S->writeIndex;
+
+    if (S->count == windowSize)
+    {
+      /* Remove the oldest sample */
+      old = pState[pos];
+      S->sum -= old;
+      S->power -= ((q63_t) old * old) >> 16U;
+      in8 = old >> 8U;
+      S->sumOfSquares -= ((q63_t) (in8) * (in8));
+      S->sumShifted -= in8;
+
+      if ((S->minCount > 0U) && (pMinQueue[S->minHead] == pos))
+      {
+        S->minHead = (S->minHead + 1U == windowSize) ? 0U : S->minHead + 1U;
+        S->minCount--;
+      }
+      if ((S->maxCount > 0U) && (pMaxQueue[S->maxHead] == pos))
+      {
+        S->maxHead = (S->maxHead + 1U == windowSize) ? 0U : S->maxHead + 1U;
+        S->maxCount--;
+      }
+    }
+    else
+    {
+      S->count++;
+    }
+
+    pState[pos] = in;
+    S->sum += in;
+    S->power += ((q63_t) in * in) >> 16U;
+    in8 = in >> 8U;
+    S->sumOfSquares += ((q63_t) (in8) * (in8));
+    S->sumShifted += in8;
+
+    /* Remove the candidates which can no more be the minimum.
+       Equal values are kept so that the oldest one is reported. */
+    while (S->minCount > 0U)
+    {
+      back = S->minHead + S->minCount - 1U;
+      back = (back >= windowSize) ? back - windowSize : back;
+      if (pState[pMinQueue[back]] <= in)
+      {
+        break;
+      }
+      S->minCount--;
+    }
+    back = S->minHead + S->minCount;
+    back = (back >= windowSize) ? back - windowSize : back;
+    pMinQueue[back] = pos;
+    S->minCount++;
+
+    while (S->maxCount > 0U)
+    {
+      back = S->maxHead + S->maxCount - 1U;
+      back = (back >= windowSize) ? back - windowSize : back;
+      if (pState[pMaxQueue[back]] >= in)
+      {
+        break;
+      }
+      S->maxCount--;
+    }
+    back = S->maxHead + S->maxCount;
+    back = (back >= windowSize) ? back - windowSize : back;
+    pMaxQueue[back] = pos;
+    S->maxCount++;
+
+    S->writeIndex = (pos + 1U == windowSize) ? 0U : pos + 1U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @brief         Statistics of the samples in the Q31 sliding window.
+  @param[in]     S          points to an instance of the sliding window statistics structure.
+  @param[out]    pResult    statistics returned here
+
+  @par           Scaling and Overflow Behavior
+                   The statistics are computed like in arm_stats_q31 with blockSize
+                   being the number of samples in the window. The input signal must be scaled
+                   down by log2(windowSize)-8 bits to avoid overflows.
+                   When the window is empty, all the statistics are 0.
+                   minIndex and maxIndex are relative to the oldest sample in the window.
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_window_result_q31(
+  const arm_sliding_window_instance_q31 * S,
+        arm_stats_result_q31 * pResult)
+{
+  const uint32_t count = S->count;
+  uint32_t oldest, pos;
+  q63_t meanOfSquares, squareOfMean;             /* Square of mean and mean of square */
+
+  if (count == 0U)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_q31));
+    return;
+  }
+
+  pResult->mean = (q31_t) (S->sum / (q63_t) count);
+
+  if (count > 1U)
+  {
+    /* Compute Mean of squares and square of mean */
+    meanOfSquares = (S->sumOfSquares / (q63_t)(count - 1U));
+    squareOfMean = ( S->sumShifted * S->sumShifted / ((q63_t)count * (count - 1U)));
+
+    pResult->var = (q31_t)((meanOfSquares - squareOfMean) >> 15U);
+  }
+  else
+  {
+    pResult->var = 0;
+  }
+  arm_sqrt_q31(pResult->var, &pResult->std);
+
+  /* Mean of squares in 2.46 format converted to 1.31 */
+  arm_sqrt_q31(clip_q63_to_q31((S->power / (q63_t) count) >> 15U), &pResult->rms);
+
+  /* Position of the oldest sample in the state buffer */
+  oldest = (count == S->windowSize) ? S->writeIndex : 0U;
+
+  pos = S->pMinQueue[S->minHead];
+  pResult->min = S->pState[pos];
+  pResult->minIndex = (pos < oldest) ? pos + S->windowSize - oldest : pos - oldest;
+
+  pos = S->pMaxQueue[S->maxHead];
+  pResult->max = S->pState[pos];
+  pResult->maxIndex = (pos < oldest) ? pos + S->windowSize - oldest : pos - oldest;
+}
+
+/**
+  @} end of RunningStats group
+ */
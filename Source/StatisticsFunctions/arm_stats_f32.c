@@ -0,0 +1,362 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_f32.c
+ * Description:  Mean, variance, RMS, minimum and maximum of a floating-point vector in one pass
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup stats  Statistics in one pass
+
+  Computes the mean, variance, standard deviation, RMS, minimum
+  and maximum of the elements of the input vector while reading
+  the vector only once.
+
+  It gives the same results as calling arm_mean, arm_var, arm_std,
+  arm_rms, arm_min and arm_max on the same vector but with less
+  memory traffic.
+
+  For floating point, the samples are processed in chunks.
+  For each chunk, the sum and the sum of squares of the samples
+  shifted by the first sample of the vector are computed. The chunks
+  are then merged with the pairwise update of Chan et al:
+
+  <pre>
+      delta = meanChunk - mean
+      mean  = mean + delta * nbChunk / (nb + nbChunk)
+      M2    = M2 + M2Chunk + delta^2 * nb * nbChunk / (nb + nbChunk)
+  </pre>
+
+  It avoids the cancellation of the one pass sum of squares
+  formula when the mean is big compared to the standard deviation.
+
+  The index of the minimum (resp. maximum) is the index of the
+  first occurrence of the minimum (resp. maximum).
+
+  There are separate functions for floating point, Q31, and Q15 data types.
+ */
+
+/**
+  @addtogroup stats
+  @{
+ */
+
+/* Number of samples processed before merging the partial sums.
+   Must be a multiple of 4 */
+#define ARM_STATS_CHUNK_F32 256U
+
+/* Merge the statistics of a chunk with the statistics of the
+   previous chunks */
+__STATIC_FORCEINLINE void arm_stats_merge_f32(
+  float32_t shift,
+  float32_t s,
+  float32_t q,
+  uint32_t chunkSize,
+  uint32_t *pNb,
+  float32_t *pMean,
+  float32_t *pM2)
+{
+    float32_t nbChunk = (float32_t)chunkSize;
+    float32_t nb = (float32_t)*pNb;
+    float32_t total = nb + nbChunk;
+    float32_t m2Chunk = q - s * s / nbChunk;
+    float32_t delta = shift + s / nbChunk - *pMean;
+
+    *pMean += delta * nbChunk / total;
+    *pM2 += m2Chunk + delta * delta * nb * nbChunk / total;
+    *pNb += chunkSize;
+}
+
+/* Derive variance, standard deviation and RMS from the
+   mean and the sum of the squared deviations */
+__STATIC_FORCEINLINE void arm_stats_finalize_f32(
+  uint32_t blockSize,
+  float32_t mean,
+  float32_t m2,
+  arm_stats_result_f32 * pResult)
+{
+    if (m2 < 0.0f)
+    {
+        m2 = 0.0f;
+    }
+
+    pResult->mean = mean;
+    if (blockSize > 1U)
+    {
+        pResult->var = m2 / (float32_t) (blockSize - 1U);
+    }
+    else
+    {
+        pResult->var = 0.0f;
+    }
+    arm_sqrt_f32(pResult->var, &pResult->std);
+    arm_sqrt_f32(mean * mean + m2 / (float32_t) blockSize, &pResult->rms);
+}
+
+/**
+  @brief         Mean, variance, standard deviation, RMS, minimum and maximum of a floating-point vector.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @param[out]    pResult    statistics returned here
+
+  @par           The variance is normalized by blockSize - 1 like arm_var_f32.
+                 When blockSize is 0, all the statistics are 0.
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+ARM_DSP_ATTRIBUTE void arm_stats_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_result_f32 * pResult)
+{
+    uint32_t  blkCnt;           /* loop counters */
+    uint32_t  chunkSize;
+    uint32_t  nb = 0U;
+    uint32_t  index = 0U;
+    f32x4_t   vecSrc;
+    f32x4_t   sumVec, sqVec;
+    f32x4_t   curMinValVec, curMaxValVec;
+    uint32x4_t indexVec;
+    uint32x4_t curMinIdxVec, curMaxIdxVec;
+    mve_pred16_t p0;
+    float32_t shift, s, q, in;
+    float32_t mean = 0.0f, m2 = 0.0f;
+    float32_t minValue, maxValue;
+    uint32_t  minIdx, maxIdx;
+
+    if (blockSize == 0U)
+    {
+        memset(pResult, 0, sizeof(arm_stats_result_f32));
+        return;
+    }
+
+    shift = pSrc[0];
+    minValue = shift;
+    maxValue = shift;
+    minIdx = 0U;
+    maxIdx = 0U;
+
+    indexVec = vidupq_u32((uint32_t)0, 1);
+    curMinValVec = vdupq_n_f32(shift);
+    curMaxValVec = vdupq_n_f32(shift);
+    curMinIdxVec = vdupq_n_u32(0);
+    curMaxIdxVec = vdupq_n_u32(0);
+
+    while (index < blockSize)
+    {
+        chunkSize = blockSize - index;
+        if (chunkSize > ARM_STATS_CHUNK_F32)
+        {
+            chunkSize = ARM_STATS_CHUNK_F32;
+        }
+
+        sumVec = vdupq_n_f32(0.0f);
+        sqVec = vdupq_n_f32(0.0f);
+
+        /* Compute 4 outputs at a time */
+        blkCnt = chunkSize >> 2U;
+        while (blkCnt > 0U)
+        {
+            vecSrc = vld1q(pSrc);
+            pSrc += 4;
+
+            /*
+             * Get current min and max per lane and current index per lane
+             * when a min or max is selected
+             */
+            p0 = vcmpltq(vecSrc, curMinValVec);
+            curMinValVec = vpselq(vecSrc, curMinValVec, p0);
+            curMinIdxVec = vpselq(indexVec, curMinIdxVec, p0);
+
+            p0 = vcmpgtq(vecSrc, curMaxValVec);
+            curMaxValVec = vpselq(vecSrc, curMaxValVec, p0);
+            curMaxIdxVec = vpselq(indexVec, curMaxIdxVec, p0);
+
+            vecSrc = vsubq(vecSrc, shift);
+            sumVec = vaddq(sumVec, vecSrc);
+            sqVec = vfmaq(sqVec, vecSrc, vecSrc);
+
+            indexVec = indexVec + 4;
+            blkCnt--;
+        }
+
+        s = vecAddAcrossF32Mve(sumVec);
+        q = vecAddAcrossF32Mve(sqVec);
+
+        /*
+         * tail (only for the last chunk since the chunk size is a multiple of 4)
+         * The min and max of the tail are merged after the vector
+         * reduction. The tail indexes are the biggest ones so
+         * a strict comparison keeps the first occurrence.
+         */
+        blkCnt = chunkSize & 0x3;
+        while (blkCnt > 0U)
+        {
+            in = *pSrc++;
+            if (in < minValue)
+            {
+                minValue = in;
+                minIdx = blockSize - blkCnt;
+            }
+            if (in > maxValue)
+            {
+                maxValue = in;
+                maxIdx = blockSize - blkCnt;
+            }
+            in = in - shift;
+            s += in;
+            q += in * in;
+            blkCnt--;
+        }
+
+        arm_stats_merge_f32(shift, s, q, chunkSize, &nb, &mean, &m2);
+        index += chunkSize;
+    }
+
+    /*
+     * Get min and max value across the vector and the index of
+     * the first occurrence
+     */
+    {
+        float32_t vecMin, vecMax;
+        uint32_t  vecMinIdx, vecMaxIdx;
+
+        vecMin = vminnmvq(F32_MAX, curMinValVec);
+        p0 = vcmpleq(curMinValVec, vecMin);
+        indexVec = vpselq(curMinIdxVec, vdupq_n_u32(blockSize), p0);
+        vecMinIdx = vminvq(blockSize, indexVec);
+
+        vecMax = vmaxnmvq(-F32_MAX, curMaxValVec);
+        p0 = vcmpgeq(curMaxValVec, vecMax);
+        indexVec = vpselq(curMaxIdxVec, vdupq_n_u32(blockSize), p0);
+        vecMaxIdx = vminvq(blockSize, indexVec);
+
+        if (!(minValue < vecMin))
+        {
+            minValue = vecMin;
+            minIdx = vecMinIdx;
+        }
+        if (!(maxValue > vecMax))
+        {
+            maxValue = vecMax;
+            maxIdx = vecMaxIdx;
+        }
+    }
+
+    pResult->min = minValue;
+    pResult->minIndex = minIdx;
+    pResult->max = maxValue;
+    pResult->maxIndex = maxIdx;
+
+    arm_stats_finalize_f32(blockSize, mean, m2, pResult);
+}
+#else
+ARM_DSP_ATTRIBUTE void arm_stats_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_result_f32 * pResult)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        uint32_t chunkSize;
+        uint32_t nb = 0U;
+        uint32_t index = 0U;                           /* Index of current sample */
+        float32_t shift, s, q, in;
+        float32_t mean = 0.0f, m2 = 0.0f;
+        float32_t minValue, maxValue;
+        uint32_t minIdx = 0U, maxIdx = 0U;
+
+  if (blockSize == 0U)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_f32));
+    return;
+  }
+
+  shift = pSrc[0];
+  minValue = shift;
+  maxValue = shift;
+
+  while (index < blockSize)
+  {
+    chunkSize = blockSize - index;
+    if (chunkSize > ARM_STATS_CHUNK_F32)
+    {
+      chunkSize = ARM_STATS_CHUNK_F32;
+    }
+
+    s = 0.0f;
+    q = 0.0f;
+
+    blkCnt = chunkSize;
+
+    while (blkCnt > 0U)
+    {
+      in = *pSrc++;
+
+      /* compare for the minimum and maximum values */
+      if (in < minValue)
+      {
+        minValue = in;
+        minIdx = index;
+      }
+      if (in > maxValue)
+      {
+        maxValue = in;
+        maxIdx = index;
+      }
+
+      in = in - shift;
+      s += in;
+      q += in * in;
+
+      index++;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    arm_stats_merge_f32(shift, s, q, chunkSize, &nb, &mean, &m2);
+  }
+
+  pResult->min = minValue;
+  pResult->minIndex = minIdx;
+  pResult->max = maxValue;
+  pResult->maxIndex = maxIdx;
+
+  arm_stats_finalize_f32(blockSize, mean, m2, pResult);
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of stats group
+ */
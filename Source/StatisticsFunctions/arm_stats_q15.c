@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_q15.c
+ * Description:  Mean, variance, RMS, minimum and maximum of a Q15 vector in one pass
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup stats
+  @{
+ */
+
+/**
+  @brief         Mean, variance, standard deviation, RMS, minimum and maximum of a Q15 vector.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @param[out]    pResult    statistics returned here
+
+  @par           Scaling and Overflow Behavior
+                   The mean is computed like in arm_mean_q15.
+                   The variance, standard deviation and RMS are computed like in
+                   arm_var_q15, arm_std_q15 and arm_rms_q15: the sum of squares
+                   is accumulated in a 64-bit accumulator in 34.30 format and
+                   the sum in a 32-bit accumulator.
+                   When blockSize is 0, all the statistics are 0.
+ */
+ARM_DSP_ATTRIBUTE void arm_stats_q15(
+  const q15_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_result_q15 * pResult)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        uint32_t index = 0U;                           /* Index of current sample */
+        q31_t sum = 0;                                 /* Accumulator */
+        q63_t sumOfSquares = 0;                        /* Sum of squares */
+        q31_t meanOfSquares, squareOfMean;             /* Square of mean and mean of square */
+        q31_t var = 0;
+        q15_t in;
+        q15_t minValue, maxValue;
+        uint32_t minIdx = 0U, maxIdx = 0U;
+
+  if (blockSize == 0U)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_q15));
+    return;
+  }
+
+  minValue = pSrc[0];
+  maxValue = pSrc[0];
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* compare for the minimum and maximum values */
+    if (in < minValue)
+    {
+      minValue = in;
+      minIdx = index;
+    }
+    if (in > maxValue)
+    {
+      maxValue = in;
+      maxIdx = index;
+    }
+
+#if defined (ARM_MATH_DSP)
+    sumOfSquares = __SMLALD(in, in, sumOfSquares);
+#else
+    sumOfSquares += (in * in);
+#endif /* #if defined (ARM_MATH_DSP) */
+    sum += in;
+
+    index++;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  pResult->min = minValue;
+  pResult->minIndex = minIdx;
+  pResult->max = maxValue;
+  pResult->maxIndex = maxIdx;
+
+  pResult->mean = (q15_t) (sum / (int32_t) blockSize);
+
+  if (blockSize > 1U)
+  {
+    /* Compute Mean of squares and square of mean */
+    meanOfSquares = (q31_t) (sumOfSquares / (q63_t)(blockSize - 1U));
+    squareOfMean = (q31_t) ((q63_t) sum * sum / (q63_t)(blockSize * (blockSize - 1U)));
+
+    var = meanOfSquares - squareOfMean;
+  }
+  pResult->var = (q15_t) (var >> 15U);
+  arm_sqrt_q15((q15_t) __SSAT(var >> 15U, 16U), &pResult->std);
+
+  arm_sqrt_q15((q15_t) __SSAT((sumOfSquares / (q63_t)blockSize) >> 15, 16), &pResult->rms);
+}
+
+/**
+  @} end of stats group
+ */
@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_q31.c
+ * Description:  Mean, variance, RMS, minimum and maximum of a Q31 vector in one pass
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup stats
+  @{
+ */
+
+/**
+  @brief         Mean, variance, standard deviation, RMS, minimum and maximum of a Q31 vector.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @param[out]    pResult    statistics returned here
+
+  @par           Scaling and Overflow Behavior
+                   The mean is computed like in arm_mean_q31.
+                   The variance and standard deviation are computed like in arm_var_q31
+                   and arm_std_q31: the input is downshifted by 8 bits which yields 1.23 and the
+                   sum of squares is accumulated in a 64-bit accumulator in 2.46 format.
+                   The input signal must be scaled down by log2(blockSize)-8 bits
+                   to avoid overflows.
+                   For the RMS, the full precision squares are downshifted by 16 bits
+                   and accumulated in 2.46 format so that there is no overflow
+                   for the same input range.
+                   When blockSize is 0, all the statistics are 0.
+ */
+ARM_DSP_ATTRIBUTE void arm_stats_q31(
+  const q31_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_result_q31 * pResult)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        uint32_t index = 0U;                           /* Index of current sample */
+        q63_t sum = 0;                                 /* Sum of the samples */
+        q63_t sumShifted = 0;                          /* Sum of the downshifted samples */
+        q63_t sumOfSquares = 0;                        /* Sum of squares of the downshifted samples */
+        q63_t power = 0;                               /* Sum of squares for the RMS */
+        q63_t meanOfSquares, squareOfMean;             /* Square of mean and mean of square */
+        q31_t in, in8;
+        q31_t minValue, maxValue;
+        uint32_t minIdx = 0U, maxIdx = 0U;
+
+  if (blockSize == 0U)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_q31));
+    return;
+  }
+
+  minValue = pSrc[0];
+  maxValue = pSrc[0];
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* compare for the minimum and maximum values */
+    if (in < minValue)
+    {
+      minValue = in;
+      minIdx = index;
+    }
+    if (in > maxValue)
+    {
+      maxValue = in;
+      maxIdx = index;
+    }
+
+    sum += in;
+    power += ((q63_t) in * in) >> 16U;
+
+    in8 = in >> 8U;
+    sumOfSquares += ((q63_t) (in8) * (in8));
+    sumShifted += in8;
+
+    index++;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  pResult->min = minValue;
+  pResult->minIndex = minIdx;
+  pResult->max = maxValue;
+  pResult->maxIndex = maxIdx;
+
+  pResult->mean = (q31_t) (sum / blockSize);
+
+  if (blockSize > 1U)
+  {
+    /* Compute Mean of squares and square of mean */
+    meanOfSquares = (sumOfSquares / (q63_t)(blockSize - 1U));
+    squareOfMean = ( sumShifted * sumShifted / (q63_t)(blockSize * (blockSize - 1U)));
+
+    pResult->var = (q31_t)((meanOfSquares - squareOfMean) >> 15U);
+  }
+  else
+  {
+    pResult->var = 0;
+  }
+  arm_sqrt_q31(pResult->var, &pResult->std);
+
+  /* Mean of squares in 2.46 format converted to 1.31 */
+  arm_sqrt_q31(clip_q63_to_q31((power / (q63_t) blockSize) >> 15U), &pResult->rms);
+}
+
+/**
+  @} end of stats group
+ */
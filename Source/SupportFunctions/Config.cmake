@@ -10,7 +10,9 @@ if (FASTBUILD)
 
 else()
 
-target_sources(CMSISDSP PRIVATE SupportFunctions/arm_barycenter_f32.c
+target_sources(CMSISDSP PRIVATE SupportFunctions/arm_argsort_f32.c
+SupportFunctions/arm_argsort_init_f32.c
+SupportFunctions/arm_barycenter_f32.c
 SupportFunctions/arm_bitonic_sort_f32.c
 SupportFunctions/arm_bubble_sort_f32.c
 SupportFunctions/arm_copy_f32.c
@@ -50,6 +52,7 @@ SupportFunctions/arm_q7_to_float.c
 SupportFunctions/arm_q7_to_q15.c
 SupportFunctions/arm_q7_to_q31.c
 SupportFunctions/arm_quick_sort_f32.c
+SupportFunctions/arm_radix_sort_f32.c
 SupportFunctions/arm_selection_sort_f32.c
 SupportFunctions/arm_sort_f32.c
 SupportFunctions/arm_sort_init_f32.c
@@ -26,6 +26,8 @@
  * limitations under the License.
  */
 
+#include "arm_argsort_f32.c"
+#include "arm_argsort_init_f32.c"
 #include "arm_barycenter_f32.c"
 #include "arm_bitonic_sort_f32.c"
 #include "arm_bubble_sort_f32.c"
@@ -44,6 +46,7 @@
 #include "arm_merge_sort_f32.c"
 #include "arm_merge_sort_init_f32.c"
 #include "arm_quick_sort_f32.c"
+#include "arm_radix_sort_f32.c"
 #include "arm_selection_sort_f32.c"
 #include "arm_sort_f32.c"
 #include "arm_sort_init_f32.c"
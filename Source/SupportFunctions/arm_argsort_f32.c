@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_argsort_f32.c
+ * Description:  Floating point argsort
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/support_functions.h"
+#include "arm_sorting.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+   * @brief Indices sorting a floating-point vector
+   * @param[in]  S          points to an instance of the argsort structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pIndex     points to the permutation sorting the input
+   * @param[in]  blockSize  number of samples to process.
+   *
+   * @par        Algorithm
+   *               pSrc[pIndex[0]], pSrc[pIndex[1]] ... is the sorted input.
+   *               A least significant digit radix sort on the indices is used.
+   *               The bit pattern of each float is mapped to an unsigned
+   *               key with the same ordering and the indices are
+   *               distributed according to each byte of the key, starting
+   *               with the least significant one. Bytes which are the same for
+   *               all the keys are skipped.
+   *
+   * @par          The sort is stable: equal values are kept in the order of
+   *               the input.
+   *
+   * @par          A work array of 2*blockSize words is always needed. It must be
+   *               allocated by the user and linked to the instance at
+   *               initialization time. The input is not modified.
+   */
+ARM_DSP_ATTRIBUTE void arm_argsort_f32(
+  const arm_argsort_instance_f32 * S,
+  const float32_t *pSrc,
+        uint32_t *pIndex,
+        uint32_t blockSize)
+{
+    uint32_t * pKeys = S->buffer;
+    uint32_t * pIn = pIndex;
+    uint32_t * pOut = S->buffer + blockSize;
+    uint32_t * pTmp;
+    uint32_t count[256];
+    uint32_t shift, i, d, idx;
+    uint32_t bits;
+
+    if (blockSize == 0U)
+    {
+        return;
+    }
+
+    for (i = 0; i < blockSize; i++)
+    {
+        memcpy(&bits, &pSrc[i], sizeof(uint32_t));
+        pKeys[i] = arm_sort_key_f32(bits, S->dir);
+        pIndex[i] = i;
+    }
+
+    for (shift = 0; shift < 32U; shift += 8U)
+    {
+        memset(count, 0, sizeof(count));
+        for (i = 0; i < blockSize; i++)
+        {
+            count[(pKeys[i] >> shift) & 0xFFU]++;
+        }
+
+        /* All the keys have the same digit : nothing to do for this pass */
+        if (count[(pKeys[0] >> shift) & 0xFFU] == blockSize)
+        {
+            continue;
+        }
+
+        /* Start of each bucket */
+        idx = 0;
+        for (d = 0; d < 256U; d++)
+        {
+            i = count[d];
+            count[d] = idx;
+            idx += i;
+        }
+
+        for (i = 0; i < blockSize; i++)
+        {
+            idx = pIn[i];
+            pOut[count[(pKeys[idx] >> shift) & 0xFFU]++] = idx;
+        }
+
+        pTmp = pIn;
+        pIn = pOut;
+        pOut = pTmp;
+    }
+
+    if (pIn != pIndex)
+    {
+        memcpy(pIndex, pIn, blockSize*sizeof(uint32_t));
+    }
+}
+/**
+  @} end of Sorting group
+ */
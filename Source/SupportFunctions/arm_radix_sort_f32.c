@@ -0,0 +1,201 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_radix_sort_f32.c
+ * Description:  Floating point radix sort
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+
+#include "dsp/support_functions.h"
+#include "arm_sorting.h"
+
+/* Buckets smaller than this are sorted with an insertion sort */
+#define RADIX_SORT_INSERTION_THRESHOLD 32U
+
+#define RADIX_DIGIT(KEY,SHIFT) (((KEY) >> (SHIFT)) & 0xFFU)
+
+static void arm_radix_insertion_sort_u32(uint32_t * pA, uint32_t n)
+{
+    uint32_t i, j;
+    uint32_t temp;
+
+    for (i = 1; i < n; i++)
+    {
+        temp = pA[i];
+        j = i;
+        while ((j > 0U) && (pA[j - 1U] > temp))
+        {
+            pA[j] = pA[j - 1U];
+            j--;
+        }
+        pA[j] = temp;
+    }
+}
+
+/* 
+ * Permute the keys in place so that they are grouped by the
+ * digit at position shift (American flag sort).
+ */
+static void arm_radix_flag_pass_u32(uint32_t * pA, uint32_t n, uint32_t shift)
+{
+    uint32_t heads[256];
+    uint32_t tails[256];
+    uint32_t i, d, b;
+    uint32_t key, temp;
+
+    memset(tails, 0, sizeof(tails));
+    for (i = 0; i < n; i++)
+    {
+        tails[RADIX_DIGIT(pA[i], shift)]++;
+    }
+
+    /* Start and end of each bucket */
+    d = 0;
+    for (i = 0; i < 256U; i++)
+    {
+        heads[i] = d;
+        d += tails[i];
+        tails[i] = d;
+    }
+
+    for (d = 0; d < 256U; d++)
+    {
+        while (heads[d] < tails[d])
+        {
+            key = pA[heads[d]];
+            b = RADIX_DIGIT(key, shift);
+
+            /* Move the key to its bucket until a key for bucket d is found */
+            while (b != d)
+            {
+                temp = pA[heads[b]];
+                pA[heads[b]++] = key;
+                key = temp;
+                b = RADIX_DIGIT(key, shift);
+            }
+            pA[heads[d]++] = key;
+        }
+    }
+}
+
+static void arm_radix_sort_core_u32(uint32_t * pA, uint32_t n, uint32_t shift)
+{
+    uint32_t start, end, d;
+
+    if (n <= RADIX_SORT_INSERTION_THRESHOLD)
+    {
+        arm_radix_insertion_sort_u32(pA, n);
+        return;
+    }
+
+    arm_radix_flag_pass_u32(pA, n, shift);
+
+    if (shift == 0U)
+    {
+        return;
+    }
+
+    /* Sort each bucket on the next digit */
+    start = 0;
+    while (start < n)
+    {
+        d = RADIX_DIGIT(pA[start], shift);
+        end = start + 1U;
+        while ((end < n) && (RADIX_DIGIT(pA[end], shift) == d))
+        {
+            end++;
+        }
+
+        if (end - start > 1U)
+        {
+            arm_radix_sort_core_u32(pA + start, end - start, shift - 8U);
+        }
+        start = end;
+    }
+}
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+   * @private
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   *
+   * @par        Algorithm
+   *               The radix sort algorithm is not a comparison algorithm.
+   *               The bit pattern of each float is mapped to an unsigned
+   *               key with the same ordering. The keys are grouped by their
+   *               most significant byte, then each group is sorted
+   *               recursively on the next byte. Small groups are sorted with
+   *               an insertion sort. The complexity is linear in blockSize and
+   *               no working buffer is needed.
+   *
+   * @par          It's an in-place algorithm. In order to obtain an out-of-place
+   *               function, a memcpy of the source vector is performed.
+   *
+   * @par          Negative zero is sorted before positive zero. NaNs are sorted
+   *               after +Inf for positive NaNs and before -Inf for negative NaNs
+   *               in ascending order.
+   */
+ARM_DSP_ATTRIBUTE void arm_radix_sort_f32(
+  const arm_sort_instance_f32 * S, 
+        float32_t * pSrc, 
+        float32_t * pDst, 
+        uint32_t blockSize)
+{
+    uint32_t * pA;
+    uint32_t i;
+
+    if(pSrc != pDst) // out-of-place
+    {   
+        memcpy(pDst, pSrc, blockSize*sizeof(float32_t) );
+    }
+    pA = (uint32_t *)pDst;
+
+    for (i = 0; i < blockSize; i++)
+    {
+        pA[i] = arm_sort_key_f32(pA[i], S->dir);
+    }
+
+    arm_radix_sort_core_u32(pA, blockSize, 24U);
+
+    for (i = 0; i < blockSize; i++)
+    {
+        pA[i] = arm_sort_bits_f32(pA[i], S->dir);
+    }
+}
+/**
+  @} end of Sorting group
+ */
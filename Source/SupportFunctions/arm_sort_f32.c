@@ -81,6 +81,10 @@ ARM_DSP_ATTRIBUTE void arm_sort_f32(
         case ARM_SORT_SELECTION:
         arm_selection_sort_f32(S, pSrc, pDst, blockSize);
         break;
+
+        case ARM_SORT_RADIX:
+        arm_radix_sort_f32(S, pSrc, pDst, blockSize);
+        break;
     }
 }
 
@@ -132,6 +132,26 @@ target_sources(CMSISDSP PRIVATE TransformFunctions/arm_mfcc_f16.c)
 endif()
 
 
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_dct_init_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_dct2_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_idct2_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_dct4_f32.c)
+
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_dct_init_q31.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_dct2_q31.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_idct2_q31.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_dct4_q31.c)
+
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_dct_init_q15.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_dct2_q15.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_idct2_q15.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_dct4_q15.c)
+
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_mdct_init_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_mdct_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_mdct_init_q31.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_mdct_q31.c)
+
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_transform_buffer_sizes.c)
 
 endif()
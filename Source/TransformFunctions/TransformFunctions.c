@@ -65,6 +65,26 @@
 #include "arm_rfft_init_q15.c"
 #include "arm_rfft_init_q31.c"
 
+#include "arm_dct_init_f32.c"
+#include "arm_dct2_f32.c"
+#include "arm_idct2_f32.c"
+#include "arm_dct4_f32.c"
+
+#include "arm_dct_init_q31.c"
+#include "arm_dct2_q31.c"
+#include "arm_idct2_q31.c"
+#include "arm_dct4_q31.c"
+
+#include "arm_dct_init_q15.c"
+#include "arm_dct2_q15.c"
+#include "arm_idct2_q15.c"
+#include "arm_dct4_q15.c"
+
+#include "arm_mdct_init_f32.c"
+#include "arm_mdct_f32.c"
+#include "arm_mdct_init_q31.c"
+#include "arm_mdct_q31.c"
+
 #include "arm_transform_buffer_sizes.c"
 
 /* Deprecated */
@@ -0,0 +1,195 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dct2_f32.c
+ * Description:  Floating-point DCT-II and DST-II
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/transform_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup DCT DCT Transforms
+
+  The DCT-II, the DCT-IV and their inverses are computed with
+  a FFT in O(N log N) operations.
+
+  The DCT-II of a sequence x[n] of length N is
+  <pre>
+      X[k] = sum_{n=0}^{N-1} x[n] cos(pi (2n+1) k / (2N))
+  </pre>
+  and its inverse (a scaled DCT-III) is
+  <pre>
+      x[n] = 1/N (X[0] + 2 sum_{k=1}^{N-1} X[k] cos(pi (2n+1) k / (2N)))
+  </pre>
+
+  The DCT-IV is
+  <pre>
+      X[k] = sum_{n=0}^{N-1} x[n] cos(pi (2n+1) (2k+1) / (4N))
+  </pre>
+  and its inverse is the DCT-IV scaled by 2/N.
+
+  The floating-point DST-II is
+  <pre>
+      X[k] = sum_{n=0}^{N-1} x[n] sin(pi (2n+1) (k+1) / (2N))
+  </pre>
+  and is computed with the DCT-II of the sequence (-1)^n x[n]
+  in the reverse order.
+
+  @par           Algorithms
+                   The DCT-II is computed with a real FFT of length N of the even samples
+                   followed by the odd samples in reverse order. The output of the FFT is
+                   rotated by exp(-i pi k / (2N)).
+                   The DCT-IV is computed with a complex FFT of length N/2 with a rotation
+                   before and after the FFT.
+
+  @par           Floating-point
+                   The DCT-II uses an \ref arm_rfft_fast_instance_f32 of length N and
+                   the DCT-IV uses the CFFT of length N/2 of this instance.
+
+  @par           Q15 and Q31
+                   Both transforms use a CFFT of length N/2. The real FFT of length N needed by
+                   the DCT-II is computed from it. The forward transforms are scaled down by N:
+                   the output of arm_dct2_q31 is X[k] / N and the output of arm_dct4_q31 is X[k] / N.
+                   The inverse transforms are not scaled. As a consequence, the inverse
+                   of the forward transform gives x[n] / N like the RFFT and RIFFT.
+                   The input of an inverse transform must be the output of the
+                   forward transform or be small enough to avoid saturations.
+
+  @par           Buffers
+                   The source and destination buffers must be different.
+                   A temporary buffer of N values is used by all the transforms.
+                   The source buffer is not modified.
+
+  @par           Neon
+                   The DCT is not available with the Neon FFT instances.
+ */
+
+/**
+  @addtogroup DCT
+  @{
+ */
+
+__STATIC_FORCEINLINE void arm_dct2_core_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp,
+  const int dst)
+{
+  const uint32_t N = S->N;
+  const uint32_t M = N >> 1U;
+  const float32_t *pT = S->pTwiddleDct2;
+  float32_t re, im, c, s;
+  uint32_t n, k;
+
+  /* Even samples followed by the odd samples in reverse order.
+     The odd samples are negated for the DST-II. */
+  for (n = 0U; n < M; n++)
+  {
+    pDst[n] = pSrc[2U * n];
+    pDst[N - 1U - n] = dst ? -pSrc[2U * n + 1U] : pSrc[2U * n + 1U];
+  }
+
+  arm_rfft_fast_f32(&S->rfft, pDst, pTmp, 0);
+
+  /* X[k] = Re(V[k] exp(-i pi k / 2N)) and X[N - k] = -Im(V[k] exp(-i pi k / 2N)).
+     V[0] and V[N/2] are real and packed in the first complex. */
+  re = pTmp[0];
+  im = pTmp[1] * 0.70710678118654752440f;
+  if (dst)
+  {
+    pDst[N - 1U] = re;
+    pDst[M - 1U] = im;
+  }
+  else
+  {
+    pDst[0] = re;
+    pDst[M] = im;
+  }
+
+  for (k = 1U; k < M; k++)
+  {
+    c = pT[2U * k];
+    s = pT[2U * k + 1U];
+    re = pTmp[2U * k];
+    im = pTmp[2U * k + 1U];
+
+    if (dst)
+    {
+      pDst[N - 1U - k] = re * c + im * s;
+      pDst[k - 1U] = re * s - im * c;
+    }
+    else
+    {
+      pDst[k] = re * c + im * s;
+      pDst[N - k] = re * s - im * c;
+    }
+  }
+}
+
+/**
+  @brief         Floating-point DCT-II.
+  @param[in]     S     points to an instance of the floating-point DCT structure.
+  @param[in]     pSrc  points to the input buffer of N values
+  @param[out]    pDst  points to the output buffer of N values
+  @param[out]    pTmp  points to a temporary buffer of N values
+ */
+ARM_DSP_ATTRIBUTE void arm_dct2_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp)
+{
+  arm_dct2_core_f32(S, pSrc, pDst, pTmp, 0);
+}
+
+/**
+  @brief         Floating-point DST-II.
+  @param[in]     S     points to an instance of the floating-point DCT structure.
+  @param[in]     pSrc  points to the input buffer of N values
+  @param[out]    pDst  points to the output buffer of N values
+  @param[out]    pTmp  points to a temporary buffer of N values
+ */
+ARM_DSP_ATTRIBUTE void arm_dst2_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp)
+{
+  arm_dct2_core_f32(S, pSrc, pDst, pTmp, 1);
+}
+
+/**
+  @} end of DCT group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
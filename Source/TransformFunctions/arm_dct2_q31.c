@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dct2_q31.c
+ * Description:  Q31 DCT-II
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/transform_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup DCT
+ */
+
+/**
+  @addtogroup DCT
+  @{
+ */
+
+/**
+  @brief         Q31 DCT-II.
+  @param[in]     S     points to an instance of the Q31 DCT structure.
+  @param[in]     pSrc  points to the input buffer of N values
+  @param[out]    pDst  points to the output buffer of N values
+  @param[out]    pTmp  points to a temporary buffer of N values
+
+  @par           Scaling and Overflow Behavior
+                   The output is the DCT-II scaled down by N.
+ */
+ARM_DSP_ATTRIBUTE void arm_dct2_q31(
+  const arm_dct_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pTmp)
+{
+  const uint32_t N = S->N;
+  const uint32_t M = N >> 1U;
+  const q31_t *pT = S->pTwiddleDct2;
+  const q31_t *pW = S->pTwiddleRfft;
+  q63_t er, ei, odr, odi;
+  q31_t a, b, c, d, vr, vi;
+  uint32_t n, k;
+
+  /* Even samples followed by the odd samples in reverse order */
+  for (n = 0U; n < M; n++)
+  {
+    pTmp[n] = pSrc[2U * n];
+    pTmp[N - 1U - n] = pSrc[2U * n + 1U];
+  }
+
+  /* CFFT of length N/2 of the sequence seen as complex numbers */
+  arm_cfft_q31(&S->cfft, pTmp, 0, 1);
+
+  /* V[0] and V[N/2] are real */
+  a = pTmp[0];
+  b = pTmp[1];
+  pDst[0] = (q31_t) (((q63_t) a + b) >> 1);
+  pDst[M] = (q31_t) ((((q63_t) a - b) * 0x5A82799A) >> 32);
+
+  for (k = 1U; k < M; k++)
+  {
+    a = pTmp[2U * k];
+    b = pTmp[2U * k + 1U];
+    c = pTmp[2U * (M - k)];
+    d = pTmp[2U * (M - k) + 1U];
+
+    /* E = (Z[k] + conj(Z[N/2 - k])) / 4 and O = (Z[k] - conj(Z[N/2 - k])) / 4i */
+    er = ((q63_t) a + c) >> 2;
+    ei = ((q63_t) b - d) >> 2;
+    odr = ((q63_t) b + d) >> 2;
+    odi = ((q63_t) c - a) >> 2;
+
+    /* V[k] = E + exp(-2 i pi k / N) O */
+    vr = clip_q63_to_q31(er + ((pW[2U * k] * odr + pW[2U * k + 1U] * odi) >> 31));
+    vi = clip_q63_to_q31(ei + ((pW[2U * k] * odi - pW[2U * k + 1U] * odr) >> 31));
+
+    /* X[k] = Re(V[k] exp(-i pi k / 2N)) and X[N - k] = -Im(V[k] exp(-i pi k / 2N)) */
+    pDst[k] = clip_q63_to_q31(((q63_t) vr * pT[2U * k] + (q63_t) vi * pT[2U * k + 1U]) >> 31);
+    pDst[N - k] = clip_q63_to_q31(((q63_t) vr * pT[2U * k + 1U] - (q63_t) vi * pT[2U * k]) >> 31);
+  }
+}
+
+/**
+  @} end of DCT group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
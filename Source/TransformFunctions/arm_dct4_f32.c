@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dct4_f32.c
+ * Description:  Floating-point DCT-IV and inverse DCT-IV
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/transform_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup DCT
+ */
+
+/**
+  @addtogroup DCT
+  @{
+ */
+
+__STATIC_FORCEINLINE void arm_dct4_core_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp,
+  const float32_t scale)
+{
+  const uint32_t N = S->N;
+  const uint32_t M = N >> 1U;
+  const float32_t *pPre = S->pTwiddleDct4Pre;
+  const float32_t *pPost = S->pTwiddleDct4Post;
+  float32_t re, im, c, s;
+  uint32_t n, k;
+
+  /* (x[2n] + i x[N - 1 - 2n]) exp(-i pi (4n + 1) / 4N) */
+  for (n = 0U; n < M; n++)
+  {
+    c = pPre[2U * n];
+    s = pPre[2U * n + 1U];
+    re = pSrc[2U * n];
+    im = pSrc[N - 1U - 2U * n];
+
+    pTmp[2U * n] = re * c + im * s;
+    pTmp[2U * n + 1U] = im * c - re * s;
+  }
+
+  arm_cfft_f32(&S->rfft.Sint, pTmp, 0, 1);
+
+  /* Y[k] = Z[k] exp(-i pi k / N), X[2k] = Re(Y[k]) and X[N - 1 - 2k] = -Im(Y[k]) */
+  for (k = 0U; k < M; k++)
+  {
+    c = pPost[2U * k];
+    s = pPost[2U * k + 1U];
+    re = pTmp[2U * k];
+    im = pTmp[2U * k + 1U];
+
+    pDst[2U * k] = scale * (re * c + im * s);
+    pDst[N - 1U - 2U * k] = scale * (re * s - im * c);
+  }
+}
+
+/**
+  @brief         Floating-point DCT-IV.
+  @param[in]     S     points to an instance of the floating-point DCT structure.
+  @param[in]     pSrc  points to the input buffer of N values
+  @param[out]    pDst  points to the output buffer of N values
+  @param[out]    pTmp  points to a temporary buffer of N values
+ */
+ARM_DSP_ATTRIBUTE void arm_dct4_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp)
+{
+  arm_dct4_core_f32(S, pSrc, pDst, pTmp, 1.0f);
+}
+
+/**
+  @brief         Floating-point inverse DCT-IV.
+  @param[in]     S     points to an instance of the floating-point DCT structure.
+  @param[in]     pSrc  points to the input buffer of N values
+  @param[out]    pDst  points to the output buffer of N values
+  @param[out]    pTmp  points to a temporary buffer of N values
+
+  @par           Details
+                   The DCT-IV is its own inverse up to the scaling by 2/N.
+ */
+ARM_DSP_ATTRIBUTE void arm_idct4_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp)
+{
+  arm_dct4_core_f32(S, pSrc, pDst, pTmp, 2.0f / (float32_t) S->N);
+}
+
+/**
+  @} end of DCT group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
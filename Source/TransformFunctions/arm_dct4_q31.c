@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dct4_q31.c
+ * Description:  Q31 DCT-IV and inverse DCT-IV
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/transform_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup DCT
+ */
+
+/**
+  @addtogroup DCT
+  @{
+ */
+
+__STATIC_FORCEINLINE void arm_dct4_core_q31(
+  const arm_dct_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pTmp,
+  const int32_t shift)
+{
+  const uint32_t N = S->N;
+  const uint32_t M = N >> 1U;
+  const q31_t *pPre = S->pTwiddleDct4Pre;
+  const q31_t *pPost = S->pTwiddleDct4Post;
+  q31_t re, im, c, s;
+  uint32_t n, k;
+
+  /* (x[2n] + i x[N - 1 - 2n]) exp(-i pi (4n + 1) / 4N) */
+  for (n = 0U; n < M; n++)
+  {
+    c = pPre[2U * n];
+    s = pPre[2U * n + 1U];
+    re = pSrc[2U * n];
+    im = pSrc[N - 1U - 2U * n];
+
+    pTmp[2U * n] = clip_q63_to_q31(((q63_t) re * c + (q63_t) im * s) >> shift);
+    pTmp[2U * n + 1U] = clip_q63_to_q31(((q63_t) im * c - (q63_t) re * s) >> shift);
+  }
+
+  arm_cfft_q31(&S->cfft, pTmp, 0, 1);
+
+  /* Y[k] = Z[k] exp(-i pi k / N), X[2k] = Re(Y[k]) and X[N - 1 - 2k] = -Im(Y[k]) */
+  for (k = 0U; k < M; k++)
+  {
+    c = pPost[2U * k];
+    s = pPost[2U * k + 1U];
+    re = pTmp[2U * k];
+    im = pTmp[2U * k + 1U];
+
+    pDst[2U * k] = clip_q63_to_q31(((q63_t) re * c + (q63_t) im * s) >> 31);
+    pDst[N - 1U - 2U * k] = clip_q63_to_q31(((q63_t) re * s - (q63_t) im * c) >> 31);
+  }
+}
+
+/**
+  @brief         Q31 DCT-IV.
+  @param[in]     S     points to an instance of the Q31 DCT structure.
+  @param[in]     pSrc  points to the input buffer of N values
+  @param[out]    pDst  points to the output buffer of N values
+  @param[out]    pTmp  points to a temporary buffer of N values
+
+  @par           Scaling and Overflow Behavior
+                   The output is the DCT-IV scaled down by N.
+ */
+ARM_DSP_ATTRIBUTE void arm_dct4_q31(
+  const arm_dct_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pTmp)
+{
+  /* The rotated input is scaled down by 2 and the CFFT by N/2 */
+  arm_dct4_core_q31(S, pSrc, pDst, pTmp, 32);
+}
+
+/**
+  @brief         Q31 inverse DCT-IV.
+  @param[in]     S     points to an instance of the Q31 DCT structure.
+  @param[in]     pSrc  points to the input buffer of N values
+  @param[out]    pDst  points to the output buffer of N values
+  @param[out]    pTmp  points to a temporary buffer of N values
+
+  @par           Scaling and Overflow Behavior
+                   The output is the DCT-IV scaled by 2/N which is the exact inverse.
+                   The inverse of the output of \ref arm_dct4_q31 is the original
+                   sequence scaled down by N.
+ */
+ARM_DSP_ATTRIBUTE void arm_idct4_q31(
+  const arm_dct_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pTmp)
+{
+  /* The CFFT is scaled down by N/2 */
+  arm_dct4_core_q31(S, pSrc, pDst, pTmp, 31);
+}
+
+/**
+  @} end of DCT group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
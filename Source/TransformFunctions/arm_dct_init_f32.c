@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dct_init_f32.c
+ * Description:  Initialization function for the floating-point DCT
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/transform_functions.h"
+#include "arm_sincos.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup DCT
+ */
+
+/**
+  @addtogroup DCT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point DCT.
+  @param[out]    S         points to an instance of the floating-point DCT structure.
+  @param[in]     N         length of the DCT.
+  @param[out]    pTwiddle  points to a buffer of 3*N values for the rotation tables.
+                           It must be kept as long as the instance is used.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : N is not a supported length
+
+  @par           Details
+                   N must be a power of 2 from 32 to 4096 (the lengths supported
+                   by \ref arm_rfft_fast_init_f32).
+                   The rotation tables are computed by this function so that no
+                   precomputed table is needed for each length.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_dct_init_f32(
+  arm_dct_instance_f32 * S,
+  uint16_t N,
+  float32_t * pTwiddle)
+{
+  const uint32_t M = (uint32_t) N >> 1U;
+  float32_t *pDct2 = pTwiddle;
+  float32_t *pDct4Pre = pTwiddle + N;
+  float32_t *pDct4Post = pTwiddle + 2U * N;
+  float32_t s, c;
+  uint32_t k;
+  arm_status status;
+
+  status = arm_rfft_fast_init_f32(&S->rfft, N);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->N = N;
+  S->pTwiddleDct2 = pDct2;
+  S->pTwiddleDct4Pre = pDct4Pre;
+  S->pTwiddleDct4Post = pDct4Post;
+
+  for (k = 0U; k < M; k++)
+  {
+    /* pi k / (2 N) */
+    arm_sincos_core_f32(PI * (float32_t) k / (float32_t) (2U * N), &s, &c);
+    pDct2[2U * k] = c;
+    pDct2[2U * k + 1U] = s;
+
+    /* pi (4 k + 1) / (4 N) */
+    arm_sincos_core_f32(PI * (float32_t) (4U * k + 1U) / (float32_t) (4U * N), &s, &c);
+    pDct4Pre[2U * k] = c;
+    pDct4Pre[2U * k + 1U] = s;
+
+    /* pi k / N */
+    arm_sincos_core_f32(PI * (float32_t) k / (float32_t) N, &s, &c);
+    pDct4Post[2U * k] = c;
+    pDct4Post[2U * k + 1U] = s;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of DCT group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dct_init_q31.c
+ * Description:  Initialization function for the Q31 DCT
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/transform_functions.h"
+#include "arm_sincos.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup DCT
+ */
+
+/**
+  @addtogroup DCT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 DCT.
+  @param[out]    S         points to an instance of the Q31 DCT structure.
+  @param[in]     N         length of the DCT.
+  @param[out]    pTwiddle  points to a buffer of 4*N values for the rotation tables.
+                           It must be kept as long as the instance is used.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : N is not a supported length
+
+  @par           Details
+                   N must be a power of 2 from 32 to 8192 (twice the lengths supported
+                   by \ref arm_cfft_init_q31).
+                   The rotation tables are computed in fixed-point by this function
+                   so that no precomputed table is needed for each length.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_dct_init_q31(
+  arm_dct_instance_q31 * S,
+  uint16_t N,
+  q31_t * pTwiddle)
+{
+  const uint32_t M = (uint32_t) N >> 1U;
+  q31_t *pDct2 = pTwiddle;
+  q31_t *pRfft = pTwiddle + N;
+  q31_t *pDct4Pre = pTwiddle + 2U * N;
+  q31_t *pDct4Post = pTwiddle + 3U * N;
+  uint32_t k;
+  arm_status status;
+
+  if (N & 1U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_cfft_init_q31(&S->cfft, (uint16_t) M);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->N = N;
+  S->pTwiddleDct2 = pDct2;
+  S->pTwiddleRfft = pRfft;
+  S->pTwiddleDct4Pre = pDct4Pre;
+  S->pTwiddleDct4Post = pDct4Post;
+
+  /* The angles are in the unit of arm_sincos_core_q31 (2^31 is 2 pi).
+     They are exact since N is a power of 2. */
+  for (k = 0U; k < M; k++)
+  {
+    /* pi k / (2 N) */
+    arm_sincos_core_q31((q31_t) (((uint64_t) k << 29) / N), &pDct2[2U * k + 1U], &pDct2[2U * k]);
+
+    /* 2 pi k / N */
+    arm_sincos_core_q31((q31_t) (((uint64_t) k << 31) / N), &pRfft[2U * k + 1U], &pRfft[2U * k]);
+
+    /* pi (4 k + 1) / (4 N) */
+    arm_sincos_core_q31((q31_t) (((uint64_t) (4U * k + 1U) << 28) / N), &pDct4Pre[2U * k + 1U], &pDct4Pre[2U * k]);
+
+    /* pi k / N */
+    arm_sincos_core_q31((q31_t) (((uint64_t) k << 30) / N), &pDct4Post[2U * k + 1U], &pDct4Post[2U * k]);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of DCT group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
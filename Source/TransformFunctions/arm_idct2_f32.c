@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_idct2_f32.c
+ * Description:  Floating-point inverse DCT-II and inverse DST-II
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/transform_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup DCT
+ */
+
+/**
+  @addtogroup DCT
+  @{
+ */
+
+__STATIC_FORCEINLINE void arm_idct2_core_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp,
+  const int dst)
+{
+  const uint32_t N = S->N;
+  const uint32_t M = N >> 1U;
+  const float32_t *pT = S->pTwiddleDct2;
+  float32_t a, b, c, s;
+  uint32_t n, k;
+
+  /* V[k] = (X[k] - i X[N - k]) exp(i pi k / 2N) in the packed format of the RFFT.
+     The input of the DST-III is read in reverse order. */
+  pDst[0] = dst ? pSrc[N - 1U] : pSrc[0];
+  pDst[1] = (dst ? pSrc[M - 1U] : pSrc[M]) * 1.41421356237309504880f;
+
+  for (k = 1U; k < M; k++)
+  {
+    c = pT[2U * k];
+    s = pT[2U * k + 1U];
+    a = dst ? pSrc[N - 1U - k] : pSrc[k];
+    b = dst ? pSrc[k - 1U] : pSrc[N - k];
+
+    pDst[2U * k] = a * c + b * s;
+    pDst[2U * k + 1U] = a * s - b * c;
+  }
+
+  arm_rfft_fast_f32(&S->rfft, pDst, pTmp, 1);
+
+  /* Even samples followed by the odd samples in reverse order.
+     The odd samples are negated for the DST-III. */
+  for (n = 0U; n < M; n++)
+  {
+    pDst[2U * n] = pTmp[n];
+    pDst[2U * n + 1U] = dst ? -pTmp[N - 1U - n] : pTmp[N - 1U - n];
+  }
+}
+
+/**
+  @brief         Floating-point inverse DCT-II (DCT-III).
+  @param[in]     S     points to an instance of the floating-point DCT structure.
+  @param[in]     pSrc  points to the input buffer of N values
+  @param[out]    pDst  points to the output buffer of N values
+  @param[out]    pTmp  points to a temporary buffer of N values
+ */
+ARM_DSP_ATTRIBUTE void arm_idct2_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp)
+{
+  arm_idct2_core_f32(S, pSrc, pDst, pTmp, 0);
+}
+
+/**
+  @brief         Floating-point inverse DST-II (DST-III).
+  @param[in]     S     points to an instance of the floating-point DCT structure.
+  @param[in]     pSrc  points to the input buffer of N values
+  @param[out]    pDst  points to the output buffer of N values
+  @param[out]    pTmp  points to a temporary buffer of N values
+ */
+ARM_DSP_ATTRIBUTE void arm_idst2_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp)
+{
+  arm_idct2_core_f32(S, pSrc, pDst, pTmp, 1);
+}
+
+/**
+  @} end of DCT group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_idct2_q15.c
+ * Description:  Q15 inverse DCT-II
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/transform_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup DCT
+ */
+
+/**
+  @addtogroup DCT
+  @{
+ */
+
+/**
+  @brief         Q15 inverse DCT-II (DCT-III).
+  @param[in]     S     points to an instance of the Q15 DCT structure.
+  @param[in]     pSrc  points to the input buffer of N values
+  @param[out]    pDst  points to the output buffer of N values
+  @param[out]    pTmp  points to a temporary buffer of N values
+
+  @par           Scaling and Overflow Behavior
+                   The output is not scaled. The inverse of the output of
+                   \ref arm_dct2_q15 is the original sequence scaled down by N.
+ */
+ARM_DSP_ATTRIBUTE void arm_idct2_q15(
+  const arm_dct_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        q15_t * pTmp)
+{
+  const uint32_t N = S->N;
+  const uint32_t M = N >> 1U;
+  const q15_t *pT = S->pTwiddleDct2;
+  const q15_t *pW = S->pTwiddleRfft;
+  q31_t vr, vi, ur, ui, er, ei, dr, di, odr, odi;
+  q15_t a, b, c, s;
+  uint32_t n, k;
+
+  /* V[0] = X[0] and V[N/2] = sqrt(2) X[N/2] are real */
+  a = pSrc[0];
+  b = pSrc[M];
+  pTmp[0] = (q15_t) __SSAT((((q31_t) a << 14) + (q31_t) b * 0x5A82) >> 15, 16);
+  pTmp[1] = (q15_t) __SSAT((((q31_t) a << 14) - (q31_t) b * 0x5A82) >> 15, 16);
+
+  for (k = 1U; k < M; k++)
+  {
+    /* V[k] = (X[k] - i X[N - k]) exp(i pi k / 2N) */
+    c = pT[2U * k];
+    s = pT[2U * k + 1U];
+    a = pSrc[k];
+    b = pSrc[N - k];
+    vr = ((q31_t) a * c + (q31_t) b * s) >> 15;
+    vi = ((q31_t) a * s - (q31_t) b * c) >> 15;
+
+    /* V[N/2 - k] */
+    c = pT[2U * (M - k)];
+    s = pT[2U * (M - k) + 1U];
+    a = pSrc[M - k];
+    b = pSrc[M + k];
+    ur = ((q31_t) a * c + (q31_t) b * s) >> 15;
+    ui = ((q31_t) a * s - (q31_t) b * c) >> 15;
+
+    /* E = (V[k] + conj(V[N/2 - k])) / 2 and O = (V[k] - conj(V[N/2 - k])) exp(2 i pi k / N) / 2 */
+    er = (vr + ur) >> 1;
+    ei = (vi - ui) >> 1;
+    dr = (vr - ur) >> 1;
+    di = (vi + ui) >> 1;
+    odr = (dr * pW[2U * k] - di * pW[2U * k + 1U]) >> 15;
+    odi = (dr * pW[2U * k + 1U] + di * pW[2U * k]) >> 15;
+
+    /* Z[k] = E + i O */
+    pTmp[2U * k] = (q15_t) __SSAT(er - odi, 16);
+    pTmp[2U * k + 1U] = (q15_t) __SSAT(ei + odr, 16);
+  }
+
+  arm_cfft_q15(&S->cfft, pTmp, 1, 1);
+
+  /* Even samples followed by the odd samples in reverse order */
+  for (n = 0U; n < M; n++)
+  {
+    pDst[2U * n] = pTmp[n];
+    pDst[2U * n + 1U] = pTmp[N - 1U - n];
+  }
+}
+
+/**
+  @} end of DCT group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
@@ -0,0 +1,245 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mdct_f32.c
+ * Description:  Floating-point MDCT and inverse MDCT
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/transform_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup MDCT MDCT
+
+  The modified discrete cosine transform (MDCT) of a frame of 2N windowed
+  samples z[n] = w[n] x[n] is
+  <pre>
+      X[k] = sum_{n=0}^{2N-1} z[n] cos(pi / N (n + 1/2 + N/2) (k + 1/2))
+  </pre>
+  for k = 0 to N-1. Consecutive frames overlap by N samples.
+
+  The inverse MDCT of a frame is windowed and added to the second
+  half of the previous inverse frame. With a window verifying
+  <pre>
+      w[n] = w[2N-1-n] and w[n]^2 + w[n+N]^2 = 1
+  </pre>
+  like the sine window w[n] = sin(pi (n + 1/2) / (2N)), the time domain
+  aliasing cancels and the input signal is reconstructed with a delay of N samples.
+
+  @par           Frames
+                   Each call to \ref arm_mdct_f32 takes the N new samples of a frame.
+                   The N previous samples are kept in the state of the instance.
+                   Each call to \ref arm_imdct_f32 takes the N coefficients of a
+                   frame and returns the N samples which are complete after
+                   the overlap-add. The second half of the inverse frame is
+                   kept in the state of the instance.
+                   As a consequence, the MDCT and the inverse MDCT must use different instances.
+
+  @par           Algorithm
+                   The windowed frame (a, b, c, d) made of 4 blocks of N/2 samples
+                   is folded into (-c_r - d, a - b_r) where _r is the reverse order.
+                   The MDCT is the DCT-IV of length N of this sequence. The DCT-IV is computed
+                   with a complex FFT of length N/2 with a rotation before and after the FFT.
+                   The inverse DCT-IV gives back the folded sequence (u1, u2) which is unfolded
+                   into (u2, -u2_r, -u1_r, -u1) before the windowing.
+                   All the steps are done in the destination buffer so that
+                   no temporary buffer is needed.
+
+  @par           Q31
+                   The MDCT is scaled down by N: the output of \ref arm_mdct_q31 is X[k] / N.
+                   The inverse MDCT is not scaled. As a consequence, the reconstructed
+                   signal is x[n] / N like with the RFFT and RIFFT.
+
+  @par           Buffers
+                   The source and destination buffers of the MDCT must be different.
+                   The inverse MDCT can be computed in place.
+
+  @par           Neon
+                   The MDCT is not available with the Neon FFT instances.
+ */
+
+/**
+  @addtogroup MDCT
+  @{
+ */
+
+__STATIC_FORCEINLINE void arm_mdct_dct4_f32(
+  const arm_mdct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+  const float32_t scale)
+{
+  const uint32_t N = S->N;
+  const uint32_t M = N >> 1U;
+  const float32_t *pPre = S->pTwiddlePre;
+  const float32_t *pPost = S->pTwiddlePost;
+  float32_t re1, im1, re2, im2, c1, s1, c2, s2;
+  uint32_t n, m;
+
+  /* (x[2n] + i x[N - 1 - 2n]) exp(-i pi (4n + 1) / 4N).
+     The iterations n and M - 1 - n read and write the same 4 values
+     so they are done together and pSrc can be pDst. */
+  for (n = 0U; n < (M >> 1U); n++)
+  {
+    m = M - 1U - n;
+    c1 = pPre[2U * n];
+    s1 = pPre[2U * n + 1U];
+    c2 = pPre[2U * m];
+    s2 = pPre[2U * m + 1U];
+    re1 = pSrc[2U * n];
+    im1 = pSrc[N - 1U - 2U * n];
+    re2 = pSrc[2U * m];
+    im2 = pSrc[N - 1U - 2U * m];
+
+    pDst[2U * n] = re1 * c1 + im1 * s1;
+    pDst[2U * n + 1U] = im1 * c1 - re1 * s1;
+    pDst[2U * m] = re2 * c2 + im2 * s2;
+    pDst[2U * m + 1U] = im2 * c2 - re2 * s2;
+  }
+
+  arm_cfft_f32(&S->cfft, pDst, 0, 1);
+
+  /* Y[k] = Z[k] exp(-i pi k / N), X[2k] = Re(Y[k]) and X[N - 1 - 2k] = -Im(Y[k]).
+     The iterations k and M - 1 - k are done together to work in place. */
+  for (n = 0U; n < (M >> 1U); n++)
+  {
+    m = M - 1U - n;
+    c1 = pPost[2U * n];
+    s1 = pPost[2U * n + 1U];
+    c2 = pPost[2U * m];
+    s2 = pPost[2U * m + 1U];
+    re1 = pDst[2U * n];
+    im1 = pDst[2U * n + 1U];
+    re2 = pDst[2U * m];
+    im2 = pDst[2U * m + 1U];
+
+    pDst[2U * n] = scale * (re1 * c1 + im1 * s1);
+    pDst[N - 1U - 2U * n] = scale * (re1 * s1 - im1 * c1);
+    pDst[2U * m] = scale * (re2 * c2 + im2 * s2);
+    pDst[N - 1U - 2U * m] = scale * (re2 * s2 - im2 * c2);
+  }
+}
+
+/**
+  @brief         Floating-point MDCT of a frame.
+  @param[in,out] S     points to an instance of the floating-point MDCT structure.
+  @param[in]     pSrc  points to the N new samples
+  @param[out]    pDst  points to the N MDCT coefficients
+
+  @par           Details
+                   The frame is made of the N samples of the previous call
+                   (zeros after the initialization) followed by the N new samples.
+ */
+ARM_DSP_ATTRIBUTE void arm_mdct_f32(
+  arm_mdct_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  const uint32_t N = S->N;
+  const uint32_t M = N >> 1U;
+  const float32_t *pW = S->pWindow;
+  float32_t *pState = S->pState;
+  uint32_t n;
+
+  /* Folding of the windowed frame (a, b, c, d) into (-c_r - d, a - b_r).
+     (a, b) is the state and (c, d) are the new samples. */
+  for (n = 0U; n < M; n++)
+  {
+    pDst[n] = -(pW[3U * M - 1U - n] * pSrc[M - 1U - n] + pW[3U * M + n] * pSrc[M + n]);
+    pDst[M + n] = pW[n] * pState[n] - pW[N - 1U - n] * pState[N - 1U - n];
+  }
+
+  /* The new samples are the first half of the next frame */
+  memcpy(pState, pSrc, N * sizeof(float32_t));
+
+  arm_mdct_dct4_f32(S, pDst, pDst, 1.0f);
+}
+
+/**
+  @brief         Floating-point inverse MDCT of a frame with overlap-add.
+  @param[in,out] S     points to an instance of the floating-point MDCT structure.
+  @param[in]     pSrc  points to the N MDCT coefficients
+  @param[out]    pDst  points to the N reconstructed samples
+
+  @par           Details
+                   The output samples are the first half of the windowed inverse frame
+                   added to the second half of the previous one. With a window verifying
+                   the Princen-Bradley condition, they are the input samples of the
+                   MDCT delayed by N.
+ */
+ARM_DSP_ATTRIBUTE void arm_imdct_f32(
+  arm_mdct_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  const uint32_t N = S->N;
+  const uint32_t M = N >> 1U;
+  const float32_t *pW = S->pWindow;
+  float32_t *pState = S->pState;
+  float32_t ua, ub, uc, ud;
+  uint32_t ia, ib, ic, id;
+  uint32_t n;
+
+  /* Inverse DCT-IV : folded sequence (u1, u2) */
+  arm_mdct_dct4_f32(S, pSrc, pDst, 2.0f / (float32_t) N);
+
+  /* Unfolding into (u2, -u2_r, -u1_r, -u1), windowing and overlap-add.
+     The outputs and states at n, M - 1 - n, M + n and N - 1 - n only
+     depend on the values of u at the same positions. */
+  for (n = 0U; n < (M >> 1U); n++)
+  {
+    ia = n;
+    ib = M - 1U - n;
+    ic = M + n;
+    id = N - 1U - n;
+
+    ua = pDst[ia];
+    ub = pDst[ib];
+    uc = pDst[ic];
+    ud = pDst[id];
+
+    pDst[ia] = pState[ia] + pW[ia] * uc;
+    pDst[ib] = pState[ib] + pW[ib] * ud;
+    pDst[ic] = pState[ic] - pW[ic] * ud;
+    pDst[id] = pState[id] - pW[id] * uc;
+
+    pState[ia] = -pW[N + ia] * ub;
+    pState[ib] = -pW[N + ib] * ua;
+    pState[ic] = -pW[N + ic] * ua;
+    pState[id] = -pW[N + id] * ub;
+  }
+}
+
+/**
+  @} end of MDCT group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mdct_init_f32.c
+ * Description:  Initialization function for the floating-point MDCT
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/transform_functions.h"
+#include "arm_sincos.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup MDCT
+ */
+
+/**
+  @addtogroup MDCT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point MDCT.
+  @param[out]    S         points to an instance of the floating-point MDCT structure.
+  @param[in]     N         number of MDCT coefficients.
+  @param[in]     pWindow   points to the window of 2*N values.
+  @param[out]    pState    points to the state buffer of N values.
+  @param[out]    pTwiddle  points to a buffer of 2*N values for the rotation tables.
+                           It must be kept as long as the instance is used.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : N is not a supported length
+
+  @par           Details
+                   N must be a power of 2 from 32 to 8192 (twice the lengths supported
+                   by \ref arm_cfft_init_f32).
+                   The state buffer is cleared. An instance is used either
+                   for the MDCT or for the inverse MDCT since the state has a
+                   different meaning for each of them.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mdct_init_f32(
+  arm_mdct_instance_f32 * S,
+  uint16_t N,
+  const float32_t * pWindow,
+  float32_t * pState,
+  float32_t * pTwiddle)
+{
+  const uint32_t M = (uint32_t) N >> 1U;
+  float32_t *pPre = pTwiddle;
+  float32_t *pPost = pTwiddle + N;
+  float32_t s, c;
+  uint32_t k;
+  arm_status status;
+
+  if (N & 1U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_cfft_init_f32(&S->cfft, (uint16_t) M);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->N = N;
+  S->pWindow = pWindow;
+  S->pState = pState;
+  S->pTwiddlePre = pPre;
+  S->pTwiddlePost = pPost;
+
+  for (k = 0U; k < M; k++)
+  {
+    /* pi (4 k + 1) / (4 N) */
+    arm_sincos_core_f32(PI * (float32_t) (4U * k + 1U) / (float32_t) (4U * N), &s, &c);
+    pPre[2U * k] = c;
+    pPre[2U * k + 1U] = s;
+
+    /* pi k / N */
+    arm_sincos_core_f32(PI * (float32_t) k / (float32_t) N, &s, &c);
+    pPost[2U * k] = c;
+    pPost[2U * k + 1U] = s;
+  }
+
+  memset(pState, 0, N * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MDCT group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
@@ -0,0 +1,208 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mdct_q31.c
+ * Description:  Q31 MDCT and inverse MDCT
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arm_compiler_specific.h"
+
+#include "dsp/transform_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup MDCT
+ */
+
+/**
+  @addtogroup MDCT
+  @{
+ */
+
+/* The rotations are not scaled and the CFFT is scaled down by N/2.
+   The result is the DCT-IV scaled by 2/N which is the inverse DCT-IV. */
+__STATIC_FORCEINLINE void arm_mdct_dct4_q31(
+  const arm_mdct_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst)
+{
+  const uint32_t N = S->N;
+  const uint32_t M = N >> 1U;
+  const q31_t *pPre = S->pTwiddlePre;
+  const q31_t *pPost = S->pTwiddlePost;
+  q31_t re1, im1, re2, im2, c1, s1, c2, s2;
+  uint32_t n, m;
+
+  /* (x[2n] + i x[N - 1 - 2n]) exp(-i pi (4n + 1) / 4N).
+     The iterations n and M - 1 - n read and write the same 4 values
+     so they are done together and pSrc can be pDst. */
+  for (n = 0U; n < (M >> 1U); n++)
+  {
+    m = M - 1U - n;
+    c1 = pPre[2U * n];
+    s1 = pPre[2U * n + 1U];
+    c2 = pPre[2U * m];
+    s2 = pPre[2U * m + 1U];
+    re1 = pSrc[2U * n];
+    im1 = pSrc[N - 1U - 2U * n];
+    re2 = pSrc[2U * m];
+    im2 = pSrc[N - 1U - 2U * m];
+
+    pDst[2U * n] = clip_q63_to_q31(((q63_t) re1 * c1 + (q63_t) im1 * s1) >> 31);
+    pDst[2U * n + 1U] = clip_q63_to_q31(((q63_t) im1 * c1 - (q63_t) re1 * s1) >> 31);
+    pDst[2U * m] = clip_q63_to_q31(((q63_t) re2 * c2 + (q63_t) im2 * s2) >> 31);
+    pDst[2U * m + 1U] = clip_q63_to_q31(((q63_t) im2 * c2 - (q63_t) re2 * s2) >> 31);
+  }
+
+  arm_cfft_q31(&S->cfft, pDst, 0, 1);
+
+  /* Y[k] = Z[k] exp(-i pi k / N), X[2k] = Re(Y[k]) and X[N - 1 - 2k] = -Im(Y[k]).
+     The iterations k and M - 1 - k are done together to work in place. */
+  for (n = 0U; n < (M >> 1U); n++)
+  {
+    m = M - 1U - n;
+    c1 = pPost[2U * n];
+    s1 = pPost[2U * n + 1U];
+    c2 = pPost[2U * m];
+    s2 = pPost[2U * m + 1U];
+    re1 = pDst[2U * n];
+    im1 = pDst[2U * n + 1U];
+    re2 = pDst[2U * m];
+    im2 = pDst[2U * m + 1U];
+
+    pDst[2U * n] = clip_q63_to_q31(((q63_t) re1 * c1 + (q63_t) im1 * s1) >> 31);
+    pDst[N - 1U - 2U * n] = clip_q63_to_q31(((q63_t) re1 * s1 - (q63_t) im1 * c1) >> 31);
+    pDst[2U * m] = clip_q63_to_q31(((q63_t) re2 * c2 + (q63_t) im2 * s2) >> 31);
+    pDst[N - 1U - 2U * m] = clip_q63_to_q31(((q63_t) re2 * s2 - (q63_t) im2 * c2) >> 31);
+  }
+}
+
+/**
+  @brief         Q31 MDCT of a frame.
+  @param[in,out] S     points to an instance of the Q31 MDCT structure.
+  @param[in]     pSrc  points to the N new samples
+  @param[out]    pDst  points to the N MDCT coefficients
+
+  @par           Details
+                   The frame is made of the N samples of the previous call
+                   (zeros after the initialization) followed by the N new samples.
+
+  @par           Scaling and Overflow Behavior
+                   The output is the MDCT scaled down by N.
+ */
+ARM_DSP_ATTRIBUTE void arm_mdct_q31(
+  arm_mdct_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  const uint32_t N = S->N;
+  const uint32_t M = N >> 1U;
+  const q31_t *pW = S->pWindow;
+  q31_t *pState = S->pState;
+  uint32_t n;
+
+  /* Folding of the windowed frame (a, b, c, d) into (-c_r - d, a - b_r)
+     scaled down by 2. (a, b) is the state and (c, d) are the new samples. */
+  for (n = 0U; n < M; n++)
+  {
+    pDst[n] = clip_q63_to_q31(-(((q63_t) pW[3U * M - 1U - n] * pSrc[M - 1U - n]
+                               + (q63_t) pW[3U * M + n] * pSrc[M + n]) >> 32));
+    pDst[M + n] = clip_q63_to_q31(((q63_t) pW[n] * pState[n]
+                                 - (q63_t) pW[N - 1U - n] * pState[N - 1U - n]) >> 32);
+  }
+
+  /* The new samples are the first half of the next frame */
+  memcpy(pState, pSrc, N * sizeof(q31_t));
+
+  /* The folded sequence is scaled down by 2 and the DCT-IV by N/2 */
+  arm_mdct_dct4_q31(S, pDst, pDst);
+}
+
+/**
+  @brief         Q31 inverse MDCT of a frame with overlap-add.
+  @param[in,out] S     points to an instance of the Q31 MDCT structure.
+  @param[in]     pSrc  points to the N MDCT coefficients
+  @param[out]    pDst  points to the N reconstructed samples
+
+  @par           Details
+                   The output samples are the first half of the windowed inverse frame
+                   added to the second half of the previous one. With a window verifying
+                   the Princen-Bradley condition, they are the input samples of the
+                   MDCT delayed by N.
+
+  @par           Scaling and Overflow Behavior
+                   The output is not scaled. The inverse of the output of
+                   \ref arm_mdct_q31 is the original signal scaled down by N.
+                   The input must be the output of the MDCT or be small enough
+                   to avoid saturations.
+ */
+ARM_DSP_ATTRIBUTE void arm_imdct_q31(
+  arm_mdct_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  const uint32_t N = S->N;
+  const uint32_t M = N >> 1U;
+  const q31_t *pW = S->pWindow;
+  q31_t *pState = S->pState;
+  q31_t ua, ub, uc, ud;
+  uint32_t ia, ib, ic, id;
+  uint32_t n;
+
+  /* Inverse DCT-IV : folded sequence (u1, u2) */
+  arm_mdct_dct4_q31(S, pSrc, pDst);
+
+  /* Unfolding into (u2, -u2_r, -u1_r, -u1), windowing and overlap-add.
+     The outputs and states at n, M - 1 - n, M + n and N - 1 - n only
+     depend on the values of u at the same positions. */
+  for (n = 0U; n < (M >> 1U); n++)
+  {
+    ia = n;
+    ib = M - 1U - n;
+    ic = M + n;
+    id = N - 1U - n;
+
+    ua = pDst[ia];
+    ub = pDst[ib];
+    uc = pDst[ic];
+    ud = pDst[id];
+
+    pDst[ia] = __QADD(pState[ia], (q31_t) (((q63_t) pW[ia] * uc) >> 31));
+    pDst[ib] = __QADD(pState[ib], (q31_t) (((q63_t) pW[ib] * ud) >> 31));
+    pDst[ic] = __QSUB(pState[ic], (q31_t) (((q63_t) pW[ic] * ud) >> 31));
+    pDst[id] = __QSUB(pState[id], (q31_t) (((q63_t) pW[id] * uc) >> 31));
+
+    pState[ia] = (q31_t) (-((q63_t) pW[N + ia] * ub) >> 31);
+    pState[ib] = (q31_t) (-((q63_t) pW[N + ib] * ua) >> 31);
+    pState[ic] = (q31_t) (-((q63_t) pW[N + ic] * ua) >> 31);
+    pState[id] = (q31_t) (-((q63_t) pW[N + id] * ub) >> 31);
+  }
+}
+
+/**
+  @} end of MDCT group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
@@ -0,0 +1,30 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/controller_functions.h"
+
+class ControllerTestsF32:public Client::Suite
+    {
+        public:
+            ControllerTestsF32(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "ControllerTestsF32_decl.h"
+
+            Client::Pattern<float32_t> inputs;
+            Client::Pattern<float32_t> gains;
+            Client::Pattern<float32_t> limits;
+            Client::Pattern<float32_t> currents;
+            Client::Pattern<float32_t> angles;
+
+            Client::LocalPattern<float32_t> output;
+            Client::LocalPattern<float32_t> ref;
+            Client::LocalPattern<float32_t> sinCos;
+
+            uint32_t numControllers;
+            uint32_t nbSteps;
+
+            uint32_t nbSamples;
+
+    };
@@ -0,0 +1,25 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/controller_functions.h"
+
+class ControllerTestsQ15:public Client::Suite
+    {
+        public:
+            ControllerTestsQ15(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "ControllerTestsQ15_decl.h"
+
+            Client::Pattern<q15_t> inputs;
+            Client::Pattern<q15_t> gains;
+            Client::Pattern<q15_t> limits;
+
+            Client::LocalPattern<q15_t> output;
+            Client::LocalPattern<q15_t> ref;
+
+            uint32_t numControllers;
+            uint32_t nbSteps;
+
+    };
@@ -0,0 +1,30 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/controller_functions.h"
+
+class ControllerTestsQ31:public Client::Suite
+    {
+        public:
+            ControllerTestsQ31(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "ControllerTestsQ31_decl.h"
+
+            Client::Pattern<q31_t> inputs;
+            Client::Pattern<q31_t> gains;
+            Client::Pattern<q31_t> limits;
+            Client::Pattern<q31_t> currents;
+            Client::Pattern<q31_t> angles;
+
+            Client::LocalPattern<q31_t> output;
+            Client::LocalPattern<q31_t> ref;
+            Client::LocalPattern<q31_t> sinCos;
+
+            uint32_t numControllers;
+            uint32_t nbSteps;
+
+            uint32_t nbSamples;
+
+    };
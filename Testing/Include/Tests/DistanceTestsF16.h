@@ -19,12 +19,17 @@ class DistanceTestsF16:public Client::Suite
             Client::LocalPattern<float16_t> output;
             Client::LocalPattern<float16_t> tmpA;
             Client::LocalPattern<float16_t> tmpB;
+            Client::LocalPattern<uint32_t> outIndex;
 
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<float16_t> ref;
+            Client::RefPattern<uint32_t> refIndex;
 
             int vecDim;
             int nbPatterns;
 
+            int nbReferences;
+            int knnK;
+
 
     };
@@ -22,10 +22,12 @@ class DistanceTestsF32:public Client::Suite
             Client::LocalPattern<q7_t> tmpC;
 
             Client::LocalPattern<int16_t> outPath;
+            Client::LocalPattern<uint32_t> outIndex;
 
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<float32_t> ref;
             Client::RefPattern<int16_t> refPath;
+            Client::RefPattern<uint32_t> refIndex;
 
             int vecDim;
             int nbPatterns;
@@ -33,5 +35,7 @@ class DistanceTestsF32:public Client::Suite
             int queryLength;
             int templateLength;
 
+            arm_cdist_metric cdistMetric;
+
 
     };
@@ -0,0 +1,31 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/distance_functions.h"
+
+class DistanceTestsQ15:public Client::Suite
+    {
+        public:
+            DistanceTestsQ15(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "DistanceTestsQ15_decl.h"
+            
+            Client::Pattern<q15_t> inputA;
+            Client::Pattern<q15_t> inputB;
+            Client::Pattern<int16_t> dims;
+
+            Client::LocalPattern<q63_t> output;
+            Client::LocalPattern<uint32_t> outIndex;
+
+            // Reference patterns are not loaded when we are in dump mode
+            Client::RefPattern<q63_t> ref;
+            Client::RefPattern<uint32_t> refIndex;
+
+            int vecDim;
+            int nbPatterns;
+            int nbReferences;
+            int knnK;
+
+    };
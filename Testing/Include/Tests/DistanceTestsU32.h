@@ -17,6 +17,7 @@ class DistanceTestsU32:public Client::Suite
             Client::Pattern<int16_t> dims;
 
             Client::LocalPattern<float32_t> output;
+            Client::LocalPattern<float32_t> tmp;
 
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<float32_t> ref;
@@ -25,4 +26,6 @@ class DistanceTestsU32:public Client::Suite
             int bitVecDim;
             int nbPatterns;
 
+            arm_cdist_boolean_metric cdistMetric;
+
     };
@@ -15,9 +15,12 @@ class FastMathF32:public Client::Suite
             Client::Pattern<float32_t> input;
 
             Client::LocalPattern<float32_t> output;
+            Client::LocalPattern<float32_t> cosOutput;
+            Client::LocalPattern<float32_t> xInput;
 
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<float32_t> ref;
+            Client::RefPattern<float32_t> cosRef;
 
            
     };
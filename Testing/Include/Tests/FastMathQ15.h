@@ -19,10 +19,13 @@ class FastMathQ15:public Client::Suite
 
 
             Client::LocalPattern<q15_t> output;
+            Client::LocalPattern<q15_t> cosOutput;
+            Client::LocalPattern<q15_t> xInput;
             Client::LocalPattern<int16_t> shift;
 
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<q15_t> ref;
+            Client::RefPattern<q15_t> cosRef;
             Client::RefPattern<int16_t> refShift;
 
            
@@ -20,11 +20,14 @@ class FastMathQ31:public Client::Suite
 
 
             Client::LocalPattern<q31_t> output;
+            Client::LocalPattern<q31_t> cosOutput;
+            Client::LocalPattern<q31_t> xInput;
             Client::LocalPattern<int16_t> shift;
 
 
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<q31_t> ref;
+            Client::RefPattern<q31_t> cosRef;
             Client::RefPattern<int16_t> refShift;
 
 
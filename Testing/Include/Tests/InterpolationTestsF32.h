@@ -16,6 +16,7 @@ class InterpolationTestsF32:public Client::Suite
             Client::Pattern<float32_t> y;
             Client::Pattern<int16_t> config;
             Client::LocalPattern<float32_t> output;
+            Client::LocalPattern<float32_t> coords;
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<float32_t> ref;
 
@@ -29,5 +30,6 @@ class InterpolationTestsF32:public Client::Suite
 
             Client::LocalPattern<float32_t> buffer;
             Client::LocalPattern<float32_t> splineCoefs;
+            Client::LocalPattern<uint32_t> buckets;
 
     };
@@ -17,6 +17,7 @@ class InterpolationTestsQ15:public Client::Suite
             Client::Pattern<q15_t> y;
             Client::Pattern<int16_t> config;
             Client::LocalPattern<q15_t> output;
+            Client::LocalPattern<q31_t> coords;
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<q15_t> ref;
 
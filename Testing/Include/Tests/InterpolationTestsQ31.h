@@ -16,6 +16,7 @@ class InterpolationTestsQ31:public Client::Suite
             Client::Pattern<q31_t> y;
             Client::Pattern<int16_t> config;
             Client::LocalPattern<q31_t> output;
+            Client::LocalPattern<q31_t> coords;
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<q31_t> ref;
 
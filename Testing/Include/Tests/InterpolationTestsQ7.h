@@ -16,6 +16,7 @@ class InterpolationTestsQ7:public Client::Suite
             Client::Pattern<q7_t> y;
             Client::Pattern<int16_t> config;
             Client::LocalPattern<q7_t> output;
+            Client::LocalPattern<q31_t> coords;
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<q7_t> ref;
 
@@ -18,6 +18,18 @@ class TransformRF32:public Client::Suite
             Client::LocalPattern<float32_t> inputchanged;
 
             Client::RefPattern<float32_t> ref;
+            Client::RefPattern<float32_t> refdst;
+            Client::LocalPattern<float32_t> outputinv;
+            Client::LocalPattern<float32_t> twiddle;
+            Client::Pattern<float32_t> window;
+            Client::LocalPattern<float32_t> state;
+            Client::LocalPattern<float32_t> stateinv;
+
+#if !defined(ARM_MATH_NEON)
+            arm_dct_instance_f32 instDctF32;
+            arm_mdct_instance_f32 instMdctF32;
+            arm_mdct_instance_f32 instIMdctF32;
+#endif
 
             arm_rfft_fast_instance_f32 instRfftF32;
 
@@ -19,6 +19,12 @@ class TransformRQ15:public Client::Suite
             Client::LocalPattern<q15_t> tmp2;
 
             Client::RefPattern<q15_t> ref;
+            Client::LocalPattern<q15_t> outputinv;
+            Client::LocalPattern<q15_t> twiddle;
+
+#if !defined(ARM_MATH_NEON)
+            arm_dct_instance_q15 instDctQ15;
+#endif
 
             arm_rfft_instance_q15 instRfftQ15;
 
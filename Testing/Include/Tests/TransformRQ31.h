@@ -19,6 +19,17 @@ class TransformRQ31:public Client::Suite
             Client::LocalPattern<q31_t> tmp2;
 
             Client::RefPattern<q31_t> ref;
+            Client::LocalPattern<q31_t> outputinv;
+            Client::LocalPattern<q31_t> twiddle;
+            Client::Pattern<q31_t> window;
+            Client::LocalPattern<q31_t> state;
+            Client::LocalPattern<q31_t> stateinv;
+
+#if !defined(ARM_MATH_NEON)
+            arm_dct_instance_q31 instDctQ31;
+            arm_mdct_instance_q31 instMdctQ31;
+            arm_mdct_instance_q31 instIMdctQ31;
+#endif
 
             arm_rfft_instance_q31 instRfftQ31;
 
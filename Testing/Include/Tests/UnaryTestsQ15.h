@@ -22,6 +22,7 @@ class UnaryTestsQ15:public Client::Suite
             */
             Client::LocalPattern<q15_t> a;
             Client::LocalPattern<q15_t> b;
+            Client::LocalPattern<q15_t> c;
 
             int nbr;
             int nbc;
@@ -22,6 +22,7 @@ class UnaryTestsQ31:public Client::Suite
             */
             Client::LocalPattern<q31_t> a;
             Client::LocalPattern<q31_t> b;
+            Client::LocalPattern<q31_t> c;
 
             int nbr;
             int nbc;
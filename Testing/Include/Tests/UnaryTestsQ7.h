@@ -22,6 +22,7 @@ class UnaryTestsQ7:public Client::Suite
             */
             Client::LocalPattern<q7_t> a;
             Client::LocalPattern<q7_t> b;
+            Client::LocalPattern<q7_t> c;
 
             int nbr;
             int nbc;
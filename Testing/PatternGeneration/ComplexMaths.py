@@ -99,6 +99,18 @@ def writeTests(config,format):
         config.writeReferenceQ31(9, asReal(ref))
     else:
         config.writeReference(9, asReal(ref))
+
+    # NCO and mixer. The frequency and phase are exactly
+    # representable in all the formats.
+    if format in [0,31,15]:
+       freq = 17.0 / 256
+       phase = 3.0 / 64
+       nco = np.exp(2j*np.pi*(phase + freq*np.arange(NBSAMPLES)))
+
+       # Fixed-point outputs are saturated by the conversion
+       ref = data1 * nco
+       config.writeReference(10, asReal(ref))
+       config.writeReference(11, asReal(nco))
     
 def  generatePatterns():
      PATTERNDIR = os.path.join("Patterns","DSP","ComplexMaths","ComplexMaths")
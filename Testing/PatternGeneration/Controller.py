@@ -16,6 +16,58 @@ def writeTests(config):
     samples = Tools.normalize(samples)
     config.writeInput(1, samples,"Samples")
 
+# Bank of PID controllers.
+# The error has a constant offset so that the integral
+# terms wind up and the outputs reach the limits.
+# Some controllers have gains saturating A0 and A1.
+NBCONTROLLERS=11
+NBSTEPS=23
+
+def writeBankTests(config,maxOutput):
+    kp=np.random.uniform(0.0,0.6,NBCONTROLLERS)
+    ki=np.random.uniform(0.05,0.3,NBCONTROLLERS)
+    kd=np.random.uniform(0.0,0.3,NBCONTROLLERS)
+    kp[3]=0.6
+    ki[3]=0.3
+    kd[3]=0.3
+    kp[10]=0.7
+    ki[10]=0.4
+    kd[10]=0.2
+
+    offsets=np.where(np.arange(NBCONTROLLERS) % 2 == 0,0.5,-0.5)
+    noise=Tools.normalize(np.random.randn(NBSTEPS,NBCONTROLLERS))
+    errors=offsets + 0.4*noise
+
+    # Without limits and saturations, y[n] = A0 S[n] + A1 S[n-1] + A2 S[n-2]
+    # where S is the cumulative sum of the errors
+    a0=np.minimum(kp+ki+kd,1.0)
+    a1=-np.minimum(kp+2*kd,1.0)
+    a2=kd
+    s=np.cumsum(errors,axis=0)
+    s1=np.vstack([np.zeros(NBCONTROLLERS),s[:-1]])
+    s2=np.vstack([np.zeros((2,NBCONTROLLERS)),s[:-2]])
+    y=a0*s + a1*s1 + a2*s2
+    errors = errors * min(maxOutput / np.max(np.abs(y)),1.0)
+
+    config.writeInput(1, errors.reshape(-1),"BankInputs")
+    config.writeInput(1, np.hstack([kp,ki,kd]),"Gains")
+
+    minLimits=-np.random.uniform(0.2,0.4,NBCONTROLLERS)
+    maxLimits=np.random.uniform(0.2,0.4,NBCONTROLLERS)
+    config.writeInput(1, np.hstack([minLimits,maxLimits]),"Limits")
+
+
+# Block and fused Clarke and Park transforms.
+# The number of samples is not a multiple of the vector width.
+NBTRANSFORMSAMPLES=127
+
+def writeTransformTests(config,maxAngle):
+    currents=0.5*Tools.normalize(np.random.randn(2*NBTRANSFORMSAMPLES))
+    config.writeInput(1, currents,"Currents")
+
+    angles=np.random.uniform(-maxAngle,maxAngle,NBTRANSFORMSAMPLES)
+    config.writeInput(1, angles,"Angles")
+
     
 def generatePatterns():
     PATTERNDIR = os.path.join("Patterns","DSP","Controller","Controller")
@@ -32,6 +84,17 @@ def generatePatterns():
     writeTests(configq31)
     writeTests(configq15)
 
+    # The Q31 accumulator is not saturating : the outputs
+    # must stay in range without limits.
+    # The Q15 and F32 outputs are going out of range.
+    writeBankTests(configf32,2.0)
+    writeBankTests(configq31,0.5)
+    writeBankTests(configq15,2.0)
+
+    # Angles in radians for f32 and in [-1 1[ for q31
+    writeTransformTests(configf32,4.0*np.pi)
+    writeTransformTests(configq31,1.0)
+
 if __name__ == '__main__':
   generatePatterns()
 
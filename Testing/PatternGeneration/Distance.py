@@ -101,8 +101,63 @@ def writeDTW(config):
                 0.6170999383691333
                ]
     config.writeReference(10, references,"DTWRef")
+    # Band limited DTW without window constraint and with
+    # Sakoe-Chiba window 5
+    config.writeReference(11, references[0:2],"DTWBandRef")
     config.setOverwrite(False)
 
+KNN_K = 3
+
+def writeKNN(config,inputsA,inputsB,vecDim):
+    # Rows of A are the queries and rows of B the references
+    qa = np.array(inputsA).reshape(-1,vecDim)
+    rb = np.array(inputsB).reshape(-1,vecDim)
+    dists=[]
+    indices=[]
+    for q in qa:
+        d = np.sqrt(np.sum((rb - q)**2,axis=1))
+        i = np.argsort(d,kind='stable')[0:KNN_K]
+        dists += list(d[i])
+        indices += list(i)
+    config.writeReference(10, dists,"KnnDist")
+    config.writeReferenceU32(10, indices,"KnnIndex")
+
+KNN_NBQUERIES = 7
+KNN_NBREFS = 13
+KNN_VECDIM = 5
+KNN_GRID_K = 4
+
+def writeKNNGrid(config,squared=False):
+    # Samples are multiples of 1/8 so that the distances are exact
+    # in f16 and q15 and that there are many ties.
+    # Some references are duplicated to have ties with the same vector.
+    qa = np.random.randint(-8,8,size=(KNN_NBQUERIES,KNN_VECDIM))
+    rb = np.random.randint(-8,8,size=(KNN_NBREFS,KNN_VECDIM))
+    rb[7] = rb[2]
+    rb[11] = rb[5]
+    qa[3] = rb[5]
+    dists=[]
+    indices=[]
+    for q in qa:
+        # Squared distance in units of 1/64
+        d = np.sum((rb - q)**2,axis=1)
+        # Ties are ordered by index
+        i = np.argsort(d,kind='stable')[0:KNN_GRID_K]
+        if squared:
+           # 34.30 format
+           dists += [int(x) << 24 for x in d[i]]
+        else:
+           dists += list(np.sqrt(d[i]) / 8.0)
+        indices += list(i)
+    config.writeInputS16(12, [KNN_NBQUERIES,KNN_NBREFS,KNN_VECDIM,KNN_GRID_K],"KnnDims")
+    config.writeInput(12, list(qa.reshape(-1) / 8.0),"KnnQueries")
+    config.writeInput(12, list(rb.reshape(-1) / 8.0),"KnnRefs")
+    if squared:
+       config.writeReferenceS64(12, dists,"KnnDist")
+    else:
+       config.writeReference(12, dists,"KnnDist")
+    config.writeReferenceU32(12, indices,"KnnIndex")
+
 def writeFTest(config,funcList):
     dims=[] 
     dimsM=[]
@@ -156,6 +211,7 @@ def writeFTest(config,funcList):
     
     config.writeInput(1, inputsA,"InputA")
     config.writeInput(1, inputsB,"InputB")
+    writeKNN(config,inputsA,inputsB,vecDim)
     config.writeInput(8, inputsAJ,"InputA")
     config.writeInput(8, inputsBJ,"InputB")
     config.writeInputS16(1, dims,"Dims")
@@ -258,11 +314,13 @@ def  generatePatterns():
      configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
      configf16=Tools.Config(PATTERNDIR,PARAMDIR,"f16")
      configu32=Tools.Config(PATTERNDIR,PARAMDIR,"u32")
+     configq15=Tools.Config(PATTERNDIR,PARAMDIR,"q15")
      
      configf64.setOverwrite(False)
      configf32.setOverwrite(False)
      configf16.setOverwrite(False)
      configu32.setOverwrite(False)
+     configq15.setOverwrite(False)
 
 
      writeFTests(configf64)
@@ -270,6 +328,9 @@ def  generatePatterns():
      writeFTests(configf16)
      writeBTests(configu32)
 
+     writeKNNGrid(configf16)
+     writeKNNGrid(configq15,squared=True)
+
      writeFBenchmark(configf32)
      writeFBenchmark(configf16)
      writeUBenchmark(configu32)
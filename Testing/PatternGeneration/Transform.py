@@ -100,6 +100,56 @@ def writeTests(configs):
     for config,scaling in configs:
         config.writeInput(i, data1,"RealInputSamples" )
 
+
+DCTSIZES=[32,128,512]
+
+def writeDCTTests(configs):
+    i = 1
+    for nb in DCTSIZES:
+        sig = 0.9*Tools.normalize(noiseSignal(nb))
+        n = np.arange(nb)
+        k = n.reshape(-1,1)
+        dct2 = np.dot(np.cos(np.pi*(2*n+1)*k/(2*nb)),sig)
+        dct4 = np.dot(np.cos(np.pi*(2*n+1)*(2*k+1)/(4*nb)),sig)
+        dst2 = np.dot(np.sin(np.pi*(2*n+1)*(k+1)/(2*nb)),sig)
+        for config,scaled in configs:
+            config.writeInput(i, sig,"DCTInputSamples_%d_" % nb)
+            # Fixed-point forward transforms are scaled down by the length
+            if scaled:
+                config.writeInput(i, dct2/nb,"DCT2Samples_%d_" % nb)
+                config.writeInput(i, dct4/nb,"DCT4Samples_%d_" % nb)
+            else:
+                config.writeInput(i, dct2,"DCT2Samples_%d_" % nb)
+                config.writeInput(i, dct4,"DCT4Samples_%d_" % nb)
+                config.writeInput(i, dst2,"DST2Samples_%d_" % nb)
+        i = i + 1
+
+MDCTSIZES=[32,128,512]
+MDCTFRAMES=4
+
+def mdct(frame,nb):
+    n = np.arange(2*nb)
+    k = np.arange(nb).reshape(-1,1)
+    return np.dot(np.cos(np.pi/nb*(n+0.5+nb/2)*(k+0.5)),frame)
+
+def writeMDCTTests(configs):
+    i = 1
+    for nb in MDCTSIZES:
+        sig = 0.9*Tools.normalize(noiseSignal(MDCTFRAMES*nb))
+        # Sine window verifying the Princen-Bradley condition
+        window = np.sin(np.pi*(np.arange(2*nb)+0.5)/(2*nb))
+        # The first frame starts with nb zeros
+        padded = np.hstack([np.zeros(nb),sig])
+        coefs = np.hstack([mdct(window*padded[f*nb:(f+2)*nb],nb) for f in range(MDCTFRAMES)])
+        for config,scaled in configs:
+            config.writeInput(i, sig,"MDCTInputSamples_%d_" % nb)
+            config.writeInput(i, window,"MDCTWindow_%d_" % nb)
+            # The fixed-point MDCT is scaled down by the length
+            if scaled:
+                config.writeInput(i, coefs/nb,"MDCTSamples_%d_" % nb)
+            else:
+                config.writeInput(i, coefs,"MDCTSamples_%d_" % nb)
+        i = i + 1
    
 def generatePatterns():
     PATTERNDIR = os.path.join("Patterns","DSP","Transform","Transform")
@@ -119,6 +169,13 @@ def generatePatterns():
         ,(configq31,scalings)
         ,(configq15,scalings)])
 
+    writeDCTTests([(configf32,False)
+        ,(configq31,True)
+        ,(configq15,True)])
+
+    writeMDCTTests([(configf32,False)
+        ,(configq31,True)])
+
 
 
 
@@ -94,6 +94,16 @@ static int cholesky_offset(int d)
         arm_mat_ldlt_f32(&this->in1,&this->outll,&this->outd,(uint16_t*)outp);
     }
 
+    void UnaryF32::test_mat_cholesky_blocked_dpo_f32()
+    {
+        arm_mat_cholesky_blocked_f32(&this->in1,&this->out,ARM_MAT_DEFAULT_PANEL_SIZE);
+    }
+
+    void UnaryF32::test_ldlt_blocked_decomposition_f32()
+    {
+        arm_mat_ldlt_blocked_f32(&this->in1,&this->outll,&this->outd,(uint16_t*)outpp,ARM_MAT_DEFAULT_PANEL_SIZE);
+    }
+
     
     void UnaryF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
@@ -144,6 +154,7 @@ static int cholesky_offset(int d)
           break;
 
           case TEST_MAT_CHOLESKY_DPO_F32_8:
+          case TEST_MAT_CHOLESKY_BLOCKED_DPO_F32_12:
           {
             int offset=14;
             float32_t *p;
@@ -258,6 +269,7 @@ static int cholesky_offset(int d)
           break;
 
           case TEST_LDLT_DECOMPOSITION_F32_11:
+          case TEST_LDLT_BLOCKED_DECOMPOSITION_F32_13:
           {
              float32_t *p, *aPtr;
              
@@ -48,6 +48,11 @@ static int cholesky_offset(int d)
         arm_mat_cholesky_f64(&this->in1,&this->out);
     }
 
+    void UnaryF64::test_mat_cholesky_blocked_dpo_f64()
+    {
+        arm_mat_cholesky_blocked_f64(&this->in1,&this->out,ARM_MAT_DEFAULT_PANEL_SIZE);
+    }
+
     void UnaryF64::test_solve_upper_triangular_f64()
     {
         arm_mat_solve_upper_triangular_f64(&this->in1,&this->in2,&this->out);
@@ -86,6 +91,7 @@ static int cholesky_offset(int d)
           break;
 
           case TEST_MAT_CHOLESKY_DPO_F64_2:
+          case TEST_MAT_CHOLESKY_BLOCKED_DPO_F64_5:
           {
             int offset=14;
             float64_t *p;
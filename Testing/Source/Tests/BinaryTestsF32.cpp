@@ -16,6 +16,13 @@ a double precision computation.
 /* Upper bound of maximum matrix dimension used by Python */
 #define MAXMATRIXDIM 40
 
+/* Padding added to the rows of the strided test matrixes */
+#define STRIDEPAD 3
+
+/* Number of matrices of the batched tests. It is not a multiple
+   of the number of SIMD lanes to test the tail */
+#define BATCHSIZE 5
+
 static void checkInnerTail(float32_t *b)
 {
     ASSERT_TRUE(b[0] == 0);
@@ -121,6 +128,279 @@ static void checkInnerTail(float32_t *b)
     } 
 
 
+    void BinaryTestsF32::test_mat_mult_strided_f32()
+    {     
+      LOADDATA2();
+      arm_status status;
+      arm_matrix_strided_instance_f32 sa,sb,sout;
+      int r;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+          columns = *dimsp++;
+
+          /* Inputs are copied into larger matrixes so that they are
+             sub-blocks with a leading dimension bigger than their
+             number of columns */
+          memset(ap,0,sizeof(float32_t)*a.nbSamples());
+          memset(bp,0,sizeof(float32_t)*b.nbSamples());
+          for(r=0;r < rows; r++)
+          {
+             memcpy(ap + r*(internal+STRIDEPAD) + 1,inp1 + r*internal,sizeof(float32_t)*internal);
+          }
+          for(r=0;r < internal; r++)
+          {
+             memcpy(bp + r*(columns+STRIDEPAD) + 1,inp2 + r*columns,sizeof(float32_t)*columns);
+          }
+
+          arm_mat_strided_init_f32(&sa,rows,internal,internal+STRIDEPAD,ap + 1);
+          arm_mat_strided_init_f32(&sb,internal,columns,columns+STRIDEPAD,bp + 1);
+          arm_mat_strided_init_f32(&sout,rows,columns,columns,outp);
+
+          status=arm_mat_mult_strided_f32(&sa,&sb,&sout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+
+    } 
+
+
+    void BinaryTestsF32::test_mat_mult_large_f32()
+    {     
+      LOADDATA2();
+      arm_status status;
+      arm_matrix_instance_large_f32 la,lb,lout;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+          columns = *dimsp++;
+
+          memcpy((void*)ap,(const void*)inp1,sizeof(float32_t)*rows*internal);
+          memcpy((void*)bp,(const void*)inp2,sizeof(float32_t)*internal*columns);
+
+          arm_mat_init_large_f32(&la,rows,internal,ap);
+          arm_mat_init_large_f32(&lb,internal,columns,bp);
+          arm_mat_init_large_f32(&lout,rows,columns,outp);
+
+          status=arm_mat_mult_large_f32(&la,&lb,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+
+    } 
+
+
+    void BinaryTestsF32::test_mat_gemm_f32()
+    {     
+      LOADDATA2();
+      arm_status status;
+      int r,c;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+          columns = *dimsp++;
+
+          /* A is transposed before the call so that the product A.B
+             is computed as (A^t)^t . B */
+          for(r=0;r < rows; r++)
+          {
+             for(c=0;c < internal; c++)
+             {
+                ap[c*rows + r] = inp1[r*internal + c];
+             }
+          }
+          memcpy((void*)bp,(const void*)inp2,sizeof(float32_t)*internal*columns);
+
+          in1.numRows=internal;
+          in1.numCols=rows;
+          in1.pData = ap;
+
+          in2.numRows=internal;
+          in2.numCols=columns;
+          in2.pData = bp;
+
+          out.numRows=rows;
+          out.numCols=columns;
+          out.pData = outp;
+
+          /* Output is computed as 0.5 A.B + 0.5 A.B to test
+             the scaling and the accumulation */
+          status=arm_mat_gemm_f32(ARM_MAT_TRANS,ARM_MAT_NO_TRANS,0.5f,&this->in1,&this->in2,0.0f,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          status=arm_mat_gemm_f32(ARM_MAT_TRANS,ARM_MAT_NO_TRANS,0.5f,&this->in1,&this->in2,1.0f,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+
+    } 
+
+
+    void BinaryTestsF32::test_mat_gemm_trans_b_f32()
+    {     
+      LOADDATA2();
+      arm_status status;
+      const float32_t *refp=ref.ptr();
+      int r,c;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+          columns = *dimsp++;
+
+          /* B is transposed before the call so that the product A.B
+             is computed as A . (B^t)^t */
+          memcpy((void*)ap,(const void*)inp1,sizeof(float32_t)*rows*internal);
+          for(r=0;r < internal; r++)
+          {
+             for(c=0;c < columns; c++)
+             {
+                bp[c*internal + r] = inp2[r*columns + c];
+             }
+          }
+
+          in1.numRows=rows;
+          in1.numCols=internal;
+          in1.pData = ap;
+
+          in2.numRows=columns;
+          in2.numCols=internal;
+          in2.pData = bp;
+
+          out.numRows=rows;
+          out.numCols=columns;
+          out.pData = outp;
+
+          /* C is initialized with 2 A.B so that the output
+             1.5 A.B - 0.25 C is A.B */
+          for(r=0;r < rows*columns; r++)
+          {
+             outp[r] = 2.0f * refp[r];
+          }
+
+          status=arm_mat_gemm_f32(ARM_MAT_NO_TRANS,ARM_MAT_TRANS,1.5f,&this->in1,&this->in2,-0.25f,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+          refp += (rows * columns);
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+
+    } 
+
+    void BinaryTestsF32::test_mat_batch_mult_f32()
+    {     
+      LOADDATA2();
+      arm_status status;
+      arm_matrix_batch_instance_f32 ba,bb,bout;
+      float32_t *cp=ap + MAXMATRIXDIM*MAXMATRIXDIM;
+      float32_t scale;
+      int e,k;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+          columns = *dimsp++;
+
+          /* The matrix k of the batch is 2^k A. The scaling is
+             exact so all the products must be identical */
+          for(k=0;k < BATCHSIZE; k++)
+          {
+             scale = (float32_t)(1 << k);
+             for(e=0;e < rows*internal; e++)
+             {
+                ap[e*BATCHSIZE + k] = scale * inp1[e];
+             }
+             for(e=0;e < internal*columns; e++)
+             {
+                bp[e*BATCHSIZE + k] = inp2[e];
+             }
+          }
+
+          arm_mat_batch_init_f32(&ba,rows,internal,BATCHSIZE,ap);
+          arm_mat_batch_init_f32(&bb,internal,columns,BATCHSIZE,bp);
+          arm_mat_batch_init_f32(&bout,rows,columns,BATCHSIZE,cp);
+
+          status=arm_mat_batch_mult_f32(&ba,&bb,&bout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          out.numRows=rows;
+          out.numCols=columns;
+          out.pData = outp;
+
+          status=arm_mat_batch_get_f32(&bout,0,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          for(k=1;k < BATCHSIZE; k++)
+          {
+             scale = (float32_t)(1 << k);
+             for(e=0;e < rows*columns; e++)
+             {
+                ASSERT_TRUE(cp[e*BATCHSIZE + k] == scale * outp[e]);
+             }
+          }
+
+          outp += (rows * columns);
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+
+    } 
+
+
     void BinaryTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -129,6 +409,9 @@ static void checkInnerTail(float32_t *b)
       switch(id)
       {
          case TEST_MAT_MULT_F32_1:
+         case TEST_MAT_MULT_LARGE_F32_4:
+         case TEST_MAT_GEMM_F32_5:
+         case TEST_MAT_GEMM_TRANS_B_F32_7:
             input1.reload(BinaryTestsF32::INPUTS1_F32_ID,mgr);
             input2.reload(BinaryTestsF32::INPUTS2_F32_ID,mgr);
             dims.reload(BinaryTestsF32::DIMSBINARY1_S16_ID,mgr);
@@ -140,6 +423,30 @@ static void checkInnerTail(float32_t *b)
             b.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsF32::TMPB_F32_ID,mgr);
          break;
 
+         case TEST_MAT_MULT_STRIDED_F32_3:
+            input1.reload(BinaryTestsF32::INPUTS1_F32_ID,mgr);
+            input2.reload(BinaryTestsF32::INPUTS2_F32_ID,mgr);
+            dims.reload(BinaryTestsF32::DIMSBINARY1_S16_ID,mgr);
+
+            ref.reload(BinaryTestsF32::REFMUL1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),BinaryTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXMATRIXDIM*(MAXMATRIXDIM+STRIDEPAD),BinaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(MAXMATRIXDIM*(MAXMATRIXDIM+STRIDEPAD),BinaryTestsF32::TMPB_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_BATCH_MULT_F32_6:
+            input1.reload(BinaryTestsF32::INPUTS1_F32_ID,mgr);
+            input2.reload(BinaryTestsF32::INPUTS2_F32_ID,mgr);
+            dims.reload(BinaryTestsF32::DIMSBINARY1_S16_ID,mgr);
+
+            ref.reload(BinaryTestsF32::REFMUL1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),BinaryTestsF32::OUT_F32_ID,mgr);
+            a.create(2*MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsF32::TMPB_F32_ID,mgr);
+         break;
+
          case TEST_MAT_CMPLX_MULT_F32_2:
             input1.reload(BinaryTestsF32::INPUTSC1_F32_ID,mgr);
             input2.reload(BinaryTestsF32::INPUTSC2_F32_ID,mgr);
@@ -79,6 +79,72 @@ a double precision computation.
 
     } 
 
+
+    void BinaryTestsF64::test_mat_gemm_f64()
+    {     
+      LOADDATA2();
+      arm_status status;
+      const float64_t *refp=ref.ptr();
+      int r,c;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+          columns = *dimsp++;
+
+          /* A and B are transposed before the call so that the product
+             A.B is computed as (A^t)^t . (B^t)^t */
+          for(r=0;r < rows; r++)
+          {
+             for(c=0;c < internal; c++)
+             {
+                ap[c*rows + r] = inp1[r*internal + c];
+             }
+          }
+          for(r=0;r < internal; r++)
+          {
+             for(c=0;c < columns; c++)
+             {
+                bp[c*internal + r] = inp2[r*columns + c];
+             }
+          }
+
+          in1.numRows=internal;
+          in1.numCols=rows;
+          in1.pData = ap;
+
+          in2.numRows=columns;
+          in2.numCols=internal;
+          in2.pData = bp;
+
+          out.numRows=rows;
+          out.numCols=columns;
+          out.pData = outp;
+
+          /* C is initialized with 2 A.B so that the output
+             1.5 A.B - 0.25 C is A.B */
+          for(r=0;r < rows*columns; r++)
+          {
+             outp[r] = 2.0 * refp[r];
+          }
+
+          status=arm_mat_gemm_f64(ARM_MAT_TRANS,ARM_MAT_TRANS,1.5,&this->in1,&this->in2,-0.25,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+          refp += (rows * columns);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float64_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
     
 #if 0
     void BinaryTestsF64::test_mat_cmplx_mult_f64()
@@ -117,6 +183,7 @@ a double precision computation.
       switch(id)
       {
          case TEST_MAT_MULT_F64_1:
+         case TEST_MAT_GEMM_F64_2:
             input1.reload(BinaryTestsF64::INPUTS1_F64_ID,mgr);
             input2.reload(BinaryTestsF64::INPUTS2_F64_ID,mgr);
             dims.reload(BinaryTestsF64::DIMSBINARY1_S16_ID,mgr);
@@ -24,6 +24,16 @@ a double precision computation.
 /* Upper bound of maximum matrix dimension used by Python */
 #define MAXMATRIXDIM 40
 
+/* Dimensions of the saturation test of the large matrix product */
+#define SATROWS 6
+#define SATINTERNAL 37
+#define SATCOLUMNS 5
+
+/* Scaling factors of the gemm test. They are odd so that the
+   scaled values have a fractional part */
+#define GEMM_ALPHA_Q15 ((q15_t)0x5A5B)
+#define GEMM_BETA_Q15 ((q15_t)0xB2D3)
+
 static void checkInnerTail(q15_t *b)
 {
     ASSERT_TRUE(b[0] == 0);
@@ -37,6 +47,31 @@ static void checkInnerTail(q15_t *b)
 }
 
 
+/* Reference of the gemm : the dot product is converted to 17.15 and
+   the scaled values are summed before a single rounding and
+   a saturation to 16 bits */
+static q15_t ref_gemm_q15(const q15_t *pA,int incA,
+                          const q15_t *pB,int incB,
+                          int nb,
+                          q15_t alpha,
+                          q15_t c,
+                          q15_t beta)
+{
+    q63_t sum = 0;
+    q63_t acc;
+    int k;
+
+    for(k=0;k < nb; k++)
+    {
+        sum += (q63_t)pA[k*incA] * pB[k*incB];
+    }
+
+    acc = (q63_t)clip_q63_to_q31(sum >> 15) * alpha;
+    acc += (q63_t)c * beta;
+    acc += 0x4000;
+
+    return((q15_t)__SSAT(clip_q63_to_q31(acc >> 15),16));
+}
 
 #define LOADDATA2()                         \
       const q15_t *inp1=input1.ptr();       \
@@ -182,6 +217,295 @@ static void checkInnerTail(q15_t *b)
 
 
 
+    void BinaryTestsQ15::test_mat_mult_large_q15()
+    {     
+      LOADDATA2();
+      (void)shift;
+      arm_status status;
+      arm_matrix_instance_large_q15 la,lb,lout;
+      /* Result of arm_mat_mult_q15 after its state buffer */
+      q15_t *exactp = tmpPtr + MAXMATRIXDIM*MAXMATRIXDIM;
+      q15_t *largep = exactp + MAXMATRIXDIM*MAXMATRIXDIM;
+      int r,k;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+          columns = *dimsp++;
+          shift = *dimsp++;
+
+          PREPAREDATA2R();
+          arm_mat_init_large_q15(&la,rows,internal,ap);
+          arm_mat_init_large_q15(&lb,internal,columns,bp);
+          arm_mat_init_large_q15(&lout,rows,columns,outp);
+
+          try
+          {
+             status=arm_mat_mult_large_q15(&la,&lb,&lout);
+             ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+             ASSERT_NEAR_EQ_NB(outp,refp,ABS_HIGH_ERROR_Q15,rows*columns);
+
+             /* The large product is bit-exact with arm_mat_mult_q15 */
+             out.pData = exactp;
+             status=arm_mat_mult_q15(&this->in1,&this->in2,&this->out,tmpPtr);
+             ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+             ASSERT_NEAR_EQ_NB(outp,exactp,(q15_t)0,rows*columns);
+
+             outp += (rows * columns);
+             refp += (rows * columns);
+             checkInnerTail(outp);
+          }
+          catch(Client::Error &err)
+          {
+            char tmp[256];
+            snprintf(tmp,256," (%d x %d x %d)\n",rows,internal,columns);
+            strcat(err.details,tmp);
+            throw(err);
+          }
+
+      }
+
+      ASSERT_SNR(output,ref,(q15_t)SNR_LOW_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_HIGH_ERROR_Q15);
+
+      /* Saturation : the rows of A are full scale positive, full scale
+         negative or taken from the patterns and the first column of B
+         is full scale positive */
+      for(r=0;r < SATROWS; r++)
+      {
+          for(k=0;k < SATINTERNAL; k++)
+          {
+              if ((r % 3) == 0)
+              {
+                 ap[r*SATINTERNAL+k] = (q15_t)0x7FFF;
+              }
+              else if ((r % 3) == 1)
+              {
+                 ap[r*SATINTERNAL+k] = (q15_t)0x8000;
+              }
+              else
+              {
+                 ap[r*SATINTERNAL+k] = inp1[r*SATINTERNAL+k];
+              }
+          }
+      }
+      for(k=0;k < SATINTERNAL*SATCOLUMNS; k++)
+      {
+          bp[k] = ((k % SATCOLUMNS) == 0) ? (q15_t)0x7FFF : inp2[k];
+      }
+
+      in1.numRows=SATROWS;
+      in1.numCols=SATINTERNAL;
+      in2.numRows=SATINTERNAL;
+      in2.numCols=SATCOLUMNS;
+      out.numRows=SATROWS;
+      out.numCols=SATCOLUMNS;
+      out.pData=exactp;
+      arm_mat_init_large_q15(&la,SATROWS,SATINTERNAL,ap);
+      arm_mat_init_large_q15(&lb,SATINTERNAL,SATCOLUMNS,bp);
+      arm_mat_init_large_q15(&lout,SATROWS,SATCOLUMNS,largep);
+
+      status=arm_mat_mult_large_q15(&la,&lb,&lout);
+      ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+      status=arm_mat_mult_q15(&this->in1,&this->in2,&this->out,tmpPtr);
+      ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+      ASSERT_NEAR_EQ_NB(largep,exactp,(q15_t)0,SATROWS*SATCOLUMNS);
+      ASSERT_TRUE(largep[0] == (q15_t)0x7FFF);
+      ASSERT_TRUE(largep[SATCOLUMNS] == (q15_t)0x8000);
+
+    } 
+
+
+
+    void BinaryTestsQ15::test_mat_gemm_q15()
+    {     
+      LOADDATA2();
+      (void)shift;
+      arm_status status;
+      /* State and result of arm_mat_mult_q15, A^t, B and C */
+      q15_t *multp = tmpPtr + MAXMATRIXDIM*MAXMATRIXDIM;
+      q15_t *atp = multp + MAXMATRIXDIM*MAXMATRIXDIM;
+      q15_t *bnp = atp + MAXMATRIXDIM*MAXMATRIXDIM;
+      q15_t *cp = bnp + MAXMATRIXDIM*MAXMATRIXDIM;
+      int r,c;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+          columns = *dimsp++;
+          shift = *dimsp++;
+
+          /* A is used as it is and B is transposed */
+          memcpy((void*)ap,(const void*)inp1,sizeof(q15_t)*rows*internal);
+          memcpy((void*)bnp,(const void*)inp2,sizeof(q15_t)*internal*columns);
+          for(r=0;r < internal; r++)
+          {
+             for(c=0;c < columns; c++)
+             {
+                bp[c*internal + r] = inp2[r*columns + c];
+             }
+          }
+
+          in1.numRows=rows;
+          in1.numCols=internal;
+          in1.pData = ap;
+
+          in2.numRows=columns;
+          in2.numCols=internal;
+          in2.pData = bp;
+
+          out.numRows=rows;
+          out.numCols=columns;
+          out.pData = outp;
+
+          try
+          {
+             status=arm_mat_gemm_q15(ARM_MAT_NO_TRANS,ARM_MAT_TRANS,ARM_MAT_GEMM_ONE_Q15,&this->in1,&this->in2,0,&this->out);
+             ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+             ASSERT_NEAR_EQ_NB(outp,refp,ABS_HIGH_ERROR_Q15,rows*columns);
+
+             /* With alpha = ARM_MAT_GEMM_ONE_Q15 the result is the one of
+                arm_mat_mult_q15 except for the biggest values which may
+                decrease by one LSB */
+             in2.numRows=internal;
+             in2.numCols=columns;
+             in2.pData = bnp;
+             out.pData = multp;
+             status=arm_mat_mult_q15(&this->in1,&this->in2,&this->out,tmpPtr);
+             ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+             ASSERT_NEAR_EQ_NB(outp,multp,(q15_t)1,rows*columns);
+
+             /* alpha A.B + beta C with A transposed and B used as it is */
+             for(r=0;r < rows; r++)
+             {
+                for(c=0;c < internal; c++)
+                {
+                   atp[c*rows + r] = inp1[r*internal + c];
+                }
+             }
+             memcpy((void*)cp,(const void*)outp,sizeof(q15_t)*rows*columns);
+
+             in1.numRows=internal;
+             in1.numCols=rows;
+             in1.pData = atp;
+             out.pData = cp;
+
+             status=arm_mat_gemm_q15(ARM_MAT_TRANS,ARM_MAT_NO_TRANS,GEMM_ALPHA_Q15,&this->in1,&this->in2,GEMM_BETA_Q15,&this->out);
+             ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+             for(r=0;r < rows; r++)
+             {
+                for(c=0;c < columns; c++)
+                {
+                   ASSERT_TRUE(cp[r*columns + c] == ref_gemm_q15(inp1 + r*internal,1,
+                                                                 inp2 + c,columns,
+                                                                 internal,
+                                                                 GEMM_ALPHA_Q15,
+                                                                 outp[r*columns + c],
+                                                                 GEMM_BETA_Q15));
+                }
+             }
+
+             outp += (rows * columns);
+             refp += (rows * columns);
+             checkInnerTail(outp);
+          }
+          catch(Client::Error &err)
+          {
+            char tmp[256];
+            snprintf(tmp,256," (%d x %d x %d)\n",rows,internal,columns);
+            strcat(err.details,tmp);
+            throw(err);
+          }
+
+      }
+
+      ASSERT_SNR(output,ref,(q15_t)SNR_LOW_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_HIGH_ERROR_Q15);
+
+      /* Single rounding : the product is 1 LSB and 0.5 * 1 + 0.5 * 1
+         is 1 when the sum is rounded once. It would be 2 if each
+         scaled value was rounded. */
+      ap[0] = ONEHALF;
+      bp[0] = 2;
+      cp[0] = 1;
+      in1.numRows=1;
+      in1.numCols=1;
+      in1.pData = ap;
+      in2.numRows=1;
+      in2.numCols=1;
+      in2.pData = bp;
+      out.numRows=1;
+      out.numCols=1;
+      out.pData = cp;
+
+      status=arm_mat_gemm_q15(ARM_MAT_NO_TRANS,ARM_MAT_NO_TRANS,ONEHALF,&this->in1,&this->in2,ONEHALF,&this->out);
+      ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+      ASSERT_TRUE(cp[0] == 1);
+
+      /* Saturation : the rows of A are full scale positive, full scale
+         negative or taken from the patterns, the first column of B
+         is full scale positive and C is full scale with the sign
+         of the row */
+      for(r=0;r < SATROWS; r++)
+      {
+          for(c=0;c < SATINTERNAL; c++)
+          {
+              if ((r % 3) == 0)
+              {
+                 ap[r*SATINTERNAL+c] = (q15_t)0x7FFF;
+              }
+              else if ((r % 3) == 1)
+              {
+                 ap[r*SATINTERNAL+c] = (q15_t)0x8000;
+              }
+              else
+              {
+                 ap[r*SATINTERNAL+c] = inp1[r*SATINTERNAL+c];
+              }
+          }
+      }
+      for(c=0;c < SATINTERNAL*SATCOLUMNS; c++)
+      {
+          bp[c] = ((c % SATCOLUMNS) == 0) ? (q15_t)0x7FFF : inp2[c];
+      }
+      for(c=0;c < SATROWS*SATCOLUMNS; c++)
+      {
+          cp[c] = (((c / SATCOLUMNS) % 3) == 1) ? (q15_t)0x8000 : (q15_t)0x7FFF;
+      }
+
+      in1.numRows=SATROWS;
+      in1.numCols=SATINTERNAL;
+      in2.numRows=SATINTERNAL;
+      in2.numCols=SATCOLUMNS;
+      out.numRows=SATROWS;
+      out.numCols=SATCOLUMNS;
+
+      status=arm_mat_gemm_q15(ARM_MAT_NO_TRANS,ARM_MAT_NO_TRANS,ARM_MAT_GEMM_ONE_Q15,&this->in1,&this->in2,ARM_MAT_GEMM_ONE_Q15,&this->out);
+      ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+      for(r=0;r < SATROWS; r++)
+      {
+         for(c=0;c < SATCOLUMNS; c++)
+         {
+            ASSERT_TRUE(cp[r*SATCOLUMNS + c] == ref_gemm_q15(ap + r*SATINTERNAL,1,
+                                                             bp + c,SATCOLUMNS,
+                                                             SATINTERNAL,
+                                                             ARM_MAT_GEMM_ONE_Q15,
+                                                             ((r % 3) == 1) ? (q15_t)0x8000 : (q15_t)0x7FFF,
+                                                             ARM_MAT_GEMM_ONE_Q15));
+         }
+      }
+      ASSERT_TRUE(cp[0] == (q15_t)0x7FFF);
+      ASSERT_TRUE(cp[SATCOLUMNS] == (q15_t)0x8000);
+
+    } 
+
     void BinaryTestsQ15::test_mat_cmplx_mult_q15()
     {     
       LOADDATA2();
@@ -261,6 +585,34 @@ static void checkInnerTail(q15_t *b)
          break;
 
 
+         case TEST_MAT_MULT_LARGE_Q15_4:
+            input1.reload(BinaryTestsQ15::INPUTS1_Q15_ID,mgr);
+            input2.reload(BinaryTestsQ15::INPUTS2_Q15_ID,mgr);
+            dims.reload(BinaryTestsQ15::DIMSBINARY1_S16_ID,mgr);
+
+            ref.reload(BinaryTestsQ15::REFMUL1_Q15_ID,mgr);
+
+            output.create(ref.nbSamples(),BinaryTestsQ15::OUT_Q15_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ15::TMPA_Q15_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ15::TMPB_Q15_ID,mgr);
+            /* State, arm_mat_mult_q15 result and large result */
+            tmp.create(3*MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ15::TMP_Q15_ID,mgr);
+         break;
+
+         case TEST_MAT_GEMM_Q15_5:
+            input1.reload(BinaryTestsQ15::INPUTS1_Q15_ID,mgr);
+            input2.reload(BinaryTestsQ15::INPUTS2_Q15_ID,mgr);
+            dims.reload(BinaryTestsQ15::DIMSBINARY1_S16_ID,mgr);
+
+            ref.reload(BinaryTestsQ15::REFMUL1_Q15_ID,mgr);
+
+            output.create(ref.nbSamples(),BinaryTestsQ15::OUT_Q15_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ15::TMPA_Q15_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ15::TMPB_Q15_ID,mgr);
+            /* State and result of arm_mat_mult_q15, A^t, B and C */
+            tmp.create(5*MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ15::TMP_Q15_ID,mgr);
+         break;
+
 
     
       }
@@ -18,6 +18,18 @@ a double precision computation.
 /* Upper bound of maximum matrix dimension used by Python */
 #define MAXMATRIXDIM 40
 
+/* Dimensions of the saturation test of the gemm. The 64-bit
+   accumulator has one guard bit so only two full scale products
+   are accumulated */
+#define SATROWS 6
+#define SATINTERNAL 2
+#define SATCOLUMNS 5
+
+/* Scaling factors of the gemm test. They are odd so that the
+   scaled values have a fractional part */
+#define GEMM_ALPHA_Q31 ((q31_t)0x5A5B5C5D)
+#define GEMM_BETA_Q31 ((q31_t)0xB2D3E4F5)
+
 static void checkInnerTail(q31_t *b)
 {
     ASSERT_TRUE(b[0] == 0);
@@ -26,6 +38,31 @@ static void checkInnerTail(q31_t *b)
     ASSERT_TRUE(b[3] == 0);
 }
 
+/* Reference of the gemm : the dot product is converted to 1.31 and
+   the scaled values are summed before a single rounding and
+   a saturation */
+static q31_t ref_gemm_q31(const q31_t *pA,int incA,
+                          const q31_t *pB,int incB,
+                          int nb,
+                          q31_t alpha,
+                          q31_t c,
+                          q31_t beta)
+{
+    q63_t sum = 0;
+    q63_t acc;
+    int k;
+
+    for(k=0;k < nb; k++)
+    {
+        sum += (q63_t)pA[k*incA] * pB[k*incB];
+    }
+
+    acc = (q63_t)clip_q63_to_q31(sum >> 31) * alpha;
+    acc += (q63_t)c * beta;
+    acc += 0x40000000;
+
+    return(clip_q63_to_q31(acc >> 31));
+}
 
 #define LOADDATA2()                          \
       const q31_t *inp1=input1.ptr();    \
@@ -199,6 +236,242 @@ static void checkInnerTail(q31_t *b)
     } 
 
 
+    void BinaryTestsQ31::test_mat_mult_large_q31()
+    {     
+      LOADDATA2();
+      arm_status status;
+      arm_matrix_instance_large_q31 la,lb,lout;
+      q31_t *exactp = tmp.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA2();
+          arm_mat_init_large_q31(&la,rows,internal,ap);
+          arm_mat_init_large_q31(&lb,internal,columns,bp);
+          arm_mat_init_large_q31(&lout,rows,columns,outp);
+
+          try
+          {
+              status=arm_mat_mult_large_q31(&la,&lb,&lout);
+              ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+              ASSERT_NEAR_EQ_NB(outp,refp,ABS_ERROR_Q31,rows*columns);
+
+              /* The large product is bit-exact with arm_mat_mult_q31 */
+              out.pData = exactp;
+              status=arm_mat_mult_q31(&this->in1,&this->in2,&this->out);
+              ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+              ASSERT_NEAR_EQ_NB(outp,exactp,(q31_t)0,rows*columns);
+    
+              outp += (rows * columns);
+              refp += (rows * columns);
+              checkInnerTail(outp);
+          }
+          catch(Client::Error &err)
+          {
+            char tmp[256];
+            snprintf(tmp,256," (%d x %d x %d)\n",rows,internal,columns);
+            strcat(err.details,tmp);
+            throw(err);
+          }
+
+      }
+
+      ASSERT_SNR(output,ref,(q31_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q31);
+
+    } 
+
+
+    void BinaryTestsQ31::test_mat_gemm_q31()
+    {     
+      LOADDATA2();
+      arm_status status;
+      /* Result of arm_mat_mult_q31, A^t, B and C */
+      q31_t *multp = tmp.ptr();
+      q31_t *atp = multp + MAXMATRIXDIM*MAXMATRIXDIM;
+      q31_t *bnp = atp + MAXMATRIXDIM*MAXMATRIXDIM;
+      q31_t *cp = bnp + MAXMATRIXDIM*MAXMATRIXDIM;
+      int r,c;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+          columns = *dimsp++;
+
+          /* A is used as it is and B is transposed */
+          memcpy((void*)ap,(const void*)inp1,sizeof(q31_t)*rows*internal);
+          memcpy((void*)bnp,(const void*)inp2,sizeof(q31_t)*internal*columns);
+          for(r=0;r < internal; r++)
+          {
+             for(c=0;c < columns; c++)
+             {
+                bp[c*internal + r] = inp2[r*columns + c];
+             }
+          }
+
+          in1.numRows=rows;
+          in1.numCols=internal;
+          in1.pData = ap;
+
+          in2.numRows=columns;
+          in2.numCols=internal;
+          in2.pData = bp;
+
+          out.numRows=rows;
+          out.numCols=columns;
+          out.pData = outp;
+
+          try
+          {
+              status=arm_mat_gemm_q31(ARM_MAT_NO_TRANS,ARM_MAT_TRANS,ARM_MAT_GEMM_ONE_Q31,&this->in1,&this->in2,0,&this->out);
+              ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+              ASSERT_NEAR_EQ_NB(outp,refp,ABS_ERROR_Q31,rows*columns);
+
+              /* With alpha = ARM_MAT_GEMM_ONE_Q31 the result is the one of
+                 arm_mat_mult_q31 except for the biggest values which may
+                 decrease by one LSB */
+              in2.numRows=internal;
+              in2.numCols=columns;
+              in2.pData = bnp;
+              out.pData = multp;
+              status=arm_mat_mult_q31(&this->in1,&this->in2,&this->out);
+              ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+              ASSERT_NEAR_EQ_NB(outp,multp,(q31_t)1,rows*columns);
+
+              /* alpha A.B + beta C with A transposed and B used as it is */
+              for(r=0;r < rows; r++)
+              {
+                 for(c=0;c < internal; c++)
+                 {
+                    atp[c*rows + r] = inp1[r*internal + c];
+                 }
+              }
+              memcpy((void*)cp,(const void*)outp,sizeof(q31_t)*rows*columns);
+
+              in1.numRows=internal;
+              in1.numCols=rows;
+              in1.pData = atp;
+              out.pData = cp;
+
+              status=arm_mat_gemm_q31(ARM_MAT_TRANS,ARM_MAT_NO_TRANS,GEMM_ALPHA_Q31,&this->in1,&this->in2,GEMM_BETA_Q31,&this->out);
+              ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+              for(r=0;r < rows; r++)
+              {
+                 for(c=0;c < columns; c++)
+                 {
+                    ASSERT_TRUE(cp[r*columns + c] == ref_gemm_q31(inp1 + r*internal,1,
+                                                                  inp2 + c,columns,
+                                                                  internal,
+                                                                  GEMM_ALPHA_Q31,
+                                                                  outp[r*columns + c],
+                                                                  GEMM_BETA_Q31));
+                 }
+              }
+    
+              outp += (rows * columns);
+              refp += (rows * columns);
+              checkInnerTail(outp);
+          }
+          catch(Client::Error &err)
+          {
+            char tmp[256];
+            snprintf(tmp,256," (%d x %d x %d)\n",rows,internal,columns);
+            strcat(err.details,tmp);
+            throw(err);
+          }
+
+      }
+
+      ASSERT_SNR(output,ref,(q31_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q31);
+
+      /* Single rounding : the product is 1 LSB and 0.5 * 1 + 0.5 * 1
+         is 1 when the sum is rounded once. It would be 2 if each
+         scaled value was rounded. */
+      ap[0] = ONEHALF;
+      bp[0] = 2;
+      cp[0] = 1;
+      in1.numRows=1;
+      in1.numCols=1;
+      in1.pData = ap;
+      in2.numRows=1;
+      in2.numCols=1;
+      in2.pData = bp;
+      out.numRows=1;
+      out.numCols=1;
+      out.pData = cp;
+
+      status=arm_mat_gemm_q31(ARM_MAT_NO_TRANS,ARM_MAT_NO_TRANS,ONEHALF,&this->in1,&this->in2,ONEHALF,&this->out);
+      ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+      ASSERT_TRUE(cp[0] == 1);
+
+      /* Saturation : the rows of A are full scale positive, full scale
+         negative or taken from the patterns, the first column of B
+         is full scale positive and C is full scale with the sign
+         of the row */
+      for(r=0;r < SATROWS; r++)
+      {
+          for(c=0;c < SATINTERNAL; c++)
+          {
+              if ((r % 3) == 0)
+              {
+                 ap[r*SATINTERNAL+c] = (q31_t)0x7FFFFFFF;
+              }
+              else if ((r % 3) == 1)
+              {
+                 ap[r*SATINTERNAL+c] = (q31_t)0x80000000;
+              }
+              else
+              {
+                 ap[r*SATINTERNAL+c] = inp1[r*SATINTERNAL+c];
+              }
+          }
+      }
+      for(c=0;c < SATINTERNAL*SATCOLUMNS; c++)
+      {
+          bp[c] = ((c % SATCOLUMNS) == 0) ? (q31_t)0x7FFFFFFF : inp2[c];
+      }
+      for(c=0;c < SATROWS*SATCOLUMNS; c++)
+      {
+          cp[c] = (((c / SATCOLUMNS) % 3) == 1) ? (q31_t)0x80000000 : (q31_t)0x7FFFFFFF;
+      }
+
+      in1.numRows=SATROWS;
+      in1.numCols=SATINTERNAL;
+      in2.numRows=SATINTERNAL;
+      in2.numCols=SATCOLUMNS;
+      out.numRows=SATROWS;
+      out.numCols=SATCOLUMNS;
+
+      status=arm_mat_gemm_q31(ARM_MAT_NO_TRANS,ARM_MAT_NO_TRANS,ARM_MAT_GEMM_ONE_Q31,&this->in1,&this->in2,ARM_MAT_GEMM_ONE_Q31,&this->out);
+      ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+      for(r=0;r < SATROWS; r++)
+      {
+         for(c=0;c < SATCOLUMNS; c++)
+         {
+            ASSERT_TRUE(cp[r*SATCOLUMNS + c] == ref_gemm_q31(ap + r*SATINTERNAL,1,
+                                                             bp + c,SATCOLUMNS,
+                                                             SATINTERNAL,
+                                                             ARM_MAT_GEMM_ONE_Q31,
+                                                             ((r % 3) == 1) ? (q31_t)0x80000000 : (q31_t)0x7FFFFFFF,
+                                                             ARM_MAT_GEMM_ONE_Q31));
+         }
+      }
+      ASSERT_TRUE(cp[0] == (q31_t)0x7FFFFFFF);
+      ASSERT_TRUE(cp[SATCOLUMNS] == (q31_t)0x80000000);
+
+    } 
+
+
     void BinaryTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -257,6 +530,33 @@ static void checkInnerTail(q31_t *b)
             b.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ31::TMPB_Q31_ID,mgr);
          break;
 
+         case TEST_MAT_MULT_LARGE_Q31_5:
+            input1.reload(BinaryTestsQ31::INPUTS1_Q31_ID,mgr);
+            input2.reload(BinaryTestsQ31::INPUTS2_Q31_ID,mgr);
+            dims.reload(BinaryTestsQ31::DIMSBINARY1_S16_ID,mgr);
+
+            ref.reload(BinaryTestsQ31::REFMUL1_Q31_ID,mgr);
+
+            output.create(ref.nbSamples(),BinaryTestsQ31::OUT_Q31_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ31::TMPA_Q31_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ31::TMPB_Q31_ID,mgr);
+            tmp.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ31::TMPC_Q31_ID,mgr);
+         break;
+
+         case TEST_MAT_GEMM_Q31_6:
+            input1.reload(BinaryTestsQ31::INPUTS1_Q31_ID,mgr);
+            input2.reload(BinaryTestsQ31::INPUTS2_Q31_ID,mgr);
+            dims.reload(BinaryTestsQ31::DIMSBINARY1_S16_ID,mgr);
+
+            ref.reload(BinaryTestsQ31::REFMUL1_Q31_ID,mgr);
+
+            output.create(ref.nbSamples(),BinaryTestsQ31::OUT_Q31_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ31::TMPA_Q31_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ31::TMPB_Q31_ID,mgr);
+            /* Result of arm_mat_mult_q31, A^t, B and C */
+            tmp.create(4*MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ31::TMPC_Q31_ID,mgr);
+         break;
+
 
 
     
@@ -20,6 +20,11 @@ a double precision computation.
 /* Upper bound of maximum matrix dimension used by Python */
 #define MAXMATRIXDIM 47
 
+/* Dimensions of the saturation test of the large matrix product */
+#define SATROWS 6
+#define SATINTERNAL 37
+#define SATCOLUMNS 5
+
 static void checkInnerTail(q7_t *b)
 {
     ASSERT_TRUE(b[0] == 0);
@@ -129,6 +134,110 @@ static void checkInnerTail(q7_t *b)
 
 
 
+    void BinaryTestsQ7::test_mat_mult_large_q7()
+    {     
+      LOADDATA2();
+      (void)shift;
+      arm_status status;
+      arm_matrix_instance_large_q7 la,lb,lout;
+      /* Result of arm_mat_mult_q7 after its state buffer */
+      q7_t *exactp = tmpPtr + MAXMATRIXDIM*MAXMATRIXDIM;
+      q7_t *largep = exactp + MAXMATRIXDIM*MAXMATRIXDIM;
+      int r,k;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+          columns = *dimsp++;
+          shift = *dimsp++;
+
+          PREPAREDATA2();
+          arm_mat_init_large_q7(&la,rows,internal,ap);
+          arm_mat_init_large_q7(&lb,internal,columns,bp);
+          arm_mat_init_large_q7(&lout,rows,columns,outp);
+
+          try
+          {
+              status=arm_mat_mult_large_q7(&la,&lb,&lout);
+              ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+              ASSERT_NEAR_EQ_NB(outp,refp,ABS_ERROR_Q7,rows*columns);
+
+              /* The large product is bit-exact with arm_mat_mult_q7 */
+              out.pData = exactp;
+              status=arm_mat_mult_q7(&this->in1,&this->in2,&this->out,tmpPtr);
+              ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+              ASSERT_NEAR_EQ_NB(outp,exactp,(q7_t)0,rows*columns);
+    
+              outp += (rows * columns);
+              refp += (rows * columns);
+              checkInnerTail(outp);
+          }
+          catch(Client::Error &err)
+          {
+            char tmp[256];
+            snprintf(tmp,256," (%d x %d x %d)\n",rows,internal,columns);
+            strcat(err.details,tmp);
+            throw(err);
+          }
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q7_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q7);
+
+      /* Saturation : the rows of A are full scale positive, full scale
+         negative or taken from the patterns and the first column of B
+         is full scale positive */
+      for(r=0;r < SATROWS; r++)
+      {
+          for(k=0;k < SATINTERNAL; k++)
+          {
+              if ((r % 3) == 0)
+              {
+                 ap[r*SATINTERNAL+k] = (q7_t)0x7F;
+              }
+              else if ((r % 3) == 1)
+              {
+                 ap[r*SATINTERNAL+k] = (q7_t)0x80;
+              }
+              else
+              {
+                 ap[r*SATINTERNAL+k] = inp1[r*SATINTERNAL+k];
+              }
+          }
+      }
+      for(k=0;k < SATINTERNAL*SATCOLUMNS; k++)
+      {
+          bp[k] = ((k % SATCOLUMNS) == 0) ? (q7_t)0x7F : inp2[k];
+      }
+
+      in1.numRows=SATROWS;
+      in1.numCols=SATINTERNAL;
+      in2.numRows=SATINTERNAL;
+      in2.numCols=SATCOLUMNS;
+      out.numRows=SATROWS;
+      out.numCols=SATCOLUMNS;
+      out.pData=exactp;
+      arm_mat_init_large_q7(&la,SATROWS,SATINTERNAL,ap);
+      arm_mat_init_large_q7(&lb,SATINTERNAL,SATCOLUMNS,bp);
+      arm_mat_init_large_q7(&lout,SATROWS,SATCOLUMNS,largep);
+
+      status=arm_mat_mult_large_q7(&la,&lb,&lout);
+      ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+      status=arm_mat_mult_q7(&this->in1,&this->in2,&this->out,tmpPtr);
+      ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+      ASSERT_NEAR_EQ_NB(largep,exactp,(q7_t)0,SATROWS*SATCOLUMNS);
+      ASSERT_TRUE(largep[0] == (q7_t)0x7F);
+      ASSERT_TRUE(largep[SATCOLUMNS] == (q7_t)0x80);
+
+    } 
+
+
+
     void BinaryTestsQ7::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -149,6 +258,20 @@ static void checkInnerTail(q7_t *b)
             tmp.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ7::TMP_Q7_ID,mgr);
          break;
 
+         case TEST_MAT_MULT_LARGE_Q7_2:
+            input1.reload(BinaryTestsQ7::INPUTS1_Q7_ID,mgr);
+            input2.reload(BinaryTestsQ7::INPUTS2_Q7_ID,mgr);
+            dims.reload(BinaryTestsQ7::DIMSBINARY1_S16_ID,mgr);
+
+            ref.reload(BinaryTestsQ7::REFMUL1_Q7_ID,mgr);
+
+            output.create(ref.nbSamples(),BinaryTestsQ7::OUT_Q7_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ7::TMPA_Q7_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ7::TMPB_Q7_ID,mgr);
+            /* State, arm_mat_mult_q7 result and large result */
+            tmp.create(3*MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ7::TMP_Q7_ID,mgr);
+         break;
+
 
     
       }
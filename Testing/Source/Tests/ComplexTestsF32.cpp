@@ -5,6 +5,11 @@
 #define SNR_THRESHOLD 120
 
 #define REL_ERROR (7.0e-6)
+#define ABS_ERROR_NCO (1.0e-6)
+
+/* NCO parameters used to generate the reference patterns */
+#define NCO_FREQUENCY (17.0f / 256.0f)
+#define NCO_PHASE (2.0f * PI * 3.0f / 64.0f)
 
     void ComplexTestsF32::test_cmplx_conj_f32()
     {
@@ -105,6 +110,45 @@
         ASSERT_REL_ERROR(output,ref,REL_ERROR);
     } 
  
+    void ComplexTestsF32::test_mix_cmplx_f32()
+    {
+        const float32_t *inp1=input1.ptr();
+        float32_t *outp=output.ptr();
+        uint32_t nb = input1.nbSamples() >> 1;
+        arm_nco_instance_f32 nco;
+
+        arm_nco_init_f32(&nco,NCO_FREQUENCY,NCO_PHASE);
+
+        /* The phase must be continuous from one call to the next */
+        arm_mix_cmplx_f32(&nco,inp1,outp,3);
+        arm_mix_cmplx_f32(&nco,inp1 + 6,outp + 6,nb - 3);
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_NCO,REL_ERROR);
+
+    }
+
+    void ComplexTestsF32::test_nco_f32()
+    {
+        float32_t *outp=output.ptr();
+        arm_nco_instance_f32 nco;
+
+        arm_nco_init_f32(&nco,NCO_FREQUENCY,NCO_PHASE);
+
+        arm_nco_f32(&nco,outp,5);
+        arm_nco_f32(&nco,outp + 10,(ref.nbSamples() >> 1) - 5);
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_NCO,REL_ERROR);
+
+    }
+
     void ComplexTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
       
@@ -296,6 +340,27 @@
 
           output.create(ref.nbSamples(),ComplexTestsF32::OUT_SAMPLES_F32_ID,mgr);
         break;
+
+        case ComplexTestsF32::TEST_MIX_CMPLX_F32_25:
+          nb = 11;
+          ref.reload(ComplexTestsF32::REF_MIX_CMPLX_F32_ID,mgr,nb << 1);
+          input1.reload(ComplexTestsF32::INPUT1_F32_ID,mgr,nb << 1);
+
+          output.create(ref.nbSamples(),ComplexTestsF32::OUT_SAMPLES_F32_ID,mgr);
+        break;
+
+        case ComplexTestsF32::TEST_MIX_CMPLX_F32_26:
+          ref.reload(ComplexTestsF32::REF_MIX_CMPLX_F32_ID,mgr);
+          input1.reload(ComplexTestsF32::INPUT1_F32_ID,mgr);
+
+          output.create(ref.nbSamples(),ComplexTestsF32::OUT_SAMPLES_F32_ID,mgr);
+        break;
+
+        case ComplexTestsF32::TEST_NCO_F32_27:
+          ref.reload(ComplexTestsF32::REF_NCO_F32_ID,mgr);
+
+          output.create(ref.nbSamples(),ComplexTestsF32::OUT_SAMPLES_F32_ID,mgr);
+        break;
         
        }
       
@@ -17,6 +17,11 @@ a double precision computation.
 
 #define ABS_ERROR_Q15 ((q15_t)5)
 #define ABS_ERROR_Q31 ((q31_t)550)
+#define ABS_ERROR_NCO_Q15 ((q15_t)4)
+
+/* NCO parameters used to generate the reference patterns */
+#define NCO_FREQUENCY ((q15_t)(17 << 7))
+#define NCO_PHASE ((q15_t)(3 << 9))
 
     void ComplexTestsQ15::test_cmplx_conj_q15()
     {
@@ -137,6 +142,45 @@ a double precision computation.
 
     } 
  
+    void ComplexTestsQ15::test_mix_cmplx_q15()
+    {
+        const q15_t *inp1=input1.ptr();
+        q15_t *outp=output.ptr();
+        uint32_t nb = input1.nbSamples() >> 1;
+        arm_nco_instance_q15 nco;
+
+        arm_nco_init_q15(&nco,NCO_FREQUENCY,NCO_PHASE);
+
+        /* The phase must be continuous from one call to the next */
+        arm_mix_cmplx_q15(&nco,inp1,outp,3);
+        arm_mix_cmplx_q15(&nco,inp1 + 6,outp + 6,nb - 3);
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_NEAR_EQ(output,ref,ABS_ERROR_NCO_Q15);
+
+    }
+
+    void ComplexTestsQ15::test_nco_q15()
+    {
+        q15_t *outp=output.ptr();
+        arm_nco_instance_q15 nco;
+
+        arm_nco_init_q15(&nco,NCO_FREQUENCY,NCO_PHASE);
+
+        arm_nco_q15(&nco,outp,5);
+        arm_nco_q15(&nco,outp + 10,(ref.nbSamples() >> 1) - 5);
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_NEAR_EQ(output,ref,ABS_ERROR_NCO_Q15);
+
+    }
+
     void ComplexTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
       
@@ -354,6 +398,27 @@ a double precision computation.
 
           output.create(ref.nbSamples(),ComplexTestsQ15::OUT_SAMPLES_Q15_ID,mgr);
         break;
+
+        case ComplexTestsQ15::TEST_MIX_CMPLX_Q15_28:
+          nb = 11;
+          ref.reload(ComplexTestsQ15::REF_MIX_CMPLX_Q15_ID,mgr,nb << 1);
+          input1.reload(ComplexTestsQ15::INPUT1_Q15_ID,mgr,nb << 1);
+
+          output.create(ref.nbSamples(),ComplexTestsQ15::OUT_SAMPLES_Q15_ID,mgr);
+        break;
+
+        case ComplexTestsQ15::TEST_MIX_CMPLX_Q15_29:
+          ref.reload(ComplexTestsQ15::REF_MIX_CMPLX_Q15_ID,mgr);
+          input1.reload(ComplexTestsQ15::INPUT1_Q15_ID,mgr);
+
+          output.create(ref.nbSamples(),ComplexTestsQ15::OUT_SAMPLES_Q15_ID,mgr);
+        break;
+
+        case ComplexTestsQ15::TEST_NCO_Q15_30:
+          ref.reload(ComplexTestsQ15::REF_NCO_Q15_ID,mgr);
+
+          output.create(ref.nbSamples(),ComplexTestsQ15::OUT_SAMPLES_Q15_ID,mgr);
+        break;
        }
       
 
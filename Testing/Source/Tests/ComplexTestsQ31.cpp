@@ -13,6 +13,14 @@ a double precision computation.
 #define ABS_ERROR_Q31 ((q31_t)100)
 #define ABS_ERROR_Q63 ((q63_t)(1<<18))
 
+/* The NCO is interpolating the 512 points sine table */
+#define SNR_NCO_THRESHOLD 85
+#define ABS_ERROR_NCO_Q31 ((q31_t)40000)
+
+/* NCO parameters used to generate the reference patterns */
+#define NCO_FREQUENCY ((q31_t)(17 << 23))
+#define NCO_PHASE ((q31_t)(3 << 25))
+
 
     void ComplexTestsQ31::test_cmplx_conj_q31()
     {
@@ -118,6 +126,45 @@ a double precision computation.
 
     } 
  
+    void ComplexTestsQ31::test_mix_cmplx_q31()
+    {
+        const q31_t *inp1=input1.ptr();
+        q31_t *outp=output.ptr();
+        uint32_t nb = input1.nbSamples() >> 1;
+        arm_nco_instance_q31 nco;
+
+        arm_nco_init_q31(&nco,NCO_FREQUENCY,NCO_PHASE);
+
+        /* The phase must be continuous from one call to the next */
+        arm_mix_cmplx_q31(&nco,inp1,outp,3);
+        arm_mix_cmplx_q31(&nco,inp1 + 6,outp + 6,nb - 3);
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_NCO_THRESHOLD);
+
+        ASSERT_NEAR_EQ(output,ref,ABS_ERROR_NCO_Q31);
+
+    }
+
+    void ComplexTestsQ31::test_nco_q31()
+    {
+        q31_t *outp=output.ptr();
+        arm_nco_instance_q31 nco;
+
+        arm_nco_init_q31(&nco,NCO_FREQUENCY,NCO_PHASE);
+
+        arm_nco_q31(&nco,outp,5);
+        arm_nco_q31(&nco,outp + 10,(ref.nbSamples() >> 1) - 5);
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_NCO_THRESHOLD);
+
+        ASSERT_NEAR_EQ(output,ref,ABS_ERROR_NCO_Q31);
+
+    }
+
     void ComplexTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
       
@@ -306,6 +353,27 @@ a double precision computation.
 
           output.create(ref.nbSamples(),ComplexTestsQ31::OUT_SAMPLES_Q31_ID,mgr);
         break;
+
+        case ComplexTestsQ31::TEST_MIX_CMPLX_Q31_24:
+          nb = 11;
+          ref.reload(ComplexTestsQ31::REF_MIX_CMPLX_Q31_ID,mgr,nb << 1);
+          input1.reload(ComplexTestsQ31::INPUT1_Q31_ID,mgr,nb << 1);
+
+          output.create(ref.nbSamples(),ComplexTestsQ31::OUT_SAMPLES_Q31_ID,mgr);
+        break;
+
+        case ComplexTestsQ31::TEST_MIX_CMPLX_Q31_25:
+          ref.reload(ComplexTestsQ31::REF_MIX_CMPLX_Q31_ID,mgr);
+          input1.reload(ComplexTestsQ31::INPUT1_Q31_ID,mgr);
+
+          output.create(ref.nbSamples(),ComplexTestsQ31::OUT_SAMPLES_Q31_ID,mgr);
+        break;
+
+        case ComplexTestsQ31::TEST_NCO_Q31_26:
+          ref.reload(ComplexTestsQ31::REF_NCO_Q31_ID,mgr);
+
+          output.create(ref.nbSamples(),ComplexTestsQ31::OUT_SAMPLES_Q31_ID,mgr);
+        break;
         
        }
       
@@ -0,0 +1,404 @@
+#include "ControllerTestsF32.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define ABS_ERROR_PID 1.0e-6
+#define REL_ERROR_PID 1.0e-5
+#define ABS_ERROR_TRANSFORM 1.0e-6
+#define REL_ERROR_TRANSFORM 1.0e-5
+#define MAX_CONTROLLERS 16
+
+/*
+
+The blocks have sizes which are not a multiple of
+the vector width to test the tails.
+
+*/
+static const uint32_t blockSizes[]={1,2,3,4,5,6,7,8,9,15,16,17,19};
+
+static uint32_t block_size(uint32_t k,uint32_t remaining)
+{
+    uint32_t blockSize = blockSizes[k % (sizeof(blockSizes)/sizeof(uint32_t))];
+
+    if (blockSize > remaining)
+    {
+       blockSize = remaining;
+    }
+
+    return(blockSize);
+}
+
+/*
+
+Each controller of the bank is computed with arm_pid_f32.
+When limits are used, the output is clamped and written back
+to the state of the controller.
+
+*/
+static void ref_pid_bank(const float32_t *pInputs,
+                         const float32_t *pGains,
+                         const float32_t *pMin,
+                         const float32_t *pMax,
+                         float32_t *pRef,
+                         uint32_t numControllers,
+                         uint32_t nbSteps)
+{
+    arm_pid_instance_f32 S;
+    float32_t out;
+
+    for(uint32_t i=0; i < numControllers; i++)
+    {
+       S.Kp = pGains[i];
+       S.Ki = pGains[numControllers + i];
+       S.Kd = pGains[2*numControllers + i];
+       arm_pid_init_f32(&S,1);
+
+       for(uint32_t n=0; n < nbSteps; n++)
+       {
+          out = arm_pid_f32(&S,pInputs[n*numControllers + i]);
+
+          if ((pMin != NULL) && (out < pMin[i]))
+          {
+             out = pMin[i];
+          }
+          if ((pMax != NULL) && (out > pMax[i]))
+          {
+             out = pMax[i];
+          }
+          S.state[2] = out;
+
+          pRef[n*numControllers + i] = out;
+       }
+    }
+}
+
+    void ControllerTestsF32::test_pid_bank_f32()
+    {
+       const float32_t *inp = inputs.ptr();
+       const float32_t *gainsp = gains.ptr();
+       float32_t *outp = output.ptr();
+       float32_t *refp = ref.ptr();
+       float32_t bankGains[3*MAX_CONTROLLERS];
+       float32_t bankState[3*MAX_CONTROLLERS];
+       arm_pid_bank_instance_f32 S;
+
+       arm_pid_bank_init_f32(&S,this->numControllers,
+         gainsp,gainsp + this->numControllers,gainsp + 2*this->numControllers,
+         bankGains,bankState,NULL,NULL);
+
+       for(uint32_t n=0; n < this->nbSteps; n++)
+       {
+          arm_pid_bank_f32(&S,inp + n*this->numControllers,outp);
+          outp += this->numControllers;
+       }
+
+       /* After a reset, the bank is computing the same outputs again */
+       arm_pid_bank_reset_f32(&S);
+       for(uint32_t n=0; n < this->nbSteps; n++)
+       {
+          arm_pid_bank_f32(&S,inp + n*this->numControllers,outp);
+          outp += this->numControllers;
+       }
+
+       ref_pid_bank(inp,gainsp,NULL,NULL,refp,this->numControllers,this->nbSteps);
+       memcpy(refp + this->numControllers*this->nbSteps,refp,
+         this->numControllers*this->nbSteps*sizeof(float32_t));
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_PID,REL_ERROR_PID);
+    }
+
+    void ControllerTestsF32::test_pid_bank_limits_f32()
+    {
+       const float32_t *inp = inputs.ptr();
+       const float32_t *gainsp = gains.ptr();
+       const float32_t *minp = limits.ptr();
+       const float32_t *maxp = limits.ptr() + this->numControllers;
+       float32_t *outp = output.ptr();
+       float32_t *refp = ref.ptr();
+       float32_t bankGains[3*MAX_CONTROLLERS];
+       float32_t bankState[3*MAX_CONTROLLERS];
+       arm_pid_bank_instance_f32 S;
+       int nbMin = 0;
+       int nbMax = 0;
+
+       arm_pid_bank_init_f32(&S,this->numControllers,
+         gainsp,gainsp + this->numControllers,gainsp + 2*this->numControllers,
+         bankGains,bankState,minp,maxp);
+
+       for(uint32_t n=0; n < this->nbSteps; n++)
+       {
+          arm_pid_bank_f32(&S,inp + n*this->numControllers,outp);
+          outp += this->numControllers;
+       }
+
+       ref_pid_bank(inp,gainsp,minp,maxp,refp,this->numControllers,this->nbSteps);
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_PID,REL_ERROR_PID);
+
+       /* The patterns are such that both limits are reached */
+       outp = output.ptr();
+       for(uint32_t n=0; n < this->nbSteps; n++)
+       {
+          for(uint32_t i=0; i < this->numControllers; i++)
+          {
+             if (outp[i] == minp[i])
+             {
+                nbMin++;
+             }
+             if (outp[i] == maxp[i])
+             {
+                nbMax++;
+             }
+          }
+          outp += this->numControllers;
+       }
+
+       ASSERT_TRUE(nbMin > 0);
+       ASSERT_TRUE(nbMax > 0);
+    }
+
+    void ControllerTestsF32::test_clarke_block_f32()
+    {
+       const float32_t *inA = currents.ptr();
+       const float32_t *inB = currents.ptr() + this->nbSamples;
+       float32_t *outA = output.ptr();
+       float32_t *outB = output.ptr() + this->nbSamples;
+       float32_t *refA = ref.ptr();
+       float32_t *refB = ref.ptr() + this->nbSamples;
+       uint32_t blockSize;
+
+       for(uint32_t i=0, k=0; i < this->nbSamples; i += blockSize, k++)
+       {
+          blockSize = block_size(k,this->nbSamples - i);
+          arm_clarke_block_f32(inA + i,inB + i,outA + i,outB + i,blockSize);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_clarke_f32(inA[i],inB[i],&refA[i],&refB[i]);
+       }
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_TRANSFORM,REL_ERROR_TRANSFORM);
+    }
+
+    void ControllerTestsF32::test_inv_clarke_block_f32()
+    {
+       const float32_t *inA = currents.ptr();
+       const float32_t *inB = currents.ptr() + this->nbSamples;
+       float32_t *outA = output.ptr();
+       float32_t *outB = output.ptr() + this->nbSamples;
+       float32_t *refA = ref.ptr();
+       float32_t *refB = ref.ptr() + this->nbSamples;
+       uint32_t blockSize;
+
+       for(uint32_t i=0, k=0; i < this->nbSamples; i += blockSize, k++)
+       {
+          blockSize = block_size(k,this->nbSamples - i);
+          arm_inv_clarke_block_f32(inA + i,inB + i,outA + i,outB + i,blockSize);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_inv_clarke_f32(inA[i],inB[i],&refA[i],&refB[i]);
+       }
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_TRANSFORM,REL_ERROR_TRANSFORM);
+    }
+
+    void ControllerTestsF32::test_park_block_f32()
+    {
+       const float32_t *inA = currents.ptr();
+       const float32_t *inB = currents.ptr() + this->nbSamples;
+       float32_t *outA = output.ptr();
+       float32_t *outB = output.ptr() + this->nbSamples;
+       float32_t *refA = ref.ptr();
+       float32_t *refB = ref.ptr() + this->nbSamples;
+       uint32_t blockSize;
+       const float32_t *anglesp = angles.ptr();
+       float32_t *sinp = sinCos.ptr();
+       float32_t *cosp = sinCos.ptr() + this->nbSamples;
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          sinp[i] = sinf(anglesp[i]);
+          cosp[i] = cosf(anglesp[i]);
+       }
+
+       for(uint32_t i=0, k=0; i < this->nbSamples; i += blockSize, k++)
+       {
+          blockSize = block_size(k,this->nbSamples - i);
+          arm_park_block_f32(inA + i,inB + i,sinp + i,cosp + i,outA + i,outB + i,blockSize);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_park_f32(inA[i],inB[i],&refA[i],&refB[i],sinp[i],cosp[i]);
+       }
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_TRANSFORM,REL_ERROR_TRANSFORM);
+    }
+
+    void ControllerTestsF32::test_inv_park_block_f32()
+    {
+       const float32_t *inA = currents.ptr();
+       const float32_t *inB = currents.ptr() + this->nbSamples;
+       float32_t *outA = output.ptr();
+       float32_t *outB = output.ptr() + this->nbSamples;
+       float32_t *refA = ref.ptr();
+       float32_t *refB = ref.ptr() + this->nbSamples;
+       uint32_t blockSize;
+       const float32_t *anglesp = angles.ptr();
+       float32_t *sinp = sinCos.ptr();
+       float32_t *cosp = sinCos.ptr() + this->nbSamples;
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          sinp[i] = sinf(anglesp[i]);
+          cosp[i] = cosf(anglesp[i]);
+       }
+
+       for(uint32_t i=0, k=0; i < this->nbSamples; i += blockSize, k++)
+       {
+          blockSize = block_size(k,this->nbSamples - i);
+          arm_inv_park_block_f32(inA + i,inB + i,sinp + i,cosp + i,outA + i,outB + i,blockSize);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_inv_park_f32(inA[i],inB[i],&refA[i],&refB[i],sinp[i],cosp[i]);
+       }
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_TRANSFORM,REL_ERROR_TRANSFORM);
+    }
+
+    void ControllerTestsF32::test_clarke_park_f32()
+    {
+       const float32_t *inA = currents.ptr();
+       const float32_t *inB = currents.ptr() + this->nbSamples;
+       float32_t *outA = output.ptr();
+       float32_t *outB = output.ptr() + this->nbSamples;
+       float32_t *refA = ref.ptr();
+       float32_t *refB = ref.ptr() + this->nbSamples;
+       uint32_t blockSize;
+       const float32_t *anglesp = angles.ptr();
+       float32_t *sinp = sinCos.ptr();
+       float32_t *cosp = sinCos.ptr() + this->nbSamples;
+       float32_t alpha, beta;
+
+       for(uint32_t i=0, k=0; i < this->nbSamples; i += blockSize, k++)
+       {
+          blockSize = block_size(k,this->nbSamples - i);
+          arm_clarke_park_f32(inA + i,inB + i,anglesp + i,outA + i,outB + i,blockSize);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          sinp[i] = sinf(anglesp[i]);
+          cosp[i] = cosf(anglesp[i]);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_clarke_f32(inA[i],inB[i],&alpha,&beta);
+          arm_park_f32(alpha,beta,&refA[i],&refB[i],sinp[i],cosp[i]);
+       }
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_TRANSFORM,REL_ERROR_TRANSFORM);
+    }
+
+    void ControllerTestsF32::test_inv_park_clarke_f32()
+    {
+       const float32_t *inA = currents.ptr();
+       const float32_t *inB = currents.ptr() + this->nbSamples;
+       float32_t *outA = output.ptr();
+       float32_t *outB = output.ptr() + this->nbSamples;
+       float32_t *refA = ref.ptr();
+       float32_t *refB = ref.ptr() + this->nbSamples;
+       uint32_t blockSize;
+       const float32_t *anglesp = angles.ptr();
+       float32_t *sinp = sinCos.ptr();
+       float32_t *cosp = sinCos.ptr() + this->nbSamples;
+       float32_t alpha, beta;
+
+       for(uint32_t i=0, k=0; i < this->nbSamples; i += blockSize, k++)
+       {
+          blockSize = block_size(k,this->nbSamples - i);
+          arm_inv_park_clarke_f32(inA + i,inB + i,anglesp + i,outA + i,outB + i,blockSize);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          sinp[i] = sinf(anglesp[i]);
+          cosp[i] = cosf(anglesp[i]);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_inv_park_f32(inA[i],inB[i],&alpha,&beta,sinp[i],cosp[i]);
+          arm_inv_clarke_f32(alpha,beta,&refA[i],&refB[i]);
+       }
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_TRANSFORM,REL_ERROR_TRANSFORM);
+    }
+
+    void ControllerTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+       (void)paramsArgs;
+
+       switch(id)
+       {
+          case ControllerTestsF32::TEST_PID_BANK_F32_1:
+             inputs.reload(ControllerTestsF32::INPUTS_F32_ID,mgr);
+             gains.reload(ControllerTestsF32::GAINS_F32_ID,mgr);
+
+             this->numControllers = gains.nbSamples() / 3;
+             this->nbSteps = inputs.nbSamples() / this->numControllers;
+
+             output.create(2*inputs.nbSamples(),ControllerTestsF32::OUT_F32_ID,mgr);
+             ref.create(2*inputs.nbSamples(),ControllerTestsF32::REF_F32_ID,mgr);
+          break;
+
+          case ControllerTestsF32::TEST_PID_BANK_LIMITS_F32_2:
+             inputs.reload(ControllerTestsF32::INPUTS_F32_ID,mgr);
+             gains.reload(ControllerTestsF32::GAINS_F32_ID,mgr);
+
+             this->numControllers = gains.nbSamples() / 3;
+             this->nbSteps = inputs.nbSamples() / this->numControllers;
+
+             limits.reload(ControllerTestsF32::LIMITS_F32_ID,mgr);
+             output.create(inputs.nbSamples(),ControllerTestsF32::OUT_F32_ID,mgr);
+             ref.create(inputs.nbSamples(),ControllerTestsF32::REF_F32_ID,mgr);
+          break;
+
+          case ControllerTestsF32::TEST_CLARKE_BLOCK_F32_3:
+          case ControllerTestsF32::TEST_INV_CLARKE_BLOCK_F32_4:
+          case ControllerTestsF32::TEST_PARK_BLOCK_F32_5:
+          case ControllerTestsF32::TEST_INV_PARK_BLOCK_F32_6:
+          case ControllerTestsF32::TEST_CLARKE_PARK_F32_7:
+          case ControllerTestsF32::TEST_INV_PARK_CLARKE_F32_8:
+             currents.reload(ControllerTestsF32::CURRENTS_F32_ID,mgr);
+             angles.reload(ControllerTestsF32::ANGLES_F32_ID,mgr);
+
+             this->nbSamples = angles.nbSamples();
+
+             output.create(2*this->nbSamples,ControllerTestsF32::OUT_F32_ID,mgr);
+             ref.create(2*this->nbSamples,ControllerTestsF32::REF_F32_ID,mgr);
+             sinCos.create(2*this->nbSamples,ControllerTestsF32::TMP_F32_ID,mgr);
+          break;
+       }
+    }
+
+    void ControllerTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+       (void)id;
+       output.dump(mgr);
+    }
@@ -0,0 +1,168 @@
+#include "ControllerTestsQ15.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define MAX_CONTROLLERS 16
+
+/*
+
+Each controller of the bank is computed with arm_pid_q15.
+When limits are used, the output is clamped and written back
+to the state of the controller.
+
+*/
+static void ref_pid_bank(const q15_t *pInputs,
+                         const q15_t *pGains,
+                         const q15_t *pMin,
+                         const q15_t *pMax,
+                         q15_t *pRef,
+                         uint32_t numControllers,
+                         uint32_t nbSteps)
+{
+    arm_pid_instance_q15 S;
+    q15_t out;
+
+    for(uint32_t i=0; i < numControllers; i++)
+    {
+       S.Kp = pGains[i];
+       S.Ki = pGains[numControllers + i];
+       S.Kd = pGains[2*numControllers + i];
+       arm_pid_init_q15(&S,1);
+
+       for(uint32_t n=0; n < nbSteps; n++)
+       {
+          out = arm_pid_q15(&S,pInputs[n*numControllers + i]);
+
+          if ((pMin != NULL) && (out < pMin[i]))
+          {
+             out = pMin[i];
+          }
+          if ((pMax != NULL) && (out > pMax[i]))
+          {
+             out = pMax[i];
+          }
+          S.state[2] = out;
+
+          pRef[n*numControllers + i] = out;
+       }
+    }
+}
+
+    void ControllerTestsQ15::test_pid_bank_q15()
+    {
+       const q15_t *inp = inputs.ptr();
+       const q15_t *gainsp = gains.ptr();
+       q15_t *outp = output.ptr();
+       q15_t *refp = ref.ptr();
+       q15_t bankGains[3*MAX_CONTROLLERS];
+       q15_t bankState[3*MAX_CONTROLLERS];
+       arm_pid_bank_instance_q15 S;
+
+       arm_pid_bank_init_q15(&S,this->numControllers,
+         gainsp,gainsp + this->numControllers,gainsp + 2*this->numControllers,
+         bankGains,bankState,NULL,NULL);
+
+       for(uint32_t n=0; n < this->nbSteps; n++)
+       {
+          arm_pid_bank_q15(&S,inp + n*this->numControllers,outp);
+          outp += this->numControllers;
+       }
+
+       /* After a reset, the bank is computing the same outputs again */
+       arm_pid_bank_reset_q15(&S);
+       for(uint32_t n=0; n < this->nbSteps; n++)
+       {
+          arm_pid_bank_q15(&S,inp + n*this->numControllers,outp);
+          outp += this->numControllers;
+       }
+
+       ref_pid_bank(inp,gainsp,NULL,NULL,refp,this->numControllers,this->nbSteps);
+       memcpy(refp + this->numControllers*this->nbSteps,refp,
+         this->numControllers*this->nbSteps*sizeof(q15_t));
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_NEAR_EQ(output,ref,(q15_t)0);
+    }
+
+    void ControllerTestsQ15::test_pid_bank_limits_q15()
+    {
+       const q15_t *inp = inputs.ptr();
+       const q15_t *gainsp = gains.ptr();
+       const q15_t *minp = limits.ptr();
+       const q15_t *maxp = limits.ptr() + this->numControllers;
+       q15_t *outp = output.ptr();
+       q15_t *refp = ref.ptr();
+       q15_t bankGains[3*MAX_CONTROLLERS];
+       q15_t bankState[3*MAX_CONTROLLERS];
+       arm_pid_bank_instance_q15 S;
+       int nbMin = 0;
+       int nbMax = 0;
+
+       arm_pid_bank_init_q15(&S,this->numControllers,
+         gainsp,gainsp + this->numControllers,gainsp + 2*this->numControllers,
+         bankGains,bankState,minp,maxp);
+
+       for(uint32_t n=0; n < this->nbSteps; n++)
+       {
+          arm_pid_bank_q15(&S,inp + n*this->numControllers,outp);
+          outp += this->numControllers;
+       }
+
+       ref_pid_bank(inp,gainsp,minp,maxp,refp,this->numControllers,this->nbSteps);
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_NEAR_EQ(output,ref,(q15_t)0);
+
+       /* The patterns are such that both limits are reached */
+       outp = output.ptr();
+       for(uint32_t n=0; n < this->nbSteps; n++)
+       {
+          for(uint32_t i=0; i < this->numControllers; i++)
+          {
+             if (outp[i] == minp[i])
+             {
+                nbMin++;
+             }
+             if (outp[i] == maxp[i])
+             {
+                nbMax++;
+             }
+          }
+          outp += this->numControllers;
+       }
+
+       ASSERT_TRUE(nbMin > 0);
+       ASSERT_TRUE(nbMax > 0);
+    }
+
+    void ControllerTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+       (void)paramsArgs;
+
+       inputs.reload(ControllerTestsQ15::INPUTS_Q15_ID,mgr);
+       gains.reload(ControllerTestsQ15::GAINS_Q15_ID,mgr);
+
+       this->numControllers = gains.nbSamples() / 3;
+       this->nbSteps = inputs.nbSamples() / this->numControllers;
+
+       switch(id)
+       {
+          case ControllerTestsQ15::TEST_PID_BANK_Q15_1:
+             output.create(2*inputs.nbSamples(),ControllerTestsQ15::OUT_Q15_ID,mgr);
+             ref.create(2*inputs.nbSamples(),ControllerTestsQ15::REF_Q15_ID,mgr);
+          break;
+
+          case ControllerTestsQ15::TEST_PID_BANK_LIMITS_Q15_2:
+             limits.reload(ControllerTestsQ15::LIMITS_Q15_ID,mgr);
+             output.create(inputs.nbSamples(),ControllerTestsQ15::OUT_Q15_ID,mgr);
+             ref.create(inputs.nbSamples(),ControllerTestsQ15::REF_Q15_ID,mgr);
+          break;
+       }
+    }
+
+    void ControllerTestsQ15::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+       (void)id;
+       output.dump(mgr);
+    }
@@ -0,0 +1,396 @@
+#include "ControllerTestsQ31.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define MAX_CONTROLLERS 16
+
+/*
+
+The blocks have sizes which are not a multiple of
+the vector width to test the tails.
+
+*/
+static const uint32_t blockSizes[]={1,2,3,4,5,6,7,8,9,15,16,17,19};
+
+static uint32_t block_size(uint32_t k,uint32_t remaining)
+{
+    uint32_t blockSize = blockSizes[k % (sizeof(blockSizes)/sizeof(uint32_t))];
+
+    if (blockSize > remaining)
+    {
+       blockSize = remaining;
+    }
+
+    return(blockSize);
+}
+
+/*
+
+Each controller of the bank is computed with arm_pid_q31.
+When limits are used, the output is clamped and written back
+to the state of the controller.
+
+*/
+static void ref_pid_bank(const q31_t *pInputs,
+                         const q31_t *pGains,
+                         const q31_t *pMin,
+                         const q31_t *pMax,
+                         q31_t *pRef,
+                         uint32_t numControllers,
+                         uint32_t nbSteps)
+{
+    arm_pid_instance_q31 S;
+    q31_t out;
+
+    for(uint32_t i=0; i < numControllers; i++)
+    {
+       S.Kp = pGains[i];
+       S.Ki = pGains[numControllers + i];
+       S.Kd = pGains[2*numControllers + i];
+       arm_pid_init_q31(&S,1);
+
+       for(uint32_t n=0; n < nbSteps; n++)
+       {
+          out = arm_pid_q31(&S,pInputs[n*numControllers + i]);
+
+          if ((pMin != NULL) && (out < pMin[i]))
+          {
+             out = pMin[i];
+          }
+          if ((pMax != NULL) && (out > pMax[i]))
+          {
+             out = pMax[i];
+          }
+          S.state[2] = out;
+
+          pRef[n*numControllers + i] = out;
+       }
+    }
+}
+
+    void ControllerTestsQ31::test_pid_bank_q31()
+    {
+       const q31_t *inp = inputs.ptr();
+       const q31_t *gainsp = gains.ptr();
+       q31_t *outp = output.ptr();
+       q31_t *refp = ref.ptr();
+       q31_t bankGains[3*MAX_CONTROLLERS];
+       q31_t bankState[3*MAX_CONTROLLERS];
+       arm_pid_bank_instance_q31 S;
+
+       arm_pid_bank_init_q31(&S,this->numControllers,
+         gainsp,gainsp + this->numControllers,gainsp + 2*this->numControllers,
+         bankGains,bankState,NULL,NULL);
+
+       for(uint32_t n=0; n < this->nbSteps; n++)
+       {
+          arm_pid_bank_q31(&S,inp + n*this->numControllers,outp);
+          outp += this->numControllers;
+       }
+
+       /* After a reset, the bank is computing the same outputs again */
+       arm_pid_bank_reset_q31(&S);
+       for(uint32_t n=0; n < this->nbSteps; n++)
+       {
+          arm_pid_bank_q31(&S,inp + n*this->numControllers,outp);
+          outp += this->numControllers;
+       }
+
+       ref_pid_bank(inp,gainsp,NULL,NULL,refp,this->numControllers,this->nbSteps);
+       memcpy(refp + this->numControllers*this->nbSteps,refp,
+         this->numControllers*this->nbSteps*sizeof(q31_t));
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_NEAR_EQ(output,ref,(q31_t)0);
+    }
+
+    void ControllerTestsQ31::test_pid_bank_limits_q31()
+    {
+       const q31_t *inp = inputs.ptr();
+       const q31_t *gainsp = gains.ptr();
+       const q31_t *minp = limits.ptr();
+       const q31_t *maxp = limits.ptr() + this->numControllers;
+       q31_t *outp = output.ptr();
+       q31_t *refp = ref.ptr();
+       q31_t bankGains[3*MAX_CONTROLLERS];
+       q31_t bankState[3*MAX_CONTROLLERS];
+       arm_pid_bank_instance_q31 S;
+       int nbMin = 0;
+       int nbMax = 0;
+
+       arm_pid_bank_init_q31(&S,this->numControllers,
+         gainsp,gainsp + this->numControllers,gainsp + 2*this->numControllers,
+         bankGains,bankState,minp,maxp);
+
+       for(uint32_t n=0; n < this->nbSteps; n++)
+       {
+          arm_pid_bank_q31(&S,inp + n*this->numControllers,outp);
+          outp += this->numControllers;
+       }
+
+       ref_pid_bank(inp,gainsp,minp,maxp,refp,this->numControllers,this->nbSteps);
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_NEAR_EQ(output,ref,(q31_t)0);
+
+       /* The patterns are such that both limits are reached */
+       outp = output.ptr();
+       for(uint32_t n=0; n < this->nbSteps; n++)
+       {
+          for(uint32_t i=0; i < this->numControllers; i++)
+          {
+             if (outp[i] == minp[i])
+             {
+                nbMin++;
+             }
+             if (outp[i] == maxp[i])
+             {
+                nbMax++;
+             }
+          }
+          outp += this->numControllers;
+       }
+
+       ASSERT_TRUE(nbMin > 0);
+       ASSERT_TRUE(nbMax > 0);
+    }
+
+    void ControllerTestsQ31::test_clarke_block_q31()
+    {
+       const q31_t *inA = currents.ptr();
+       const q31_t *inB = currents.ptr() + this->nbSamples;
+       q31_t *outA = output.ptr();
+       q31_t *outB = output.ptr() + this->nbSamples;
+       q31_t *refA = ref.ptr();
+       q31_t *refB = ref.ptr() + this->nbSamples;
+       uint32_t blockSize;
+
+       for(uint32_t i=0, k=0; i < this->nbSamples; i += blockSize, k++)
+       {
+          blockSize = block_size(k,this->nbSamples - i);
+          arm_clarke_block_q31(inA + i,inB + i,outA + i,outB + i,blockSize);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_clarke_q31(inA[i],inB[i],&refA[i],&refB[i]);
+       }
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_NEAR_EQ(output,ref,(q31_t)0);
+    }
+
+    void ControllerTestsQ31::test_inv_clarke_block_q31()
+    {
+       const q31_t *inA = currents.ptr();
+       const q31_t *inB = currents.ptr() + this->nbSamples;
+       q31_t *outA = output.ptr();
+       q31_t *outB = output.ptr() + this->nbSamples;
+       q31_t *refA = ref.ptr();
+       q31_t *refB = ref.ptr() + this->nbSamples;
+       uint32_t blockSize;
+
+       for(uint32_t i=0, k=0; i < this->nbSamples; i += blockSize, k++)
+       {
+          blockSize = block_size(k,this->nbSamples - i);
+          arm_inv_clarke_block_q31(inA + i,inB + i,outA + i,outB + i,blockSize);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_inv_clarke_q31(inA[i],inB[i],&refA[i],&refB[i]);
+       }
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_NEAR_EQ(output,ref,(q31_t)0);
+    }
+
+    void ControllerTestsQ31::test_park_block_q31()
+    {
+       const q31_t *inA = currents.ptr();
+       const q31_t *inB = currents.ptr() + this->nbSamples;
+       q31_t *outA = output.ptr();
+       q31_t *outB = output.ptr() + this->nbSamples;
+       q31_t *refA = ref.ptr();
+       q31_t *refB = ref.ptr() + this->nbSamples;
+       uint32_t blockSize;
+       const q31_t *anglesp = angles.ptr();
+       q31_t *sinp = sinCos.ptr();
+       q31_t *cosp = sinCos.ptr() + this->nbSamples;
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_sin_cos_q31(anglesp[i],&sinp[i],&cosp[i]);
+       }
+
+       for(uint32_t i=0, k=0; i < this->nbSamples; i += blockSize, k++)
+       {
+          blockSize = block_size(k,this->nbSamples - i);
+          arm_park_block_q31(inA + i,inB + i,sinp + i,cosp + i,outA + i,outB + i,blockSize);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_park_q31(inA[i],inB[i],&refA[i],&refB[i],sinp[i],cosp[i]);
+       }
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_NEAR_EQ(output,ref,(q31_t)0);
+    }
+
+    void ControllerTestsQ31::test_inv_park_block_q31()
+    {
+       const q31_t *inA = currents.ptr();
+       const q31_t *inB = currents.ptr() + this->nbSamples;
+       q31_t *outA = output.ptr();
+       q31_t *outB = output.ptr() + this->nbSamples;
+       q31_t *refA = ref.ptr();
+       q31_t *refB = ref.ptr() + this->nbSamples;
+       uint32_t blockSize;
+       const q31_t *anglesp = angles.ptr();
+       q31_t *sinp = sinCos.ptr();
+       q31_t *cosp = sinCos.ptr() + this->nbSamples;
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_sin_cos_q31(anglesp[i],&sinp[i],&cosp[i]);
+       }
+
+       for(uint32_t i=0, k=0; i < this->nbSamples; i += blockSize, k++)
+       {
+          blockSize = block_size(k,this->nbSamples - i);
+          arm_inv_park_block_q31(inA + i,inB + i,sinp + i,cosp + i,outA + i,outB + i,blockSize);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_inv_park_q31(inA[i],inB[i],&refA[i],&refB[i],sinp[i],cosp[i]);
+       }
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_NEAR_EQ(output,ref,(q31_t)0);
+    }
+
+    void ControllerTestsQ31::test_clarke_park_q31()
+    {
+       const q31_t *inA = currents.ptr();
+       const q31_t *inB = currents.ptr() + this->nbSamples;
+       q31_t *outA = output.ptr();
+       q31_t *outB = output.ptr() + this->nbSamples;
+       q31_t *refA = ref.ptr();
+       q31_t *refB = ref.ptr() + this->nbSamples;
+       uint32_t blockSize;
+       const q31_t *anglesp = angles.ptr();
+       q31_t *sinp = sinCos.ptr();
+       q31_t *cosp = sinCos.ptr() + this->nbSamples;
+       q31_t alpha, beta;
+
+       for(uint32_t i=0, k=0; i < this->nbSamples; i += blockSize, k++)
+       {
+          blockSize = block_size(k,this->nbSamples - i);
+          arm_clarke_park_q31(inA + i,inB + i,anglesp + i,outA + i,outB + i,blockSize);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_sin_cos_q31(anglesp[i],&sinp[i],&cosp[i]);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_clarke_q31(inA[i],inB[i],&alpha,&beta);
+          arm_park_q31(alpha,beta,&refA[i],&refB[i],sinp[i],cosp[i]);
+       }
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_NEAR_EQ(output,ref,(q31_t)0);
+    }
+
+    void ControllerTestsQ31::test_inv_park_clarke_q31()
+    {
+       const q31_t *inA = currents.ptr();
+       const q31_t *inB = currents.ptr() + this->nbSamples;
+       q31_t *outA = output.ptr();
+       q31_t *outB = output.ptr() + this->nbSamples;
+       q31_t *refA = ref.ptr();
+       q31_t *refB = ref.ptr() + this->nbSamples;
+       uint32_t blockSize;
+       const q31_t *anglesp = angles.ptr();
+       q31_t *sinp = sinCos.ptr();
+       q31_t *cosp = sinCos.ptr() + this->nbSamples;
+       q31_t alpha, beta;
+
+       for(uint32_t i=0, k=0; i < this->nbSamples; i += blockSize, k++)
+       {
+          blockSize = block_size(k,this->nbSamples - i);
+          arm_inv_park_clarke_q31(inA + i,inB + i,anglesp + i,outA + i,outB + i,blockSize);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_sin_cos_q31(anglesp[i],&sinp[i],&cosp[i]);
+       }
+
+       for(uint32_t i=0; i < this->nbSamples; i++)
+       {
+          arm_inv_park_q31(inA[i],inB[i],&alpha,&beta,sinp[i],cosp[i]);
+          arm_inv_clarke_q31(alpha,beta,&refA[i],&refB[i]);
+       }
+
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_NEAR_EQ(output,ref,(q31_t)0);
+    }
+
+    void ControllerTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+       (void)paramsArgs;
+
+       switch(id)
+       {
+          case ControllerTestsQ31::TEST_PID_BANK_Q31_1:
+             inputs.reload(ControllerTestsQ31::INPUTS_Q31_ID,mgr);
+             gains.reload(ControllerTestsQ31::GAINS_Q31_ID,mgr);
+
+             this->numControllers = gains.nbSamples() / 3;
+             this->nbSteps = inputs.nbSamples() / this->numControllers;
+
+             output.create(2*inputs.nbSamples(),ControllerTestsQ31::OUT_Q31_ID,mgr);
+             ref.create(2*inputs.nbSamples(),ControllerTestsQ31::REF_Q31_ID,mgr);
+          break;
+
+          case ControllerTestsQ31::TEST_PID_BANK_LIMITS_Q31_2:
+             inputs.reload(ControllerTestsQ31::INPUTS_Q31_ID,mgr);
+             gains.reload(ControllerTestsQ31::GAINS_Q31_ID,mgr);
+
+             this->numControllers = gains.nbSamples() / 3;
+             this->nbSteps = inputs.nbSamples() / this->numControllers;
+
+             limits.reload(ControllerTestsQ31::LIMITS_Q31_ID,mgr);
+             output.create(inputs.nbSamples(),ControllerTestsQ31::OUT_Q31_ID,mgr);
+             ref.create(inputs.nbSamples(),ControllerTestsQ31::REF_Q31_ID,mgr);
+          break;
+
+          case ControllerTestsQ31::TEST_CLARKE_BLOCK_Q31_3:
+          case ControllerTestsQ31::TEST_INV_CLARKE_BLOCK_Q31_4:
+          case ControllerTestsQ31::TEST_PARK_BLOCK_Q31_5:
+          case ControllerTestsQ31::TEST_INV_PARK_BLOCK_Q31_6:
+          case ControllerTestsQ31::TEST_CLARKE_PARK_Q31_7:
+          case ControllerTestsQ31::TEST_INV_PARK_CLARKE_Q31_8:
+             currents.reload(ControllerTestsQ31::CURRENTS_Q31_ID,mgr);
+             angles.reload(ControllerTestsQ31::ANGLES_Q31_ID,mgr);
+
+             this->nbSamples = angles.nbSamples();
+
+             output.create(2*this->nbSamples,ControllerTestsQ31::OUT_Q31_ID,mgr);
+             ref.create(2*this->nbSamples,ControllerTestsQ31::REF_Q31_ID,mgr);
+             sinCos.create(2*this->nbSamples,ControllerTestsQ31::TMP_Q31_ID,mgr);
+          break;
+       }
+    }
+
+    void ControllerTestsQ31::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+       (void)id;
+       output.dump(mgr);
+    }
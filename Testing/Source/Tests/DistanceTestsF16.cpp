@@ -9,6 +9,9 @@
 
 #define REL_MK_ERROR (1e-2)
 
+/* Some of the k-NN distances are zero */
+#define ABS_KNN_ERROR (1e-3)
+
 
     void DistanceTestsF16::test_braycurtis_distance_f16()
     {
@@ -193,11 +196,36 @@
     } 
   
   
+    void DistanceTestsF16::test_knn_f16()
+    {
+       arm_matrix_instance_f16 queries;
+       arm_matrix_instance_f16 references;
+       arm_status status;
+
+       queries.numRows=this->nbPatterns;
+       queries.numCols=this->vecDim;
+       queries.pData=(float16_t*)inputA.ptr();
+
+       references.numRows=this->nbReferences;
+       references.numCols=this->vecDim;
+       references.pData=(float16_t*)inputB.ptr();
+
+       status = arm_knn_f16(&queries,&references,this->knnK,outIndex.ptr(),output.ptr());
+       ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+       /* The samples are on a grid so the squared distances are
+          exact and equal distances are ordered by index */
+       ASSERT_CLOSE_ERROR(output,ref,ABS_KNN_ERROR,REL_ERROR);
+       ASSERT_EQ(outIndex,refIndex);
+    }
+
     void DistanceTestsF16::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
 
         (void)paramsArgs;
-        if ((id != DistanceTestsF16::TEST_MINKOWSKI_DISTANCE_F16_9) && (id != DistanceTestsF16::TEST_JENSENSHANNON_DISTANCE_F16_8))
+        if ((id != DistanceTestsF16::TEST_MINKOWSKI_DISTANCE_F16_9) && 
+            (id != DistanceTestsF16::TEST_JENSENSHANNON_DISTANCE_F16_8) &&
+            (id != DistanceTestsF16::TEST_KNN_F16_10))
         {
             inputA.reload(DistanceTestsF16::INPUTA_F16_ID,mgr);
             inputB.reload(DistanceTestsF16::INPUTB_F16_ID,mgr);
@@ -288,6 +316,27 @@
             }
             break;
 
+            case DistanceTestsF16::TEST_KNN_F16_10:
+            {
+              inputA.reload(DistanceTestsF16::INPUT_KNN_QUERIES_F16_ID,mgr);
+              inputB.reload(DistanceTestsF16::INPUT_KNN_REFS_F16_ID,mgr);
+              dims.reload(DistanceTestsF16::DIMS_KNN_S16_ID,mgr);
+
+              const int16_t   *dimsp = dims.ptr();
+
+              this->nbPatterns=dimsp[0];
+              this->nbReferences=dimsp[1];
+              this->vecDim=dimsp[2];
+              this->knnK=dimsp[3];
+
+              output.create(this->knnK*this->nbPatterns,DistanceTestsF16::OUT_F16_ID,mgr);
+              outIndex.create(this->knnK*this->nbPatterns,DistanceTestsF16::OUT_INDEX_U32_ID,mgr);
+
+              ref.reload(DistanceTestsF16::REF_KNN_DIST_F16_ID,mgr);
+              refIndex.reload(DistanceTestsF16::REF_KNN_INDEX_U32_ID,mgr);
+            }
+            break;
+
         }
 
        
@@ -3,6 +3,74 @@
 #include "Error.h"
 #include "Test.h"
 
+/* Number of neighbours in the k-NN test */
+#define KNN_K 3
+
+/* The second matrix of the cdist tests has less rows
+   so that the distance matrix is not square */
+#define CDIST_REMOVED_ROWS 3
+#define CDIST_MINKOWSKI_ORDER 3
+
+/* The euclidean distances of cdist are computed from the
+   norms and the dot products */
+#define CDIST_ABS_ERROR 1.0e-4
+#define CDIST_REL_ERROR 1.0e-4
+
+/*
+
+Distance between two rows with the vector distance functions.
+The rows are copied into the scratch buffer because the
+correlation distance is modifying its inputs.
+
+*/
+static float32_t pair_distance_f32(arm_cdist_metric metric,
+                                   const float32_t *pA,
+                                   const float32_t *pB,
+                                   float32_t *pScratch,
+                                   uint32_t vecDim)
+{
+    float32_t *tmpA = pScratch;
+    float32_t *tmpB = pScratch + vecDim;
+    float32_t d;
+
+    memcpy(tmpA,pA,vecDim*sizeof(float32_t));
+    memcpy(tmpB,pB,vecDim*sizeof(float32_t));
+
+    switch(metric)
+    {
+       case ARM_CDIST_EUCLIDEAN:
+          d = arm_euclidean_distance_f32(tmpA,tmpB,vecDim);
+       break;
+       case ARM_CDIST_SQEUCLIDEAN:
+          d = arm_euclidean_distance_f32(tmpA,tmpB,vecDim);
+          d = d * d;
+       break;
+       case ARM_CDIST_COSINE:
+          d = arm_cosine_distance_f32(tmpA,tmpB,vecDim);
+       break;
+       case ARM_CDIST_CORRELATION:
+          d = arm_correlation_distance_f32(tmpA,tmpB,vecDim);
+       break;
+       case ARM_CDIST_CITYBLOCK:
+          d = arm_cityblock_distance_f32(tmpA,tmpB,vecDim);
+       break;
+       case ARM_CDIST_CHEBYSHEV:
+          d = arm_chebyshev_distance_f32(tmpA,tmpB,vecDim);
+       break;
+       case ARM_CDIST_BRAYCURTIS:
+          d = arm_braycurtis_distance_f32(tmpA,tmpB,vecDim);
+       break;
+       case ARM_CDIST_CANBERRA:
+          d = arm_canberra_distance_f32(tmpA,tmpB,vecDim);
+       break;
+       default:
+          d = arm_jensenshannon_distance_f32(tmpA,tmpB,vecDim);
+       break;
+    }
+
+    return(d);
+}
+
 
 
     void DistanceTestsF32::test_dtw_distance_f32()
@@ -101,6 +169,182 @@
 
     }
 
+    void DistanceTestsF32::test_dtw_band_distance_f32()
+    {
+       const float32_t *inpA = inputA.ptr();
+       const float32_t *inpB = inputB.ptr();
+       float32_t *scratch = tmpA.ptr();
+       float32_t *upper = tmpB.ptr();
+       float32_t *lower = upper + this->templateLength;
+       float32_t *outp = output.ptr();
+       float32_t d, lb;
+       arm_status status;
+
+       /* Window big enough to have no constraint */
+       status = arm_dtw_band_distance_f32(inpA,this->queryLength,
+                                          inpB,this->templateLength,
+                                          1,this->queryLength,
+                                          F32_MAX,scratch,outp);
+       ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+       outp++;
+
+       /* ARM_DTW_SAKOE_CHIBA_WINDOW 5 */
+       status = arm_dtw_band_distance_f32(inpA,this->queryLength,
+                                          inpB,this->templateLength,
+                                          1,5,
+                                          F32_MAX,scratch,outp);
+       ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+       /* Early abandon */
+       status = arm_dtw_band_distance_f32(inpA,this->queryLength,
+                                          inpB,this->templateLength,
+                                          1,5,
+                                          0.5f * *outp,scratch,&d);
+       ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+       ASSERT_TRUE(d == F32_MAX);
+       outp++;
+
+       /* ARM_DTW_SAKOE_CHIBA_WINDOW 3 */
+       status = arm_dtw_band_distance_f32(inpA,this->queryLength,
+                                          inpB,this->templateLength,
+                                          1,3,
+                                          F32_MAX,scratch,&d);
+       ASSERT_TRUE(status == ARM_MATH_ARGUMENT_ERROR);
+
+       /* LB_Keogh with the start of the query */
+       arm_dtw_lb_keogh_envelope_f32(inpB,this->templateLength,1,2,upper,lower);
+       lb = arm_dtw_lb_keogh_f32(inpA,upper,lower,this->templateLength,1);
+       status = arm_dtw_band_distance_f32(inpA,this->templateLength,
+                                          inpB,this->templateLength,
+                                          1,2,
+                                          F32_MAX,scratch,&d);
+       ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+       ASSERT_TRUE(lb <= d);
+
+       ASSERT_NEAR_EQ(output,ref,(float32_t)1e-3);
+
+    }
+
+    void DistanceTestsF32::test_cdist_f32()
+    {
+       arm_matrix_instance_f32 srcA;
+       arm_matrix_instance_f32 srcB;
+       arm_matrix_instance_f32 dst;
+       arm_status status;
+       const int numB = this->nbPatterns - CDIST_REMOVED_ROWS;
+       const float32_t *inpA = inputA.ptr();
+       const float32_t *inpB = inputB.ptr();
+       const float32_t *refp = ref.ptr();
+       float32_t *outp = output.ptr();
+       float32_t *pairp = tmpA.ptr();
+       float32_t d;
+
+       srcA.numRows=this->nbPatterns;
+       srcA.numCols=this->vecDim;
+       srcA.pData=(float32_t*)inpA;
+
+       srcB.numRows=numB;
+       srcB.numCols=this->vecDim;
+       srcB.pData=(float32_t*)inpB;
+
+       dst.numRows=this->nbPatterns;
+       dst.numCols=numB;
+       dst.pData=outp;
+
+       status = arm_cdist_f32(&srcA,&srcB,this->cdistMetric,tmpB.ptr(),&dst);
+       ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+       /* All the pairs are compared with the distance functions */
+       for(int i=0; i < this->nbPatterns ; i ++)
+       {
+          for(int j=0; j < numB ; j ++)
+          {
+             pairp[i*numB + j] = pair_distance_f32(this->cdistMetric,
+                inpA + i*this->vecDim,
+                inpB + j*this->vecDim,
+                tmpB.ptr(),
+                this->vecDim);
+          }
+       }
+
+       ASSERT_CLOSE_ERROR(tmpA,output,CDIST_ABS_ERROR,CDIST_REL_ERROR);
+
+       /* The reference distances are between
+          the rows with the same index */
+       for(int i=0; i < numB ; i ++)
+       {
+          d = refp[i];
+          if (this->cdistMetric == ARM_CDIST_SQEUCLIDEAN)
+          {
+             d = d * d;
+          }
+          ASSERT_NEAR_EQ(outp[i*numB + i],d,(float32_t)1e-3);
+       }
+    }
+
+    void DistanceTestsF32::test_cdist_minkowski_f32()
+    {
+       arm_matrix_instance_f32 srcA;
+       arm_matrix_instance_f32 srcB;
+       arm_matrix_instance_f32 dst;
+       arm_status status;
+       const int numB = this->nbPatterns - CDIST_REMOVED_ROWS;
+       const float32_t *inpA = inputA.ptr();
+       const float32_t *inpB = inputB.ptr();
+       float32_t *pairp = tmpA.ptr();
+
+       srcA.numRows=this->nbPatterns;
+       srcA.numCols=this->vecDim;
+       srcA.pData=(float32_t*)inpA;
+
+       srcB.numRows=numB;
+       srcB.numCols=this->vecDim;
+       srcB.pData=(float32_t*)inpB;
+
+       dst.numRows=this->nbPatterns;
+       dst.numCols=numB;
+       dst.pData=output.ptr();
+
+       status = arm_cdist_minkowski_f32(&srcA,&srcB,CDIST_MINKOWSKI_ORDER,&dst);
+       ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+       for(int i=0; i < this->nbPatterns ; i ++)
+       {
+          for(int j=0; j < numB ; j ++)
+          {
+             pairp[i*numB + j] = arm_minkowski_distance_f32(
+                inpA + i*this->vecDim,
+                inpB + j*this->vecDim,
+                CDIST_MINKOWSKI_ORDER,
+                this->vecDim);
+          }
+       }
+
+       ASSERT_CLOSE_ERROR(tmpA,output,CDIST_ABS_ERROR,CDIST_REL_ERROR);
+    }
+
+    void DistanceTestsF32::test_knn_f32()
+    {
+       arm_matrix_instance_f32 queries;
+       arm_matrix_instance_f32 references;
+       arm_status status;
+
+       /* Each vector of A is searched in the vectors of B */
+       queries.numRows=this->nbPatterns;
+       queries.numCols=this->vecDim;
+       queries.pData=(float32_t*)inputA.ptr();
+
+       references.numRows=this->nbPatterns;
+       references.numCols=this->vecDim;
+       references.pData=(float32_t*)inputB.ptr();
+
+       status = arm_knn_f32(&queries,&references,KNN_K,outIndex.ptr(),output.ptr());
+       ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+       ASSERT_NEAR_EQ(output,ref,(float32_t)1e-3);
+       ASSERT_EQ(outIndex,refIndex);
+    }
+
     void DistanceTestsF32::test_braycurtis_distance_f32()
     {
        const float32_t *inpA = inputA.ptr();
@@ -288,7 +532,9 @@
     {
 
         (void)paramsArgs;
-        if ((id != DistanceTestsF32::TEST_MINKOWSKI_DISTANCE_F32_9) && (id != DistanceTestsF32::TEST_JENSENSHANNON_DISTANCE_F32_8))
+        if ((id != DistanceTestsF32::TEST_MINKOWSKI_DISTANCE_F32_9) && 
+            (id != DistanceTestsF32::TEST_JENSENSHANNON_DISTANCE_F32_8) &&
+            (id != DistanceTestsF32::TEST_CDIST_F32_19))
         {
             inputA.reload(DistanceTestsF32::INPUTA_F32_ID,mgr);
             inputB.reload(DistanceTestsF32::INPUTB_F32_ID,mgr);
@@ -401,6 +647,138 @@
             }
             break;
 
+         case DistanceTestsF32::TEST_DTW_BAND_DISTANCE_F32_11:
+            {
+              inputA.reload(DistanceTestsF32::INPUT_QUERY_F32_ID,mgr);
+              inputB.reload(DistanceTestsF32::INPUT_TEMPLATE_F32_ID,mgr);
+
+              this->queryLength=inputA.nbSamples();
+              this->templateLength=inputB.nbSamples();
+              output.create(2,DistanceTestsF32::OUT_F32_ID,mgr);
+              tmpA.create(2*(2*this->queryLength+1),DistanceTestsF32::TMPA_F32_ID,mgr);
+              tmpB.create(2*this->templateLength,DistanceTestsF32::TMPB_F32_ID,mgr);
+
+              ref.reload(DistanceTestsF32::REF11_F32_ID,mgr);
+
+            }
+            break;
+
+            case DistanceTestsF32::TEST_CDIST_F32_12:
+            {
+              ref.reload(DistanceTestsF32::REF1_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_BRAYCURTIS;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::OUT_F32_ID,mgr);
+              tmpA.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::TMPA_F32_ID,mgr);
+              tmpB.create(2*this->nbPatterns*(this->vecDim+1),DistanceTestsF32::TMPB_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsF32::TEST_CDIST_F32_13:
+            {
+              ref.reload(DistanceTestsF32::REF2_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_CANBERRA;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::OUT_F32_ID,mgr);
+              tmpA.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::TMPA_F32_ID,mgr);
+              tmpB.create(2*this->nbPatterns*(this->vecDim+1),DistanceTestsF32::TMPB_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsF32::TEST_CDIST_F32_14:
+            {
+              ref.reload(DistanceTestsF32::REF3_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_CHEBYSHEV;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::OUT_F32_ID,mgr);
+              tmpA.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::TMPA_F32_ID,mgr);
+              tmpB.create(2*this->nbPatterns*(this->vecDim+1),DistanceTestsF32::TMPB_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsF32::TEST_CDIST_F32_15:
+            {
+              ref.reload(DistanceTestsF32::REF4_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_CITYBLOCK;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::OUT_F32_ID,mgr);
+              tmpA.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::TMPA_F32_ID,mgr);
+              tmpB.create(2*this->nbPatterns*(this->vecDim+1),DistanceTestsF32::TMPB_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsF32::TEST_CDIST_F32_16:
+            {
+              ref.reload(DistanceTestsF32::REF5_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_CORRELATION;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::OUT_F32_ID,mgr);
+              tmpA.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::TMPA_F32_ID,mgr);
+              tmpB.create(2*this->nbPatterns*(this->vecDim+1),DistanceTestsF32::TMPB_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsF32::TEST_CDIST_F32_17:
+            {
+              ref.reload(DistanceTestsF32::REF6_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_COSINE;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::OUT_F32_ID,mgr);
+              tmpA.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::TMPA_F32_ID,mgr);
+              tmpB.create(2*this->nbPatterns*(this->vecDim+1),DistanceTestsF32::TMPB_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsF32::TEST_CDIST_F32_18:
+            {
+              ref.reload(DistanceTestsF32::REF7_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_EUCLIDEAN;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::OUT_F32_ID,mgr);
+              tmpA.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::TMPA_F32_ID,mgr);
+              tmpB.create(2*this->nbPatterns*(this->vecDim+1),DistanceTestsF32::TMPB_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsF32::TEST_CDIST_F32_19:
+            {
+              inputA.reload(DistanceTestsF32::INPUTA_JEN_F32_ID,mgr);
+              inputB.reload(DistanceTestsF32::INPUTB_JEN_F32_ID,mgr);
+              dims.reload(DistanceTestsF32::DIMS_S16_ID,mgr);
+
+              const int16_t   *dimsp = dims.ptr();
+
+              this->nbPatterns=dimsp[0];
+              this->vecDim=dimsp[1];
+
+              ref.reload(DistanceTestsF32::REF8_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_JENSENSHANNON;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::OUT_F32_ID,mgr);
+              tmpA.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::TMPA_F32_ID,mgr);
+              tmpB.create(2*this->nbPatterns*(this->vecDim+1),DistanceTestsF32::TMPB_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsF32::TEST_KNN_F32_20:
+            {
+              output.create(KNN_K*this->nbPatterns,DistanceTestsF32::OUT_F32_ID,mgr);
+              outIndex.create(KNN_K*this->nbPatterns,DistanceTestsF32::OUT_INDEX_U32_ID,mgr);
+
+              ref.reload(DistanceTestsF32::REF_KNN_DIST_F32_ID,mgr);
+              refIndex.reload(DistanceTestsF32::REF_KNN_INDEX_U32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsF32::TEST_CDIST_F32_21:
+            {
+              ref.reload(DistanceTestsF32::REF7_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_SQEUCLIDEAN;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::OUT_F32_ID,mgr);
+              tmpA.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::TMPA_F32_ID,mgr);
+              tmpB.create(2*this->nbPatterns*(this->vecDim+1),DistanceTestsF32::TMPB_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsF32::TEST_CDIST_MINKOWSKI_F32_22:
+            {
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::OUT_F32_ID,mgr);
+              tmpA.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsF32::TMPA_F32_ID,mgr);
+            }
+            break;
+
         }
 
        
@@ -0,0 +1,65 @@
+#include "DistanceTestsQ15.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+
+    void DistanceTestsQ15::test_knn_q15()
+    {
+       arm_matrix_instance_q15 queries;
+       arm_matrix_instance_q15 references;
+       arm_status status;
+
+       queries.numRows=this->nbPatterns;
+       queries.numCols=this->vecDim;
+       queries.pData=(q15_t*)inputA.ptr();
+
+       references.numRows=this->nbReferences;
+       references.numCols=this->vecDim;
+       references.pData=(q15_t*)inputB.ptr();
+
+       status = arm_knn_q15(&queries,&references,this->knnK,outIndex.ptr(),output.ptr());
+       ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+       /* The squared distances are exact in 34.30 format and
+          equal distances are ordered by index */
+       ASSERT_NEAR_EQ(output,ref,(q63_t)0);
+       ASSERT_EQ(outIndex,refIndex);
+    }
+
+    void DistanceTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+        (void)paramsArgs;
+
+        switch(id)
+        {
+            case DistanceTestsQ15::TEST_KNN_Q15_1:
+            {
+              inputA.reload(DistanceTestsQ15::INPUT_KNN_QUERIES_Q15_ID,mgr);
+              inputB.reload(DistanceTestsQ15::INPUT_KNN_REFS_Q15_ID,mgr);
+              dims.reload(DistanceTestsQ15::DIMS_KNN_S16_ID,mgr);
+
+              const int16_t   *dimsp = dims.ptr();
+
+              this->nbPatterns=dimsp[0];
+              this->nbReferences=dimsp[1];
+              this->vecDim=dimsp[2];
+              this->knnK=dimsp[3];
+
+              output.create(this->knnK*this->nbPatterns,DistanceTestsQ15::OUT_Q63_ID,mgr);
+              outIndex.create(this->knnK*this->nbPatterns,DistanceTestsQ15::OUT_INDEX_U32_ID,mgr);
+
+              ref.reload(DistanceTestsQ15::REF_KNN_DIST_Q63_ID,mgr);
+              refIndex.reload(DistanceTestsQ15::REF_KNN_INDEX_U32_ID,mgr);
+            }
+            break;
+        }
+
+    }
+
+    void DistanceTestsQ15::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+       (void)id;
+       output.dump(mgr);
+    }
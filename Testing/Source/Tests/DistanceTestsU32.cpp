@@ -5,6 +5,42 @@
 
 #define ERROR_THRESHOLD 1e-8
 
+/* The second set of the cdist tests has less vectors
+   so that the distance matrix is not square */
+#define CDIST_REMOVED_ROWS 3
+
+/* The cdist and the distance functions are not computing
+   the ratios with the same operations */
+#define CDIST_ERROR_THRESHOLD 1e-6
+
+static float32_t pair_distance_boolean(arm_cdist_boolean_metric metric,
+                                       const uint32_t *pA,
+                                       const uint32_t *pB,
+                                       uint32_t numberOfBools)
+{
+    switch(metric)
+    {
+       case ARM_CDIST_DICE:
+          return(arm_dice_distance(pA,pB,numberOfBools));
+       case ARM_CDIST_HAMMING:
+          return(arm_hamming_distance(pA,pB,numberOfBools));
+       case ARM_CDIST_JACCARD:
+          return(arm_jaccard_distance(pA,pB,numberOfBools));
+       case ARM_CDIST_KULSINSKI:
+          return(arm_kulsinski_distance(pA,pB,numberOfBools));
+       case ARM_CDIST_ROGERSTANIMOTO:
+          return(arm_rogerstanimoto_distance(pA,pB,numberOfBools));
+       case ARM_CDIST_RUSSELLRAO:
+          return(arm_russellrao_distance(pA,pB,numberOfBools));
+       case ARM_CDIST_SOKALMICHENER:
+          return(arm_sokalmichener_distance(pA,pB,numberOfBools));
+       case ARM_CDIST_SOKALSNEATH:
+          return(arm_sokalsneath_distance(pA,pB,numberOfBools));
+       default:
+          return(arm_yule_distance(pA,pB,numberOfBools));
+    }
+}
+
     void DistanceTestsU32::test_dice_distance()
     {
        const uint32_t *inpA = inputA.ptr();
@@ -179,6 +215,45 @@
 
   
   
+    void DistanceTestsU32::test_cdist_boolean()
+    {
+       const int numB = this->nbPatterns - CDIST_REMOVED_ROWS;
+       const uint32_t *inpA = inputA.ptr();
+       const uint32_t *inpB = inputB.ptr();
+       const float32_t *refp = ref.ptr();
+       float32_t *tmpp = tmp.ptr();
+       float32_t *outp = output.ptr();
+       arm_status status;
+
+       status = arm_cdist_boolean(inpA,this->nbPatterns,
+                                  inpB,numB,
+                                  this->vecDim,
+                                  this->cdistMetric,
+                                  outp);
+       ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+       /* All the pairs are compared with the distance functions */
+       for(int i=0; i < this->nbPatterns ; i ++)
+       {
+          for(int j=0; j < numB ; j ++)
+          {
+             tmpp[i*numB + j] = pair_distance_boolean(this->cdistMetric,
+                inpA + i*this->bitVecDim,
+                inpB + j*this->bitVecDim,
+                this->vecDim);
+          }
+       }
+
+       ASSERT_CLOSE_ERROR(tmp,output,CDIST_ERROR_THRESHOLD,CDIST_ERROR_THRESHOLD);
+
+       /* The reference distances are between
+          the vectors with the same index */
+       for(int i=0; i < numB ; i ++)
+       {
+          ASSERT_NEAR_EQ(outp[i*numB + i],refp[i],(float32_t)CDIST_ERROR_THRESHOLD);
+       }
+    }
+
     void DistanceTestsU32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
 
@@ -251,6 +326,87 @@
             }
             break;
 
+            case DistanceTestsU32::TEST_CDIST_BOOLEAN_10:
+            {
+              ref.reload(DistanceTestsU32::REF1_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_DICE;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+              tmp.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsU32::TEST_CDIST_BOOLEAN_11:
+            {
+              ref.reload(DistanceTestsU32::REF2_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_HAMMING;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+              tmp.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsU32::TEST_CDIST_BOOLEAN_12:
+            {
+              ref.reload(DistanceTestsU32::REF3_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_JACCARD;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+              tmp.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsU32::TEST_CDIST_BOOLEAN_13:
+            {
+              ref.reload(DistanceTestsU32::REF4_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_KULSINSKI;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+              tmp.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsU32::TEST_CDIST_BOOLEAN_14:
+            {
+              ref.reload(DistanceTestsU32::REF5_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_ROGERSTANIMOTO;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+              tmp.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsU32::TEST_CDIST_BOOLEAN_15:
+            {
+              ref.reload(DistanceTestsU32::REF6_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_RUSSELLRAO;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+              tmp.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsU32::TEST_CDIST_BOOLEAN_16:
+            {
+              ref.reload(DistanceTestsU32::REF7_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_SOKALMICHENER;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+              tmp.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsU32::TEST_CDIST_BOOLEAN_17:
+            {
+              ref.reload(DistanceTestsU32::REF8_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_SOKALSNEATH;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+              tmp.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsU32::TEST_CDIST_BOOLEAN_18:
+            {
+              ref.reload(DistanceTestsU32::REF9_F32_ID,mgr);
+              this->cdistMetric = ARM_CDIST_YULE;
+              output.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+              tmp.create(this->nbPatterns*(this->nbPatterns-CDIST_REMOVED_ROWS),DistanceTestsU32::OUT_F32_ID,mgr);
+            }
+            break;
+
         }
 
 
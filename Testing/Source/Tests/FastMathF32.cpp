@@ -124,6 +124,72 @@ a double precision computation.
     }
 
   
+    void FastMathF32::test_vsin_f32()
+    {
+        const float32_t *inp  = input.ptr();
+        float32_t *outp  = output.ptr();
+
+        arm_vsin_f32(inp,outp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR,REL_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathF32::test_vcos_f32()
+    {
+        const float32_t *inp  = input.ptr();
+        float32_t *outp  = output.ptr();
+
+        arm_vcos_f32(inp,outp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR,REL_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathF32::test_vsincos_f32()
+    {
+        const float32_t *inp  = input.ptr();
+        float32_t *sinp  = output.ptr();
+        float32_t *cosp  = cosOutput.ptr();
+
+        arm_vsincos_f32(inp,sinp,cosp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR,REL_ERROR);
+        ASSERT_SNR(cosRef,cosOutput,(float32_t)SNR_THRESHOLD);
+        ASSERT_CLOSE_ERROR(cosRef,cosOutput,ABS_ERROR,REL_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+        ASSERT_EMPTY_TAIL(cosOutput);
+
+    }
+
+    void FastMathF32::test_vatan2_f32()
+    {
+        const float32_t *inp  = input.ptr();
+        float32_t *xp  = xInput.ptr();
+        float32_t *outp  = output.ptr();
+        unsigned long i;
+        arm_status status;
+
+        for(i=0; i < ref.nbSamples(); i++)
+        {
+          outp[i]=inp[2*i];
+          xp[i]=inp[2*i+1];
+        }
+
+        /* The y coordinates are processed in place */
+        status=arm_vatan2_f32(outp,xp,outp,ref.nbSamples());
+        ASSERT_TRUE((status == ARM_MATH_SUCCESS));
+
+        ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR_ATAN,REL_ERROR_ATAN);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
     void FastMathF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
         (void)paramsArgs;
@@ -238,6 +304,53 @@ a double precision computation.
 
            
 
+            case FastMathF32::TEST_VSIN_F32_13:
+            {
+               input.reload(FastMathF32::ANGLES1_F32_ID,mgr);
+               ref.reload(FastMathF32::SIN1_F32_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF32::TEST_VSIN_F32_14:
+            {
+               input.reload(FastMathF32::ANGLES1_F32_ID,mgr,3);
+               ref.reload(FastMathF32::SIN1_F32_ID,mgr,3);
+               output.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF32::TEST_VCOS_F32_15:
+            {
+               input.reload(FastMathF32::ANGLES1_F32_ID,mgr);
+               ref.reload(FastMathF32::COS1_F32_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF32::TEST_VSINCOS_F32_16:
+            {
+               input.reload(FastMathF32::ANGLES1_F32_ID,mgr);
+               ref.reload(FastMathF32::SIN1_F32_ID,mgr);
+               cosRef.reload(FastMathF32::COS1_F32_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+               cosOutput.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF32::TEST_VATAN2_F32_17:
+            {
+               input.reload(FastMathF32::ATAN2INPUT1_F32_ID,mgr);
+               ref.reload(FastMathF32::ATAN2_F32_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+               xInput.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+            }
+            break;
+
         }
         
     }
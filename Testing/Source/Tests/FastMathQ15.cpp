@@ -152,6 +152,114 @@ a double precision computation.
 
     }
   
+    void FastMathQ15::test_vsin_q15()
+    {
+        const q15_t *inp  = input.ptr();
+        q15_t *outp  = output.ptr();
+
+        arm_vsin_q15(inp,outp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(ref,output,ABS_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathQ15::test_vcos_q15()
+    {
+        const q15_t *inp  = input.ptr();
+        q15_t *outp  = output.ptr();
+
+        arm_vcos_q15(inp,outp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(ref,output,ABS_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathQ15::test_vsincos_q15()
+    {
+        const q15_t *inp  = input.ptr();
+        q15_t *sinp  = output.ptr();
+        q15_t *cosp  = cosOutput.ptr();
+
+        arm_vsincos_q15(inp,sinp,cosp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(ref,output,ABS_ERROR);
+        ASSERT_SNR(cosRef,cosOutput,(float32_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(cosRef,cosOutput,ABS_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+        ASSERT_EMPTY_TAIL(cosOutput);
+
+    }
+
+    void FastMathQ15::test_vatan2_q15()
+    {
+        const q15_t *inp  = input.ptr();
+        q15_t *xp  = xInput.ptr();
+        q15_t *outp  = output.ptr();
+        unsigned long i;
+        arm_status status;
+
+        for(i=0; i < ref.nbSamples(); i++)
+        {
+          outp[i]=inp[2*i];
+          xp[i]=inp[2*i+1];
+        }
+
+        /* The y coordinates are processed in place */
+        status=arm_vatan2_q15(outp,xp,outp,ref.nbSamples());
+        ASSERT_TRUE((status == ARM_MATH_SUCCESS));
+
+        ASSERT_SNR(ref,output,(q15_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(ref,output,ABS_ATAN_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathQ15::test_vsqrt_q15()
+    {
+        const q15_t *inp  = input.ptr();
+        q15_t *outp  = output.ptr();
+        arm_status status,refStatus=ARM_MATH_SUCCESS;
+        unsigned long i;
+
+        for(i=0; i < ref.nbSamples(); i++)
+        {
+           if (inp[i] < 0)
+           {
+              refStatus = ARM_MATH_ARGUMENT_ERROR;
+           }
+        }
+
+        status=arm_vsqrt_q15(inp,outp,ref.nbSamples());
+        ASSERT_TRUE((status == refStatus));
+
+        ASSERT_NEAR_EQ(ref,output,ABS_SQRT_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathQ15::test_vdivide_q15()
+    {
+        const q15_t *nump  = numerator.ptr();
+        const q15_t *denp  = denominator.ptr();
+        q15_t *outp  = output.ptr();
+        int16_t *shiftp  = shift.ptr();
+        arm_status status;
+
+        status = arm_vdivide_q15(nump,denp,outp,shiftp,ref.nbSamples());
+        (void)status;
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(ref,output,DIV_ERROR);
+        ASSERT_EQ(refShift,shift);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
     void FastMathQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
         (void)paramsArgs;
@@ -255,6 +363,76 @@ a double precision computation.
             }
             break;
 
+            case FastMathQ15::TEST_VSIN_Q15_11:
+            {
+               input.reload(FastMathQ15::ANGLES1_Q15_ID,mgr);
+               ref.reload(FastMathQ15::SIN1_Q15_ID,mgr);
+               output.create(ref.nbSamples(),FastMathQ15::OUT_Q15_ID,mgr);
+
+            }
+            break;
+
+            case FastMathQ15::TEST_VSIN_Q15_12:
+            {
+               input.reload(FastMathQ15::ANGLES1_Q15_ID,mgr,3);
+               ref.reload(FastMathQ15::SIN1_Q15_ID,mgr,3);
+               output.create(ref.nbSamples(),FastMathQ15::OUT_Q15_ID,mgr);
+
+            }
+            break;
+
+            case FastMathQ15::TEST_VCOS_Q15_13:
+            {
+               input.reload(FastMathQ15::ANGLES1_Q15_ID,mgr);
+               ref.reload(FastMathQ15::COS1_Q15_ID,mgr);
+               output.create(ref.nbSamples(),FastMathQ15::OUT_Q15_ID,mgr);
+
+            }
+            break;
+
+            case FastMathQ15::TEST_VSINCOS_Q15_14:
+            {
+               input.reload(FastMathQ15::ANGLES1_Q15_ID,mgr);
+               ref.reload(FastMathQ15::SIN1_Q15_ID,mgr);
+               cosRef.reload(FastMathQ15::COS1_Q15_ID,mgr);
+               output.create(ref.nbSamples(),FastMathQ15::OUT_Q15_ID,mgr);
+               cosOutput.create(ref.nbSamples(),FastMathQ15::OUT_Q15_ID,mgr);
+
+            }
+            break;
+
+            case FastMathQ15::TEST_VATAN2_Q15_15:
+            {
+               input.reload(FastMathQ15::ATAN2INPUT1_Q15_ID,mgr);
+               ref.reload(FastMathQ15::ATAN2_Q15_ID,mgr);
+               output.create(ref.nbSamples(),FastMathQ15::OUT_Q15_ID,mgr);
+               xInput.create(ref.nbSamples(),FastMathQ15::OUT_Q15_ID,mgr);
+            }
+            break;
+
+            case FastMathQ15::TEST_VSQRT_Q15_16:
+            {
+               input.reload(FastMathQ15::SQRTINPUT1_Q15_ID,mgr);
+               ref.reload(FastMathQ15::SQRT1_Q15_ID,mgr);
+               output.create(ref.nbSamples(),FastMathQ15::OUT_Q15_ID,mgr);
+
+            }
+            break;
+
+            case FastMathQ15::TEST_VDIVIDE_Q15_17:
+            {
+               numerator.reload(FastMathQ15::NUMERATOR_Q15_ID,mgr);
+               denominator.reload(FastMathQ15::DENOMINATOR_Q15_ID,mgr);
+
+               ref.reload(FastMathQ15::DIVISION_VALUE_Q15_ID,mgr);
+               refShift.reload(FastMathQ15::DIVISION_SHIFT_S16_ID,mgr);
+
+               output.create(ref.nbSamples(),FastMathQ15::OUT_Q15_ID,mgr);
+               shift.create(ref.nbSamples(),FastMathQ15::SHIFT_S16_ID,mgr);
+
+            }
+            break;
+
         }
         
     }
@@ -149,6 +149,114 @@ a double precision computation.
 
     }
   
+    void FastMathQ31::test_vsin_q31()
+    {
+        const q31_t *inp  = input.ptr();
+        q31_t *outp  = output.ptr();
+
+        arm_vsin_q31(inp,outp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(ref,output,ABS_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathQ31::test_vcos_q31()
+    {
+        const q31_t *inp  = input.ptr();
+        q31_t *outp  = output.ptr();
+
+        arm_vcos_q31(inp,outp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(ref,output,ABS_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathQ31::test_vsincos_q31()
+    {
+        const q31_t *inp  = input.ptr();
+        q31_t *sinp  = output.ptr();
+        q31_t *cosp  = cosOutput.ptr();
+
+        arm_vsincos_q31(inp,sinp,cosp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(ref,output,ABS_ERROR);
+        ASSERT_SNR(cosRef,cosOutput,(float32_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(cosRef,cosOutput,ABS_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+        ASSERT_EMPTY_TAIL(cosOutput);
+
+    }
+
+    void FastMathQ31::test_vatan2_q31()
+    {
+        const q31_t *inp  = input.ptr();
+        q31_t *xp  = xInput.ptr();
+        q31_t *outp  = output.ptr();
+        unsigned long i;
+        arm_status status;
+
+        for(i=0; i < ref.nbSamples(); i++)
+        {
+          outp[i]=inp[2*i];
+          xp[i]=inp[2*i+1];
+        }
+
+        /* The y coordinates are processed in place */
+        status=arm_vatan2_q31(outp,xp,outp,ref.nbSamples());
+        ASSERT_TRUE((status == ARM_MATH_SUCCESS));
+
+        ASSERT_SNR(ref,output,(q31_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(ref,output,ABS_ATAN_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathQ31::test_vsqrt_q31()
+    {
+        const q31_t *inp  = input.ptr();
+        q31_t *outp  = output.ptr();
+        arm_status status,refStatus=ARM_MATH_SUCCESS;
+        unsigned long i;
+
+        for(i=0; i < ref.nbSamples(); i++)
+        {
+           if (inp[i] < 0)
+           {
+              refStatus = ARM_MATH_ARGUMENT_ERROR;
+           }
+        }
+
+        status=arm_vsqrt_q31(inp,outp,ref.nbSamples());
+        ASSERT_TRUE((status == refStatus));
+
+        ASSERT_NEAR_EQ(ref,output,ABS_SQRT_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathQ31::test_vdivide_q31()
+    {
+        const q31_t *nump  = numerator.ptr();
+        const q31_t *denp  = denominator.ptr();
+        q31_t *outp  = output.ptr();
+        int16_t *shiftp  = shift.ptr();
+        arm_status status;
+
+        status = arm_vdivide_q31(nump,denp,outp,shiftp,ref.nbSamples());
+        (void)status;
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(ref,output,ABS_DIV_ERROR);
+        ASSERT_EQ(refShift,shift);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
     void FastMathQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
         (void)paramsArgs;
@@ -252,6 +360,76 @@ a double precision computation.
             }
             break;
 
+            case FastMathQ31::TEST_VSIN_Q31_11:
+            {
+               input.reload(FastMathQ31::ANGLES1_Q31_ID,mgr);
+               ref.reload(FastMathQ31::SIN1_Q31_ID,mgr);
+               output.create(ref.nbSamples(),FastMathQ31::OUT_Q31_ID,mgr);
+
+            }
+            break;
+
+            case FastMathQ31::TEST_VSIN_Q31_12:
+            {
+               input.reload(FastMathQ31::ANGLES1_Q31_ID,mgr,3);
+               ref.reload(FastMathQ31::SIN1_Q31_ID,mgr,3);
+               output.create(ref.nbSamples(),FastMathQ31::OUT_Q31_ID,mgr);
+
+            }
+            break;
+
+            case FastMathQ31::TEST_VCOS_Q31_13:
+            {
+               input.reload(FastMathQ31::ANGLES1_Q31_ID,mgr);
+               ref.reload(FastMathQ31::COS1_Q31_ID,mgr);
+               output.create(ref.nbSamples(),FastMathQ31::OUT_Q31_ID,mgr);
+
+            }
+            break;
+
+            case FastMathQ31::TEST_VSINCOS_Q31_14:
+            {
+               input.reload(FastMathQ31::ANGLES1_Q31_ID,mgr);
+               ref.reload(FastMathQ31::SIN1_Q31_ID,mgr);
+               cosRef.reload(FastMathQ31::COS1_Q31_ID,mgr);
+               output.create(ref.nbSamples(),FastMathQ31::OUT_Q31_ID,mgr);
+               cosOutput.create(ref.nbSamples(),FastMathQ31::OUT_Q31_ID,mgr);
+
+            }
+            break;
+
+            case FastMathQ31::TEST_VATAN2_Q31_15:
+            {
+               input.reload(FastMathQ31::ATAN2INPUT1_Q31_ID,mgr);
+               ref.reload(FastMathQ31::ATAN2_Q31_ID,mgr);
+               output.create(ref.nbSamples(),FastMathQ31::OUT_Q31_ID,mgr);
+               xInput.create(ref.nbSamples(),FastMathQ31::OUT_Q31_ID,mgr);
+            }
+            break;
+
+            case FastMathQ31::TEST_VSQRT_Q31_16:
+            {
+               input.reload(FastMathQ31::SQRTINPUT1_Q31_ID,mgr);
+               ref.reload(FastMathQ31::SQRT1_Q31_ID,mgr);
+               output.create(ref.nbSamples(),FastMathQ31::OUT_Q31_ID,mgr);
+
+            }
+            break;
+
+            case FastMathQ31::TEST_VDIVIDE_Q31_17:
+            {
+               numerator.reload(FastMathQ31::NUMERATOR_Q31_ID,mgr);
+               denominator.reload(FastMathQ31::DENOMINATOR_Q31_ID,mgr);
+
+               ref.reload(FastMathQ31::DIVISION_VALUE_Q31_ID,mgr);
+               refShift.reload(FastMathQ31::DIVISION_SHIFT_S16_ID,mgr);
+
+               output.create(ref.nbSamples(),FastMathQ31::OUT_Q31_ID,mgr);
+               shift.create(ref.nbSamples(),FastMathQ31::SHIFT_S16_ID,mgr);
+
+            }
+            break;
+
         }
         
     }
@@ -114,6 +114,100 @@ a double precision computation.
     } 
 
 
+
+    void InterpolationTestsF32::test_linear_interp_block_f32()
+    {
+       arm_linear_interp_block_f32(&S,input.ptr(),output.ptr(),input.nbSamples());
+
+       ASSERT_EMPTY_TAIL(output);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+       ASSERT_REL_ERROR(output,ref,REL_ERROR);
+
+    } 
+
+    void InterpolationTestsF32::test_bilinear_interp_block_f32()
+    {
+       const float32_t *inp = input.ptr();
+       float32_t *pX = coords.ptr();
+       float32_t *pY = pX + input.nbSamples() / 2;
+       unsigned long nb;
+
+       /* Coordinates are interleaved in the input pattern */
+       for(nb = 0; nb < input.nbSamples() / 2; nb++)
+       {
+          pX[nb] = inp[2*nb];
+          pY[nb] = inp[2*nb+1];
+       }
+
+       arm_bilinear_interp_block_f32(&SBI,pX,pY,output.ptr(),input.nbSamples() / 2);
+
+       ASSERT_EMPTY_TAIL(output);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+       ASSERT_REL_ERROR(output,ref,REL_ERROR);
+
+    } 
+
+    void InterpolationTestsF32::test_linear_interp_nonuniform_f32()
+    {
+       float32_t *xVal = buffer.ptr();
+       arm_interp_index_instance_f32 index;
+       arm_linear_interp_nonuniform_instance_f32 SNU;
+       unsigned long nb;
+
+       /* Same grid as the uniform linear interpolation test */
+       for(nb = 0; nb < y.nbSamples(); nb++)
+       {
+          xVal[nb] = S.x1 + nb * S.xSpacing;
+       }
+
+       arm_interp_index_init_f32(&index, xVal, y.nbSamples(), y.nbSamples() / 4, buckets.ptr());
+
+       SNU.x = xVal;
+       SNU.y = y.ptr();
+       SNU.n_x = y.nbSamples();
+       SNU.pIndex = &index;
+
+       arm_linear_interp_nonuniform_f32(&SNU,input.ptr(),output.ptr(),input.nbSamples());
+
+       ASSERT_EMPTY_TAIL(buffer);
+       ASSERT_EMPTY_TAIL(buckets);
+       ASSERT_EMPTY_TAIL(output);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+       ASSERT_REL_ERROR(output,ref,REL_ERROR);
+
+    } 
+
+    void InterpolationTestsF32::test_spline_index_f32()
+    {
+       const float32_t *inpX = inputX.ptr();
+       const float32_t *inpY = inputY.ptr();
+       const float32_t *outX = outputX.ptr();
+       float32_t *outp = output.ptr();
+       float32_t *buf = buffer.ptr(); // ((2*9-1)*sizeof(float32_t))
+       float32_t *coef = splineCoefs.ptr(); // ((3*(9-1))*sizeof(float32_t))
+
+       arm_spline_instance_f32 S;
+       arm_interp_index_instance_f32 index;
+
+       arm_spline_init_f32(&S, ARM_SPLINE_NATURAL, inpX, inpY, 9, coef, buf);
+       arm_interp_index_init_f32(&index, inpX, 9, 4, buckets.ptr());
+       S.pIndex = &index;
+
+       arm_spline_f32(&S, outX, outp, 33);
+
+       ASSERT_EMPTY_TAIL(buffer);
+       ASSERT_EMPTY_TAIL(splineCoefs);
+       ASSERT_EMPTY_TAIL(buckets);
+       ASSERT_EMPTY_TAIL(output);
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+    } 
+
     void InterpolationTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
       
@@ -125,6 +219,8 @@ a double precision computation.
        switch(id)
        {
         case InterpolationTestsF32::TEST_LINEAR_INTERP_F32_1:
+        case InterpolationTestsF32::TEST_LINEAR_INTERP_BLOCK_F32_6:
+        case InterpolationTestsF32::TEST_LINEAR_INTERP_NONUNIFORM_F32_8:
           input.reload(InterpolationTestsF32::INPUT_F32_ID,mgr,nb);
           y.reload(InterpolationTestsF32::YVAL_F32_ID,mgr,nb);
           ref.reload(InterpolationTestsF32::REF_LINEAR_F32_ID,mgr,nb);
@@ -136,9 +232,16 @@ a double precision computation.
           S.x1=0.0;               /**< x1 */
           S.xSpacing=1.0;         /**< xSpacing */
           S.pYData=y.ptr();          /**< pointer to the table of Y values */
+
+          if (id == InterpolationTestsF32::TEST_LINEAR_INTERP_NONUNIFORM_F32_8)
+          {
+             buffer.create(y.nbSamples(),InterpolationTestsF32::TEMP_SPLINE_F32_ID,mgr);
+             buckets.create(y.nbSamples() / 4 + 1,InterpolationTestsF32::TEMP_SPLINE_F32_ID,mgr);
+          }
           break;
 
          case InterpolationTestsF32::TEST_BILINEAR_INTERP_F32_2:
+         case InterpolationTestsF32::TEST_BILINEAR_INTERP_BLOCK_F32_7:
           input.reload(InterpolationTestsF32::INPUTBI_F32_ID,mgr,nb);
           config.reload(InterpolationTestsF32::CONFIGBI_S16_ID,mgr,nb);
           y.reload(InterpolationTestsF32::YVALBI_F32_ID,mgr,nb);
@@ -150,6 +253,8 @@ a double precision computation.
           SBI.numCols = pConfig[0];
           
           SBI.pData = y.ptr();
+
+          coords.create(input.nbSamples(),InterpolationTestsF32::OUT_SAMPLES_F32_ID,mgr);
          
           break;
 
@@ -165,6 +270,7 @@ a double precision computation.
           break;
 
           case TEST_SPLINE_SINE_F32_4:
+          case TEST_SPLINE_INDEX_F32_9:
              inputX.reload(InterpolationTestsF32::INPUT_SPLINE_SIN_X_F32_ID,mgr,9);
              inputY.reload(InterpolationTestsF32::INPUT_SPLINE_SIN_Y_F32_ID,mgr,9);
              outputX.reload(InterpolationTestsF32::OUTPUT_SPLINE_SIN_X_F32_ID,mgr,33);
@@ -173,6 +279,7 @@ a double precision computation.
              
              buffer.create(2*9-1,InterpolationTestsF32::TEMP_SPLINE_F32_ID,mgr);
              output.create(33,InterpolationTestsF32::OUT_SAMPLES_F32_ID,mgr);
+             buckets.create(4+1,InterpolationTestsF32::TEMP_SPLINE_F32_ID,mgr);
           break;
 
           case TEST_SPLINE_RAMP_F32_5:
@@ -55,7 +55,42 @@ a double precision computation.
 
     } 
 
- 
+    void InterpolationTestsQ15::test_linear_interp_block_q15()
+    {
+       arm_linear_interp_block_q15(y.ptr(),y.nbSamples(),input.ptr(),output.ptr(),input.nbSamples());
+
+       ASSERT_EMPTY_TAIL(output);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+       ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q15);
+
+    } 
+
+    void InterpolationTestsQ15::test_bilinear_interp_block_q15()
+    {
+       const q31_t *inp = input.ptr();
+       q31_t *pX = coords.ptr();
+       q31_t *pY = pX + input.nbSamples() / 2;
+       unsigned long nb;
+
+       /* Coordinates are interleaved in the input pattern */
+       for(nb = 0; nb < input.nbSamples() / 2; nb++)
+       {
+          pX[nb] = inp[2*nb];
+          pY[nb] = inp[2*nb+1];
+       }
+
+       arm_bilinear_interp_block_q15(&SBI,pX,pY,output.ptr(),input.nbSamples() / 2);
+
+       ASSERT_EMPTY_TAIL(output);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+       ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q15);
+
+    } 
+
     void InterpolationTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
       
@@ -66,6 +101,7 @@ a double precision computation.
        switch(id)
        {
         case InterpolationTestsQ15::TEST_LINEAR_INTERP_Q15_1:
+        case InterpolationTestsQ15::TEST_LINEAR_INTERP_BLOCK_Q15_3:
           input.reload(InterpolationTestsQ15::INPUT_Q31_ID,mgr,nb);
           y.reload(InterpolationTestsQ15::YVAL_Q15_ID,mgr,nb);
           ref.reload(InterpolationTestsQ15::REF_LINEAR_Q15_ID,mgr,nb);
@@ -73,6 +109,7 @@ a double precision computation.
           break;
 
         case InterpolationTestsQ15::TEST_BILINEAR_INTERP_Q15_2:
+        case InterpolationTestsQ15::TEST_BILINEAR_INTERP_BLOCK_Q15_4:
           input.reload(InterpolationTestsQ15::INPUTBI_Q31_ID,mgr,nb);
           config.reload(InterpolationTestsQ15::CONFIGBI_S16_ID,mgr,nb);
           y.reload(InterpolationTestsQ15::YVALBI_Q15_ID,mgr,nb);
@@ -84,6 +121,8 @@ a double precision computation.
           SBI.numCols = pConfig[0];
           
           SBI.pData = y.ptr();
+
+          coords.create(input.nbSamples(),InterpolationTestsQ15::OUT_SAMPLES_Q15_ID,mgr);
          
           break;
 
@@ -54,7 +54,42 @@ a double precision computation.
 
     } 
 
- 
+    void InterpolationTestsQ7::test_linear_interp_block_q7()
+    {
+       arm_linear_interp_block_q7(y.ptr(),y.nbSamples(),input.ptr(),output.ptr(),input.nbSamples());
+
+       ASSERT_EMPTY_TAIL(output);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+       ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q7);
+
+    } 
+
+    void InterpolationTestsQ7::test_bilinear_interp_block_q7()
+    {
+       const q31_t *inp = input.ptr();
+       q31_t *pX = coords.ptr();
+       q31_t *pY = pX + input.nbSamples() / 2;
+       unsigned long nb;
+
+       /* Coordinates are interleaved in the input pattern */
+       for(nb = 0; nb < input.nbSamples() / 2; nb++)
+       {
+          pX[nb] = inp[2*nb];
+          pY[nb] = inp[2*nb+1];
+       }
+
+       arm_bilinear_interp_block_q7(&SBI,pX,pY,output.ptr(),input.nbSamples() / 2);
+
+       ASSERT_EMPTY_TAIL(output);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+       ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q7);
+
+    } 
+
     void InterpolationTestsQ7::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
       
@@ -65,6 +100,7 @@ a double precision computation.
        switch(id)
        {
         case InterpolationTestsQ7::TEST_LINEAR_INTERP_Q7_1:
+        case InterpolationTestsQ7::TEST_LINEAR_INTERP_BLOCK_Q7_3:
           input.reload(InterpolationTestsQ7::INPUT_Q31_ID,mgr,nb);
           y.reload(InterpolationTestsQ7::YVAL_Q7_ID,mgr,nb);
           ref.reload(InterpolationTestsQ7::REF_LINEAR_Q7_ID,mgr,nb);
@@ -72,6 +108,7 @@ a double precision computation.
           break;
 
         case InterpolationTestsQ7::TEST_BILINEAR_INTERP_Q7_2:
+        case InterpolationTestsQ7::TEST_BILINEAR_INTERP_BLOCK_Q7_4:
           input.reload(InterpolationTestsQ7::INPUTBI_Q31_ID,mgr,nb);
           config.reload(InterpolationTestsQ7::CONFIGBI_S16_ID,mgr,nb);
           y.reload(InterpolationTestsQ7::YVALBI_Q7_ID,mgr,nb);
@@ -83,6 +120,8 @@ a double precision computation.
           SBI.numCols = pConfig[0];
           
           SBI.pData = y.ptr();
+
+          coords.create(input.nbSamples(),InterpolationTestsQ7::OUT_SAMPLES_Q7_ID,mgr);
          
           break;
 
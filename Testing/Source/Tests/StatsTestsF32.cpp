@@ -12,6 +12,8 @@ a double precision computation.
 
 */
 #define REL_ERROR (1.0e-5)
+#define ABS_ERROR (1.0e-6)
+#define WINDOW_SIZE 32
 
     void StatsTestsF32::test_max_f32()
     {
@@ -352,6 +354,154 @@ a double precision computation.
 
     }
 
+    void StatsTestsF32::test_stats_f32()
+    {
+        const float32_t *inp  = inputA.ptr();
+        uint32_t nb = inputA.nbSamples();
+
+        arm_stats_result_f32 result;
+        float32_t refVal;
+        uint32_t refIndex;
+
+        float32_t *outp  = output.ptr();
+
+        arm_stats_f32(inp, nb, &result);
+
+        outp[0] = result.var;
+
+        arm_mean_f32(inp, nb, &refVal);
+        ASSERT_CLOSE_ERROR(refVal,result.mean,ABS_ERROR,REL_ERROR);
+
+        arm_var_f32(inp, nb, &refVal);
+        ASSERT_REL_ERROR(result.var,refVal,REL_ERROR);
+
+        arm_std_f32(inp, nb, &refVal);
+        ASSERT_REL_ERROR(result.std,refVal,REL_ERROR);
+
+        arm_rms_f32(inp, nb, &refVal);
+        ASSERT_REL_ERROR(result.rms,refVal,REL_ERROR);
+
+        arm_min_f32(inp, nb, &refVal, &refIndex);
+        ASSERT_TRUE(result.min == refVal);
+        ASSERT_TRUE(result.minIndex == refIndex);
+
+        arm_max_f32(inp, nb, &refVal, &refIndex);
+        ASSERT_TRUE(result.max == refVal);
+        ASSERT_TRUE(result.maxIndex == refIndex);
+
+    }
+
+    void StatsTestsF32::test_stats_stability_f32()
+    {
+      /*
+
+      Same values as in test_std_stability_f32 but with a
+      much bigger offset. The one pass sum of squares
+      would give a completely wrong variance.
+
+      */
+      float32_t in[4]={4.0f, 7.0f, 13.0f, 16.0f};
+      arm_stats_result_f32 result;
+      int i;
+
+      for(i=0 ; i < 4; i++)
+      {
+        in[i] += 1.0e6f;
+      }
+
+      arm_stats_f32(in,4,&result);
+
+      ASSERT_TRUE(fabsf(30.0f - result.var) < 1.0e-3f);
+      ASSERT_TRUE(fabsf(5.47723f - result.std) < 1.0e-4f);
+      ASSERT_TRUE(result.minIndex == 0);
+      ASSERT_TRUE(result.maxIndex == 3);
+
+    }
+
+    void StatsTestsF32::test_running_stats_f32()
+    {
+        const float32_t *inp  = inputA.ptr();
+        uint32_t nb = inputA.nbSamples();
+
+        arm_running_stats_instance_f32 S;
+        arm_stats_result_f32 result, ref;
+
+        float32_t *outp  = output.ptr();
+
+        /* Statistics updated with blocks of different sizes */
+        arm_running_stats_init_f32(&S);
+        arm_running_stats_f32(&S, inp, 3);
+        arm_running_stats_f32(&S, inp + 3, nb - 3);
+        arm_running_stats_result_f32(&S, &result);
+
+        outp[0] = result.var;
+
+        arm_stats_f32(inp, nb, &ref);
+
+        ASSERT_CLOSE_ERROR(ref.mean,result.mean,ABS_ERROR,REL_ERROR);
+        ASSERT_REL_ERROR(result.var,ref.var,REL_ERROR);
+        ASSERT_REL_ERROR(result.std,ref.std,REL_ERROR);
+        ASSERT_REL_ERROR(result.rms,ref.rms,REL_ERROR);
+        ASSERT_TRUE(result.min == ref.min);
+        ASSERT_TRUE(result.minIndex == ref.minIndex);
+        ASSERT_TRUE(result.max == ref.max);
+        ASSERT_TRUE(result.maxIndex == ref.maxIndex);
+
+    }
+
+    void StatsTestsF32::test_sliding_window_f32()
+    {
+        const float32_t *inp  = inputA.ptr();
+        uint32_t nb = inputA.nbSamples();
+
+        arm_sliding_window_instance_f32 S;
+        float32_t state[WINDOW_SIZE];
+        uint32_t minQueue[WINDOW_SIZE];
+        uint32_t maxQueue[WINDOW_SIZE];
+        arm_stats_result_f32 result, ref;
+        uint32_t i;
+
+        float32_t *outp  = output.ptr();
+
+        arm_status status = arm_sliding_window_init_f32(&S, WINDOW_SIZE, state, minQueue, maxQueue);
+        ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+        /* Window partially filled */
+        arm_sliding_window_f32(&S, inp, WINDOW_SIZE - 1);
+        arm_sliding_window_result_f32(&S, &result);
+        arm_stats_f32(inp, WINDOW_SIZE - 1, &ref);
+
+        ASSERT_CLOSE_ERROR(ref.mean,result.mean,ABS_ERROR,REL_ERROR);
+        ASSERT_REL_ERROR(result.var,ref.var,REL_ERROR);
+        ASSERT_REL_ERROR(result.std,ref.std,REL_ERROR);
+        ASSERT_REL_ERROR(result.rms,ref.rms,REL_ERROR);
+        ASSERT_TRUE(result.min == ref.min);
+        ASSERT_TRUE(result.minIndex == ref.minIndex);
+        ASSERT_TRUE(result.max == ref.max);
+        ASSERT_TRUE(result.maxIndex == ref.maxIndex);
+
+        /* Samples added one by one in a full window */
+        for(i = WINDOW_SIZE - 1; i < nb; i++)
+        {
+            arm_sliding_window_f32(&S, inp + i, 1);
+        }
+        arm_sliding_window_result_f32(&S, &result);
+
+        outp[0] = result.var;
+
+        arm_stats_f32(inp + nb - WINDOW_SIZE, WINDOW_SIZE, &ref);
+
+        ASSERT_CLOSE_ERROR(ref.mean,result.mean,ABS_ERROR,REL_ERROR);
+        ASSERT_REL_ERROR(result.var,ref.var,REL_ERROR);
+        ASSERT_REL_ERROR(result.std,ref.std,REL_ERROR);
+        ASSERT_REL_ERROR(result.rms,ref.rms,REL_ERROR);
+        ASSERT_TRUE(result.min == ref.min);
+        ASSERT_TRUE(result.minIndex == ref.minIndex);
+        ASSERT_TRUE(result.max == ref.max);
+        ASSERT_TRUE(result.maxIndex == ref.maxIndex);
+
+    }
+
     void StatsTestsF32::test_entropy_f32()
     {
       const float32_t *inp  = inputA.ptr();
@@ -1135,6 +1285,30 @@ a double precision computation.
             }
             break;
 
+            case StatsTestsF32::TEST_STATS_F32_54:
+            {
+               inputA.reload(StatsTestsF32::INPUTNEW1_F32_ID,mgr,100);
+
+               output.create(1,StatsTestsF32::OUT_F32_ID,mgr);
+            }
+            break;
+
+            case StatsTestsF32::TEST_RUNNING_STATS_F32_56:
+            {
+               inputA.reload(StatsTestsF32::INPUTNEW1_F32_ID,mgr,100);
+
+               output.create(1,StatsTestsF32::OUT_F32_ID,mgr);
+            }
+            break;
+
+            case StatsTestsF32::TEST_SLIDING_WINDOW_F32_57:
+            {
+               inputA.reload(StatsTestsF32::INPUTNEW1_F32_ID,mgr,100);
+
+               output.create(1,StatsTestsF32::OUT_F32_ID,mgr);
+            }
+            break;
+
 
         }
         
@@ -18,6 +18,7 @@ a double precision computation.
 #define ABS_ERROR_Q15_MSE ((q15_t)100)
 
 #define ABS_ERROR_Q63 (1<<17)
+#define WINDOW_SIZE 9
 
     void StatsTestsQ15::test_max_q15()
     {
@@ -338,6 +339,127 @@ a double precision computation.
     }
 
   
+    void StatsTestsQ15::test_stats_q15()
+    {
+        const q15_t *inp  = inputA.ptr();
+        uint32_t nb = inputA.nbSamples();
+
+        arm_stats_result_q15 result;
+        q15_t refVal;
+        uint32_t refIndex;
+
+        q15_t *outp  = output.ptr();
+
+        arm_stats_q15(inp, nb, &result);
+
+        outp[0] = result.var;
+
+        arm_mean_q15(inp, nb, &refVal);
+        ASSERT_TRUE(result.mean == refVal);
+
+        arm_var_q15(inp, nb, &refVal);
+        ASSERT_TRUE(result.var == refVal);
+
+        arm_std_q15(inp, nb, &refVal);
+        ASSERT_TRUE(result.std == refVal);
+
+        /* arm_rms_q15 is using a different internal format */
+        ASSERT_NEAR_EQ(result.rms,ref.ptr()[this->refOffset],ABS_ERROR_Q15);
+
+        arm_min_q15(inp, nb, &refVal, &refIndex);
+        ASSERT_TRUE(result.min == refVal);
+        ASSERT_TRUE(result.minIndex == refIndex);
+
+        arm_max_q15(inp, nb, &refVal, &refIndex);
+        ASSERT_TRUE(result.max == refVal);
+        ASSERT_TRUE(result.maxIndex == refIndex);
+
+    }
+
+    void StatsTestsQ15::test_running_stats_q15()
+    {
+        const q15_t *inp  = inputA.ptr();
+        uint32_t nb = inputA.nbSamples();
+
+        arm_running_stats_instance_q15 S;
+        arm_stats_result_q15 result, ref;
+
+        q15_t *outp  = output.ptr();
+
+        /* Statistics updated with blocks of different sizes */
+        arm_running_stats_init_q15(&S);
+        arm_running_stats_q15(&S, inp, 3);
+        arm_running_stats_q15(&S, inp + 3, nb - 3);
+        arm_running_stats_result_q15(&S, &result);
+
+        outp[0] = result.var;
+
+        arm_stats_q15(inp, nb, &ref);
+
+        ASSERT_TRUE(result.mean == ref.mean);
+        ASSERT_TRUE(result.var == ref.var);
+        ASSERT_TRUE(result.std == ref.std);
+        ASSERT_TRUE(result.rms == ref.rms);
+        ASSERT_TRUE(result.min == ref.min);
+        ASSERT_TRUE(result.minIndex == ref.minIndex);
+        ASSERT_TRUE(result.max == ref.max);
+        ASSERT_TRUE(result.maxIndex == ref.maxIndex);
+
+    }
+
+    void StatsTestsQ15::test_sliding_window_q15()
+    {
+        const q15_t *inp  = inputA.ptr();
+        uint32_t nb = inputA.nbSamples();
+
+        arm_sliding_window_instance_q15 S;
+        q15_t state[WINDOW_SIZE];
+        uint32_t minQueue[WINDOW_SIZE];
+        uint32_t maxQueue[WINDOW_SIZE];
+        arm_stats_result_q15 result, ref;
+        uint32_t i;
+
+        q15_t *outp  = output.ptr();
+
+        arm_status status = arm_sliding_window_init_q15(&S, WINDOW_SIZE, state, minQueue, maxQueue);
+        ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+        /* Window partially filled */
+        arm_sliding_window_q15(&S, inp, WINDOW_SIZE - 1);
+        arm_sliding_window_result_q15(&S, &result);
+        arm_stats_q15(inp, WINDOW_SIZE - 1, &ref);
+
+        ASSERT_TRUE(result.mean == ref.mean);
+        ASSERT_TRUE(result.var == ref.var);
+        ASSERT_TRUE(result.std == ref.std);
+        ASSERT_TRUE(result.rms == ref.rms);
+        ASSERT_TRUE(result.min == ref.min);
+        ASSERT_TRUE(result.minIndex == ref.minIndex);
+        ASSERT_TRUE(result.max == ref.max);
+        ASSERT_TRUE(result.maxIndex == ref.maxIndex);
+
+        /* Samples added one by one in a full window */
+        for(i = WINDOW_SIZE - 1; i < nb; i++)
+        {
+            arm_sliding_window_q15(&S, inp + i, 1);
+        }
+        arm_sliding_window_result_q15(&S, &result);
+
+        outp[0] = result.var;
+
+        arm_stats_q15(inp + nb - WINDOW_SIZE, WINDOW_SIZE, &ref);
+
+        ASSERT_TRUE(result.mean == ref.mean);
+        ASSERT_TRUE(result.var == ref.var);
+        ASSERT_TRUE(result.std == ref.std);
+        ASSERT_TRUE(result.rms == ref.rms);
+        ASSERT_TRUE(result.min == ref.min);
+        ASSERT_TRUE(result.minIndex == ref.minIndex);
+        ASSERT_TRUE(result.max == ref.max);
+        ASSERT_TRUE(result.maxIndex == ref.maxIndex);
+
+    }
+
     void StatsTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
         (void)paramsArgs;
@@ -914,6 +1036,34 @@ a double precision computation.
             break;
 
           
+            case StatsTestsQ15::TEST_STATS_Q15_46:
+            {
+               inputA.reload(StatsTestsQ15::INPUT1_Q15_ID,mgr,23);
+
+               ref.reload(StatsTestsQ15::RMSVALS_Q15_ID,mgr);
+
+               output.create(1,StatsTestsQ15::OUT_Q15_ID,mgr);
+
+               refOffset = 2;
+            }
+            break;
+
+            case StatsTestsQ15::TEST_RUNNING_STATS_Q15_47:
+            {
+               inputA.reload(StatsTestsQ15::INPUT1_Q15_ID,mgr,23);
+
+               output.create(1,StatsTestsQ15::OUT_Q15_ID,mgr);
+            }
+            break;
+
+            case StatsTestsQ15::TEST_SLIDING_WINDOW_Q15_48:
+            {
+               inputA.reload(StatsTestsQ15::INPUT1_Q15_ID,mgr,23);
+
+               output.create(1,StatsTestsQ15::OUT_Q15_ID,mgr);
+            }
+            break;
+
         }
         
     }
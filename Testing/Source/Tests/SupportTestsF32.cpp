@@ -444,6 +444,115 @@ void SupportTestsF32::test_selection_sort_const_f32()
 } 
 
 
+void SupportTestsF32::test_radix_sort_out_f32()
+{
+ float32_t *inp = input.ptr();
+ float32_t *outp = output.ptr();
+ arm_sort_instance_f32 S;
+
+ arm_sort_init_f32(&S, ARM_SORT_RADIX, ARM_SORT_ASCENDING);
+
+ arm_sort_f32(&S,inp,outp,this->nbSamples);
+ 
+ ASSERT_EMPTY_TAIL(output);
+
+ ASSERT_EQ(output,ref);
+
+} 
+
+void SupportTestsF32::test_radix_sort_in_f32()
+{
+ float32_t *inp = input.ptr();
+ arm_sort_instance_f32 S;
+
+ arm_sort_init_f32(&S, ARM_SORT_RADIX, ARM_SORT_ASCENDING);
+
+ arm_sort_f32(&S,inp,inp,this->nbSamples);
+ 
+ ASSERT_EMPTY_TAIL(input);
+
+ ASSERT_EQ(input,ref);
+
+} 
+
+void SupportTestsF32::test_radix_sort_const_f32()
+{
+ float32_t *inp = input.ptr();
+ float32_t *outp = output.ptr();
+ arm_sort_instance_f32 S;
+
+ arm_sort_init_f32(&S, ARM_SORT_RADIX, ARM_SORT_ASCENDING);
+
+ arm_sort_f32(&S,inp,outp,this->nbSamples);
+ 
+ ASSERT_EMPTY_TAIL(output);
+
+ ASSERT_EQ(output,ref);
+
+} 
+
+void SupportTestsF32::test_radix_sort_long_f32()
+{
+ float32_t *inp = input.ptr();
+ float32_t *outp = output.ptr();
+ float32_t *refp = buffer.ptr();
+ float32_t *buf = (float32_t *)malloc((this->nbSamples)*sizeof(float32_t) );
+ arm_merge_sort_instance_f32 SM;
+ arm_sort_instance_f32 S;
+
+ /* The merge sort is used as reference */
+ arm_merge_sort_init_f32(&SM, ARM_SORT_DESCENDING, buf);
+ arm_merge_sort_f32(&SM,inp,refp,this->nbSamples);
+ free(buf);
+
+ arm_sort_init_f32(&S, ARM_SORT_RADIX, ARM_SORT_DESCENDING);
+
+ arm_sort_f32(&S,inp,outp,this->nbSamples);
+ 
+ ASSERT_EMPTY_TAIL(output);
+
+ for(int i=0; i < this->nbSamples; i++)
+ {
+    ASSERT_TRUE(outp[i] == refp[i]);
+ }
+
+} 
+
+void SupportTestsF32::test_argsort_f32()
+{
+ const float32_t *inp = input.ptr();
+ float32_t *outp = output.ptr();
+ uint32_t *buf = (uint32_t *)malloc(2*(this->nbSamples)*sizeof(uint32_t) );
+ uint32_t *index = (uint32_t *)malloc((this->nbSamples)*sizeof(uint32_t) );
+ arm_argsort_instance_f32 S;
+ int i;
+
+ arm_argsort_init_f32(&S, ARM_SORT_ASCENDING, buf);
+ arm_argsort_f32(&S,inp,index,this->nbSamples);
+
+ for(i=0; i < this->nbSamples; i++)
+ {
+    outp[i] = inp[index[i]];
+ }
+
+ /* The sort must be stable */
+ for(i=1; i < this->nbSamples; i++)
+ {
+    if (outp[i] == outp[i-1])
+    {
+       ASSERT_TRUE(index[i] > index[i-1]);
+    }
+ }
+
+ free(buf);
+ free(index);
+ 
+ ASSERT_EMPTY_TAIL(output);
+
+ ASSERT_EQ(output,ref);
+
+} 
+
 void SupportTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
 {
 
@@ -771,6 +880,48 @@ void SupportTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>&
 
     break;
 
+    case TEST_RADIX_SORT_OUT_F32_43:
+    this->nbSamples = 11;
+    input.reload(SupportTestsF32::INPUT_SORT_F32_ID,mgr,this->nbSamples);
+    ref.reload(SupportTestsF32::REF_SORT_F32_ID,mgr);
+    output.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);            
+    break;
+
+    case TEST_RADIX_SORT_IN_F32_44:
+    this->nbSamples = 11;
+    input.reload(SupportTestsF32::INPUT_SORT_F32_ID,mgr,this->nbSamples);
+    ref.reload(SupportTestsF32::REF_SORT_F32_ID,mgr);
+    output.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);            
+    break;
+
+    case TEST_RADIX_SORT_CONST_F32_45:
+    this->nbSamples = 16;
+    input.reload(SupportTestsF32::INPUT_SORT_CONST_F32_ID,mgr,this->nbSamples);
+    ref.reload(SupportTestsF32::REF_SORT_CONST_F32_ID,mgr);
+    output.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr); 
+    break;
+
+    case TEST_RADIX_SORT_LONG_F32_46:
+    this->nbSamples = 256;
+    input.reload(SupportTestsF32::SAMPLES_F32_ID,mgr,this->nbSamples);
+    buffer.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+    output.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr); 
+    break;
+
+    case TEST_ARGSORT_F32_47:
+    this->nbSamples = 11;
+    input.reload(SupportTestsF32::INPUT_SORT_F32_ID,mgr,this->nbSamples);
+    ref.reload(SupportTestsF32::REF_SORT_F32_ID,mgr);
+    output.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);            
+    break;
+
+    case TEST_ARGSORT_F32_48:
+    this->nbSamples = 16;
+    input.reload(SupportTestsF32::INPUT_SORT_CONST_F32_ID,mgr,this->nbSamples);
+    ref.reload(SupportTestsF32::REF_SORT_CONST_F32_ID,mgr);
+    output.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr); 
+    break;
+
 
 
   }       
@@ -8,6 +8,25 @@
 #define REL_ERROR (1.0e-5)
 #define ABS_ERROR (5.0e-5)
 
+#if !defined(ARM_MATH_NEON)
+#define DCT_INIT(L) \
+  twiddle.create(3*L,TransformRF32::TEMP_F32_ID,mgr); \
+  arm_dct_init_f32(&this->instDctF32,L,twiddle.ptr());
+#else
+#define DCT_INIT(L)
+#endif
+
+#if !defined(ARM_MATH_NEON)
+#define MDCT_INIT(L) \
+  twiddle.create(2*L,TransformRF32::TEMP_F32_ID,mgr); \
+  state.create(L,TransformRF32::TEMP_F32_ID,mgr); \
+  stateinv.create(L,TransformRF32::TEMP_F32_ID,mgr); \
+  arm_mdct_init_f32(&this->instMdctF32,L,window.ptr(),state.ptr(),twiddle.ptr()); \
+  arm_mdct_init_f32(&this->instIMdctF32,L,window.ptr(),stateinv.ptr(),twiddle.ptr());
+#else
+#define MDCT_INIT(L)
+#endif
+
 
     void TransformRF32::test_rfft_f32()
     {
@@ -43,6 +62,95 @@
     } 
 
   
+    void TransformRF32::test_dct2_f32()
+    {
+#if !defined(ARM_MATH_NEON)
+       const float32_t *inp = input.ptr();
+       const float32_t *refp = ref.ptr();
+       const float32_t *refdstp = refdst.ptr();
+       float32_t *tmp = inputchanged.ptr();
+       float32_t *outp = outputfft.ptr();
+       float32_t *invp = outputinv.ptr();
+
+       arm_dct2_f32(&this->instDctF32,inp,outp,tmp);
+
+       ASSERT_SNR(outputfft,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_CLOSE_ERROR(outputfft,ref,ABS_ERROR,REL_ERROR);
+
+       arm_idct2_f32(&this->instDctF32,refp,invp,tmp);
+
+       ASSERT_SNR(outputinv,input,(float32_t)SNR_THRESHOLD);
+       ASSERT_CLOSE_ERROR(outputinv,input,ABS_ERROR,REL_ERROR);
+
+       arm_dst2_f32(&this->instDctF32,inp,outp,tmp);
+
+       ASSERT_SNR(outputfft,refdst,(float32_t)SNR_THRESHOLD);
+       ASSERT_CLOSE_ERROR(outputfft,refdst,ABS_ERROR,REL_ERROR);
+
+       arm_idst2_f32(&this->instDctF32,refdstp,invp,tmp);
+
+       ASSERT_SNR(outputinv,input,(float32_t)SNR_THRESHOLD);
+       ASSERT_CLOSE_ERROR(outputinv,input,ABS_ERROR,REL_ERROR);
+       ASSERT_EMPTY_TAIL(outputfft);
+#endif
+    }
+
+    void TransformRF32::test_dct4_f32()
+    {
+#if !defined(ARM_MATH_NEON)
+       const float32_t *inp = input.ptr();
+       const float32_t *refp = ref.ptr();
+       float32_t *tmp = inputchanged.ptr();
+       float32_t *outp = outputfft.ptr();
+       float32_t *invp = outputinv.ptr();
+
+       arm_dct4_f32(&this->instDctF32,inp,outp,tmp);
+
+       ASSERT_SNR(outputfft,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_CLOSE_ERROR(outputfft,ref,ABS_ERROR,REL_ERROR);
+
+       arm_idct4_f32(&this->instDctF32,refp,invp,tmp);
+
+       ASSERT_SNR(outputinv,input,(float32_t)SNR_THRESHOLD);
+       ASSERT_CLOSE_ERROR(outputinv,input,ABS_ERROR,REL_ERROR);
+       ASSERT_EMPTY_TAIL(outputfft);
+#endif
+    }
+
+    void TransformRF32::test_mdct_f32()
+    {
+#if !defined(ARM_MATH_NEON)
+       const float32_t *inp = input.ptr();
+       const float32_t *refp = ref.ptr();
+       float32_t *expectedp = inputchanged.ptr();
+       float32_t *outp = outputfft.ptr();
+       float32_t *invp = outputinv.ptr();
+       const unsigned long N = this->instMdctF32.N;
+       const unsigned long nbFrames = input.nbSamples() / N;
+
+       for(unsigned long f = 0;f < nbFrames; f++)
+       {
+           arm_mdct_f32(&this->instMdctF32,inp + f*N,outp + f*N);
+       }
+
+       ASSERT_SNR(outputfft,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_CLOSE_ERROR(outputfft,ref,ABS_ERROR,REL_ERROR);
+
+       for(unsigned long f = 0;f < nbFrames; f++)
+       {
+           arm_imdct_f32(&this->instIMdctF32,refp + f*N,invp + f*N);
+       }
+
+       /* The reconstructed signal is the input delayed by one frame */
+       memset(expectedp,0,sizeof(float32_t)*N);
+       memcpy(expectedp + N,inp,sizeof(float32_t)*(input.nbSamples() - N));
+
+       ASSERT_SNR(outputinv,inputchanged,(float32_t)SNR_THRESHOLD);
+       ASSERT_CLOSE_ERROR(outputinv,inputchanged,ABS_ERROR,REL_ERROR);
+       ASSERT_EMPTY_TAIL(outputfft);
+#endif
+    }
+
     void TransformRF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
 
@@ -52,6 +160,121 @@
        switch(id)
        {
 
+          case TransformRF32::TEST_DCT2_F32_33:
+
+            input.reload(TransformRF32::INPUTS_DCT_32_F32_ID,mgr);
+            ref.reload(  TransformRF32::REF_DCT2_32_F32_ID,mgr);
+            refdst.reload(TransformRF32::REF_DST2_32_F32_ID,mgr);
+
+            DCT_INIT(32);
+
+            inputchanged.create(input.nbSamples(),TransformRF32::TEMP_F32_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRF32::OUTPUT_RFFT_F32_ID,mgr);
+
+          break;
+
+          case TransformRF32::TEST_DCT2_F32_34:
+
+            input.reload(TransformRF32::INPUTS_DCT_128_F32_ID,mgr);
+            ref.reload(  TransformRF32::REF_DCT2_128_F32_ID,mgr);
+            refdst.reload(TransformRF32::REF_DST2_128_F32_ID,mgr);
+
+            DCT_INIT(128);
+
+            inputchanged.create(input.nbSamples(),TransformRF32::TEMP_F32_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRF32::OUTPUT_RFFT_F32_ID,mgr);
+
+          break;
+
+          case TransformRF32::TEST_DCT2_F32_35:
+
+            input.reload(TransformRF32::INPUTS_DCT_512_F32_ID,mgr);
+            ref.reload(  TransformRF32::REF_DCT2_512_F32_ID,mgr);
+            refdst.reload(TransformRF32::REF_DST2_512_F32_ID,mgr);
+
+            DCT_INIT(512);
+
+            inputchanged.create(input.nbSamples(),TransformRF32::TEMP_F32_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRF32::OUTPUT_RFFT_F32_ID,mgr);
+
+          break;
+
+          case TransformRF32::TEST_DCT4_F32_36:
+
+            input.reload(TransformRF32::INPUTS_DCT_32_F32_ID,mgr);
+            ref.reload(  TransformRF32::REF_DCT4_32_F32_ID,mgr);
+
+            DCT_INIT(32);
+
+            inputchanged.create(input.nbSamples(),TransformRF32::TEMP_F32_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRF32::OUTPUT_RFFT_F32_ID,mgr);
+
+          break;
+
+          case TransformRF32::TEST_DCT4_F32_37:
+
+            input.reload(TransformRF32::INPUTS_DCT_128_F32_ID,mgr);
+            ref.reload(  TransformRF32::REF_DCT4_128_F32_ID,mgr);
+
+            DCT_INIT(128);
+
+            inputchanged.create(input.nbSamples(),TransformRF32::TEMP_F32_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRF32::OUTPUT_RFFT_F32_ID,mgr);
+
+          break;
+
+          case TransformRF32::TEST_DCT4_F32_38:
+
+            input.reload(TransformRF32::INPUTS_DCT_512_F32_ID,mgr);
+            ref.reload(  TransformRF32::REF_DCT4_512_F32_ID,mgr);
+
+            DCT_INIT(512);
+
+            inputchanged.create(input.nbSamples(),TransformRF32::TEMP_F32_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRF32::OUTPUT_RFFT_F32_ID,mgr);
+
+          break;
+
+          case TransformRF32::TEST_MDCT_F32_39:
+
+            input.reload(TransformRF32::INPUTS_MDCT_32_F32_ID,mgr);
+            window.reload(TransformRF32::WINDOW_MDCT_32_F32_ID,mgr);
+            ref.reload(  TransformRF32::REF_MDCT_32_F32_ID,mgr);
+
+            MDCT_INIT(32);
+
+            inputchanged.create(input.nbSamples(),TransformRF32::TEMP_F32_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRF32::OUTPUT_RFFT_F32_ID,mgr);
+
+          break;
+
+          case TransformRF32::TEST_MDCT_F32_40:
+
+            input.reload(TransformRF32::INPUTS_MDCT_128_F32_ID,mgr);
+            window.reload(TransformRF32::WINDOW_MDCT_128_F32_ID,mgr);
+            ref.reload(  TransformRF32::REF_MDCT_128_F32_ID,mgr);
+
+            MDCT_INIT(128);
+
+            inputchanged.create(input.nbSamples(),TransformRF32::TEMP_F32_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRF32::OUTPUT_RFFT_F32_ID,mgr);
+
+          break;
+
+          case TransformRF32::TEST_MDCT_F32_41:
+
+            input.reload(TransformRF32::INPUTS_MDCT_512_F32_ID,mgr);
+            window.reload(TransformRF32::WINDOW_MDCT_512_F32_ID,mgr);
+            ref.reload(  TransformRF32::REF_MDCT_512_F32_ID,mgr);
+
+            MDCT_INIT(512);
+
+            inputchanged.create(input.nbSamples(),TransformRF32::TEMP_F32_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRF32::OUTPUT_RFFT_F32_ID,mgr);
+
+          break;
+
+
           case TransformRF32::TEST_RFFT_F32_1:
 
             input.reload(TransformRF32::INPUTS_RFFT_NOISY_32_F32_ID,mgr);
@@ -10,6 +10,19 @@
 #define ABS_FFT_ERROR_Q15 ((q15_t)14)
 #define ABS_IFFT_ERROR_Q15 ((q15_t)1250)
 
+#define DCT_SNR_THRESHOLD 40
+#define IDCT_SNR_THRESHOLD 20
+#define ABS_DCT_ERROR_Q15 ((q15_t)14)
+#define ABS_IDCT_ERROR_Q15 ((q15_t)4000)
+
+#if !defined(ARM_MATH_NEON)
+#define DCT_INIT(L) \
+  twiddle.create(4*L,TransformRQ15::TEMP_Q15_ID,mgr); \
+  arm_dct_init_q15(&this->instDctQ15,L,twiddle.ptr());
+#else
+#define DCT_INIT(L)
+#endif
+
 #if defined(ARM_MATH_NEON)
 #define RFFT_INIT(L) \
   arm_rfft_init_q15(&this->instRfftQ15 ,L);
@@ -76,6 +89,62 @@
     } 
 
   
+    void TransformRQ15::test_dct2_q15()
+    {
+#if !defined(ARM_MATH_NEON)
+       const q15_t *inp = input.ptr();
+       const q15_t *refp = ref.ptr();
+       q15_t *tmp = inputchanged.ptr();
+       q15_t *outp = outputfft.ptr();
+       q15_t *invp = outputinv.ptr();
+
+       arm_dct2_q15(&this->instDctQ15,inp,outp,tmp);
+
+       ASSERT_SNR(outputfft,ref,(float32_t)DCT_SNR_THRESHOLD);
+       ASSERT_NEAR_EQ(outputfft,ref,ABS_DCT_ERROR_Q15);
+
+       /* The inverse of the scaled transform is the input scaled down by N */
+       arm_idct2_q15(&this->instDctQ15,refp,invp,tmp);
+
+       for(unsigned long i = 0;i < outputinv.nbSamples(); i++)
+       {
+           invp[i] = invp[i] << this->scaling;
+       }
+
+       ASSERT_SNR(outputinv,input,(float32_t)IDCT_SNR_THRESHOLD);
+       ASSERT_NEAR_EQ(outputinv,input,ABS_IDCT_ERROR_Q15);
+       ASSERT_EMPTY_TAIL(outputfft);
+#endif
+    }
+
+    void TransformRQ15::test_dct4_q15()
+    {
+#if !defined(ARM_MATH_NEON)
+       const q15_t *inp = input.ptr();
+       const q15_t *refp = ref.ptr();
+       q15_t *tmp = inputchanged.ptr();
+       q15_t *outp = outputfft.ptr();
+       q15_t *invp = outputinv.ptr();
+
+       arm_dct4_q15(&this->instDctQ15,inp,outp,tmp);
+
+       ASSERT_SNR(outputfft,ref,(float32_t)DCT_SNR_THRESHOLD);
+       ASSERT_NEAR_EQ(outputfft,ref,ABS_DCT_ERROR_Q15);
+
+       /* The inverse of the scaled transform is the input scaled down by N */
+       arm_idct4_q15(&this->instDctQ15,refp,invp,tmp);
+
+       for(unsigned long i = 0;i < outputinv.nbSamples(); i++)
+       {
+           invp[i] = invp[i] << this->scaling;
+       }
+
+       ASSERT_SNR(outputinv,input,(float32_t)IDCT_SNR_THRESHOLD);
+       ASSERT_NEAR_EQ(outputinv,input,ABS_IDCT_ERROR_Q15);
+       ASSERT_EMPTY_TAIL(outputfft);
+#endif
+    }
+
     void TransformRQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
 
@@ -85,6 +154,91 @@
        switch(id)
        {
 
+          case TransformRQ15::TEST_DCT2_Q15_33:
+
+            input.reload(TransformRQ15::INPUTS_DCT_32_Q15_ID,mgr);
+            ref.reload(  TransformRQ15::REF_DCT2_32_Q15_ID,mgr);
+
+            DCT_INIT(32);
+
+            inputchanged.create(input.nbSamples(),TransformRQ15::TEMP_Q15_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRQ15::OUTPUT_RFFT_Q15_ID,mgr);
+
+            this->scaling=5;
+
+          break;
+
+          case TransformRQ15::TEST_DCT2_Q15_34:
+
+            input.reload(TransformRQ15::INPUTS_DCT_128_Q15_ID,mgr);
+            ref.reload(  TransformRQ15::REF_DCT2_128_Q15_ID,mgr);
+
+            DCT_INIT(128);
+
+            inputchanged.create(input.nbSamples(),TransformRQ15::TEMP_Q15_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRQ15::OUTPUT_RFFT_Q15_ID,mgr);
+
+            this->scaling=7;
+
+          break;
+
+          case TransformRQ15::TEST_DCT2_Q15_35:
+
+            input.reload(TransformRQ15::INPUTS_DCT_512_Q15_ID,mgr);
+            ref.reload(  TransformRQ15::REF_DCT2_512_Q15_ID,mgr);
+
+            DCT_INIT(512);
+
+            inputchanged.create(input.nbSamples(),TransformRQ15::TEMP_Q15_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRQ15::OUTPUT_RFFT_Q15_ID,mgr);
+
+            this->scaling=9;
+
+          break;
+
+          case TransformRQ15::TEST_DCT4_Q15_36:
+
+            input.reload(TransformRQ15::INPUTS_DCT_32_Q15_ID,mgr);
+            ref.reload(  TransformRQ15::REF_DCT4_32_Q15_ID,mgr);
+
+            DCT_INIT(32);
+
+            inputchanged.create(input.nbSamples(),TransformRQ15::TEMP_Q15_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRQ15::OUTPUT_RFFT_Q15_ID,mgr);
+
+            this->scaling=5;
+
+          break;
+
+          case TransformRQ15::TEST_DCT4_Q15_37:
+
+            input.reload(TransformRQ15::INPUTS_DCT_128_Q15_ID,mgr);
+            ref.reload(  TransformRQ15::REF_DCT4_128_Q15_ID,mgr);
+
+            DCT_INIT(128);
+
+            inputchanged.create(input.nbSamples(),TransformRQ15::TEMP_Q15_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRQ15::OUTPUT_RFFT_Q15_ID,mgr);
+
+            this->scaling=7;
+
+          break;
+
+          case TransformRQ15::TEST_DCT4_Q15_38:
+
+            input.reload(TransformRQ15::INPUTS_DCT_512_Q15_ID,mgr);
+            ref.reload(  TransformRQ15::REF_DCT4_512_Q15_ID,mgr);
+
+            DCT_INIT(512);
+
+            inputchanged.create(input.nbSamples(),TransformRQ15::TEMP_Q15_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRQ15::OUTPUT_RFFT_Q15_ID,mgr);
+
+            this->scaling=9;
+
+          break;
+
+
           case TransformRQ15::TEST_RFFT_Q15_1:
 
             input.reload(TransformRQ15::INPUTS_RFFT_NOISY_32_Q15_ID,mgr);
@@ -9,6 +9,30 @@
 #define ABS_RIFFT_ERROR_Q31 ((q31_t)52000)
 #define ABS_RIFFT_LONG_ERROR_Q31 ((q31_t)209000)
 
+#define DCT_SNR_THRESHOLD 100
+#define IDCT_SNR_THRESHOLD 70
+#define ABS_DCT_ERROR_Q31 ((q31_t)100)
+#define ABS_IDCT_ERROR_Q31 ((q31_t)200000)
+
+#if !defined(ARM_MATH_NEON)
+#define DCT_INIT(L) \
+  twiddle.create(4*L,TransformRQ31::TEMP_Q31_ID,mgr); \
+  arm_dct_init_q31(&this->instDctQ31,L,twiddle.ptr());
+#else
+#define DCT_INIT(L)
+#endif
+
+#if !defined(ARM_MATH_NEON)
+#define MDCT_INIT(L) \
+  twiddle.create(2*L,TransformRQ31::TEMP_Q31_ID,mgr); \
+  state.create(L,TransformRQ31::TEMP_Q31_ID,mgr); \
+  stateinv.create(L,TransformRQ31::TEMP_Q31_ID,mgr); \
+  arm_mdct_init_q31(&this->instMdctQ31,L,window.ptr(),state.ptr(),twiddle.ptr()); \
+  arm_mdct_init_q31(&this->instIMdctQ31,L,window.ptr(),stateinv.ptr(),twiddle.ptr());
+#else
+#define MDCT_INIT(L)
+#endif
+
 
 #if defined(ARM_MATH_NEON)
 #define RFFT_INIT(L) \
@@ -107,6 +131,102 @@
     } 
 
   
+    void TransformRQ31::test_dct2_q31()
+    {
+#if !defined(ARM_MATH_NEON)
+       const q31_t *inp = input.ptr();
+       const q31_t *refp = ref.ptr();
+       q31_t *tmp = inputchanged.ptr();
+       q31_t *outp = outputfft.ptr();
+       q31_t *invp = outputinv.ptr();
+
+       arm_dct2_q31(&this->instDctQ31,inp,outp,tmp);
+
+       ASSERT_SNR(outputfft,ref,(float32_t)DCT_SNR_THRESHOLD);
+       ASSERT_NEAR_EQ(outputfft,ref,ABS_DCT_ERROR_Q31);
+
+       /* The inverse of the scaled transform is the input scaled down by N */
+       arm_idct2_q31(&this->instDctQ31,refp,invp,tmp);
+
+       for(unsigned long i = 0;i < outputinv.nbSamples(); i++)
+       {
+           invp[i] = invp[i] << this->scaling;
+       }
+
+       ASSERT_SNR(outputinv,input,(float32_t)IDCT_SNR_THRESHOLD);
+       ASSERT_NEAR_EQ(outputinv,input,ABS_IDCT_ERROR_Q31);
+       ASSERT_EMPTY_TAIL(outputfft);
+#endif
+    }
+
+    void TransformRQ31::test_dct4_q31()
+    {
+#if !defined(ARM_MATH_NEON)
+       const q31_t *inp = input.ptr();
+       const q31_t *refp = ref.ptr();
+       q31_t *tmp = inputchanged.ptr();
+       q31_t *outp = outputfft.ptr();
+       q31_t *invp = outputinv.ptr();
+
+       arm_dct4_q31(&this->instDctQ31,inp,outp,tmp);
+
+       ASSERT_SNR(outputfft,ref,(float32_t)DCT_SNR_THRESHOLD);
+       ASSERT_NEAR_EQ(outputfft,ref,ABS_DCT_ERROR_Q31);
+
+       /* The inverse of the scaled transform is the input scaled down by N */
+       arm_idct4_q31(&this->instDctQ31,refp,invp,tmp);
+
+       for(unsigned long i = 0;i < outputinv.nbSamples(); i++)
+       {
+           invp[i] = invp[i] << this->scaling;
+       }
+
+       ASSERT_SNR(outputinv,input,(float32_t)IDCT_SNR_THRESHOLD);
+       ASSERT_NEAR_EQ(outputinv,input,ABS_IDCT_ERROR_Q31);
+       ASSERT_EMPTY_TAIL(outputfft);
+#endif
+    }
+
+    void TransformRQ31::test_mdct_q31()
+    {
+#if !defined(ARM_MATH_NEON)
+       const q31_t *inp = input.ptr();
+       const q31_t *refp = ref.ptr();
+       q31_t *expectedp = inputchanged.ptr();
+       q31_t *outp = outputfft.ptr();
+       q31_t *invp = outputinv.ptr();
+       const unsigned long N = this->instMdctQ31.N;
+       const unsigned long nbFrames = input.nbSamples() / N;
+
+       for(unsigned long f = 0;f < nbFrames; f++)
+       {
+           arm_mdct_q31(&this->instMdctQ31,inp + f*N,outp + f*N);
+       }
+
+       ASSERT_SNR(outputfft,ref,(float32_t)DCT_SNR_THRESHOLD);
+       ASSERT_NEAR_EQ(outputfft,ref,ABS_DCT_ERROR_Q31);
+
+       for(unsigned long f = 0;f < nbFrames; f++)
+       {
+           arm_imdct_q31(&this->instIMdctQ31,refp + f*N,invp + f*N);
+       }
+
+       for(unsigned long i = 0;i < outputinv.nbSamples(); i++)
+       {
+           invp[i] = invp[i] << this->scaling;
+       }
+
+       /* The reconstructed signal is the input scaled down by N
+          and delayed by one frame */
+       memset(expectedp,0,sizeof(q31_t)*N);
+       memcpy(expectedp + N,inp,sizeof(q31_t)*(input.nbSamples() - N));
+
+       ASSERT_SNR(outputinv,inputchanged,(float32_t)IDCT_SNR_THRESHOLD);
+       ASSERT_NEAR_EQ(outputinv,inputchanged,ABS_IDCT_ERROR_Q31);
+       ASSERT_EMPTY_TAIL(outputfft);
+#endif
+    }
+
     void TransformRQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
 
@@ -116,6 +236,136 @@
        switch(id)
        {
 
+          case TransformRQ31::TEST_DCT2_Q31_33:
+
+            input.reload(TransformRQ31::INPUTS_DCT_32_Q31_ID,mgr);
+            ref.reload(  TransformRQ31::REF_DCT2_32_Q31_ID,mgr);
+
+            DCT_INIT(32);
+
+            inputchanged.create(input.nbSamples(),TransformRQ31::TEMP_Q31_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRQ31::OUTPUT_RFFT_Q31_ID,mgr);
+
+            this->scaling=5;
+
+          break;
+
+          case TransformRQ31::TEST_DCT2_Q31_34:
+
+            input.reload(TransformRQ31::INPUTS_DCT_128_Q31_ID,mgr);
+            ref.reload(  TransformRQ31::REF_DCT2_128_Q31_ID,mgr);
+
+            DCT_INIT(128);
+
+            inputchanged.create(input.nbSamples(),TransformRQ31::TEMP_Q31_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRQ31::OUTPUT_RFFT_Q31_ID,mgr);
+
+            this->scaling=7;
+
+          break;
+
+          case TransformRQ31::TEST_DCT2_Q31_35:
+
+            input.reload(TransformRQ31::INPUTS_DCT_512_Q31_ID,mgr);
+            ref.reload(  TransformRQ31::REF_DCT2_512_Q31_ID,mgr);
+
+            DCT_INIT(512);
+
+            inputchanged.create(input.nbSamples(),TransformRQ31::TEMP_Q31_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRQ31::OUTPUT_RFFT_Q31_ID,mgr);
+
+            this->scaling=9;
+
+          break;
+
+          case TransformRQ31::TEST_DCT4_Q31_36:
+
+            input.reload(TransformRQ31::INPUTS_DCT_32_Q31_ID,mgr);
+            ref.reload(  TransformRQ31::REF_DCT4_32_Q31_ID,mgr);
+
+            DCT_INIT(32);
+
+            inputchanged.create(input.nbSamples(),TransformRQ31::TEMP_Q31_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRQ31::OUTPUT_RFFT_Q31_ID,mgr);
+
+            this->scaling=5;
+
+          break;
+
+          case TransformRQ31::TEST_DCT4_Q31_37:
+
+            input.reload(TransformRQ31::INPUTS_DCT_128_Q31_ID,mgr);
+            ref.reload(  TransformRQ31::REF_DCT4_128_Q31_ID,mgr);
+
+            DCT_INIT(128);
+
+            inputchanged.create(input.nbSamples(),TransformRQ31::TEMP_Q31_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRQ31::OUTPUT_RFFT_Q31_ID,mgr);
+
+            this->scaling=7;
+
+          break;
+
+          case TransformRQ31::TEST_DCT4_Q31_38:
+
+            input.reload(TransformRQ31::INPUTS_DCT_512_Q31_ID,mgr);
+            ref.reload(  TransformRQ31::REF_DCT4_512_Q31_ID,mgr);
+
+            DCT_INIT(512);
+
+            inputchanged.create(input.nbSamples(),TransformRQ31::TEMP_Q31_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRQ31::OUTPUT_RFFT_Q31_ID,mgr);
+
+            this->scaling=9;
+
+          break;
+
+          case TransformRQ31::TEST_MDCT_Q31_39:
+
+            input.reload(TransformRQ31::INPUTS_MDCT_32_Q31_ID,mgr);
+            window.reload(TransformRQ31::WINDOW_MDCT_32_Q31_ID,mgr);
+            ref.reload(  TransformRQ31::REF_MDCT_32_Q31_ID,mgr);
+
+            MDCT_INIT(32);
+
+            inputchanged.create(input.nbSamples(),TransformRQ31::TEMP_Q31_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRQ31::OUTPUT_RFFT_Q31_ID,mgr);
+
+            this->scaling=5;
+
+          break;
+
+          case TransformRQ31::TEST_MDCT_Q31_40:
+
+            input.reload(TransformRQ31::INPUTS_MDCT_128_Q31_ID,mgr);
+            window.reload(TransformRQ31::WINDOW_MDCT_128_Q31_ID,mgr);
+            ref.reload(  TransformRQ31::REF_MDCT_128_Q31_ID,mgr);
+
+            MDCT_INIT(128);
+
+            inputchanged.create(input.nbSamples(),TransformRQ31::TEMP_Q31_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRQ31::OUTPUT_RFFT_Q31_ID,mgr);
+
+            this->scaling=7;
+
+          break;
+
+          case TransformRQ31::TEST_MDCT_Q31_41:
+
+            input.reload(TransformRQ31::INPUTS_MDCT_512_Q31_ID,mgr);
+            window.reload(TransformRQ31::WINDOW_MDCT_512_Q31_ID,mgr);
+            ref.reload(  TransformRQ31::REF_MDCT_512_Q31_ID,mgr);
+
+            MDCT_INIT(512);
+
+            inputchanged.create(input.nbSamples(),TransformRQ31::TEMP_Q31_ID,mgr);
+            outputinv.create(input.nbSamples(),TransformRQ31::OUTPUT_RFFT_Q31_ID,mgr);
+
+            this->scaling=9;
+
+          break;
+
+
           case TransformRQ31::TEST_RFFT_Q31_1:
 
             input.reload(TransformRQ31::INPUTS_RFFT_NOISY_32_Q31_ID,mgr);
@@ -61,6 +61,19 @@ Comparison for Cholesky
 #define REL_ERROR_LDLT_SPDO (1e-5)
 #define ABS_ERROR_LDLT_SDPO (2e-1)
 
+/* Eigen and singular value decompositions are checked
+   by reconstructing the input matrix */
+#define REL_ERROR_EIG (1e-5)
+#define ABS_ERROR_EIG (1e-4)
+
+/* Panel size of the blocked decompositions. Small so that
+   several panels are used with the test matrices. */
+#define BLOCKED_PANEL_SIZE 3
+
+/* Number of matrices of the batched tests. It is not a multiple
+   of the number of SIMD lanes to test the tail */
+#define BATCHSIZE 5
+
 /* Upper bound of maximum matrix dimension used by Python */
 #define MAXMATRIXDIM 40
 
@@ -72,6 +85,49 @@ static void checkInnerTailOverflow(float32_t *b)
     ASSERT_TRUE(b[3] == 0);
 }
 
+/* Dimensions of the large transpose tests. They are not multiples of
+   ARM_MAT_LARGE_TRANS_TILE and are sorted by increasing size so that
+   the tail after each result is not overwritten by the previous one */
+static const uint32_t largeTransDims[]={1,40, 40,1, 17,17, 16,33, 37,21, 33,40};
+#define NBLARGETRANS (sizeof(largeTransDims)/(2*sizeof(uint32_t)))
+
+/* Padding added to the rows of the strided test matrixes */
+#define STRIDEPAD 3
+
+/* Size of a buffer for a strided matrix with two paddings */
+#define STRIDEDBUFSIZE ((MAXMATRIXDIM+2*STRIDEPAD)*(MAXMATRIXDIM+2*STRIDEPAD)+1)
+
+/* The strided matrixes start after one sample of padding */
+static void copyToStrided(float32_t *dst,const float32_t *src,int rows,int columns,int stride)
+{
+    memset(dst,0,sizeof(float32_t)*(rows*stride+1));
+    for(int r=0;r < rows; r++)
+    {
+       memcpy(dst + r*stride + 1,src + r*columns,sizeof(float32_t)*columns);
+    }
+}
+
+static void copyFromStrided(float32_t *dst,const float32_t *src,int rows,int columns,int stride)
+{
+    for(int r=0;r < rows; r++)
+    {
+       memcpy(dst + r*columns,src + r*stride + 1,sizeof(float32_t)*columns);
+    }
+}
+
+/* The padding of a strided output must not be written */
+static void checkStridedPadding(const float32_t *b,int rows,int columns,int stride)
+{
+    ASSERT_TRUE(b[0] == 0);
+    for(int r=0;r < rows; r++)
+    {
+       for(int c=columns;c < stride; c++)
+       {
+          ASSERT_TRUE(b[r*stride + c + 1] == 0);
+       }
+    }
+}
+
 #define LOADDATA2()                          \
       const float32_t *inp1=input1.ptr();    \
       const float32_t *inp2=input2.ptr();    \
@@ -680,6 +736,211 @@ void UnaryTestsF32::test_mat_inverse_f32()
       ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR,REL_ERROR);
     }
 
+    void UnaryTestsF32::test_mat_add_strided_f32()
+    {     
+      LOADDATA2();
+      arm_status status;
+      arm_matrix_strided_instance_f32 sa,sb,sout;
+      float32_t *cp=c.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          /* The inputs and the output have different strides */
+          copyToStrided(ap,inp1,rows,columns,columns+STRIDEPAD);
+          copyToStrided(bp,inp2,rows,columns,columns+2*STRIDEPAD);
+          memset(cp,0,sizeof(float32_t)*c.nbSamples());
+
+          arm_mat_strided_init_f32(&sa,rows,columns,columns+STRIDEPAD,ap + 1);
+          arm_mat_strided_init_f32(&sb,rows,columns,columns+2*STRIDEPAD,bp + 1);
+          arm_mat_strided_init_f32(&sout,rows,columns,columns+STRIDEPAD,cp + 1);
+
+          status=arm_mat_add_strided_f32(&sa,&sb,&sout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          checkStridedPadding(cp,rows,columns,columns+STRIDEPAD);
+          copyFromStrided(outp,cp,rows,columns,columns+STRIDEPAD);
+
+          outp += (rows * columns);
+          checkInnerTailOverflow(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void UnaryTestsF32::test_mat_trans_strided_f32()
+    {     
+      LOADDATA1();
+      arm_status status;
+      arm_matrix_strided_instance_f32 sa,sout;
+      float32_t *cp=c.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          copyToStrided(ap,inp1,rows,columns,columns+STRIDEPAD);
+          memset(cp,0,sizeof(float32_t)*c.nbSamples());
+
+          arm_mat_strided_init_f32(&sa,rows,columns,columns+STRIDEPAD,ap + 1);
+          arm_mat_strided_init_f32(&sout,columns,rows,rows+2*STRIDEPAD,cp + 1);
+
+          status=arm_mat_trans_strided_f32(&sa,&sout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          checkStridedPadding(cp,columns,rows,rows+2*STRIDEPAD);
+          copyFromStrided(outp,cp,columns,rows,rows+2*STRIDEPAD);
+
+          outp += (rows * columns);
+          checkInnerTailOverflow(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void UnaryTestsF32::test_mat_vec_mult_strided_f32()
+    {     
+      LOADVECDATA2();
+      arm_matrix_strided_instance_f32 sa;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+
+          copyToStrided(ap,inp1,rows,internal,internal+STRIDEPAD);
+          memcpy((void*)bp,(const void*)inp2,sizeof(float32_t)*internal);
+
+          arm_mat_strided_init_f32(&sa,rows,internal,internal+STRIDEPAD,ap + 1);
+
+          arm_mat_vec_mult_strided_f32(&sa, bp, outp);
+
+          outp += rows ;
+          checkInnerTailOverflow(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void UnaryTestsF32::test_solve_upper_triangular_strided_f32()
+    {
+      float32_t *ap=a.ptr();                 
+      const float32_t *inp1=input1.ptr();    
+
+      float32_t *bp=b.ptr();                 
+      const float32_t *inp2=input2.ptr();    
+                                             
+      float32_t *outp=output.ptr();     
+      int16_t *dimsp = dims.ptr();           
+      int nbMatrixes = dims.nbSamples()>>1;
+
+      int rows,columns;                      
+      int i;
+      arm_status status;
+      arm_matrix_strided_instance_f32 sut,sx;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          copyToStrided(ap,inp1,rows,rows,rows+STRIDEPAD);
+          copyToStrided(bp,inp2,rows,columns,columns+2*STRIDEPAD);
+
+          arm_mat_strided_init_f32(&sut,rows,rows,rows+STRIDEPAD,ap + 1);
+          arm_mat_strided_init_f32(&sx,rows,columns,columns+2*STRIDEPAD,bp + 1);
+
+          /* The solution replaces the right hand side */
+          status=arm_mat_solve_upper_triangular_strided_f32(&sut,&sx,&sx);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          checkStridedPadding(bp,rows,columns,columns+2*STRIDEPAD);
+          copyFromStrided(outp,bp,rows,columns,columns+2*STRIDEPAD);
+
+          outp += (rows * columns);
+          inp1 += (rows * rows);
+          inp2 += (rows * columns);
+          checkInnerTailOverflow(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR,REL_ERROR);
+    }
+
+    void UnaryTestsF32::test_solve_lower_triangular_strided_f32()
+    {
+      float32_t *ap=a.ptr();                 
+      const float32_t *inp1=input1.ptr();    
+
+      float32_t *bp=b.ptr();                 
+      const float32_t *inp2=input2.ptr();    
+                                             
+      float32_t *outp=output.ptr();     
+      int16_t *dimsp = dims.ptr();           
+      int nbMatrixes = dims.nbSamples()>>1;
+
+      int rows,columns;                      
+      int i;
+      arm_status status;
+      arm_matrix_strided_instance_f32 slt,sx;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          copyToStrided(ap,inp1,rows,rows,rows+STRIDEPAD);
+          copyToStrided(bp,inp2,rows,columns,columns+2*STRIDEPAD);
+
+          arm_mat_strided_init_f32(&slt,rows,rows,rows+STRIDEPAD,ap + 1);
+          arm_mat_strided_init_f32(&sx,rows,columns,columns+2*STRIDEPAD,bp + 1);
+
+          /* The solution replaces the right hand side */
+          status=arm_mat_solve_lower_triangular_strided_f32(&slt,&sx,&sx);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          checkStridedPadding(bp,rows,columns,columns+2*STRIDEPAD);
+          copyFromStrided(outp,bp,rows,columns,columns+2*STRIDEPAD);
+
+          outp += (rows * columns);
+          inp1 += (rows * rows);
+          inp2 += (rows * columns);
+          checkInnerTailOverflow(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR,REL_ERROR);
+    }
+
     static void trans_f64(const float64_t *src, float64_t *dst, int n)
     {
         for(int r=0; r<n ; r++)
@@ -856,67 +1117,974 @@ void UnaryTestsF32::test_mat_inverse_f32()
   
     }
 
-    void UnaryTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
+    void UnaryTestsF32::test_mat_cholesky_blocked_dpo_f32()
     {
+      float32_t *ap=a.ptr();                 
+      const float32_t *inp1=input1.ptr();    
+                                             
+                                             
+      float32_t *outp=output.ptr();     
+      int16_t *dimsp = dims.ptr();           
+      int nbMatrixes = dims.nbSamples();
 
+      int rows,columns;                      
+      int i;
+      arm_status status;
 
-      (void)params;
-      switch(id)
+      for(i=0;i < nbMatrixes ; i ++)
       {
-         case TEST_MAT_ADD_F32_1:
-            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
-            input2.reload(UnaryTestsF32::INPUTS2_F32_ID,mgr);
-            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+          rows = *dimsp++;
+          columns = rows;
 
-            ref.reload(UnaryTestsF32::REFADD1_F32_ID,mgr);
+          PREPAREDATA1(false);
 
-            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
-            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
-            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPB_F32_ID,mgr);
-         break;
+          status=arm_mat_cholesky_blocked_f32(&this->in1,&this->out,BLOCKED_PANEL_SIZE);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
 
-         case TEST_MAT_SUB_F32_2:
-            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
-            input2.reload(UnaryTestsF32::INPUTS2_F32_ID,mgr);
-            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+          outp += (rows * columns);
+          inp1 += (rows * columns);
+          checkInnerTailOverflow(outp);
 
-            ref.reload(UnaryTestsF32::REFSUB1_F32_ID,mgr);
+      }
 
-            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
-            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
-            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPB_F32_ID,mgr);
-         break;
+      ASSERT_EMPTY_TAIL(output);
 
-         case TEST_MAT_SCALE_F32_3:
-            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
-            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD_CHOL);
 
-            ref.reload(UnaryTestsF32::REFSCALE1_F32_ID,mgr);
+      ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR_CHOL,REL_ERROR_CHOL);
+    }
 
-            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
-            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
-         break;
+    void UnaryTestsF32::test_mat_ldl_blocked_f32()
+    {
+      float32_t *ap=a.ptr();                 
+      const float32_t *inp1=input1.ptr();  
 
-         case TEST_MAT_TRANS_F32_4:
-            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
-            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+                                        
+      float32_t *outllp=outputll.ptr();   
+      float32_t *outdp=outputd.ptr();   
+      int16_t *outpp=outputp.ptr();   
 
-            ref.reload(UnaryTestsF32::REFTRANS1_F32_ID,mgr);
 
-            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
-            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
-         break;
+      outa=outputa.ptr();   
+      outb=outputb.ptr();   
 
-         case TEST_MAT_INVERSE_F32_5:
-            input1.reload(UnaryTestsF32::INPUTSINV_F32_ID,mgr);
-            dims.reload(UnaryTestsF32::DIMSINVERT1_S16_ID,mgr);
+      int16_t *dimsp = dims.ptr();           
+      int nbMatrixes = dims.nbSamples();
 
-            ref.reload(UnaryTestsF32::REFINV1_F32_ID,mgr);
+      int rows,columns;                      
+      int i;
+      arm_status status;
+
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = rows;
+
+          PREPAREDATALL1();
+
+          outd.numRows=rows;
+          outd.numCols=columns;
+          outd.pData=outdp;
+
+          memset(outpp,0,rows*sizeof(uint16_t));
+          memset(outdp,0,columns*rows*sizeof(float32_t));
+
+          status=arm_mat_ldlt_blocked_f32(&this->in1,&this->outll,&this->outd,(uint16_t*)outpp,BLOCKED_PANEL_SIZE);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+ 
+
+          compute_ldlt_error(rows,outpp);
+
+         
+          outllp += (rows * columns);
+          outdp += (rows * columns);
+          outpp += rows;
+
+          outa += (rows * columns);
+          outb +=(rows * columns);
+
+          inp1 += (rows * columns);
+
+          checkInnerTailOverflow(outllp);
+          checkInnerTailOverflow(outdp);
+
+
+      }
+
+      ASSERT_EMPTY_TAIL(outputll);
+      ASSERT_EMPTY_TAIL(outputd);
+      ASSERT_EMPTY_TAIL(outputp);
+      ASSERT_EMPTY_TAIL(outputa);
+      ASSERT_EMPTY_TAIL(outputb);
+
+
+      ASSERT_CLOSE_ERROR(outputa,outputb,(double)snrAbs,(double)snrRel);
+
+
+  
+    }
+
+    void UnaryTestsF32::test_mat_lu_solve_f32()
+    {
+      const float32_t *inp1=input1.ptr();
+      const float32_t *refp=ref.ptr();
+
+      float32_t *ap=a.ptr();
+      float32_t *bp=b.ptr();
+
+      float32_t *outp=output.ptr();
+      int16_t *dimsp = dims.ptr();
+      int nbMatrixes = dims.nbSamples();
+      uint16_t pivots[MAXMATRIXDIM];
+      int rows,columns;
+      int i,k;
+      arm_status status;
+
+      /* The inverse is the solution of A X = I */
+      for(i=0;i < nbMatrixes-1 ; i ++)
+      {
+          rows = *dimsp++;
+          columns = rows;
+
+          PREPAREDATA1(false);
+
+          this->in2.numRows=rows;
+          this->in2.numCols=columns;
+          this->in2.pData = bp;
+
+          status=arm_mat_lu_f32(&this->in1,&this->in2,pivots);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          memset(outp,0,sizeof(float32_t)*rows*columns);
+          for(k=0;k < rows; k++)
+          {
+            outp[k*columns+k] = 1.0f;
+          }
+
+          status=arm_mat_lu_solve_f32(&this->in2,pivots,&this->out,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+          inp1 += (rows * columns);
+          refp += (rows * columns);
+
+      }
+
+      /*** Singular matrix **/
+      rows = *dimsp++;
+      columns = rows;
+
+      PREPAREDATA1(false);
+
+      this->in2.numRows=rows;
+      this->in2.numCols=columns;
+      this->in2.pData = bp;
+
+      status=arm_mat_lu_f32(&this->in1,&this->in2,pivots);
+      ASSERT_TRUE(status==ARM_MATH_SINGULAR);
+
+      /* There is no solution to compare with the reference */
+      memcpy(outp,refp,sizeof(float32_t)*rows*columns);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_INV,REL_ERROR_INV);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD_INV);
+
+    }
+
+    void UnaryTestsF32::test_mat_eig_sym_f32()
+    {
+      const float32_t *inp1=input1.ptr();
+      float32_t *ap=a.ptr();
+      float32_t *tmpp=b.ptr();
+      float32_t *eigp=c.ptr();
+
+      float32_t *outp=output.ptr();
+      int16_t *dimsp = dims.ptr();
+      int nbMatrixes = dims.nbSamples();
+      int rows,columns;
+      int i;
+      arm_status status;
+
+      outa=outputa.ptr();
+      outb=outputb.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = rows;
+
+          PREPAREDATA1(false);
+
+          status=arm_mat_eig_sym_f32(&this->in1,eigp,&this->out,tmpp);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          /* The source matrix is not modified */
+          ASSERT_TRUE(memcmp(ap,inp1,sizeof(float32_t)*rows*columns) == 0);
+
+          /* Compute V D V^t */
+          for(int r=0; r<rows ; r++)
+          {
+            for(int col=0; col<columns ; col++)
+            {
+               float64_t sum=0.0;
+               for(int k=0; k < columns ; k++)
+               {
+                  sum += (float64_t)outp[r*columns+k] * (float64_t)eigp[k] * (float64_t)outp[col*columns+k];
+               }
+               outa[r*columns+col] = (float64_t)inp1[r*columns+col];
+               outb[r*columns+col] = sum;
+            }
+          }
+
+          outp += (rows * columns);
+          inp1 += (rows * columns);
+          outa += (rows * columns);
+          outb += (rows * columns);
+
+      }
+
+      ASSERT_CLOSE_ERROR(outputa,outputb,ABS_ERROR_EIG,REL_ERROR_EIG);
+    }
+
+    void UnaryTestsF32::test_mat_svd_f32()
+    {
+      const int16_t *dimsp = dims.ptr();
+      const int nbMatrixes = dims.nbSamples() / 3;
+      const float32_t *inp1=input1.ptr();
+      float32_t *vp=a.ptr();
+      float32_t *singp=c.ptr();
+
+      float32_t *outp=output.ptr();
+      int rows,columns;
+      int i;
+      arm_status status;
+      arm_matrix_instance_f32 outV;
+
+      outa=outputa.ptr();
+      outb=outputb.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+          dimsp++;
+
+          in1.numRows=rows;
+          in1.numCols=columns;
+          in1.pData = (float32_t*)inp1;
+
+          out.numRows=rows;
+          out.numCols=columns;
+          out.pData = outp;
+
+          outV.numRows=columns;
+          outV.numCols=columns;
+          outV.pData = vp;
+
+          status=arm_mat_svd_f32(&this->in1,&this->out,singp,&outV);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          /* Compute U S V^t */
+          for(int r=0; r<rows ; r++)
+          {
+            for(int col=0; col<columns ; col++)
+            {
+               float64_t sum=0.0;
+               for(int k=0; k < columns ; k++)
+               {
+                  sum += (float64_t)outp[r*columns+k] * (float64_t)singp[k] * (float64_t)vp[col*columns+k];
+               }
+               outa[r*columns+col] = (float64_t)inp1[r*columns+col];
+               outb[r*columns+col] = sum;
+            }
+          }
+
+          outp += (rows * columns);
+          inp1 += (rows * columns);
+          outa += (rows * columns);
+          outb += (rows * columns);
+
+      }
+
+      ASSERT_CLOSE_ERROR(outputa,outputb,ABS_ERROR_EIG,REL_ERROR_EIG);
+    }
+
+    void UnaryTestsF32::test_mat_qr_blocked_f32()
+    {
+      int32_t rows, columns;
+      const int16_t *dimsp = dims.ptr();
+      const int nbMatrixes = dims.nbSamples() / 3;
+      const float32_t *inp1=input1.ptr();
+
+      float32_t *outTaup=outputTau.ptr();
+      float32_t *outRp=outputR.ptr();
+      float32_t *outQp=outputQ.ptr();
+
+      float32_t *pTmp=a.ptr();
+
+      for(int i=0; i < nbMatrixes ; i++)
+      {
+         rows = *dimsp++;
+         columns = *dimsp++;
+         dimsp++;
+
+         in1.numRows=rows;
+         in1.numCols=columns;
+         in1.pData = (float32_t*)inp1;
+
+         outR.numRows = rows;
+         outR.numCols = columns;
+         outR.pData = (float32_t*)outRp;
+
+         outQ.numRows = rows;
+         outQ.numCols = rows;
+         outQ.pData = (float32_t*)outQp;
+
+         arm_status status=arm_mat_qr_blocked_f32(&in1,DEFAULT_HOUSEHOLDER_THRESHOLD_F32,&outR,&outQ,outTaup,pTmp,BLOCKED_PANEL_SIZE);
+         ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+         inp1 += rows * columns;
+         outRp += rows * columns;
+         outQp += rows * rows;
+         outTaup += columns;
+
+         checkInnerTailOverflow(outRp);
+         checkInnerTailOverflow(outQp);
+         checkInnerTailOverflow(outTaup);
+      }
+
+      ASSERT_EMPTY_TAIL(outputR);
+      ASSERT_EMPTY_TAIL(outputQ);
+      ASSERT_EMPTY_TAIL(outputTau);
+
+      ASSERT_SNR(refQ,outputQ,(float32_t)SNR_QR_THRESHOLD);
+      ASSERT_SNR(refR,outputR,(float32_t)SNR_QR_THRESHOLD);
+      ASSERT_SNR(refTau,outputTau,(float32_t)SNR_QR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(refQ,outputQ,ABS_QR_ERROR,REL_QR_ERROR);
+      ASSERT_CLOSE_ERROR(refR,outputR,ABS_QR_ERROR,REL_QR_ERROR);
+      ASSERT_CLOSE_ERROR(refTau,outputTau,ABS_QR_ERROR,REL_QR_ERROR);
+    }
+
+    void UnaryTestsF32::test_mat_qr_solve_f32()
+    {
+      const int16_t *dimsp = dims.ptr();
+      const int nbMatrixes = dims.nbSamples() / 3;
+      const float32_t *inp1=input1.ptr();
+      float32_t *rp=a.ptr();
+      float32_t *bp=b.ptr();
+      float32_t *taup=c.ptr();
+      float32_t *tmpp=d.ptr();
+      float32_t *outp=output.ptr();
+      int rows,columns,rank;
+      int i;
+      arm_status status;
+      arm_matrix_instance_f32 rhs;
+
+      outa=outputa.ptr();
+      outb=outputb.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+          rank = *dimsp++;
+
+          /* Only full rank matrices have a unique least squares solution */
+          if (rank >= columns)
+          {
+            in1.numRows=rows;
+            in1.numCols=columns;
+            in1.pData = (float32_t*)inp1;
+
+            out.numRows=rows;
+            out.numCols=columns;
+            out.pData = rp;
+
+            status=arm_mat_qr_f32(&this->in1,DEFAULT_HOUSEHOLDER_THRESHOLD_F32,&this->out,NULL,taup,tmpp,bp);
+            ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+            /* B = A x with x = 1 ... columns */
+            for(int r=0; r<rows ; r++)
+            {
+              float64_t sum=0.0;
+              for(int col=0; col<columns ; col++)
+              {
+                 sum += (float64_t)inp1[r*columns+col] * (col + 1);
+              }
+              bp[r] = (float32_t)sum;
+            }
+
+            rhs.numRows=rows;
+            rhs.numCols=1;
+            rhs.pData=bp;
+
+            in2.numRows=columns;
+            in2.numCols=1;
+            in2.pData=outp;
+
+            status=arm_mat_qr_solve_f32(&this->out,taup,&rhs,&this->in2,tmpp);
+            ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+            /* The residual A x - B is checked since some test
+               matrices are ill-conditioned */
+            for(int r=0; r<rows ; r++)
+            {
+                 sum += (float64_t)inp1[r*columns+col] * (float64_t)outp[col];
+              for(int col=0; col<columns ; col++)
+              {
+                 sum += (float64_t)inp1[r*columns+col] * outp[col];
+              }
+              outa[r] = (float64_t)bp[r];
+              outb[r] = sum;
+            }
+
+            outa += rows;
+            outb += rows;
+          }
+
+          inp1 += (rows * columns);
+      }
+
+      ASSERT_CLOSE_ERROR(outputa,outputb,ABS_QR_ERROR,REL_QR_ERROR);
+    }
+
+    void UnaryTestsF32::test_mat_batch_inverse_f32()
+    {
+      const int16_t *dimsp = dims.ptr();
+      const int nbMatrixes = dims.nbSamples();
+      const float32_t *inp1=input1.ptr();
+      const float32_t *refp=ref.ptr();
+      float32_t *ap=a.ptr();
+      float32_t *bp=b.ptr();
+      float32_t scale;
+      int n,e,k;
+      int i;
+      arm_status status;
+      arm_matrix_batch_instance_f32 bsrc,bdst;
+
+      outa=outputa.ptr();
+      outb=outputb.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          n = *dimsp++;
+
+          arm_mat_batch_init_f32(&bsrc,n,n,BATCHSIZE,ap);
+          arm_mat_batch_init_f32(&bdst,n,n,BATCHSIZE,bp);
+
+          /* Last matrix is singular */
+          if (i == nbMatrixes-1)
+          {
+            for(k=0;k < BATCHSIZE; k++)
+            {
+               for(e=0;e < n*n; e++)
+               {
+                  ap[e*BATCHSIZE + k] = inp1[e];
+               }
+            }
+
+            status=arm_mat_batch_inverse_f32(&bsrc,&bdst);
+            ASSERT_TRUE(status==ARM_MATH_SINGULAR);
+          }
+          else if (n > (int)ARM_MAT_BATCH_MAX_DIM)
+          {
+            status=arm_mat_batch_inverse_f32(&bsrc,&bdst);
+            ASSERT_TRUE(status==ARM_MATH_ARGUMENT_ERROR);
+          }
+          else
+          {
+            /* The matrix k of the batch is 2^k A and its inverse 2^-k A^-1 */
+            for(k=0;k < BATCHSIZE; k++)
+            {
+               scale = (float32_t)(1 << k);
+               for(e=0;e < n*n; e++)
+               {
+                  ap[e*BATCHSIZE + k] = scale * inp1[e];
+               }
+            }
+
+            status=arm_mat_batch_inverse_f32(&bsrc,&bdst);
+            ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+            for(k=0;k < BATCHSIZE; k++)
+            {
+               scale = (float32_t)(1 << k);
+               for(e=0;e < n*n; e++)
+               {
+                  *outa++ = (float64_t)refp[e];
+                  *outb++ = (float64_t)(scale * bp[e*BATCHSIZE + k]);
+               }
+            }
+          }
+
+          inp1 += (n * n);
+          refp += (n * n);
+      }
+
+      ASSERT_CLOSE_ERROR(outputa,outputb,ABS_ERROR_INV,REL_ERROR_INV);
+    }
+
+    void UnaryTestsF32::test_mat_add_large_f32()
+    {     
+      LOADDATA2();
+      arm_status status;
+      arm_matrix_instance_large_f32 la,lb,lout;
+      float32_t *exactp=c.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA2();
+          arm_mat_init_large_f32(&la,rows,columns,ap);
+          arm_mat_init_large_f32(&lb,rows,columns,bp);
+          arm_mat_init_large_f32(&lout,rows,columns,outp);
+          status=arm_mat_add_large_f32(&la,&lb,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          /* The large function is bit-exact with arm_mat_add_f32 */
+          out.pData = exactp;
+          status=arm_mat_add_f32(&this->in1,&this->in2,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+          ASSERT_NEAR_EQ_NB(outp,exactp,0.0f,rows*columns);
+
+          outp += (rows * columns);
+          checkInnerTailOverflow(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void UnaryTestsF32::test_mat_sub_large_f32()
+    {     
+      LOADDATA2();
+      arm_status status;
+      arm_matrix_instance_large_f32 la,lb,lout;
+      float32_t *exactp=c.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA2();
+          arm_mat_init_large_f32(&la,rows,columns,ap);
+          arm_mat_init_large_f32(&lb,rows,columns,bp);
+          arm_mat_init_large_f32(&lout,rows,columns,outp);
+          status=arm_mat_sub_large_f32(&la,&lb,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          /* The large function is bit-exact with arm_mat_sub_f32 */
+          out.pData = exactp;
+          status=arm_mat_sub_f32(&this->in1,&this->in2,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+          ASSERT_NEAR_EQ_NB(outp,exactp,0.0f,rows*columns);
+
+          outp += (rows * columns);
+          checkInnerTailOverflow(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void UnaryTestsF32::test_mat_scale_large_f32()
+    {     
+      LOADDATA1();
+      arm_status status;
+      arm_matrix_instance_large_f32 la,lout;
+      float32_t *exactp=c.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA1(false);
+          arm_mat_init_large_f32(&la,rows,columns,ap);
+          arm_mat_init_large_f32(&lout,rows,columns,outp);
+          status=arm_mat_scale_large_f32(&la,0.5f,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          /* The large function is bit-exact with arm_mat_scale_f32 */
+          out.pData = exactp;
+          status=arm_mat_scale_f32(&this->in1,0.5f,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+          ASSERT_NEAR_EQ_NB(outp,exactp,0.0f,rows*columns);
+
+          outp += (rows * columns);
+          checkInnerTailOverflow(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void UnaryTestsF32::test_mat_trans_large_f32()
+    {     
+      LOADDATA1();
+      arm_status status;
+      arm_matrix_instance_large_f32 la,lout;
+      float32_t *largep=c.ptr();
+      unsigned long t;
+      uint32_t r,k;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA1(true);
+          arm_mat_init_large_f32(&la,rows,columns,ap);
+          arm_mat_init_large_f32(&lout,columns,rows,outp);
+
+          status=arm_mat_trans_large_f32(&la,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+          checkInnerTailOverflow(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_NEAR_EQ(output,ref,0.0f);
+
+      /* The dimensions are not multiples of the tile size */
+      for(t=0;t < NBLARGETRANS; t++)
+      {
+          const uint32_t nr = largeTransDims[2*t];
+          const uint32_t nc = largeTransDims[2*t+1];
+
+          for(k=0;k < nr*nc; k++)
+          {
+             ap[k] = (float32_t)k;
+          }
+
+          arm_mat_init_large_f32(&la,nr,nc,ap);
+          arm_mat_init_large_f32(&lout,nc,nr,largep);
+          status=arm_mat_trans_large_f32(&la,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          for(r=0;r < nr; r++)
+          {
+             for(k=0;k < nc; k++)
+             {
+                ASSERT_TRUE(largep[k*nr+r] == ap[r*nc+k]);
+             }
+          }
+          checkInnerTailOverflow(largep + nr * nc);
+      }
+
+    } 
+
+    void UnaryTestsF32::test_mat_vec_mult_large_f32()
+    {     
+      LOADVECDATA2();
+      arm_matrix_instance_large_f32 la;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+
+          PREPAREVECDATA2();
+          arm_mat_init_large_f32(&la,rows,internal,ap);
+
+          arm_mat_vec_mult_large_f32(&la, bp, outp);
+
+          outp += rows ;
+          checkInnerTailOverflow(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void UnaryTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
+    {
+
+
+      (void)params;
+      switch(id)
+      {
+         case TEST_MAT_ADD_F32_1:
+            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
+            input2.reload(UnaryTestsF32::INPUTS2_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFADD1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPB_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_SUB_F32_2:
+            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
+            input2.reload(UnaryTestsF32::INPUTS2_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFSUB1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPB_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_SCALE_F32_3:
+            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFSCALE1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_TRANS_F32_4:
+            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFTRANS1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_INVERSE_F32_5:
+            input1.reload(UnaryTestsF32::INPUTSINV_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSINVERT1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFINV1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_EIG_SYM_F32_19:
+            input1.reload(UnaryTestsF32::INPUTSCHOLESKY1_DPO_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSCHOLESKY1_DPO_S16_ID,mgr);
+
+            output.create(input1.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            outputa.create(input1.nbSamples(),UnaryTestsF32::OUTA_F64_ID,mgr);
+            outputb.create(input1.nbSamples(),UnaryTestsF32::OUTB_F64_ID,mgr);
+
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(3*MAXMATRIXDIM,UnaryTestsF32::TMPB_F32_ID,mgr);
+            c.create(MAXMATRIXDIM,UnaryTestsF32::TMPC_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_SVD_F32_20:
+            input1.reload(UnaryTestsF32::INPUTS_QR_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMS_QR_S16_ID,mgr);
+
+            output.create(input1.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            outputa.create(input1.nbSamples(),UnaryTestsF32::OUTA_F64_ID,mgr);
+            outputb.create(input1.nbSamples(),UnaryTestsF32::OUTB_F64_ID,mgr);
+
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+            c.create(MAXMATRIXDIM,UnaryTestsF32::TMPC_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_QR_BLOCKED_F32_21:
+            input1.reload(UnaryTestsF32::INPUTS_QR_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMS_QR_S16_ID,mgr);
+            refTau.reload(UnaryTestsF32::REF_QR_TAU_F32_ID,mgr);
+            refR.reload(UnaryTestsF32::REF_QR_R_F32_ID,mgr);
+            refQ.reload(UnaryTestsF32::REF_QR_Q_F32_ID,mgr);
+
+            outputTau.create(refTau.nbSamples(),UnaryTestsF32::TMPA_F32_ID,mgr);
+            outputR.create(refR.nbSamples(),UnaryTestsF32::TMPB_F32_ID,mgr);
+            outputQ.create(refQ.nbSamples(),UnaryTestsF32::TMPC_F32_ID,mgr);
+
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPD_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_QR_SOLVE_F32_22:
+            input1.reload(UnaryTestsF32::INPUTS_QR_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMS_QR_S16_ID,mgr);
+
+            output.create(MAXMATRIXDIM,UnaryTestsF32::OUT_F32_ID,mgr);
+            outputa.create(input1.nbSamples(),UnaryTestsF32::OUTA_F64_ID,mgr);
+            outputb.create(input1.nbSamples(),UnaryTestsF32::OUTB_F64_ID,mgr);
+
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(MAXMATRIXDIM,UnaryTestsF32::TMPB_F32_ID,mgr);
+            c.create(MAXMATRIXDIM,UnaryTestsF32::TMPC_F32_ID,mgr);
+            d.create(MAXMATRIXDIM,UnaryTestsF32::TMPD_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_BATCH_INVERSE_F32_23:
+            input1.reload(UnaryTestsF32::INPUTSINV_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSINVERT1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFINV1_F32_ID,mgr);
+
+            /* Only the matrices supported by the batched inverse are checked */
+            {
+              const int16_t *dimsp = dims.ptr();
+              int nb = 0;
+              for(Testing::nbSamples_t i=0;i < dims.nbSamples(); i++)
+              {
+                 if (dimsp[i] <= (int16_t)ARM_MAT_BATCH_MAX_DIM)
+                 {
+                    nb += dimsp[i] * dimsp[i];
+                 }
+              }
+              outputa.create(BATCHSIZE*nb,UnaryTestsF32::OUTA_F64_ID,mgr);
+              outputb.create(BATCHSIZE*nb,UnaryTestsF32::OUTB_F64_ID,mgr);
+            }
+
+            a.create(BATCHSIZE*ARM_MAT_BATCH_MAX_DIM*ARM_MAT_BATCH_MAX_DIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(BATCHSIZE*ARM_MAT_BATCH_MAX_DIM*ARM_MAT_BATCH_MAX_DIM,UnaryTestsF32::TMPB_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_LU_SOLVE_F32_18:
+            input1.reload(UnaryTestsF32::INPUTSINV_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSINVERT1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFINV1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPB_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_ADD_STRIDED_F32_24:
+            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
+            input2.reload(UnaryTestsF32::INPUTS2_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFADD1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(STRIDEDBUFSIZE,UnaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(STRIDEDBUFSIZE,UnaryTestsF32::TMPB_F32_ID,mgr);
+            c.create(STRIDEDBUFSIZE,UnaryTestsF32::TMPC_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_TRANS_STRIDED_F32_25:
+            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFTRANS1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(STRIDEDBUFSIZE,UnaryTestsF32::TMPA_F32_ID,mgr);
+            c.create(STRIDEDBUFSIZE,UnaryTestsF32::TMPC_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_VEC_MULT_STRIDED_F32_26:
+            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
+            input2.reload(UnaryTestsF32::INPUTVEC1_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFVECMUL1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(STRIDEDBUFSIZE,UnaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(MAXMATRIXDIM,UnaryTestsF32::TMPB_F32_ID,mgr);
+         break;
+
+         case TEST_SOLVE_UPPER_TRIANGULAR_STRIDED_F32_27:
+            input1.reload(UnaryTestsF32::INPUT_MAT_UTSOLVE_F32_ID,mgr);
+            input2.reload(UnaryTestsF32::INPUT_VEC_LTSOLVE_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIM_LTSOLVE_F32_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REF_UT_SOLVE_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(STRIDEDBUFSIZE,UnaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(STRIDEDBUFSIZE,UnaryTestsF32::TMPB_F32_ID,mgr);
+         break;
+
+         case TEST_SOLVE_LOWER_TRIANGULAR_STRIDED_F32_28:
+            input1.reload(UnaryTestsF32::INPUT_MAT_LTSOLVE_F32_ID,mgr);
+            input2.reload(UnaryTestsF32::INPUT_VEC_LTSOLVE_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIM_LTSOLVE_F32_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REF_LT_SOLVE_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(STRIDEDBUFSIZE,UnaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(STRIDEDBUFSIZE,UnaryTestsF32::TMPB_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_ADD_LARGE_F32_29:
+            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
+            input2.reload(UnaryTestsF32::INPUTS2_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFADD1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPB_F32_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPC_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_SUB_LARGE_F32_30:
+            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
+            input2.reload(UnaryTestsF32::INPUTS2_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFSUB1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPB_F32_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPC_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_SCALE_LARGE_F32_31:
+            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFSCALE1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPC_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_TRANS_LARGE_F32_32:
+            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFTRANS1_F32_ID,mgr);
 
             output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
             a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPC_F32_ID,mgr);
          break;
 
+         case TEST_MAT_VEC_MULT_LARGE_F32_33:
          case TEST_MAT_VEC_MULT_F32_6:
             input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
             input2.reload(UnaryTestsF32::INPUTVEC1_F32_ID,mgr);
@@ -940,6 +2108,7 @@ void UnaryTestsF32::test_mat_inverse_f32()
          break;
 
          case TEST_MAT_CHOLESKY_DPO_F32_8:
+         case TEST_MAT_CHOLESKY_BLOCKED_DPO_F32_15:
             input1.reload(UnaryTestsF32::INPUTSCHOLESKY1_DPO_F32_ID,mgr);
             dims.reload(UnaryTestsF32::DIMSCHOLESKY1_DPO_S16_ID,mgr);
 
@@ -976,6 +2145,7 @@ void UnaryTestsF32::test_mat_inverse_f32()
          break;
 
          case TEST_MAT_LDL_F32_11:
+         case TEST_MAT_LDL_BLOCKED_F32_16:
             // Definite positive test
             input1.reload(UnaryTestsF32::INPUTSCHOLESKY1_DPO_F32_ID,mgr);
             dims.reload(UnaryTestsF32::DIMSCHOLESKY1_DPO_S16_ID,mgr);
@@ -999,6 +2169,7 @@ void UnaryTestsF32::test_mat_inverse_f32()
          break;
 
          case TEST_MAT_LDL_F32_12:
+         case TEST_MAT_LDL_BLOCKED_F32_17:
             // Semi definite positive test
             input1.reload(UnaryTestsF32::INPUTSCHOLESKY1_SDPO_F32_ID,mgr);
             dims.reload(UnaryTestsF32::DIMSCHOLESKY1_SDPO_S16_ID,mgr);
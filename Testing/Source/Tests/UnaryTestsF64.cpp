@@ -47,6 +47,11 @@ Comparison for Cholesky
 /* Upper bound of maximum matrix dimension used by Python */
 #define MAXMATRIXDIM 40
 
+/* Dimensions of the large transpose tests. They are not multiples of
+   ARM_MAT_LARGE_TRANS_TILE */
+static const uint32_t largeTransDims[]={1,40, 40,1, 17,17, 16,33, 37,21, 33,40};
+#define NBLARGETRANS (sizeof(largeTransDims)/(2*sizeof(uint32_t)))
+
 #define LOADDATA2()                          \
       const float64_t *inp1=input1.ptr();    \
       const float64_t *inp2=input2.ptr();    \
@@ -418,6 +423,78 @@ void UnaryTestsF64::test_mat_inverse_f64()
 
     }
 
+    void UnaryTestsF64::test_mat_lu_solve_f64()
+    {
+      const float64_t *inp1=input1.ptr();
+      const float64_t *refp=ref.ptr();
+
+      float64_t *ap=a.ptr();
+      float64_t *bp=b.ptr();
+
+      float64_t *outp=output.ptr();
+      int16_t *dimsp = dims.ptr();
+      int nbMatrixes = dims.nbSamples();
+      uint16_t pivots[MAXMATRIXDIM];
+      int rows,columns;
+      int i,k;
+      arm_status status;
+
+      /* The inverse is the solution of A X = I */
+      for(i=0;i < nbMatrixes-1 ; i ++)
+      {
+          rows = *dimsp++;
+          columns = rows;
+
+          PREPAREDATA1(false);
+
+          this->in2.numRows=rows;
+          this->in2.numCols=columns;
+          this->in2.pData = bp;
+
+          refInnerTail(outp+(rows * columns));
+
+          status=arm_mat_lu_f64(&this->in1,&this->in2,pivots);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          memset(outp,0,sizeof(float64_t)*rows*columns);
+          for(k=0;k < rows; k++)
+          {
+            outp[k*columns+k] = 1.0;
+          }
+
+          status=arm_mat_lu_solve_f64(&this->in2,pivots,&this->out,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+          inp1 += (rows * columns);
+          refp += (rows * columns);
+
+          checkInnerTail(outp);
+
+      }
+
+      /*** Singular matrix **/
+      rows = *dimsp++;
+      columns = rows;
+
+      PREPAREDATA1(false);
+
+      this->in2.numRows=rows;
+      this->in2.numCols=columns;
+      this->in2.pData = bp;
+
+      status=arm_mat_lu_f64(&this->in1,&this->in2,pivots);
+      ASSERT_TRUE(status==ARM_MATH_SINGULAR);
+
+      /* There is no solution to compare with the reference */
+      memcpy(outp,refp,sizeof(float64_t)*rows*columns);
+
+      ASSERT_SNR(output,ref,(float64_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    }
+
     void UnaryTestsF64::test_mat_cholesky_dpo_f64()
     {
       float64_t *ap=a.ptr();                 
@@ -679,6 +756,102 @@ void UnaryTestsF64::test_mat_inverse_f64()
     }
 
 
+    void UnaryTestsF64::test_mat_sub_large_f64()
+    {     
+      LOADDATA2();
+      arm_status status;
+      arm_matrix_instance_large_f64 la,lb,lout;
+      float64_t *exactp=c.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA2();
+          arm_mat_init_large_f64(&la,rows,columns,ap);
+          arm_mat_init_large_f64(&lb,rows,columns,bp);
+          arm_mat_init_large_f64(&lout,rows,columns,outp);
+
+          status=arm_mat_sub_large_f64(&la,&lb,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          /* The large function is bit-exact with arm_mat_sub_f64 */
+          out.pData = exactp;
+          status=arm_mat_sub_f64(&this->in1,&this->in2,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+          ASSERT_NEAR_EQ_NB(outp,exactp,0.0,rows*columns);
+
+          outp += (rows * columns);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float64_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void UnaryTestsF64::test_mat_trans_large_f64()
+    {     
+      LOADDATA1();
+      arm_status status;
+      arm_matrix_instance_large_f64 la,lout;
+      float64_t *largep=c.ptr();
+      unsigned long t;
+      uint32_t r,k;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA1(true);
+          arm_mat_init_large_f64(&la,rows,columns,ap);
+          arm_mat_init_large_f64(&lout,columns,rows,outp);
+
+          status=arm_mat_trans_large_f64(&la,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_NEAR_EQ(output,ref,0.0);
+
+      /* The dimensions are not multiples of the tile size */
+      for(t=0;t < NBLARGETRANS; t++)
+      {
+          const uint32_t nr = largeTransDims[2*t];
+          const uint32_t nc = largeTransDims[2*t+1];
+
+          for(k=0;k < nr*nc; k++)
+          {
+             ap[k] = (float64_t)k;
+          }
+
+          arm_mat_init_large_f64(&la,nr,nc,ap);
+          arm_mat_init_large_f64(&lout,nc,nr,largep);
+          refInnerTail(largep + nr * nc);
+          status=arm_mat_trans_large_f64(&la,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          for(r=0;r < nr; r++)
+          {
+             for(k=0;k < nc; k++)
+             {
+                ASSERT_TRUE(largep[k*nr+r] == ap[r*nc+k]);
+             }
+          }
+          checkInnerTail(largep + nr * nc);
+      }
+
+    } 
+
     void UnaryTestsF64::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
     
@@ -716,6 +889,17 @@ void UnaryTestsF64::test_mat_inverse_f64()
             a.create(ref.nbSamples(),UnaryTestsF64::TMPA_F64_ID,mgr);
          break;
 
+         case TEST_MAT_LU_SOLVE_F64_15:
+            input1.reload(UnaryTestsF64::INPUTSINV_F64_ID,mgr);
+            dims.reload(UnaryTestsF64::DIMSINVERT1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF64::REFINV1_F64_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF64::OUT_F64_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF64::TMPA_F64_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF64::TMPB_F64_ID,mgr);
+         break;
+
          case TEST_MAT_CHOLESKY_DPO_F64_6:
             input1.reload(UnaryTestsF64::INPUTSCHOLESKY1_DPO_F64_ID,mgr);
             dims.reload(UnaryTestsF64::DIMSCHOLESKY1_DPO_S16_ID,mgr);
@@ -818,6 +1002,30 @@ void UnaryTestsF64::test_mat_inverse_f64()
             b.create(47,UnaryTestsF64::TMPD_F64_ID,mgr);
          break;
 
+         case TEST_MAT_SUB_LARGE_F64_13:
+            input1.reload(UnaryTestsF64::INPUTS1_F64_ID,mgr);
+            input2.reload(UnaryTestsF64::INPUTS2_F64_ID,mgr);
+            dims.reload(UnaryTestsF64::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF64::REFSUB1_F64_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF64::OUT_F64_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF64::TMPA_F64_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF64::TMPB_F64_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF64::TMPC_F64_ID,mgr);
+         break;
+
+         case TEST_MAT_TRANS_LARGE_F64_14:
+            input1.reload(UnaryTestsF64::INPUTS1_F64_ID,mgr);
+            dims.reload(UnaryTestsF64::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF64::REFTRANS1_F64_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF64::OUT_F64_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF64::TMPA_F64_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF64::TMPC_F64_ID,mgr);
+         break;
+
       }
        
 
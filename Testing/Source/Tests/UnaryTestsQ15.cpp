@@ -18,6 +18,16 @@ a double precision computation.
 /* Upper bound of maximum matrix dimension used by Python */
 #define MAXMATRIXDIM 40
 
+/* Dimensions of the large transpose tests. They are not multiples of
+   ARM_MAT_LARGE_TRANS_TILE and are sorted by increasing size so that
+   the tail after each result is not overwritten by the previous one */
+static const uint32_t largeTransDims[]={1,40, 40,1, 17,17, 16,33, 37,21, 33,40};
+#define NBLARGETRANS (sizeof(largeTransDims)/(2*sizeof(uint32_t)))
+
+/* Dimensions of the saturation test of the large matrix vector product */
+#define SATROWS 6
+#define SATINTERNAL 37
+
 static void refInnerTail(q15_t *b)
 {
     b[0] = 1;
@@ -302,6 +312,247 @@ void UnaryTestsQ15::test_mat_cmplx_trans_q15()
     }
 
 
+    void UnaryTestsQ15::test_mat_add_large_q15()
+    {     
+      LOADDATA2();
+      arm_status status;
+      arm_matrix_instance_large_q15 la,lb,lout;
+      q15_t *exactp=c.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA2();
+          arm_mat_init_large_q15(&la,rows,columns,ap);
+          arm_mat_init_large_q15(&lb,rows,columns,bp);
+          arm_mat_init_large_q15(&lout,rows,columns,outp);
+          refInnerTail(outp + rows * columns);
+          status=arm_mat_add_large_q15(&la,&lb,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          /* The large function is bit-exact with arm_mat_add_q15 */
+          out.pData = exactp;
+          status=arm_mat_add_q15(&this->in1,&this->in2,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+          ASSERT_NEAR_EQ_NB(outp,exactp,(q15_t)0,rows*columns);
+
+          outp += (rows * columns);
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_SNR(output,ref,(q15_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q15);
+
+    } 
+
+    void UnaryTestsQ15::test_mat_sub_large_q15()
+    {     
+      LOADDATA2();
+      arm_status status;
+      arm_matrix_instance_large_q15 la,lb,lout;
+      q15_t *exactp=c.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA2();
+          arm_mat_init_large_q15(&la,rows,columns,ap);
+          arm_mat_init_large_q15(&lb,rows,columns,bp);
+          arm_mat_init_large_q15(&lout,rows,columns,outp);
+          refInnerTail(outp + rows * columns);
+          status=arm_mat_sub_large_q15(&la,&lb,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          /* The large function is bit-exact with arm_mat_sub_q15 */
+          out.pData = exactp;
+          status=arm_mat_sub_q15(&this->in1,&this->in2,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+          ASSERT_NEAR_EQ_NB(outp,exactp,(q15_t)0,rows*columns);
+
+          outp += (rows * columns);
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_SNR(output,ref,(q15_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q15);
+
+    } 
+
+    void UnaryTestsQ15::test_mat_scale_large_q15()
+    {     
+      LOADDATA1();
+      arm_status status;
+      arm_matrix_instance_large_q15 la,lout;
+      q15_t *exactp=c.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA1(false);
+          arm_mat_init_large_q15(&la,rows,columns,ap);
+          arm_mat_init_large_q15(&lout,rows,columns,outp);
+          refInnerTail(outp + rows * columns);
+          status=arm_mat_scale_large_q15(&la,ONEHALF,0,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          /* The large function is bit-exact with arm_mat_scale_q15 */
+          out.pData = exactp;
+          status=arm_mat_scale_q15(&this->in1,ONEHALF,0,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+          ASSERT_NEAR_EQ_NB(outp,exactp,(q15_t)0,rows*columns);
+
+          outp += (rows * columns);
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_SNR(output,ref,(q15_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q15);
+
+    } 
+
+    void UnaryTestsQ15::test_mat_trans_large_q15()
+    {     
+      LOADDATA1();
+      arm_status status;
+      arm_matrix_instance_large_q15 la,lout;
+      q15_t *largep=c.ptr();
+      unsigned long t;
+      uint32_t r,k;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA1(true);
+          arm_mat_init_large_q15(&la,rows,columns,ap);
+          arm_mat_init_large_q15(&lout,columns,rows,outp);
+          refInnerTail(outp + rows * columns);
+          status=arm_mat_trans_large_q15(&la,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_SNR(output,ref,(q15_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q15);
+
+      /* The dimensions are not multiples of the tile size */
+      for(t=0;t < NBLARGETRANS; t++)
+      {
+          const uint32_t nr = largeTransDims[2*t];
+          const uint32_t nc = largeTransDims[2*t+1];
+
+          for(k=0;k < nr*nc; k++)
+          {
+             ap[k] = (q15_t)k;
+          }
+
+          arm_mat_init_large_q15(&la,nr,nc,ap);
+          arm_mat_init_large_q15(&lout,nc,nr,largep);
+          refInnerTail(largep + nr * nc);
+          status=arm_mat_trans_large_q15(&la,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          for(r=0;r < nr; r++)
+          {
+             for(k=0;k < nc; k++)
+             {
+                ASSERT_TRUE(largep[k*nr+r] == ap[r*nc+k]);
+             }
+          }
+          checkInnerTail(largep + nr * nc);
+      }
+
+    } 
+
+    void UnaryTestsQ15::test_mat_vec_mult_large_q15()
+    {     
+      LOADVECDATA2();
+      arm_matrix_instance_large_q15 la;
+      q15_t *exactp=c.ptr();
+      q15_t *largep=exactp + MAXMATRIXDIM;
+      int r,k;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+
+          PREPAREVECDATA2();
+          arm_mat_init_large_q15(&la,rows,internal,ap);
+          refInnerTail(outp + rows);
+          arm_mat_vec_mult_large_q15(&la, bp, outp);
+
+          /* The large product is bit-exact with arm_mat_vec_mult_q15 */
+          arm_mat_vec_mult_q15(&this->in1, bp, exactp);
+          ASSERT_NEAR_EQ_NB(outp,exactp,(q15_t)0,rows);
+
+          outp += rows ;
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_SNR(output,ref,(q15_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q15);
+
+      /* Saturation : the rows of the matrix are full scale positive,
+         full scale negative or taken from the patterns and the vector
+         is full scale positive */
+      for(r=0;r < SATROWS; r++)
+      {
+          for(k=0;k < SATINTERNAL; k++)
+          {
+              if ((r % 3) == 0)
+              {
+                 ap[r*SATINTERNAL+k] = (q15_t)0x7FFF;
+              }
+              else if ((r % 3) == 1)
+              {
+                 ap[r*SATINTERNAL+k] = (q15_t)0x8000;
+              }
+              else
+              {
+                 ap[r*SATINTERNAL+k] = inp1[r*SATINTERNAL+k];
+              }
+          }
+      }
+      for(k=0;k < SATINTERNAL; k++)
+      {
+          bp[k] = (q15_t)0x7FFF;
+      }
+
+      in1.numRows=SATROWS;
+      in1.numCols=SATINTERNAL;
+      in1.pData=ap;
+      arm_mat_init_large_q15(&la,SATROWS,SATINTERNAL,ap);
+
+      arm_mat_vec_mult_large_q15(&la, bp, largep);
+      arm_mat_vec_mult_q15(&this->in1, bp, exactp);
+
+      ASSERT_NEAR_EQ_NB(largep,exactp,(q15_t)0,SATROWS);
+      ASSERT_TRUE(largep[0] == (q15_t)0x7FFF);
+      ASSERT_TRUE(largep[1] == (q15_t)0x8000);
+
+    } 
+
+
     void UnaryTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -376,6 +627,68 @@ void UnaryTestsQ15::test_mat_cmplx_trans_q15()
          break;
 
         
+
+         case TEST_MAT_ADD_LARGE_Q15_7:
+            input1.reload(UnaryTestsQ15::INPUTS1_Q15_ID,mgr);
+            input2.reload(UnaryTestsQ15::INPUTS2_Q15_ID,mgr);
+            dims.reload(UnaryTestsQ15::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ15::REFADD1_Q15_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ15::OUT_Q15_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPA_Q15_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPB_Q15_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPC_Q15_ID,mgr);
+         break;
+
+         case TEST_MAT_SUB_LARGE_Q15_8:
+            input1.reload(UnaryTestsQ15::INPUTS1_Q15_ID,mgr);
+            input2.reload(UnaryTestsQ15::INPUTS2_Q15_ID,mgr);
+            dims.reload(UnaryTestsQ15::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ15::REFSUB1_Q15_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ15::OUT_Q15_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPA_Q15_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPB_Q15_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPC_Q15_ID,mgr);
+         break;
+
+         case TEST_MAT_SCALE_LARGE_Q15_9:
+            input1.reload(UnaryTestsQ15::INPUTS1_Q15_ID,mgr);
+            dims.reload(UnaryTestsQ15::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ15::REFSCALE1_Q15_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ15::OUT_Q15_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPA_Q15_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPC_Q15_ID,mgr);
+         break;
+
+         case TEST_MAT_TRANS_LARGE_Q15_10:
+            input1.reload(UnaryTestsQ15::INPUTS1_Q15_ID,mgr);
+            dims.reload(UnaryTestsQ15::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ15::REFTRANS1_Q15_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ15::OUT_Q15_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPA_Q15_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPC_Q15_ID,mgr);
+         break;
+
+         case TEST_MAT_VEC_MULT_LARGE_Q15_11:
+            input1.reload(UnaryTestsQ15::INPUTS1_Q15_ID,mgr);
+            input2.reload(UnaryTestsQ15::INPUTVEC1_Q15_ID,mgr);
+            dims.reload(UnaryTestsQ15::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ15::REFVECMUL1_Q15_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ15::OUT_Q15_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPA_Q15_ID,mgr);
+            b.create(MAXMATRIXDIM,UnaryTestsQ15::TMPB_Q15_ID,mgr);
+            c.create(2*MAXMATRIXDIM,UnaryTestsQ15::TMPC_Q15_ID,mgr);
+         break;
+
       }
        
 
@@ -18,6 +18,12 @@ a double precision computation.
 /* Upper bound of maximum matrix dimension used by Python */
 #define MAXMATRIXDIM 40
 
+/* Dimensions of the large transpose tests. They are not multiples of
+   ARM_MAT_LARGE_TRANS_TILE and are sorted by increasing size so that
+   the tail after each result is not overwritten by the previous one */
+static const uint32_t largeTransDims[]={1,40, 40,1, 17,17, 16,33, 37,21, 33,40};
+#define NBLARGETRANS (sizeof(largeTransDims)/(2*sizeof(uint32_t)))
+
 static void checkInnerTail(q31_t *b)
 {
     ASSERT_TRUE(b[0] == 0);
@@ -291,6 +297,211 @@ void UnaryTestsQ31::test_mat_cmplx_trans_q31()
     } 
 
 
+    void UnaryTestsQ31::test_mat_add_large_q31()
+    {     
+      LOADDATA2();
+      arm_status status;
+      arm_matrix_instance_large_q31 la,lb,lout;
+      q31_t *exactp=c.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA2();
+          arm_mat_init_large_q31(&la,rows,columns,ap);
+          arm_mat_init_large_q31(&lb,rows,columns,bp);
+          arm_mat_init_large_q31(&lout,rows,columns,outp);
+          status=arm_mat_add_large_q31(&la,&lb,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          /* The large function is bit-exact with arm_mat_add_q31 */
+          out.pData = exactp;
+          status=arm_mat_add_q31(&this->in1,&this->in2,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+          ASSERT_NEAR_EQ_NB(outp,exactp,(q31_t)0,rows*columns);
+
+          outp += (rows * columns);
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q31_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q31);
+
+    } 
+
+    void UnaryTestsQ31::test_mat_sub_large_q31()
+    {     
+      LOADDATA2();
+      arm_status status;
+      arm_matrix_instance_large_q31 la,lb,lout;
+      q31_t *exactp=c.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA2();
+          arm_mat_init_large_q31(&la,rows,columns,ap);
+          arm_mat_init_large_q31(&lb,rows,columns,bp);
+          arm_mat_init_large_q31(&lout,rows,columns,outp);
+          status=arm_mat_sub_large_q31(&la,&lb,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          /* The large function is bit-exact with arm_mat_sub_q31 */
+          out.pData = exactp;
+          status=arm_mat_sub_q31(&this->in1,&this->in2,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+          ASSERT_NEAR_EQ_NB(outp,exactp,(q31_t)0,rows*columns);
+
+          outp += (rows * columns);
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q31_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q31);
+
+    } 
+
+    void UnaryTestsQ31::test_mat_scale_large_q31()
+    {     
+      LOADDATA1();
+      arm_status status;
+      arm_matrix_instance_large_q31 la,lout;
+      q31_t *exactp=c.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA1(false);
+          arm_mat_init_large_q31(&la,rows,columns,ap);
+          arm_mat_init_large_q31(&lout,rows,columns,outp);
+          status=arm_mat_scale_large_q31(&la,ONEHALF,0,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          /* The large function is bit-exact with arm_mat_scale_q31 */
+          out.pData = exactp;
+          status=arm_mat_scale_q31(&this->in1,ONEHALF,0,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+          ASSERT_NEAR_EQ_NB(outp,exactp,(q31_t)0,rows*columns);
+
+          outp += (rows * columns);
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q31_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q31);
+
+    } 
+
+    void UnaryTestsQ31::test_mat_trans_large_q31()
+    {     
+      LOADDATA1();
+      arm_status status;
+      arm_matrix_instance_large_q31 la,lout;
+      q31_t *largep=c.ptr();
+      unsigned long t;
+      uint32_t r,k;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA1(true);
+          arm_mat_init_large_q31(&la,rows,columns,ap);
+          arm_mat_init_large_q31(&lout,columns,rows,outp);
+          status=arm_mat_trans_large_q31(&la,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q31_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q31);
+
+      /* The dimensions are not multiples of the tile size */
+      for(t=0;t < NBLARGETRANS; t++)
+      {
+          const uint32_t nr = largeTransDims[2*t];
+          const uint32_t nc = largeTransDims[2*t+1];
+
+          for(k=0;k < nr*nc; k++)
+          {
+             ap[k] = (q31_t)k;
+          }
+
+          arm_mat_init_large_q31(&la,nr,nc,ap);
+          arm_mat_init_large_q31(&lout,nc,nr,largep);
+          status=arm_mat_trans_large_q31(&la,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          for(r=0;r < nr; r++)
+          {
+             for(k=0;k < nc; k++)
+             {
+                ASSERT_TRUE(largep[k*nr+r] == ap[r*nc+k]);
+             }
+          }
+          checkInnerTail(largep + nr * nc);
+      }
+
+    } 
+
+    void UnaryTestsQ31::test_mat_vec_mult_large_q31()
+    {     
+      LOADVECDATA2();
+      arm_matrix_instance_large_q31 la;
+      q31_t *exactp=c.ptr();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+
+          PREPAREVECDATA2();
+          arm_mat_init_large_q31(&la,rows,internal,ap);
+          arm_mat_vec_mult_large_q31(&la, bp, outp);
+
+          /* The large product is bit-exact with arm_mat_vec_mult_q31 */
+          arm_mat_vec_mult_q31(&this->in1, bp, exactp);
+          ASSERT_NEAR_EQ_NB(outp,exactp,(q31_t)0,rows);
+
+          outp += rows ;
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q31_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q31);
+
+    } 
+
+
     void UnaryTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -365,6 +576,68 @@ void UnaryTestsQ31::test_mat_cmplx_trans_q31()
          break;
 
         
+
+         case TEST_MAT_ADD_LARGE_Q31_7:
+            input1.reload(UnaryTestsQ31::INPUTS1_Q31_ID,mgr);
+            input2.reload(UnaryTestsQ31::INPUTS2_Q31_ID,mgr);
+            dims.reload(UnaryTestsQ31::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ31::REFADD1_Q31_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ31::OUT_Q31_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPA_Q31_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPB_Q31_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPC_Q31_ID,mgr);
+         break;
+
+         case TEST_MAT_SUB_LARGE_Q31_8:
+            input1.reload(UnaryTestsQ31::INPUTS1_Q31_ID,mgr);
+            input2.reload(UnaryTestsQ31::INPUTS2_Q31_ID,mgr);
+            dims.reload(UnaryTestsQ31::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ31::REFSUB1_Q31_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ31::OUT_Q31_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPA_Q31_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPB_Q31_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPC_Q31_ID,mgr);
+         break;
+
+         case TEST_MAT_SCALE_LARGE_Q31_9:
+            input1.reload(UnaryTestsQ31::INPUTS1_Q31_ID,mgr);
+            dims.reload(UnaryTestsQ31::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ31::REFSCALE1_Q31_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ31::OUT_Q31_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPA_Q31_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPC_Q31_ID,mgr);
+         break;
+
+         case TEST_MAT_TRANS_LARGE_Q31_10:
+            input1.reload(UnaryTestsQ31::INPUTS1_Q31_ID,mgr);
+            dims.reload(UnaryTestsQ31::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ31::REFTRANS1_Q31_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ31::OUT_Q31_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPA_Q31_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPC_Q31_ID,mgr);
+         break;
+
+         case TEST_MAT_VEC_MULT_LARGE_Q31_11:
+            input1.reload(UnaryTestsQ31::INPUTS1_Q31_ID,mgr);
+            input2.reload(UnaryTestsQ31::INPUTVEC1_Q31_ID,mgr);
+            dims.reload(UnaryTestsQ31::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ31::REFVECMUL1_Q31_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ31::OUT_Q31_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPA_Q31_ID,mgr);
+            b.create(MAXMATRIXDIM,UnaryTestsQ31::TMPB_Q31_ID,mgr);
+            c.create(2*MAXMATRIXDIM,UnaryTestsQ31::TMPC_Q31_ID,mgr);
+         break;
+
       }
        
 
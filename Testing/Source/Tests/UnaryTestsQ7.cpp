@@ -19,6 +19,16 @@ a double precision computation.
 /* Upper bound of maximum matrix dimension used by Python */
 #define MAXMATRIXDIM 47
 
+/* Dimensions of the large transpose tests. They are not multiples of
+   ARM_MAT_LARGE_TRANS_TILE and are sorted by increasing size so that
+   the tail after each result is not overwritten by the previous one */
+static const uint32_t largeTransDims[]={1,40, 40,1, 17,17, 16,33, 37,21, 33,40};
+#define NBLARGETRANS (sizeof(largeTransDims)/(2*sizeof(uint32_t)))
+
+/* Dimensions of the saturation test of the large matrix vector product */
+#define SATROWS 6
+#define SATINTERNAL 37
+
 static void checkInnerTail(q7_t *b)
 {
     ASSERT_TRUE(b[0] == 0);
@@ -173,6 +183,138 @@ void UnaryTestsQ7::test_mat_trans_q7()
     } 
 
 
+    void UnaryTestsQ7::test_mat_trans_large_q7()
+    {     
+      LOADDATA1();
+      arm_status status;
+      arm_matrix_instance_large_q7 la,lout;
+      q7_t *largep=c.ptr();
+      unsigned long t;
+      uint32_t r,k;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA1(true);
+          arm_mat_init_large_q7(&la,rows,columns,ap);
+          arm_mat_init_large_q7(&lout,columns,rows,outp);
+          status=arm_mat_trans_large_q7(&la,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q7_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q7);
+
+      /* The dimensions are not multiples of the tile size */
+      for(t=0;t < NBLARGETRANS; t++)
+      {
+          const uint32_t nr = largeTransDims[2*t];
+          const uint32_t nc = largeTransDims[2*t+1];
+
+          for(k=0;k < nr*nc; k++)
+          {
+             ap[k] = (q7_t)k;
+          }
+
+          arm_mat_init_large_q7(&la,nr,nc,ap);
+          arm_mat_init_large_q7(&lout,nc,nr,largep);
+          status=arm_mat_trans_large_q7(&la,&lout);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          for(r=0;r < nr; r++)
+          {
+             for(k=0;k < nc; k++)
+             {
+                ASSERT_TRUE(largep[k*nr+r] == ap[r*nc+k]);
+             }
+          }
+          checkInnerTail(largep + nr * nc);
+      }
+
+    } 
+
+    void UnaryTestsQ7::test_mat_vec_mult_large_q7()
+    {     
+      LOADVECDATA2();
+      arm_matrix_instance_large_q7 la;
+      q7_t *exactp=c.ptr();
+      q7_t *largep=exactp + MAXMATRIXDIM;
+      int r,k;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+
+          PREPAREVECDATA2();
+          arm_mat_init_large_q7(&la,rows,internal,ap);
+          arm_mat_vec_mult_large_q7(&la, bp, outp);
+
+          /* The large product is bit-exact with arm_mat_vec_mult_q7 */
+          arm_mat_vec_mult_q7(&this->in1, bp, exactp);
+          ASSERT_NEAR_EQ_NB(outp,exactp,(q7_t)0,rows);
+
+          outp += rows ;
+          checkInnerTail(outp);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q7_t)SNR_LOW_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q7);
+
+      /* Saturation : the rows of the matrix are full scale positive,
+         full scale negative or taken from the patterns and the vector
+         is full scale positive */
+      for(r=0;r < SATROWS; r++)
+      {
+          for(k=0;k < SATINTERNAL; k++)
+          {
+              if ((r % 3) == 0)
+              {
+                 ap[r*SATINTERNAL+k] = (q7_t)0x7F;
+              }
+              else if ((r % 3) == 1)
+              {
+                 ap[r*SATINTERNAL+k] = (q7_t)0x80;
+              }
+              else
+              {
+                 ap[r*SATINTERNAL+k] = inp1[r*SATINTERNAL+k];
+              }
+          }
+      }
+      for(k=0;k < SATINTERNAL; k++)
+      {
+          bp[k] = (q7_t)0x7F;
+      }
+
+      in1.numRows=SATROWS;
+      in1.numCols=SATINTERNAL;
+      in1.pData=ap;
+      arm_mat_init_large_q7(&la,SATROWS,SATINTERNAL,ap);
+
+      arm_mat_vec_mult_large_q7(&la, bp, largep);
+      arm_mat_vec_mult_q7(&this->in1, bp, exactp);
+
+      ASSERT_NEAR_EQ_NB(largep,exactp,(q7_t)0,SATROWS);
+      ASSERT_TRUE(largep[0] == (q7_t)0x7F);
+      ASSERT_TRUE(largep[1] == (q7_t)0x80);
+
+    } 
+
+
     void UnaryTestsQ7::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -205,6 +347,30 @@ void UnaryTestsQ7::test_mat_trans_q7()
             a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ7::TMPA_Q7_ID,mgr);
             b.create(MAXMATRIXDIM,UnaryTestsQ7::TMPB_Q7_ID,mgr);
          break;
+
+         case TEST_MAT_TRANS_LARGE_Q7_3:
+            input1.reload(UnaryTestsQ7::INPUTS1_Q7_ID,mgr);
+            dims.reload(UnaryTestsQ7::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ7::REFTRANS1_Q7_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ7::OUT_Q7_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ7::TMPA_Q7_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ7::TMPC_Q7_ID,mgr);
+         break;
+
+         case TEST_MAT_VEC_MULT_LARGE_Q7_4:
+            input1.reload(UnaryTestsQ7::INPUTS1_Q7_ID,mgr);
+            input2.reload(UnaryTestsQ7::INPUTVEC1_Q7_ID,mgr);
+            dims.reload(UnaryTestsQ7::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ7::REFVECMUL1_Q7_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ7::OUT_Q7_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ7::TMPA_Q7_ID,mgr);
+            b.create(MAXMATRIXDIM,UnaryTestsQ7::TMPB_Q7_ID,mgr);
+            c.create(2*MAXMATRIXDIM,UnaryTestsQ7::TMPC_Q7_ID,mgr);
+         break;
        }
 
     
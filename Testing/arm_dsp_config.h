@@ -8,5 +8,10 @@
 #define ARM_MATH_L2_CACHE_SIZE (128*1024)
 #define ARM_MATH_L3_CACHE_SIZE (512*1024)
 
+/* Small odd block size so that the element-wise large matrix
+ * functions process the test matrices in several blocks
+ */
+#define ARM_MAT_LARGE_BLOCK_SIZE (7U)
+
 #endif
 
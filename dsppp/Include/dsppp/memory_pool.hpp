@@ -6,6 +6,7 @@
 #include <cstdio>
 #include <cstddef>
 #include <vector>
+#include <map>
 #include "common.hpp"
 
 namespace arm_cmsis_dsp {
@@ -320,7 +321,7 @@ public:
     {
          /* No error handling.
             The sizing of the pool must have been done, for
-            instance, with a statistic allocator.
+            instance, with statistics_allocator.
             Allocation is thus assumed to succeed */
          char* res = reinterpret_cast<char*>(free);
          free = free->next;
@@ -375,6 +376,773 @@ protected:
 };
 
 
+/*
+
+Memory arena
+
+A memory arena is a bump pointer allocator working
+on a single buffer. Contrary to the memory pool, it can
+allocate buffers of any size.
+
+Buffers released in the reverse order of their allocation
+are given back to the arena immediately. All the buffers
+allocated since a mark can be released in O(1) by rewinding
+the arena to this mark.
+
+*/
+
+class MemoryArena;
+
+/**
+ * @ingroup MEMTOOL
+ * @brief      Position in a memory arena
+ *
+ * A mark is used to rewind the arena and release, in one
+ * operation, all the buffers allocated after the mark.
+ */
+struct ArenaMark {
+    //! Offset of the first free byte in the arena
+    std::size_t top;
+    //! Offset of the last allocated buffer in the arena
+    std::size_t last;
+};
+
+/**
+ * @ingroup MEMTOOL
+ * @brief      Header stored in front of each buffer allocated
+ *             from a memory arena
+ */
+struct ArenaHeader {
+    //! Arena containing the buffer
+    MemoryArena *arena;
+    //! Top of the arena before the allocation of the buffer
+    std::size_t previous_top;
+    //! Previous buffer in the arena
+    std::size_t previous_last;
+    //! True when the buffer has been released but not yet given back to the arena
+    bool released;
+};
+
+/**
+ * @ingroup MEMTOOL
+ * @brief      This class describes a memory arena (bump pointer allocator)
+ *             that can be used to build a memory allocator for vectors
+ *             and matrixes of any dimensions
+ *
+ * The memory used by the arena is provided by the user and is not
+ * owned by the arena. Use OwnedMemoryArena to let the arena allocate
+ * its memory.
+ */
+class MemoryArena {
+public:
+    /**
+     * @brief      Create a new memory arena
+     *
+     * @param      buf        The memory buffer used by the arena
+     * @param[in]  bytes      The size of the memory buffer in bytes
+     * @param[in]  alignment  The alignment of the allocated buffers (power of 2)
+     */
+    MemoryArena(char *buf,
+                const std::size_t bytes,
+                const std::size_t alignment = MEMORY_POOL_ALIGNMENT) noexcept:
+    buffer_(buf),capacity_(bytes),alignment_(alignment)
+    {
+        reset();
+    };
+
+    MemoryArena(const MemoryArena& other) = delete;
+
+    MemoryArena(MemoryArena&& other) = delete;
+
+    MemoryArena& operator=(const MemoryArena& other) = delete;
+    
+    MemoryArena& operator=(MemoryArena&& other) = delete;
+
+    /**
+     * @brief      Allocate a new buffer
+     *
+     * @param[in]  bytes  The size of the buffer in bytes
+     *
+     * @return     Pointer to the buffer or nullptr if the arena is full
+     */
+    char* allocate(const std::size_t bytes) noexcept
+    {
+        const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(buffer_);
+        const std::uintptr_t addr = (base + top_ + sizeof(ArenaHeader) + alignment_ - 1)
+                                    & ~static_cast<std::uintptr_t>(alignment_ - 1);
+        const std::size_t start = addr - base;
+
+        if (start + bytes > capacity_)
+        {
+           #if defined(MEMORY_ALLOCATION_DEBUG)
+           std::cout << "memory arena alloc error " << bytes << " bytes\r\n";
+           #endif
+           return(nullptr);
+        }
+
+        char *res = buffer_ + start;
+        ArenaHeader *h = header(res);
+        h->arena = this;
+        h->previous_top = top_;
+        h->previous_last = last_;
+        h->released = false;
+
+        top_ = start + bytes;
+        last_ = start;
+        if (top_ > peak_)
+        {
+            peak_ = top_;
+        }
+        return(res);
+    }
+
+    /**
+     * @brief      Release a buffer
+     *
+     * If the buffer is the last allocated one, it is given back to the arena
+     * with all the previous buffers already released. Otherwise, it will be
+     * given back when the last allocated buffers are released or when the
+     * arena is rewound.
+     *
+     * @param      buf   The buffer
+     */
+    void release(char* buf) noexcept
+    {
+        #if defined(MEMORY_ALLOCATION_DEBUG)
+        if (buf == nullptr)
+        {
+           std::cout << "memory arena free error\r\n";
+        }
+        #endif
+        header(buf)->released = true;
+        while ((last_ != NO_BUFFER) && header(buffer_ + last_)->released)
+        {
+            const ArenaHeader *h = header(buffer_ + last_);
+            top_ = h->previous_top;
+            last_ = h->previous_last;
+        }
+    }
+
+    /**
+     * @brief      Allocate a buffer outside of any arena
+     *
+     * The buffer is allocated on the heap with an arena header
+     * so that it can be released with release_buffer.
+     * It is used by arena_allocator when no ArenaScope is alive.
+     *
+     * @param[in]  bytes  The size of the buffer in bytes
+     *
+     * @return     Pointer to the buffer or nullptr if out of memory
+     */
+    static char* allocate_unscoped(const std::size_t bytes) noexcept
+    {
+        char *base = reinterpret_cast<char*>(aligned_malloc(MEMORY_POOL_ALIGNMENT,
+                                                            UNSCOPED_OFFSET + bytes));
+        if (base == nullptr)
+        {
+           return(nullptr);
+        }
+
+        char *res = base + UNSCOPED_OFFSET;
+        ArenaHeader *h = header(res);
+        h->arena = nullptr;
+        h->previous_top = 0;
+        h->previous_last = NO_BUFFER;
+        h->released = false;
+        return(res);
+    }
+
+    /**
+     * @brief      Release a buffer in the arena where it was allocated
+     *
+     * Buffers allocated with allocate_unscoped are freed.
+     *
+     * @param      buf   The buffer
+     */
+    static void release_buffer(char* buf) noexcept
+    {
+        MemoryArena *arena = header(buf)->arena;
+        if (arena == nullptr)
+        {
+           aligned_free(buf - UNSCOPED_OFFSET);
+           return;
+        }
+        arena->release(buf);
+    }
+
+    /**
+     * @brief      Current position in the arena
+     *
+     * @return     The mark
+     */
+    ArenaMark mark() const noexcept
+    {
+        return(ArenaMark{top_,last_});
+    }
+
+    /**
+     * @brief      Release all the buffers allocated after a mark
+     *
+     * @param[in]  m     The mark
+     */
+    void rewind(const ArenaMark &m) noexcept
+    {
+        top_ = m.top;
+        last_ = m.last;
+    }
+
+    /**
+     * @brief      Release all the buffers
+     */
+    void reset() noexcept
+    {
+        top_ = 0;
+        last_ = NO_BUFFER;
+    }
+
+    /**
+     * @brief      Number of bytes currently used in the arena
+     *
+     * @return     Number of bytes (including headers and alignment padding)
+     */
+    std::size_t used() const noexcept {return(top_);};
+
+    /**
+     * @brief      Maximum number of bytes used since the creation of the arena
+     *
+     * @return     Number of bytes (including headers and alignment padding)
+     */
+    std::size_t peak() const noexcept {return(peak_);};
+
+    /**
+     * @brief      Size of the arena
+     *
+     * @return     Number of bytes
+     */
+    std::size_t capacity() const noexcept {return(capacity_);};
+
+protected:
+    static constexpr std::size_t NO_BUFFER = static_cast<std::size_t>(-1);
+
+    /* Offset of an unscoped buffer in its heap allocation. The header
+       is in front of the buffer and the buffer stays aligned. */
+    static constexpr std::size_t UNSCOPED_OFFSET =
+       (sizeof(ArenaHeader) + MEMORY_POOL_ALIGNMENT - 1) & ~static_cast<std::size_t>(MEMORY_POOL_ALIGNMENT - 1);
+
+    static ArenaHeader* header(char *buf) noexcept
+    {
+        return(reinterpret_cast<ArenaHeader*>(buf - sizeof(ArenaHeader)));
+    }
+
+    char *buffer_;
+    const std::size_t capacity_;
+    const std::size_t alignment_;
+    std::size_t top_;
+    std::size_t last_;
+    std::size_t peak_ = 0;
+};
+
+/**
+ * @ingroup MEMTOOL
+ * @brief      Memory arena owning its memory buffer
+ *
+ * @tparam     UserAllocator  Memory allocator to allocate the memory buffer
+ */
+template<typename UserAllocator = default_user_allocator_malloc_free>
+class OwnedMemoryArena:public MemoryArena {
+public:
+    /**
+     * @brief      Create a new memory arena
+     *
+     * @param[in]  bytes      The size of the arena in bytes
+     * @param[in]  alignment  The alignment of the allocated buffers (power of 2)
+     */
+    explicit OwnedMemoryArena(const std::size_t bytes,
+                              const std::size_t alignment = MEMORY_POOL_ALIGNMENT):
+    MemoryArena(UserAllocator::malloc(bytes),bytes,alignment)
+    {
+    };
+
+    /**
+     * @brief      Destroys the object.
+     */
+    ~OwnedMemoryArena()
+    {
+        UserAllocator::free(buffer_);
+    }
+};
+
+/**
+ * @ingroup MEMTOOL
+ * @brief      Arena used by arena_allocator for new allocations
+ *
+ * @return     Reference to the pointer to the current arena
+ */
+inline MemoryArena*& current_arena() noexcept
+{
+    static MemoryArena *arena = nullptr;
+    return(arena);
+}
+
+/**
+ * @ingroup MEMTOOL
+ * @brief      Scope for the allocation of temporaries in a memory arena
+ *
+ * While the scope is alive, arena_allocator is allocating in
+ * the arena. When the scope is destroyed, all the buffers
+ * allocated in the arena since the creation of the scope are
+ * released in O(1) and the previous current arena is restored.
+ *
+ * The scope must be created before the vectors and matrixes of the
+ * processing block so that it is destroyed after them.
+ *
+ * ```cpp
+ * {
+ *    ArenaScope scope(arena);
+ *    Vector<float32_t> tmp = a + b;
+ *    ...
+ * }
+ * ```
+ */
+class ArenaScope {
+public:
+    /**
+     * @brief      Open a new scope
+     *
+     * @param      arena  The arena to use in this scope
+     */
+    explicit ArenaScope(MemoryArena &arena) noexcept:
+    arena_(arena),mark_(arena.mark()),previous_(current_arena())
+    {
+        current_arena() = &arena;
+    };
+
+    /**
+     * @brief      Close the scope and rewind the arena
+     */
+    ~ArenaScope()
+    {
+        arena_.rewind(mark_);
+        current_arena() = previous_;
+    }
+
+    ArenaScope(const ArenaScope& other) = delete;
+
+    ArenaScope(ArenaScope&& other) = delete;
+
+    ArenaScope& operator=(const ArenaScope& other) = delete;
+    
+    ArenaScope& operator=(ArenaScope&& other) = delete;
+
+protected:
+    MemoryArena &arena_;
+    const ArenaMark mark_;
+    MemoryArena *previous_;
+};
+
+/**
+ * @ingroup MEMVEC
+ * @brief      Memory allocator for vectors and matrixes using the current
+ *             memory arena
+ *
+ * Can be used as `TMP_ALLOC`. The buffers are allocated in the
+ * arena of the innermost ArenaScope alive. There is no error
+ * handling : the arena must be big enough (use MemoryArena::peak
+ * to size it).
+ *
+ * When no ArenaScope is alive, the buffers are allocated on the heap
+ * (MemoryArena::allocate_unscoped) so that a temporary created
+ * outside of a scope is still valid. With `MEMORY_ALLOCATION_DEBUG`,
+ * those allocations are reported.
+ *
+ * @tparam     L     Size known at build time in bytes
+ */
+template<int L>
+struct arena_allocator {
+    /**
+     * @brief      Allocate a buffer with size known at runtime
+     *
+     * @param[in]  sz    The size
+     *
+     * @return     Pointer to the buffer
+     */
+    static  char* allocate  ( vector_length_t sz) noexcept{
+        return(allocate_bytes(sz));
+    }
+
+    /**
+     * @brief      Allocate a buffer with size known at build time
+     *
+     * @return     Pointer to the buffer
+     */
+    static  char* allocate  ( ) noexcept{
+        return(allocate_bytes(L));
+    }
+
+    /**
+     * @brief      Destroys the given pointer.
+     *
+     * @param      ptr   The pointer
+     */
+    static void destroy  ( char* ptr ) noexcept {
+        MemoryArena::release_buffer(ptr);
+    }
+
+protected:
+    static char* allocate_bytes(const std::size_t bytes) noexcept
+    {
+        MemoryArena *arena = current_arena();
+        if (arena == nullptr)
+        {
+           #if defined(MEMORY_ALLOCATION_DEBUG)
+           std::cout << "arena allocator used outside of an ArenaScope\r\n";
+           #endif
+           return(MemoryArena::allocate_unscoped(bytes));
+        }
+        return(arena->allocate(bytes));
+    }
+   
+};
+
+
+/*
+
+Statistics allocator
+
+Allocator recording statistics about the allocations done
+by another allocator. The statistics are used to size the
+memory pools and memory arenas.
+
+*/
+
+/**
+ * @ingroup MEMTOOL
+ * @brief      Statistics for the buffers of one size
+ *
+ * Lifetimes are measured in number of allocations done
+ * (for all sizes) while the buffer is alive.
+ */
+struct AllocationStatistics {
+    //! Number of allocations
+    std::size_t nb_allocations = 0;
+    //! Number of buffers currently allocated
+    std::size_t current = 0;
+    //! Maximum number of buffers allocated at the same time
+    std::size_t peak = 0;
+    //! Number of released buffers
+    std::size_t nb_released = 0;
+    //! Sum of the lifetimes of the released buffers
+    std::size_t total_lifetime = 0;
+    //! Maximum lifetime of a released buffer
+    std::size_t max_lifetime = 0;
+};
+
+/**
+ * @ingroup MEMTOOL
+ * @brief      Statistics about the memory allocations
+ *
+ * Allocations are identified by a size key. A positive key is
+ * a size in bytes known at build time. A negative key is the
+ * opposite of a size in bytes only known at runtime.
+ */
+class MemoryStatistics {
+public:
+    /**
+     * @brief      Record a new allocation
+     *
+     * @param      ptr    The allocated buffer
+     * @param[in]  key    The size key
+     * @param[in]  bytes  The size of the buffer in bytes
+     */
+    void record_allocation(char *ptr,const int key,const std::size_t bytes)
+    {
+        AllocationStatistics &s = stats_[key];
+        s.nb_allocations++;
+        s.current++;
+        if (s.current > s.peak)
+        {
+            s.peak = s.current;
+        }
+
+        current_bytes_ += bytes;
+        if (current_bytes_ > peak_bytes_)
+        {
+            peak_bytes_ = current_bytes_;
+        }
+
+        live_[ptr] = LiveBuffer{key,bytes,clock_};
+        clock_++;
+    }
+
+    /**
+     * @brief      Record the release of a buffer
+     *
+     * @param      ptr   The released buffer
+     */
+    void record_release(char *ptr)
+    {
+        auto it = live_.find(ptr);
+        if (it == live_.end())
+        {
+            #if defined(MEMORY_ALLOCATION_DEBUG)
+            std::cout << "statistics allocator free error\r\n";
+            #endif
+            return;
+        }
+
+        const LiveBuffer &b = it->second;
+        AllocationStatistics &s = stats_[b.key];
+        const std::size_t lifetime = clock_ - b.birth;
+        s.current--;
+        s.nb_released++;
+        s.total_lifetime += lifetime;
+        if (lifetime > s.max_lifetime)
+        {
+            s.max_lifetime = lifetime;
+        }
+        current_bytes_ -= b.bytes;
+
+        live_.erase(it);
+    }
+
+    /**
+     * @brief      Statistics for each size key
+     *
+     * @return     Map from size keys to statistics
+     */
+    const std::map<int,AllocationStatistics>& sizes() const {return(stats_);};
+
+    /**
+     * @brief      Number of buffers currently allocated
+     *
+     * @return     Number of buffers
+     */
+    std::size_t nb_live_buffers() const {return(live_.size());};
+
+    /**
+     * @brief      Number of bytes currently allocated
+     *
+     * @return     Number of bytes
+     */
+    std::size_t current_bytes() const {return(current_bytes_);};
+
+    /**
+     * @brief      Maximum number of bytes allocated at the same time
+     *
+     * @return     Number of bytes
+     */
+    std::size_t peak_bytes() const {return(peak_bytes_);};
+
+    /**
+     * @brief      Clear all the statistics
+     */
+    void reset()
+    {
+        stats_.clear();
+        live_.clear();
+        current_bytes_ = 0;
+        peak_bytes_ = 0;
+        clock_ = 0;
+    }
+
+    /**
+     * @brief      Print the memory pool configuration required for the
+     *             recorded allocations
+     *
+     * The output is a header that can be used as is in the application.
+     * It must be included before the vector and matrix headers of the
+     * library. It contains:
+     * - one MemoryPool per size known at build time, sized with the
+     *   maximum number of buffers alive at the same time;
+     * - the `pool_allocator` using those pools (and `malloc` for the sizes
+     *   only known at runtime);
+     * - the definition of `TMP_ALLOC`.
+     *
+     * The statistics of each size are reported as comments. The peak
+     * number of bytes can be used to size a MemoryArena.
+     *
+     * @param      os    The output stream
+     */
+    void print_pool_configuration(std::ostream &os) const
+    {
+        std::size_t total_static = 0;
+
+        os << "// Memory pool configuration generated by print_pool_configuration\n";
+        os << "// Include this header before the dsppp vector and matrix headers\n";
+        os << "#pragma once\n\n";
+        os << "#define TMP_ALLOC pool_allocator\n\n";
+        os << "#include <cstdlib>\n";
+        os << "#include <dsppp/memory_pool.hpp>\n\n";
+
+        os << "// Memory pools for sizes known at build time\n";
+        os << "// (lifetime in number of allocations)\n";
+        for (const auto &v : stats_)
+        {
+            if (v.first > 0)
+            {
+                const AllocationStatistics &s = v.second;
+                os << "inline arm_cmsis_dsp::MemoryPool<" << v.first
+                   << ",arm_cmsis_dsp::user_allocator_aligned_malloc> vecPool_" << v.first
+                   << "(" << s.peak << ");";
+                print_usage(os,s);
+                total_static += v.first * s.peak;
+            }
+        }
+        os << "// Total bytes for the pools: " << total_static << "\n\n";
+
+        os << "template<int L>\n";
+        os << "struct pool_allocator;\n";
+        for (const auto &v : stats_)
+        {
+            if (v.first > 0)
+            {
+                os << '\n';
+                os << "template<>\n";
+                os << "struct pool_allocator<" << v.first << "> {\n";
+                os << "    static char* allocate() noexcept {\n";
+                os << "        return(vecPool_" << v.first << ".get_new_buffer());\n";
+                os << "    }\n\n";
+                os << "    static void destroy(char* ptr) noexcept {\n";
+                os << "        vecPool_" << v.first << ".recycle_buffer(ptr);\n";
+                os << "    }\n";
+                os << "};\n";
+            }
+        }
+
+        os << "\n// Sizes only known at runtime are allocated with malloc\n";
+        for (const auto &v : stats_)
+        {
+            if (v.first < 0)
+            {
+                const AllocationStatistics &s = v.second;
+                os << "// " << -v.first << " bytes : " << s.peak << " buffers";
+                print_usage(os,s);
+            }
+        }
+        os << "template<>\n";
+        os << "struct pool_allocator<arm_cmsis_dsp::DYNAMIC> {\n";
+        os << "    static char* allocate(arm_cmsis_dsp::vector_length_t sz) noexcept {\n";
+        os << "        return(reinterpret_cast<char*>(std::malloc(sz)));\n";
+        os << "    }\n\n";
+        os << "    static void destroy(char* ptr) noexcept {\n";
+        os << "        std::free(ptr);\n";
+        os << "    }\n";
+        os << "};\n";
+
+        os << "\n// Peak bytes allocated at the same time: " << peak_bytes_ << "\n";
+        if (!live_.empty())
+        {
+            os << "// Buffers not released: " << live_.size() << "\n";
+        }
+    }
+
+protected:
+    struct LiveBuffer {
+        int key;
+        std::size_t bytes;
+        std::size_t birth;
+    };
+
+    static void print_usage(std::ostream &os,const AllocationStatistics &s)
+    {
+        os << " // " << s.nb_allocations << " allocations";
+        if (s.nb_released > 0)
+        {
+            os << ", mean lifetime " << (s.total_lifetime / s.nb_released)
+               << ", max lifetime " << s.max_lifetime;
+        }
+        os << '\n';
+    }
+
+    std::map<int,AllocationStatistics> stats_;
+    std::map<char*,LiveBuffer> live_;
+    std::size_t current_bytes_ = 0;
+    std::size_t peak_bytes_ = 0;
+    std::size_t clock_ = 0;
+};
+
+/**
+ * @ingroup MEMTOOL
+ * @brief      Statistics recorded by the statistics allocators
+ *
+ * @return     Reference to the statistics
+ */
+inline MemoryStatistics& memory_statistics()
+{
+    static MemoryStatistics stats;
+    return(stats);
+}
+
+/**
+ * @ingroup MEMVEC
+ * @brief      Wrap a memory allocator to record statistics about
+ *             the allocations
+ *
+ * The statistics are recorded in memory_statistics().
+ *
+ * ```cpp
+ * #define TMP_ALLOC statistics_allocator_for<my_allocator>::allocator
+ * ```
+ *
+ * @tparam     Allocator  The memory allocator doing the allocations
+ */
+template<template<int> typename Allocator>
+struct statistics_allocator_for {
+    /**
+     * @brief      Memory allocator recording statistics
+     *
+     * @tparam     L     Size known at build time in bytes
+     */
+    template<int L>
+    struct allocator {
+        /**
+         * @brief      Allocate a buffer with size known at runtime
+         *
+         * @param[in]  sz    The size
+         *
+         * @return     Pointer to the buffer
+         */
+        static  char* allocate  ( vector_length_t sz) noexcept{
+            char *res = Allocator<L>::allocate(sz);
+            memory_statistics().record_allocation(res,-sz,sz);
+            return(res);
+        }
+
+        /**
+         * @brief      Allocate a buffer with size known at build time
+         *
+         * @return     Pointer to the buffer
+         */
+        static  char* allocate  ( ) noexcept{
+            char *res = Allocator<L>::allocate();
+            memory_statistics().record_allocation(res,L,L);
+            return(res);
+        }
+
+        /**
+         * @brief      Destroys the given pointer.
+         *
+         * @param      ptr   The pointer
+         */
+        static void destroy  ( char* ptr ) noexcept {
+            memory_statistics().record_release(ptr);
+            Allocator<L>::destroy(ptr);
+        }
+    };
+};
+
+/**
+ * @ingroup MEMVEC
+ * @brief      Malloc memory allocator recording statistics
+ *
+ * Can be used as `TMP_ALLOC` to size the memory pools.
+ *
+ * @tparam     L     Size known at build time in bytes
+ */
+template<int L>
+using statistics_allocator = typename statistics_allocator_for<malloc_allocator>::template allocator<L>;
+
+
 /*! @} */
 
 }
\ No newline at end of file
@@ -76,6 +76,9 @@ int main(void)
     #if defined(FUSION_TEST)
     fusion_test();
     #endif
+    #if defined(MEMORY_TEST)
+    memory_test();
+    #endif
     //debug_test();
 
     memory_pool_stats();
@@ -185,6 +185,7 @@ ALL_TESTS=["DOT_TEST",
        "ROW_TEST",
        "COL_TEST",
        "MATRIX_TEST",
+       "MEMORY_TEST",
 #       "FUSION_TEST"
        ]
 
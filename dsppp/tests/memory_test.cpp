@@ -0,0 +1,240 @@
+extern "C" {
+    extern void memory_test();
+}
+
+#include "allocator.h"
+
+/* The vectors of this file use the memory arena allocator as
+   default allocator. Only vectors are used so that no inline
+   function is shared with the other test files using another
+   TMP_ALLOC. */
+#undef TMP_ALLOC
+#define TMP_ALLOC arena_allocator
+
+#include <dsppp/arch.hpp>
+#include <dsppp/matrix.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#define NB_ARENA 100
+#define NB_INNER 1000
+
+static void test_arena_scope()
+{
+   std::cout << "----\r\n" << "Arena scope\r\n";
+
+   OwnedMemoryArena<user_allocator_aligned_malloc> arena(32768);
+   std::size_t outer_used, inner_used, expr_used;
+   bool ok = true;
+
+   {
+      ArenaScope scope(arena);
+
+      Vector<float32_t> a(NB_ARENA);
+      Vector<float32_t> b(NB_ARENA);
+      for(int i=0;i<NB_ARENA;i++)
+      {
+         a[i] = (float32_t)i;
+         b[i] = 2.0f;
+      }
+      outer_used = arena.used();
+
+      {
+         ArenaScope inner(arena);
+
+         Vector<float32_t> tmp(NB_INNER);
+         tmp = 1.0f;
+         inner_used = arena.used();
+         if ((inner_used < outer_used + NB_INNER*sizeof(float32_t)) || (tmp[NB_INNER-1] != 1.0f))
+         {
+            printf("arena nested allocation failed \r\n");
+            ok = false;
+         }
+      }
+
+      if (arena.used() != outer_used)
+      {
+         printf("arena nested rewind failed \r\n");
+         ok = false;
+      }
+
+      /* TMP_ALLOC is used for the result of the expression */
+      Vector<float32_t> res = a + a * b;
+      expr_used = arena.used();
+      for(int i=0;i<NB_ARENA;i++)
+      {
+         if (res[i] != 3.0f*(float32_t)i)
+         {
+            printf("arena expression failed \r\n");
+            ok = false;
+            break;
+         }
+      }
+      if (expr_used <= outer_used)
+      {
+         printf("arena expression not allocated in arena \r\n");
+         ok = false;
+      }
+   }
+
+   if (arena.used() != 0)
+   {
+      printf("arena rewind failed \r\n");
+      ok = false;
+   }
+
+   if (arena.peak() != std::max(inner_used,expr_used))
+   {
+      printf("arena peak failed \r\n");
+      ok = false;
+   }
+
+   /* Buffers released in reverse order are given back immediately */
+   {
+      ArenaScope scope(arena);
+      char *x = arena.allocate(10);
+      char *y = arena.allocate(20);
+      char *z = arena.allocate(30);
+      const std::size_t used_xyz = arena.used();
+      MemoryArena::release_buffer(y);
+      if (arena.used() != used_xyz)
+      {
+         printf("arena out of order release failed \r\n");
+         ok = false;
+      }
+      MemoryArena::release_buffer(z);
+      MemoryArena::release_buffer(x);
+      if (arena.used() != 0)
+      {
+         printf("arena lifo release failed \r\n");
+         ok = false;
+      }
+   }
+
+   /* Without scope, the temporaries are allocated on the heap */
+   {
+      Vector<float32_t> c(NB_ARENA);
+      c = 4.0f;
+      Vector<float32_t> d = c + c;
+      if ((arena.used() != 0) || (d[NB_ARENA-1] != 8.0f))
+      {
+         printf("arena allocation without scope failed \r\n");
+         ok = false;
+      }
+   }
+
+   if (ok)
+   {
+      std::cout << "arena ok\r\n";
+   }
+
+   std::cout << "=====\r\n";
+}
+
+template<int L>
+using stat_arena_allocator = statistics_allocator_for<arena_allocator>::allocator<L>;
+
+static bool check_stats(const int key,
+                        const std::size_t nb_allocations,
+                        const std::size_t peak,
+                        const std::size_t total_lifetime,
+                        const std::size_t max_lifetime)
+{
+   const auto &sizes = memory_statistics().sizes();
+   const auto it = sizes.find(key);
+   if (it == sizes.end())
+   {
+      printf("statistics missing for size %d \r\n",key);
+      return(false);
+   }
+   const AllocationStatistics &s = it->second;
+   if ((s.nb_allocations != nb_allocations) ||
+       (s.peak != peak) ||
+       (s.current != 0) ||
+       (s.nb_released != nb_allocations) ||
+       (s.total_lifetime != total_lifetime) ||
+       (s.max_lifetime != max_lifetime))
+   {
+      printf("statistics failed for size %d \r\n",key);
+      return(false);
+   }
+   return(true);
+}
+
+static void test_statistics()
+{
+   std::cout << "----\r\n" << "Statistics allocator\r\n";
+
+   OwnedMemoryArena<user_allocator_aligned_malloc> arena(4096);
+   bool ok = true;
+
+   memory_statistics().reset();
+   {
+      ArenaScope scope(arena);
+
+      /* Clock 0 */
+      Vector<float32_t,16,stat_arena_allocator> s1;
+      {
+         /* Clock 1 and 2 */
+         Vector<float32_t,16,stat_arena_allocator> s2;
+         Vector<float32_t,DYNAMIC,stat_arena_allocator> d(10);
+         s1 = 1.0f;
+         s2 = 2.0f;
+         d = 3.0f;
+         /* d and s2 are released at clock 3 */
+      }
+      /* Clock 3 */
+      Vector<float32_t,16,stat_arena_allocator> s3 = s1 + s1;
+      if (s3[15] != 2.0f)
+      {
+         printf("statistics allocator expression failed \r\n");
+         ok = false;
+      }
+      /* s3 and s1 are released at clock 4 */
+   }
+
+   /* s1, s2 and s3 : lifetimes 4, 2, 1 */
+   ok = check_stats(16*sizeof(float32_t),3,2,7,4) && ok;
+   /* d : lifetime 1 */
+   ok = check_stats(-10*(int)sizeof(float32_t),1,1,1,1) && ok;
+
+   if ((memory_statistics().peak_bytes() != (2*16+10)*sizeof(float32_t)) ||
+       (memory_statistics().current_bytes() != 0) ||
+       (memory_statistics().nb_live_buffers() != 0))
+   {
+      printf("statistics peak bytes failed \r\n");
+      ok = false;
+   }
+
+   std::ostringstream os;
+   memory_statistics().print_pool_configuration(os);
+   const std::string conf = os.str();
+   if ((conf.find("#define TMP_ALLOC pool_allocator") == std::string::npos) ||
+       (conf.find("MemoryPool<64,arm_cmsis_dsp::user_allocator_aligned_malloc> vecPool_64(2);") == std::string::npos) ||
+       (conf.find("struct pool_allocator<64> {") == std::string::npos) ||
+       (conf.find("struct pool_allocator<arm_cmsis_dsp::DYNAMIC> {") == std::string::npos) ||
+       (conf.find("// 40 bytes : 1 buffers") == std::string::npos) ||
+       (conf.find('\r') != std::string::npos))
+   {
+      printf("statistics pool configuration failed \r\n");
+      std::cout << conf;
+      ok = false;
+   }
+
+   memory_statistics().reset();
+
+   if (ok)
+   {
+      std::cout << "statistics ok\r\n";
+   }
+
+   std::cout << "=====\r\n";
+}
+
+void memory_test()
+{
+   test_arena_scope();
+   test_statistics();
+}
@@ -12,6 +12,7 @@ extern void col_test(void);
 extern void filter_test(void);
 extern void fusion_test(void);
 extern void debug_test(void);
+extern void memory_test(void);
 
 extern void memory_pool_stats();
 